@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_DM_DISPLAY_MANAGER_ADAPTER_H
 #define FOUNDATION_DM_DISPLAY_MANAGER_ADAPTER_H
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <surface.h>
@@ -24,6 +25,7 @@
 #include <iremote_proxy.h>
 #include <iremote_object.h>
 #include "display.h"
+#include "display_info_shared_memory.h"
 #include "dm_common.h"
 #include "fold_screen_info.h"
 #include "idisplay_manager.h"
@@ -157,10 +159,24 @@ public:
         const sptr<IDisplayManagerAgent> displayManagerAgent);
     virtual DMError UnRegisterDisplayAttribute(const std::vector<std::string>& attributes,
         const sptr<IDisplayManagerAgent> displayManagerAgent);
+    /*
+     * Lock-free read of the display info published by the server, returns cached when version is unchanged
+     * and nullptr when the caller has to fall back to GetDisplayInfo. When the fields not mirrored changed
+     * since generation, version and generation are set to the record that the IPC refresh covers.
+     */
+    virtual sptr<DisplayInfo> GetDisplayInfoFromSharedMemory(DisplayId displayId, const sptr<DisplayInfo>& cached,
+        uint64_t& version, uint32_t& generation);
+    void Clear() override;
 protected:
     bool RegisterClientDeathListener() override;
 private:
+    DisplayInfoSharedMemory* GetDisplayInfoSharedMemory();
+
     static inline SingletonDelegator<DisplayManagerAdapter> delegator;
+    std::atomic<DisplayInfoSharedMemory*> displayInfoShm_ { nullptr };
+    std::atomic<bool> displayInfoShmQueried_ { false };
+    /* mappings stay alive after a server death, readers may still hold the raw pointer */
+    std::vector<std::unique_ptr<DisplayInfoSharedMemory>> displayInfoShmHolder_;
 };
 
 class ScreenManagerAdapter : public BaseAdapter {
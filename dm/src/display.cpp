@@ -61,6 +61,35 @@ public:
         std::lock_guard<std::mutex> lock(displayInfoMutex_);
         displayInfo_ = value;
         displayUpdateTime_ = std::chrono::steady_clock::now();
+        if (hasRefreshShmVersion_) {
+            shmVersion_ = refreshShmVersion_;
+            shmGeneration_ = refreshShmGeneration_;
+            hasRefreshShmVersion_ = false;
+        }
+    }
+
+    /* only the mirrored fields are refreshed, the update time keeps tracking the last full refresh */
+    void SetDisplayInfoFromSharedMemory(sptr<DisplayInfo> value, uint64_t version)
+    {
+        std::lock_guard<std::mutex> lock(displayInfoMutex_);
+        displayInfo_ = value;
+        shmVersion_ = version;
+    }
+
+    void GetShmVersion(uint64_t& version, uint32_t& generation)
+    {
+        std::lock_guard<std::mutex> lock(displayInfoMutex_);
+        version = shmVersion_;
+        generation = shmGeneration_;
+    }
+
+    /* the shared memory record read before an IPC refresh, the refresh covers it once it is applied */
+    void SetRefreshShmVersion(uint64_t version, uint32_t generation)
+    {
+        std::lock_guard<std::mutex> lock(displayInfoMutex_);
+        refreshShmVersion_ = version;
+        refreshShmGeneration_ = generation;
+        hasRefreshShmVersion_ = true;
     }
 
     void SetDisplayInfoEnv(void* env, EnvType type)
@@ -101,6 +130,11 @@ private:
     EnvType envType_ = EnvType::NONE;
     std::chrono::steady_clock::time_point displayUpdateTime_{};
     std::mutex displayInfoMutex_;
+    uint64_t shmVersion_ = 0;
+    uint32_t shmGeneration_ = 0;
+    uint64_t refreshShmVersion_ = 0;
+    uint32_t refreshShmGeneration_ = 0;
+    bool hasRefreshShmVersion_ = false;
 };
 
 Display::Display(const std::string& name, sptr<DisplayInfo> info)
@@ -133,7 +167,7 @@ std::string Display::GetName() const
 
 int32_t Display::GetWidth() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return 0;
@@ -143,7 +177,7 @@ int32_t Display::GetWidth() const
 
 int32_t Display::GetHeight() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return 0;
@@ -153,7 +187,7 @@ int32_t Display::GetHeight() const
 
 int32_t Display::GetPhysicalWidth() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return 0;
@@ -163,7 +197,7 @@ int32_t Display::GetPhysicalWidth() const
 
 int32_t Display::GetPhysicalHeight() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return 0;
@@ -173,7 +207,7 @@ int32_t Display::GetPhysicalHeight() const
 
 uint32_t Display::GetRefreshRate() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return 0;
@@ -193,7 +227,7 @@ ScreenId Display::GetScreenId() const
 
 Rotation Display::GetRotation() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return Rotation::ROTATION_0;
@@ -203,7 +237,7 @@ Rotation Display::GetRotation() const
 
 Rotation Display::GetOriginRotation() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ is nullptr");
         return Rotation::ROTATION_0;
@@ -218,7 +252,7 @@ Rotation Display::GetOriginRotation() const
 
 Orientation Display::GetOrientation() const
 {
-    UpdateDisplayInfo();
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return Orientation::UNSPECIFIED;
@@ -308,9 +342,46 @@ void Display::UpdateDisplayInfo() const
     }
 }
 
-float Display::GetVirtualPixelRatio() const
+void Display::UpdateMirroredDisplayInfo() const
 {
+    if (pImpl_ == nullptr) {
+        TLOGE(WmsLogTag::DMS, "pImpl_ is nullptr");
+        return;
+    }
+    if (pImpl_->GetValidFlag()) {
+        return;
+    }
+    if (UpdateDisplayInfoFromSharedMemory()) {
+        return;
+    }
     UpdateDisplayInfo();
+}
+
+bool Display::UpdateDisplayInfoFromSharedMemory() const
+{
+    if (pImpl_ == nullptr) {
+        return false;
+    }
+    uint64_t version = 0;
+    uint32_t generation = 0;
+    pImpl_->GetShmVersion(version, generation);
+    sptr<DisplayInfo> cachedInfo = pImpl_->GetDisplayInfo();
+    auto displayInfo = SingletonContainer::Get<DisplayManagerAdapter>().GetDisplayInfoFromSharedMemory(GetId(),
+        cachedInfo, version, generation);
+    if (displayInfo == nullptr) {
+        // fields not mirrored in shared memory changed or it is unavailable, the caller refreshes over IPC
+        pImpl_->SetRefreshShmVersion(version, generation);
+        return false;
+    }
+    if (displayInfo != cachedInfo) {
+        pImpl_->SetDisplayInfoFromSharedMemory(displayInfo, version);
+    }
+    return true;
+}
+
+float Display::GetVirtualPixelRatio() const
+{
+    UpdateMirroredDisplayInfo();
     if (pImpl_ == nullptr || pImpl_->GetDisplayInfo() == nullptr) {
         TLOGE(WmsLogTag::DMS, "pImpl_ or pImpl_->GetDisplayInfo is nullptr");
         return 0;
@@ -809,6 +809,8 @@ sptr<Display> DisplayManager::Impl::GetDisplayById(DisplayId displayId, bool isG
             static uint32_t getDisplayIntervalUs_ = (std::string(program_invocation_name) != "com.ohos.sceneboard")
                                                         ? APP_GET_DISPLAY_INTERVAL_US
                                                         : SCB_GET_DISPLAY_INTERVAL_US;
+            // mirrored fields published since the last refresh are merged, the rest still expires below
+            iter->second->UpdateDisplayInfoFromSharedMemory();
             auto interval = iter->second->GetDisplayInfoLifeTime();
             if (interval < getDisplayIntervalUs_ && !CheckNeedUpdateDisplayByTag(displayId)) {
                     return iter->second;
@@ -18,6 +18,7 @@
 #include <iremote_broker.h>
 #include <iservice_registry.h>
 #include <system_ability_definition.h>
+#include <unistd.h>
 
 #include "display_manager.h"
 #include "dm_common.h"
@@ -1189,6 +1190,72 @@ sptr<DisplayInfo> DisplayManagerAdapter::GetDisplayInfo(DisplayId displayId, boo
     return displayInfo;
 }
 
+sptr<DisplayInfo> DisplayManagerAdapter::GetDisplayInfoFromSharedMemory(DisplayId displayId,
+    const sptr<DisplayInfo>& cached, uint64_t& version, uint32_t& generation)
+{
+    static const int32_t uid = static_cast<int32_t>(getuid());
+    DisplayInfoSharedMemory* displayInfoShm = GetDisplayInfoSharedMemory();
+    if (displayInfoShm == nullptr || displayInfoShm->IsBypassed(uid)) {
+        return nullptr;
+    }
+    DisplayInfoShmRecord record;
+    uint64_t newVersion = 0;
+    if (!displayInfoShm->Read(displayId, record, newVersion)) {
+        return nullptr;
+    }
+    if (cached == nullptr || record.unmirroredGeneration != generation) {
+        version = newVersion;
+        generation = record.unmirroredGeneration;
+        return nullptr;
+    }
+    if (newVersion == version) {
+        return cached;
+    }
+    sptr<DisplayInfo> displayInfo = record.MergeInto(cached);
+    if (displayInfo == nullptr) {
+        return nullptr;
+    }
+    version = newVersion;
+    return displayInfo;
+}
+
+DisplayInfoSharedMemory* DisplayManagerAdapter::GetDisplayInfoSharedMemory()
+{
+    DisplayInfoSharedMemory* displayInfoShm = displayInfoShm_.load(std::memory_order_acquire);
+    if (displayInfoShm != nullptr || displayInfoShmQueried_.load(std::memory_order_acquire)) {
+        return displayInfoShm;
+    }
+    INIT_PROXY_CHECK_RETURN(nullptr);
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    if (displayInfoShmQueried_.load(std::memory_order_relaxed)) {
+        return displayInfoShm_.load(std::memory_order_relaxed);
+    }
+    displayInfoShmQueried_.store(true, std::memory_order_release);
+    if (screenSessionManagerServiceProxy_ == nullptr) {
+        return nullptr;
+    }
+    auto attached = std::make_unique<DisplayInfoSharedMemory>();
+    if (!attached->Attach(screenSessionManagerServiceProxy_->GetDisplayInfoSharedMemory())) {
+        TLOGW(WmsLogTag::DMS, "display info shared memory unavailable");
+        return nullptr;
+    }
+    displayInfoShm = attached.get();
+    displayInfoShmHolder_.push_back(std::move(attached));
+    displayInfoShm_.store(displayInfoShm, std::memory_order_release);
+    return displayInfoShm;
+}
+
+void DisplayManagerAdapter::Clear()
+{
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        /* the mapping of a dead server is never updated again */
+        displayInfoShm_.store(nullptr, std::memory_order_release);
+        displayInfoShmQueried_.store(false, std::memory_order_release);
+    }
+    BaseAdapter::Clear();
+}
+
 sptr<DisplayInfo> DisplayManagerAdapter::GetVisibleAreaDisplayInfoById(DisplayId displayId)
 {
     TLOGD(WmsLogTag::DMS, "enter, displayId: %{public}" PRIu64, displayId);
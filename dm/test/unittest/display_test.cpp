@@ -381,6 +381,33 @@ HWTEST_F(DisplayTest, GetEnvType, TestSize.Level1)
     display->SetDisplayInfoEnv(nullptr, Display::EnvType::NONE);
 }
 
+/**
+ * @tc.name: UpdateDisplayInfoFromSharedMemory
+ * @tc.desc: mirrored getters read shared memory until the unmirrored generation changes, full info uses IPC only
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayTest, UpdateDisplayInfoFromSharedMemory, TestSize.Level1)
+{
+    std::unique_ptr<Mocker> m = std::make_unique<Mocker>();
+    sptr<DisplayInfo> baseInfo = sptr<DisplayInfo>::MakeSptr();
+    baseInfo->SetWidth(100);
+    sptr<Display> display = sptr<Display>::MakeSptr("", baseInfo);
+    sptr<DisplayInfo> shmInfo = sptr<DisplayInfo>::MakeSptr();
+    shmInfo->SetWidth(200);
+    sptr<DisplayInfo> ipcInfo = sptr<DisplayInfo>::MakeSptr();
+    ipcInfo->SetWidth(300);
+    EXPECT_CALL(m->Mock(), GetDisplayInfoFromSharedMemory(_, _, _, _))
+        .WillOnce(Return(shmInfo))
+        .WillOnce(DoAll(SetArgReferee<2>(11), SetArgReferee<3>(7), Return(nullptr)));
+    EXPECT_CALL(m->Mock(), GetDisplayInfo(_)).Times(2).WillRepeatedly(Return(ipcInfo));
+
+    EXPECT_EQ(display->GetWidth(), 200);
+    EXPECT_EQ(display->GetWidth(), 300);
+    EXPECT_EQ(display->pImpl_->shmVersion_, 11);
+    EXPECT_EQ(display->pImpl_->shmGeneration_, 7);
+    EXPECT_EQ(display->GetDisplayInfo(), ipcInfo);
+}
+
 }
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -213,6 +213,7 @@ enum class DisplayManagerMessage : unsigned int {
     TRANS_ID_GET_RENDER_SESSION,
     TRANS_ID_NOTIFY_BOOT_ANIMATION_FINISHED,
     TRANS_ID_SET_HOVER_BLOCK_LIST,
+    TRANS_ID_GET_DISPLAY_INFO_SHARED_MEMORY,
 };
 }
 #endif // FOUNDATION_DMSERVER_DISPLAY_MANAGER_INTERFACE_CODE_H
@@ -220,6 +220,8 @@ private:
     uint32_t GetDisplayInfoLifeTime();
     void UpdateDisplayInfo(sptr<DisplayInfo>) const;
     void UpdateDisplayInfo() const;
+    void UpdateMirroredDisplayInfo() const;
+    bool UpdateDisplayInfoFromSharedMemory() const;
     class Impl;
     sptr<Impl> pImpl_;
 };
@@ -1058,6 +1058,16 @@ public:
 };
 
 static WMError DefaultCreateErrCode = WMError::WM_OK;
+
+/**
+ * @class Window
+ *
+ * @brief Window is the client side of a window.
+ *
+ * Listeners are notified from a snapshot taken when the notification starts. A notification already
+ * in progress may still reach a listener after its Unregister returns, and a listener registered
+ * meanwhile is first called on the next notification.
+ */
 class Window : virtual public RefBase {
 public:
     /**
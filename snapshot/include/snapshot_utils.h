@@ -55,6 +55,8 @@ public:
     static bool CheckWidthAndHeightValid(int32_t w, int32_t h);
     static bool RGBA8888ToRGB888(const uint8_t* rgba8888Buf, uint8_t* rgb888Buf, int32_t size);
     static bool RGB565ToRGB888(const uint8_t* rgb565Buf, uint8_t* rgb888Buf, int32_t size);
+    static bool BGRA8888ToRGB888(const uint8_t* bgra8888Buf, uint8_t* rgb888Buf, int32_t size);
+    static bool RGBA1010102ToRGB888(const uint8_t* rgba1010102Buf, uint8_t* rgb888Buf, int32_t size);
     static bool WriteRgb888ToJpeg(FILE* file, uint32_t width, uint32_t height, const uint8_t* data);
     static bool WriteToJpeg(const std::string& fileName, const WriteToJpegParam& param);
     static bool WriteToJpeg(int fd, const WriteToJpegParam& param);
@@ -65,6 +67,7 @@ public:
     static bool CheckParamValid(const WriteToJpegParam& param);
     static bool SaveSnapShot(const std::string& filename, Media::PixelMap& pixelMap, std::string fileType = "jpeg");
 private:
+    static bool ConvertAndWriteToJpeg(FILE* file, const WriteToJpegParam& param);
     static bool ProcessDisplayId(Rosen::DisplayId& displayId, bool isDisplayIdSet);
 };
 }
@@ -15,11 +15,13 @@
 
 #include "snapshot_utils.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <functional>
 #include <getopt.h>
 #include <hitrace_meter.h>
 #include <image_type.h>
@@ -30,10 +32,19 @@
 #include <securec.h>
 #include <string>
 #include <sys/time.h>
+#include <vector>
 
 #include "image_packer.h"
 #include "jpeglib.h"
 
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SNAPSHOT_USE_NEON
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SNAPSHOT_USE_SSSE3
+#endif
+
 using namespace OHOS::Rosen;
 
 namespace OHOS {
@@ -58,6 +69,10 @@ constexpr uint16_t RGB565_MASK_RED = 0x001F;
 constexpr uint32_t RGBA8888_MASK_BLUE = 0x000000FF;
 constexpr uint32_t RGBA8888_MASK_GREEN = 0x0000FF00;
 constexpr uint32_t RGBA8888_MASK_RED = 0x00FF0000;
+constexpr uint8_t SHIFT_2_BIT_1010102 = 2;
+constexpr uint8_t SHIFT_12_BIT = 12;
+constexpr uint8_t SHIFT_22_BIT = 22;
+constexpr uint32_t RGBA1010102_MASK_8_BIT = 0xFF;
 
 constexpr uint8_t PNG_PACKER_QUALITY = 100;
 constexpr uint8_t PACKER_QUALITY = 75;
@@ -161,6 +176,8 @@ bool SnapShotUtils::CheckParamValid(const WriteToJpegParam& param)
 {
     switch (param.format) {
         case Media::PixelFormat::RGBA_8888:
+        case Media::PixelFormat::BGRA_8888:
+        case Media::PixelFormat::RGBA_1010102:
             if (param.stride != param.width * RGBA8888_PIXEL_BYTES) {
                 return false;
             }
@@ -189,29 +206,35 @@ bool SnapShotUtils::CheckParamValid(const WriteToJpegParam& param)
     return true;
 }
 
-bool SnapShotUtils::RGBA8888ToRGB888(const uint8_t* rgba8888Buf, uint8_t* rgb888Buf, int32_t size)
+namespace {
+/*
+ * Conversion kernels: each vector kernel converts as many leading pixels as it can and returns the
+ * number of pixels done, the scalar kernel finishes the rest.
+ */
+void RGBA8888ToRGB888Scalar(const uint8_t* rgba8888Buf, uint8_t* rgb888Buf, int32_t start, int32_t size)
 {
-    if (rgba8888Buf == nullptr || rgb888Buf == nullptr || size <= 0) {
-        std::cout << __func__ << ": params are invalid." << std::endl;
-        return false;
-    }
     const uint32_t* rgba8888 = reinterpret_cast<const uint32_t*>(rgba8888Buf);
-    for (int32_t i = 0; i < size; i++) {
+    for (int32_t i = start; i < size; i++) {
         rgb888Buf[i * RGB888_PIXEL_BYTES + R_INDEX] = (rgba8888[i] & RGBA8888_MASK_RED) >> SHIFT_16_BIT;
         rgb888Buf[i * RGB888_PIXEL_BYTES + G_INDEX] = (rgba8888[i] & RGBA8888_MASK_GREEN) >> SHIFT_8_BIT;
         rgb888Buf[i * RGB888_PIXEL_BYTES + B_INDEX] = rgba8888[i] & RGBA8888_MASK_BLUE;
     }
-    return true;
 }
 
-bool SnapShotUtils::RGB565ToRGB888(const uint8_t* rgb565Buf, uint8_t* rgb888Buf, int32_t size)
+void BGRA8888ToRGB888Scalar(const uint8_t* bgra8888Buf, uint8_t* rgb888Buf, int32_t start, int32_t size)
 {
-    if (rgb565Buf == nullptr || rgb888Buf == nullptr || size <= 0) {
-        std::cout << __func__ << ": params are invalid." << std::endl;
-        return false;
+    const uint32_t* bgra8888 = reinterpret_cast<const uint32_t*>(bgra8888Buf);
+    for (int32_t i = start; i < size; i++) {
+        rgb888Buf[i * RGB888_PIXEL_BYTES + B_INDEX] = (bgra8888[i] & RGBA8888_MASK_RED) >> SHIFT_16_BIT;
+        rgb888Buf[i * RGB888_PIXEL_BYTES + G_INDEX] = (bgra8888[i] & RGBA8888_MASK_GREEN) >> SHIFT_8_BIT;
+        rgb888Buf[i * RGB888_PIXEL_BYTES + R_INDEX] = bgra8888[i] & RGBA8888_MASK_BLUE;
     }
+}
+
+void RGB565ToRGB888Scalar(const uint8_t* rgb565Buf, uint8_t* rgb888Buf, int32_t start, int32_t size)
+{
     const uint16_t* rgb565 = reinterpret_cast<const uint16_t*>(rgb565Buf);
-    for (int32_t i = 0; i < size; i++) {
+    for (int32_t i = start; i < size; i++) {
         rgb888Buf[i * RGB888_PIXEL_BYTES + R_INDEX] = (rgb565[i] & RGB565_MASK_RED);
         rgb888Buf[i * RGB888_PIXEL_BYTES + G_INDEX] = (rgb565[i] & RGB565_MASK_GREEN) >> SHIFT_5_BIT;
         rgb888Buf[i * RGB888_PIXEL_BYTES + B_INDEX] = (rgb565[i] & RGB565_MASK_BLUE) >> SHIFT_11_BIT;
@@ -219,22 +242,184 @@ bool SnapShotUtils::RGB565ToRGB888(const uint8_t* rgb565Buf, uint8_t* rgb888Buf,
         rgb888Buf[i * RGB888_PIXEL_BYTES + G_INDEX] <<= SHIFT_2_BIT;
         rgb888Buf[i * RGB888_PIXEL_BYTES + B_INDEX] <<= SHIFT_3_BIT;
     }
+}
+
+void RGBA1010102ToRGB888Scalar(const uint8_t* rgba1010102Buf, uint8_t* rgb888Buf, int32_t start, int32_t size)
+{
+    const uint32_t* rgba1010102 = reinterpret_cast<const uint32_t*>(rgba1010102Buf);
+    for (int32_t i = start; i < size; i++) {
+        rgb888Buf[i * RGB888_PIXEL_BYTES + B_INDEX] =
+            (rgba1010102[i] >> SHIFT_2_BIT_1010102) & RGBA1010102_MASK_8_BIT;
+        rgb888Buf[i * RGB888_PIXEL_BYTES + G_INDEX] = (rgba1010102[i] >> SHIFT_12_BIT) & RGBA1010102_MASK_8_BIT;
+        rgb888Buf[i * RGB888_PIXEL_BYTES + R_INDEX] = (rgba1010102[i] >> SHIFT_22_BIT) & RGBA1010102_MASK_8_BIT;
+    }
+}
+
+#if defined(SNAPSHOT_USE_NEON)
+constexpr int32_t NEON_PIXELS_8 = 8;
+constexpr int32_t NEON_PIXELS_16 = 16;
+
+int32_t Rgba8888ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size, bool swapRedBlue)
+{
+    int32_t i = 0;
+    for (; i + NEON_PIXELS_16 <= size; i += NEON_PIXELS_16) {
+        uint8x16x4_t rgba = vld4q_u8(src + i * RGBA8888_PIXEL_BYTES);
+        uint8x16x3_t rgb;
+        rgb.val[B_INDEX] = swapRedBlue ? rgba.val[R_INDEX] : rgba.val[B_INDEX];
+        rgb.val[G_INDEX] = rgba.val[G_INDEX];
+        rgb.val[R_INDEX] = swapRedBlue ? rgba.val[B_INDEX] : rgba.val[R_INDEX];
+        vst3q_u8(dst + i * RGB888_PIXEL_BYTES, rgb);
+    }
+    return i;
+}
+
+int32_t Rgb565ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size)
+{
+    int32_t i = 0;
+    const uint8x8_t mask5Bit = vdup_n_u8(0xF8);
+    const uint8x8_t mask6Bit = vdup_n_u8(0xFC);
+    for (; i + NEON_PIXELS_8 <= size; i += NEON_PIXELS_8) {
+        uint16x8_t pixels = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i * RGB565_PIXEL_BYTES));
+        uint8x8x3_t rgb;
+        rgb.val[R_INDEX] = vmovn_u16(vshlq_n_u16(pixels, SHIFT_3_BIT));
+        rgb.val[G_INDEX] = vand_u8(vshrn_n_u16(pixels, SHIFT_3_BIT), mask6Bit);
+        rgb.val[B_INDEX] = vand_u8(vshrn_n_u16(pixels, SHIFT_8_BIT), mask5Bit);
+        vst3_u8(dst + i * RGB888_PIXEL_BYTES, rgb);
+    }
+    return i;
+}
+
+int32_t Rgba1010102ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size)
+{
+    constexpr int32_t halfPixels = NEON_PIXELS_8 / 2;
+    int32_t i = 0;
+    for (; i + NEON_PIXELS_8 <= size; i += NEON_PIXELS_8) {
+        const uint32_t* pixels = reinterpret_cast<const uint32_t*>(src + i * RGBA8888_PIXEL_BYTES);
+        uint32x4_t low = vld1q_u32(pixels);
+        uint32x4_t high = vld1q_u32(pixels + halfPixels);
+        uint8x8x3_t rgb;
+        rgb.val[B_INDEX] = vmovn_u16(vcombine_u16(vmovn_u32(vshrq_n_u32(low, SHIFT_2_BIT_1010102)),
+            vmovn_u32(vshrq_n_u32(high, SHIFT_2_BIT_1010102))));
+        rgb.val[G_INDEX] = vmovn_u16(vcombine_u16(vmovn_u32(vshrq_n_u32(low, SHIFT_12_BIT)),
+            vmovn_u32(vshrq_n_u32(high, SHIFT_12_BIT))));
+        rgb.val[R_INDEX] = vmovn_u16(vcombine_u16(vmovn_u32(vshrq_n_u32(low, SHIFT_22_BIT)),
+            vmovn_u32(vshrq_n_u32(high, SHIFT_22_BIT))));
+        vst3_u8(dst + i * RGB888_PIXEL_BYTES, rgb);
+    }
+    return i;
+}
+#elif defined(SNAPSHOT_USE_SSSE3)
+constexpr int32_t SSE_PIXELS_4 = 4;
+/* a 16 byte store writes 4 bytes past the 4 converted pixels, keep them inside the buffer */
+constexpr int32_t SSE_PIXELS_GUARD = 6;
+
+bool IsSsse3Supported()
+{
+    static const bool isSupported = __builtin_cpu_supports("ssse3");
+    return isSupported;
+}
+
+__attribute__((target("ssse3")))
+int32_t Rgba8888ToRgb888Ssse3(const uint8_t* src, uint8_t* dst, int32_t size, bool swapRedBlue)
+{
+    const __m128i keepOrder = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    const __m128i swapOrder = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m128i shuffle = swapRedBlue ? swapOrder : keepOrder;
+    int32_t i = 0;
+    for (; i + SSE_PIXELS_GUARD <= size; i += SSE_PIXELS_4) {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * RGBA8888_PIXEL_BYTES));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * RGB888_PIXEL_BYTES), _mm_shuffle_epi8(rgba, shuffle));
+    }
+    return i;
+}
+
+int32_t Rgba8888ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size, bool swapRedBlue)
+{
+    return IsSsse3Supported() ? Rgba8888ToRgb888Ssse3(src, dst, size, swapRedBlue) : 0;
+}
+
+int32_t Rgb565ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size)
+{
+    return 0;
+}
+
+int32_t Rgba1010102ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size)
+{
+    return 0;
+}
+#else
+int32_t Rgba8888ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size, bool swapRedBlue)
+{
+    return 0;
+}
+
+int32_t Rgb565ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size)
+{
+    return 0;
+}
+
+int32_t Rgba1010102ToRgb888Vector(const uint8_t* src, uint8_t* dst, int32_t size)
+{
+    return 0;
+}
+#endif
+} // namespace
+
+bool SnapShotUtils::RGBA8888ToRGB888(const uint8_t* rgba8888Buf, uint8_t* rgb888Buf, int32_t size)
+{
+    if (rgba8888Buf == nullptr || rgb888Buf == nullptr || size <= 0) {
+        std::cout << __func__ << ": params are invalid." << std::endl;
+        return false;
+    }
+    int32_t done = Rgba8888ToRgb888Vector(rgba8888Buf, rgb888Buf, size, false);
+    RGBA8888ToRGB888Scalar(rgba8888Buf, rgb888Buf, done, size);
     return true;
 }
 
-// The method will NOT release file.
-bool SnapShotUtils::WriteRgb888ToJpeg(FILE* file, uint32_t width, uint32_t height, const uint8_t* data)
+bool SnapShotUtils::BGRA8888ToRGB888(const uint8_t* bgra8888Buf, uint8_t* rgb888Buf, int32_t size)
 {
-    if (data == nullptr) {
-        std::cout << "error: data error, nullptr!" << std::endl;
+    if (bgra8888Buf == nullptr || rgb888Buf == nullptr || size <= 0) {
+        std::cout << __func__ << ": params are invalid." << std::endl;
         return false;
     }
+    int32_t done = Rgba8888ToRgb888Vector(bgra8888Buf, rgb888Buf, size, true);
+    BGRA8888ToRGB888Scalar(bgra8888Buf, rgb888Buf, done, size);
+    return true;
+}
 
-    if (file == nullptr) {
-        std::cout << "error: file is null" << std::endl;
+bool SnapShotUtils::RGB565ToRGB888(const uint8_t* rgb565Buf, uint8_t* rgb888Buf, int32_t size)
+{
+    if (rgb565Buf == nullptr || rgb888Buf == nullptr || size <= 0) {
+        std::cout << __func__ << ": params are invalid." << std::endl;
         return false;
     }
+    int32_t done = Rgb565ToRgb888Vector(rgb565Buf, rgb888Buf, size);
+    RGB565ToRGB888Scalar(rgb565Buf, rgb888Buf, done, size);
+    return true;
+}
+
+bool SnapShotUtils::RGBA1010102ToRGB888(const uint8_t* rgba1010102Buf, uint8_t* rgb888Buf, int32_t size)
+{
+    if (rgba1010102Buf == nullptr || rgb888Buf == nullptr || size <= 0) {
+        std::cout << __func__ << ": params are invalid." << std::endl;
+        return false;
+    }
+    int32_t done = Rgba1010102ToRgb888Vector(rgba1010102Buf, rgb888Buf, size);
+    RGBA1010102ToRGB888Scalar(rgba1010102Buf, rgb888Buf, done, size);
+    return true;
+}
 
+namespace {
+constexpr uint32_t JPEG_ROWS_PER_CHUNK = 16; // one MCU row at 4:2:0 sampling
+using GetRgb888RowsFunc = std::function<const uint8_t*(uint32_t startRow, uint32_t rowNum)>;
+
+/*
+ * Feed the encoder JPEG_ROWS_PER_CHUNK rows at a time, getRows returns rgb888 rows which only have to
+ * stay valid until the next call, so conversion only needs a buffer of a few rows.
+ */
+bool EncodeRgb888RowsToJpeg(FILE* file, uint32_t width, uint32_t height, const GetRgb888RowsFunc& getRows)
+{
+    JSAMPROW rowPointers[JPEG_ROWS_PER_CHUNK];
     struct jpeg_compress_struct jpeg;
     struct MissionErrorMgr jerr;
     jpeg.err = jpeg_std_error(&jerr);
@@ -257,16 +442,86 @@ bool SnapShotUtils::WriteRgb888ToJpeg(FILE* file, uint32_t width, uint32_t heigh
 
     jpeg_stdio_dest(&jpeg, file);
     jpeg_start_compress(&jpeg, TRUE);
-    JSAMPROW rowPointer[1];
-    for (uint32_t i = 0; i < jpeg.image_height; i++) {
-        rowPointer[0] = const_cast<uint8_t *>(data + i * jpeg.image_width * RGB888_PIXEL_BYTES);
-        (void)jpeg_write_scanlines(&jpeg, rowPointer, 1);
+    uint32_t rowBytes = width * RGB888_PIXEL_BYTES;
+    while (jpeg.next_scanline < jpeg.image_height) {
+        uint32_t startRow = jpeg.next_scanline;
+        uint32_t rowNum = std::min(JPEG_ROWS_PER_CHUNK, jpeg.image_height - startRow);
+        const uint8_t* rows = getRows(startRow, rowNum);
+        if (rows == nullptr) {
+            jpeg_abort_compress(&jpeg);
+            jpeg_destroy_compress(&jpeg);
+            return false;
+        }
+        for (uint32_t i = 0; i < rowNum; i++) {
+            rowPointers[i] = const_cast<uint8_t*>(rows + i * rowBytes);
+        }
+        (void)jpeg_write_scanlines(&jpeg, rowPointers, rowNum);
     }
 
     jpeg_finish_compress(&jpeg);
     jpeg_destroy_compress(&jpeg);
     return true;
 }
+} // namespace
+
+// The method will NOT release file.
+bool SnapShotUtils::WriteRgb888ToJpeg(FILE* file, uint32_t width, uint32_t height, const uint8_t* data)
+{
+    if (data == nullptr) {
+        std::cout << "error: data error, nullptr!" << std::endl;
+        return false;
+    }
+
+    if (file == nullptr) {
+        std::cout << "error: file is null" << std::endl;
+        return false;
+    }
+
+    uint32_t rowBytes = width * RGB888_PIXEL_BYTES;
+    return EncodeRgb888RowsToJpeg(file, width, height, [data, rowBytes](uint32_t startRow, uint32_t) {
+        return data + startRow * rowBytes;
+    });
+}
+
+// The method will NOT release file.
+bool SnapShotUtils::ConvertAndWriteToJpeg(FILE* file, const WriteToJpegParam& param)
+{
+    using ConvertFunc = bool (*)(const uint8_t*, uint8_t*, int32_t);
+    ConvertFunc convertFunc = nullptr;
+    switch (param.format) {
+        case Media::PixelFormat::RGB_888:
+            return WriteRgb888ToJpeg(file, param.width, param.height, param.data);
+        case Media::PixelFormat::RGBA_8888:
+            convertFunc = RGBA8888ToRGB888;
+            break;
+        case Media::PixelFormat::BGRA_8888:
+            convertFunc = BGRA8888ToRGB888;
+            break;
+        case Media::PixelFormat::RGBA_1010102:
+            convertFunc = RGBA1010102ToRGB888;
+            break;
+        case Media::PixelFormat::RGB_565:
+            convertFunc = RGB565ToRGB888;
+            break;
+        default:
+            std::cout << "snapshot: invalid pixel format." << std::endl;
+            return false;
+    }
+    if (file == nullptr || param.data == nullptr) {
+        std::cout << "error: file or data is null" << std::endl;
+        return false;
+    }
+    // convert a chunk of rows right before encoding it instead of the whole frame
+    std::vector<uint8_t> rgb888Rows(static_cast<size_t>(param.width) * RGB888_PIXEL_BYTES * JPEG_ROWS_PER_CHUNK);
+    auto getRows = [&param, &rgb888Rows, convertFunc](uint32_t startRow, uint32_t rowNum) -> const uint8_t* {
+        const uint8_t* src = param.data + static_cast<size_t>(startRow) * param.stride;
+        if (!convertFunc(src, rgb888Rows.data(), static_cast<int32_t>(rowNum * param.width))) {
+            return nullptr;
+        }
+        return rgb888Rows.data();
+    };
+    return EncodeRgb888RowsToJpeg(file, param.width, param.height, getRows);
+}
 
 bool SnapShotUtils::WriteToJpeg(const std::string& fileName, const WriteToJpegParam& param)
 {
@@ -286,29 +541,7 @@ bool SnapShotUtils::WriteToJpeg(const std::string& fileName, const WriteToJpegPa
         return ret;
     }
     std::cout << "snapshot: pixel format is: " << static_cast<uint32_t>(param.format) << std::endl;
-    if (param.format == Media::PixelFormat::RGBA_8888) {
-        int32_t rgb888Size = param.stride * param.height * RGB888_PIXEL_BYTES / RGBA8888_PIXEL_BYTES;
-        uint8_t *rgb888 = new uint8_t[rgb888Size];
-        ret = RGBA8888ToRGB888(param.data, rgb888, rgb888Size / RGB888_PIXEL_BYTES);
-        if (ret) {
-            std::cout << "snapshot: convert rgba8888 to rgb888 successfully." << std::endl;
-            ret = WriteRgb888ToJpeg(file, param.width, param.height, rgb888);
-        }
-        delete[] rgb888;
-    } else if (param.format == Media::PixelFormat::RGB_565) {
-        int32_t rgb888Size = param.stride * param.height * RGB888_PIXEL_BYTES / RGB565_PIXEL_BYTES;
-        uint8_t *rgb888 = new uint8_t[rgb888Size];
-        ret = RGB565ToRGB888(param.data, rgb888, rgb888Size / RGB888_PIXEL_BYTES);
-        if (ret) {
-            std::cout << "snapshot: convert rgb565 to rgb888 successfully." << std::endl;
-            ret = WriteRgb888ToJpeg(file, param.width, param.height, rgb888);
-        }
-        delete[] rgb888;
-    } else if (param.format == Media::PixelFormat::RGB_888) {
-        ret = WriteRgb888ToJpeg(file, param.width, param.height, param.data);
-    } else {
-        std::cout << "snapshot: invalid pixel format." << std::endl;
-    }
+    ret = ConvertAndWriteToJpeg(file, param);
     if (fclose(file) != 0) {
         std::cout << "error: close file failed!" << std::endl;
         ret = false;
@@ -329,29 +562,7 @@ bool SnapShotUtils::WriteToJpeg(int fd, const WriteToJpegParam& param)
         return ret;
     }
     std::cout << "snapshot: pixel format is: " << static_cast<uint32_t>(param.format) << std::endl;
-    if (param.format == Media::PixelFormat::RGBA_8888) {
-        int32_t rgb888Size = param.stride * param.height * RGB888_PIXEL_BYTES / RGBA8888_PIXEL_BYTES;
-        uint8_t *rgb888 = new uint8_t[rgb888Size];
-        ret = RGBA8888ToRGB888(param.data, rgb888, rgb888Size / RGB888_PIXEL_BYTES);
-        if (ret) {
-            std::cout << "snapshot: convert rgba8888 to rgb888 successfully." << std::endl;
-            ret = WriteRgb888ToJpeg(file, param.width, param.height, rgb888);
-        }
-        delete[] rgb888;
-    } else if (param.format == Media::PixelFormat::RGB_565) {
-        int32_t rgb888Size = param.stride * param.height * RGB888_PIXEL_BYTES / RGB565_PIXEL_BYTES;
-        uint8_t *rgb888 = new uint8_t[rgb888Size];
-        ret = RGB565ToRGB888(param.data, rgb888, rgb888Size / RGB888_PIXEL_BYTES);
-        if (ret) {
-            std::cout << "snapshot: convert rgb565 to rgb888 successfully." << std::endl;
-            ret = WriteRgb888ToJpeg(file, param.width, param.height, rgb888);
-        }
-        delete[] rgb888;
-    } else if (param.format == Media::PixelFormat::RGB_888) {
-        ret = WriteRgb888ToJpeg(file, param.width, param.height, param.data);
-    } else {
-        std::cout << "snapshot: invalid pixel format." << std::endl;
-    }
+    ret = ConvertAndWriteToJpeg(file, param);
     if (fclose(file) != 0) {
         std::cout << "error: close file failed!" << std::endl;
         ret = false;
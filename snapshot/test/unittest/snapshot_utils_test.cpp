@@ -136,6 +136,58 @@ HWTEST_F(SnapshotUtilsTest, RGB565ToRGB888, TestSize.Level1)
     EXPECT_TRUE(SnapShotUtils::RGB565ToRGB888(rgb565Buf, rgb888Buf, RGB565BUF_SIZE));
 }
 
+/**
+ * @tc.name: ConvertToRGB888Pixels
+ * @tc.desc: check converted pixels of every format, including the vector loop and the scalar tail
+ * @tc.type: FUNC
+ */
+HWTEST_F(SnapshotUtilsTest, ConvertToRGB888Pixels, TestSize.Level1)
+{
+    constexpr int32_t pixelNum = 37;
+    std::vector<uint8_t> rgba8888(pixelNum * BPP);
+    std::vector<uint8_t> bgra8888(pixelNum * BPP);
+    std::vector<uint32_t> rgba1010102(pixelNum);
+    std::vector<uint16_t> rgb565(pixelNum);
+    for (int32_t i = 0; i < pixelNum; i++) {
+        uint8_t red = static_cast<uint8_t>(i * 7);
+        uint8_t green = static_cast<uint8_t>(i * 13 + 1);
+        uint8_t blue = static_cast<uint8_t>(i * 29 + 2);
+        rgba8888[i * BPP] = red;
+        rgba8888[i * BPP + 1] = green;
+        rgba8888[i * BPP + 2] = blue;
+        rgba8888[i * BPP + 3] = 0xFF;
+        bgra8888[i * BPP] = blue;
+        bgra8888[i * BPP + 1] = green;
+        bgra8888[i * BPP + 2] = red;
+        bgra8888[i * BPP + 3] = 0xFF;
+        rgba1010102[i] = (static_cast<uint32_t>(red) << 2) | (static_cast<uint32_t>(green) << 12) |
+            (static_cast<uint32_t>(blue) << 22) | (0x3u << 30);
+        rgb565[i] = static_cast<uint16_t>(((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3));
+    }
+    std::vector<uint8_t> rgb888(pixelNum * RGB888_PIXEL_BYTES);
+    ASSERT_TRUE(SnapShotUtils::RGBA8888ToRGB888(rgba8888.data(), rgb888.data(), pixelNum));
+    for (int32_t i = 0; i < pixelNum; i++) {
+        EXPECT_EQ(rgb888[i * RGB888_PIXEL_BYTES], rgba8888[i * BPP]);
+        EXPECT_EQ(rgb888[i * RGB888_PIXEL_BYTES + 1], rgba8888[i * BPP + 1]);
+        EXPECT_EQ(rgb888[i * RGB888_PIXEL_BYTES + 2], rgba8888[i * BPP + 2]);
+    }
+    std::vector<uint8_t> fromBgra(pixelNum * RGB888_PIXEL_BYTES);
+    ASSERT_TRUE(SnapShotUtils::BGRA8888ToRGB888(bgra8888.data(), fromBgra.data(), pixelNum));
+    EXPECT_EQ(fromBgra, rgb888);
+    std::vector<uint8_t> from1010102(pixelNum * RGB888_PIXEL_BYTES);
+    ASSERT_TRUE(SnapShotUtils::RGBA1010102ToRGB888(reinterpret_cast<const uint8_t*>(rgba1010102.data()),
+        from1010102.data(), pixelNum));
+    EXPECT_EQ(from1010102, rgb888);
+    std::vector<uint8_t> from565(pixelNum * RGB888_PIXEL_BYTES);
+    ASSERT_TRUE(SnapShotUtils::RGB565ToRGB888(reinterpret_cast<const uint8_t*>(rgb565.data()),
+        from565.data(), pixelNum));
+    for (int32_t i = 0; i < pixelNum; i++) {
+        EXPECT_EQ(from565[i * RGB888_PIXEL_BYTES], rgb888[i * RGB888_PIXEL_BYTES] & 0xF8);
+        EXPECT_EQ(from565[i * RGB888_PIXEL_BYTES + 1], rgb888[i * RGB888_PIXEL_BYTES + 1] & 0xFC);
+        EXPECT_EQ(from565[i * RGB888_PIXEL_BYTES + 2], rgb888[i * RGB888_PIXEL_BYTES + 2] & 0xF8);
+    }
+}
+
 /**
  * @tc.name: WriteRgb888ToJpeg01
  * @tc.desc: write rgb888 to jpeg using invalid data
@@ -195,6 +247,28 @@ HWTEST_F(SnapshotUtilsTest, Write02, TestSize.Level1)
     ASSERT_EQ(true, SnapShotUtils::WriteToJpeg(defaultFile_, param));
 }
 
+/**
+ * @tc.name: WriteStreamRows
+ * @tc.desc: Write custom jpeg whose height is not a multiple of the encode row chunk
+ * @tc.type: FUNC
+ */
+HWTEST_F(SnapshotUtilsTest, WriteStreamRows, TestSize.Level1)
+{
+    constexpr uint32_t width = 33;
+    constexpr uint32_t height = 37;
+    std::vector<uint8_t> pixels(width * height * BPP, 0x7F);
+    WriteToJpegParam param = {
+        .width = width,
+        .height = height,
+        .stride = width * BPP,
+        .format = Media::PixelFormat::BGRA_8888,
+        .data = pixels.data()
+    };
+    ASSERT_EQ(true, SnapShotUtils::WriteToJpeg(defaultFile_, param));
+    param.format = Media::PixelFormat::RGBA_8888;
+    ASSERT_EQ(true, SnapShotUtils::WriteToJpeg(defaultFile_, param));
+}
+
 /**
  * @tc.name: Write03
  * @tc.desc: Write custom jpeg using valid file names and valid WriteToJpegParam
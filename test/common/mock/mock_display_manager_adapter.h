@@ -43,6 +43,8 @@ public:
     MOCK_METHOD1(GetDisplayState, DisplayState(DisplayId displayId));
     MOCK_METHOD1(NotifyDisplayEvent, void(DisplayEvent event));
     MOCK_METHOD1(GetDisplayInfo, sptr<DisplayInfo>(DisplayId displayId));
+    MOCK_METHOD4(GetDisplayInfoFromSharedMemory, sptr<DisplayInfo>(DisplayId displayId,
+        const sptr<DisplayInfo>& cached, uint64_t& version, uint32_t& generation));
     MOCK_METHOD4(GetCutoutInfo, sptr<CutoutInfo>(DisplayId displayId, int32_t width, int32_t height,
         Rotation rotation));
     MOCK_METHOD2(GetAvailableArea, DMError(DisplayId displayId, DMRect& area));
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "task_scheduler.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class TaskSchedulerBenchmarkTest : public testing::Test {
+public:
+    TaskSchedulerBenchmarkTest() {}
+    ~TaskSchedulerBenchmarkTest() {}
+};
+
+namespace {
+constexpr const char* PRODUCER_TASK_NAMES[] = {
+    "producerTask0", "producerTask1", "producerTask2", "producerTask3",
+    "producerTask4", "producerTask5", "producerTask6", "producerTask7",
+};
+
+struct PostBenchmarkResult {
+    double postsPerSecond = 0.0;
+    int64_t p50Ns = 0;
+    int64_t p99Ns = 0;
+    int64_t maxNs = 0;
+};
+
+/* 8 producers posting concurrently, latency is the time spent in one post call */
+template <typename PostFunc>
+PostBenchmarkResult RunPostBenchmark(int postNumPerProducer, PostFunc&& post)
+{
+    constexpr int producerNum = 8;
+    std::vector<std::vector<int64_t>> latencies(producerNum);
+    std::vector<std::thread> producers;
+    auto startTime = std::chrono::steady_clock::now();
+    for (int producer = 0; producer < producerNum; producer++) {
+        producers.emplace_back([&latencies, &post, producer, postNumPerProducer] {
+            latencies[producer].reserve(postNumPerProducer);
+            for (int i = 0; i < postNumPerProducer; i++) {
+                auto postTime = std::chrono::steady_clock::now();
+                post(producer);
+                latencies[producer].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - postTime).count());
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    std::vector<int64_t> allLatencies;
+    for (const auto& producerLatencies : latencies) {
+        allLatencies.insert(allLatencies.end(), producerLatencies.begin(), producerLatencies.end());
+    }
+    std::sort(allLatencies.begin(), allLatencies.end());
+    PostBenchmarkResult result;
+    constexpr double usPerSecond = 1000000.0;
+    result.postsPerSecond = allLatencies.size() * usPerSecond / std::max<int64_t>(elapsedUs, 1);
+    result.p50Ns = allLatencies[allLatencies.size() / 2]; // 2: median
+    result.p99Ns = allLatencies[allLatencies.size() * 99 / 100]; // 99: percentile
+    result.maxNs = allLatencies.back();
+    return result;
+}
+
+/**
+ * @tc.name: PostCoalescedTaskBenchmark
+ * @tc.desc: compare posts per second and post tail latency of 8 producers with PostAsyncTask
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerBenchmarkTest, PostCoalescedTaskBenchmark, TestSize.Level1)
+{
+    constexpr int postNumPerProducer = 20000;
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    std::atomic<int> executedCount { 0 };
+    auto coalesced = RunPostBenchmark(postNumPerProducer, [&taskScheduler, &executedCount](int producer) {
+        taskScheduler->PostCoalescedTask([&executedCount] { executedCount++; }, PRODUCER_TASK_NAMES[producer]);
+    });
+    taskScheduler->PostVoidSyncTask([] {}, "flushTask");
+    EXPECT_GT(executedCount.load(), 0);
+
+    executedCount = 0;
+    auto async = RunPostBenchmark(postNumPerProducer, [&taskScheduler, &executedCount](int producer) {
+        taskScheduler->PostAsyncTask([&executedCount] { executedCount++; }, PRODUCER_TASK_NAMES[producer]);
+    });
+    taskScheduler->PostVoidSyncTask([] {}, "flushTask");
+    EXPECT_EQ(executedCount.load(), postNumPerProducer * 8); // 8: producer number
+
+    for (const auto& [name, result] : { std::make_pair("coalesced", coalesced), std::make_pair("async", async) }) {
+        GTEST_LOG_(INFO) << name << ": " << result.postsPerSecond << " posts/s, p50 " << result.p50Ns << "ns, p99 "
+                         << result.p99Ns << "ns, max " << result.maxNs << "ns";
+    }
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
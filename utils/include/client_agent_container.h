@@ -44,12 +44,15 @@ public:
     int32_t GetAgentPid(const sptr<T1>& agent);
     bool GetAgentSystem(const sptr<T1>& agent);
     std::map<uintptr_t, std::pair<sptr<T1>, std::set<T2>>> GetAttributeAgentsMap();
+    /* only visits agents subscribed to at least one of the attributes */
+    std::set<sptr<T1>> GetAgentsByAttributes(const std::vector<T2>& attributes);
     template <typename Func>
     auto ParseAttributeAgentsMap(Func&& func);
 
 private:
     void RemoveAgent(const sptr<IRemoteObject>& remoteObject);
     bool UnregisterAgentLocked(std::set<sptr<T1>>& agents, const sptr<IRemoteObject>& agent);
+    void UnindexAttributeLocked(uintptr_t key, const T2& attribute);
 
     static constexpr HiviewDFX::HiLogLabel LABEL = {LOG_CORE, HILOG_DOMAIN_WINDOW, "ClientAgentContainer"};
 
@@ -71,6 +74,8 @@ private:
     std::recursive_mutex mutex_;
     std::map<T2, std::set<sptr<T1>>> agentMap_;
     std::map<uintptr_t, std::pair<sptr<T1>, std::set<T2>>> attributeAgentMap_;
+    /* attribute -> keys of attributeAgentMap_ listening to it */
+    std::map<T2, std::set<uintptr_t>> attributeSubscriberMap_;
     std::map<sptr<T1>, int32_t> agentPidMap_;
     std::map<sptr<T1>, bool> agentSystemMap_;
     sptr<AgentDeathRecipient> deathRecipient_;
@@ -118,6 +123,9 @@ bool ClientAgentContainer<T1, T2>::RegisterAttributeAgent(uintptr_t key, const s
         attributeAgentMap_[key] = {agent, attrSet};
         agentPidMap_[agent] = IPCSkeleton::GetCallingPid();
     }
+    for (const auto& attr : attributes) {
+        attributeSubscriberMap_[attr].insert(key);
+    }
  
     auto iter = attributeAgentMap_.find(key);
     if (iter != attributeAgentMap_.end()) {
@@ -156,6 +164,9 @@ bool ClientAgentContainer<T1, T2>::UnRegisterAllAttributeAgent(uintptr_t key, co
     if (agentSystemIt != agentSystemMap_.end()) {
         agentSystemMap_.erase(agentSystemIt);
     }
+    for (const auto& attribute : attributeAgentMap_.at(key).second) {
+        UnindexAttributeLocked(key, attribute);
+    }
     attributeAgentMap_.erase(key);
     agent->AsObject()->RemoveDeathRecipient(deathRecipient_);
     return true;
@@ -182,10 +193,24 @@ bool ClientAgentContainer<T1, T2>::UnRegisterAttribute(uintptr_t key, const sptr
             continue;
         }
         attributes.erase(iter);
+        UnindexAttributeLocked(key, attribute);
     }
     return true;
 }
 
+template<typename T1, typename T2>
+void ClientAgentContainer<T1, T2>::UnindexAttributeLocked(uintptr_t key, const T2& attribute)
+{
+    auto iter = attributeSubscriberMap_.find(attribute);
+    if (iter == attributeSubscriberMap_.end()) {
+        return;
+    }
+    iter->second.erase(key);
+    if (iter->second.empty()) {
+        attributeSubscriberMap_.erase(iter);
+    }
+}
+
 template<typename T1, typename T2>
 std::map<uintptr_t, std::pair<sptr<T1>, std::set<T2>>> ClientAgentContainer<T1, T2>::GetAttributeAgentsMap()
 {
@@ -193,6 +218,26 @@ std::map<uintptr_t, std::pair<sptr<T1>, std::set<T2>>> ClientAgentContainer<T1,
     return attributeAgentMap_;
 }
 
+template<typename T1, typename T2>
+std::set<sptr<T1>> ClientAgentContainer<T1, T2>::GetAgentsByAttributes(const std::vector<T2>& attributes)
+{
+    std::set<sptr<T1>> agents;
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    for (const auto& attribute : attributes) {
+        auto subscriberIt = attributeSubscriberMap_.find(attribute);
+        if (subscriberIt == attributeSubscriberMap_.end()) {
+            continue;
+        }
+        for (uintptr_t key : subscriberIt->second) {
+            auto agentIt = attributeAgentMap_.find(key);
+            if (agentIt != attributeAgentMap_.end() && agentIt->second.first != nullptr) {
+                agents.insert(agentIt->second.first);
+            }
+        }
+    }
+    return agents;
+}
+
 template<typename T1, typename T2>
 template <typename Func>
 auto ClientAgentContainer<T1, T2>::ParseAttributeAgentsMap(Func&& func)
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_CLIENT_AGENT_DISPATCHER_H
+#define OHOS_ROSEN_CLIENT_AGENT_DISPATCHER_H
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <iremote_object.h>
+
+#include "window_manager_hilog.h"
+
+namespace OHOS {
+namespace Rosen {
+constexpr uint32_t AGENT_NOTIFY_NO_COALESCE = 0;
+constexpr uint32_t AGENT_NOTIFY_DEFAULT_MAX_BACKLOG = 64;
+
+/*
+ * One notification delivered to client agents. It is shared by every agent it is
+ * dispatched to, so it must not be modified once dispatched.
+ */
+template <typename T1>
+class ClientAgentNotification {
+public:
+    explicit ClientAgentNotification(uint32_t coalesceKey = AGENT_NOTIFY_NO_COALESCE) : coalesceKey_(coalesceKey) {}
+    virtual ~ClientAgentNotification() = default;
+
+    virtual void Notify(const sptr<T1>& agent) = 0;
+    /*
+     * Folds a newer pending notification with the same key into this one.
+     * Returns nullptr when the newer one simply supersedes this one.
+     */
+    virtual std::shared_ptr<ClientAgentNotification<T1>> CoalesceWith(
+        const ClientAgentNotification<T1>& newer) const
+    {
+        return nullptr;
+    }
+    uint32_t GetCoalesceKey() const { return coalesceKey_; }
+
+private:
+    uint32_t coalesceKey_;
+};
+
+template <typename T1>
+class ClientAgentFuncNotification : public ClientAgentNotification<T1> {
+public:
+    explicit ClientAgentFuncNotification(std::function<void(const sptr<T1>&)>&& func,
+        uint32_t coalesceKey = AGENT_NOTIFY_NO_COALESCE)
+        : ClientAgentNotification<T1>(coalesceKey), func_(std::move(func)) {}
+
+    void Notify(const sptr<T1>& agent) override
+    {
+        if (func_) {
+            func_(agent);
+        }
+    }
+
+private:
+    std::function<void(const sptr<T1>&)> func_;
+};
+
+/*
+ * Delivers notifications to every agent through its own bounded queue drained on an executor
+ * created for that agent, a slow agent only delays itself. A pending notification is coalesced with a newer one of the
+ * same key, the oldest pending one is dropped when the backlog is full.
+ */
+template <typename T1>
+class ClientAgentDispatcher {
+public:
+    using Executor = std::function<void(std::function<void()>&&)>;
+    /* called once per agent, the executor is released when the agent is removed */
+    using ExecutorFactory = std::function<Executor()>;
+    using NotificationPtr = std::shared_ptr<ClientAgentNotification<T1>>;
+    struct AgentStats {
+        uint32_t backlog = 0;
+        uint64_t delivered = 0;
+        uint64_t coalesced = 0;
+        uint64_t dropped = 0;
+    };
+
+    /* without an executor factory queues are drained on the dispatching thread */
+    explicit ClientAgentDispatcher(ExecutorFactory executorFactory = nullptr,
+        uint32_t maxBacklog = AGENT_NOTIFY_DEFAULT_MAX_BACKLOG)
+        : executorFactory_(std::move(executorFactory)), maxBacklog_(maxBacklog == 0 ? 1 : maxBacklog) {}
+    virtual ~ClientAgentDispatcher() = default;
+
+    void Dispatch(const std::set<sptr<T1>>& agents, const NotificationPtr& notification);
+    void Dispatch(const sptr<T1>& agent, const NotificationPtr& notification);
+    /* pending notifications of a removed agent are discarded */
+    void RemoveAgent(const sptr<T1>& agent);
+    void RemoveAgent(const sptr<IRemoteObject>& remoteObject);
+    std::map<sptr<T1>, AgentStats> GetAgentStats();
+
+private:
+    struct AgentQueue {
+        std::deque<NotificationPtr> pending;
+        bool draining = false;
+        bool removed = false;
+        AgentStats stats;
+        Executor executor;
+    };
+    bool EnqueueLocked(AgentQueue& queue, const NotificationPtr& notification);
+    void Drain(const sptr<T1>& agent, const std::shared_ptr<AgentQueue>& queue);
+
+    ExecutorFactory executorFactory_;
+    uint32_t maxBacklog_;
+    std::mutex mutex_;
+    std::map<sptr<T1>, std::shared_ptr<AgentQueue>> agentQueues_;
+};
+
+template <typename T1>
+void ClientAgentDispatcher<T1>::Dispatch(const std::set<sptr<T1>>& agents, const NotificationPtr& notification)
+{
+    for (const auto& agent : agents) {
+        Dispatch(agent, notification);
+    }
+}
+
+template <typename T1>
+void ClientAgentDispatcher<T1>::Dispatch(const sptr<T1>& agent, const NotificationPtr& notification)
+{
+    if (agent == nullptr || notification == nullptr) {
+        return;
+    }
+    std::shared_ptr<AgentQueue> queue;
+    Executor executor;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& entry = agentQueues_[agent];
+        if (entry == nullptr) {
+            entry = std::make_shared<AgentQueue>();
+            if (executorFactory_ != nullptr) {
+                entry->executor = executorFactory_();
+            }
+        }
+        queue = entry;
+        if (!EnqueueLocked(*queue, notification)) {
+            return;
+        }
+        executor = queue->executor;
+    }
+    if (executor == nullptr) {
+        Drain(agent, queue);
+        return;
+    }
+    executor([this, agent, queue] { Drain(agent, queue); });
+}
+
+template <typename T1>
+bool ClientAgentDispatcher<T1>::EnqueueLocked(AgentQueue& queue, const NotificationPtr& notification)
+{
+    uint32_t key = notification->GetCoalesceKey();
+    if (key != AGENT_NOTIFY_NO_COALESCE) {
+        for (auto& pending : queue.pending) {
+            if (pending->GetCoalesceKey() != key) {
+                continue;
+            }
+            auto merged = pending->CoalesceWith(*notification);
+            pending = merged != nullptr ? merged : notification;
+            queue.stats.coalesced++;
+            return false;
+        }
+    }
+    if (queue.pending.size() >= maxBacklog_) {
+        queue.pending.pop_front();
+        if (queue.stats.dropped++ == 0) {
+            TLOGW(WmsLogTag::DEFAULT, "agent backlog full, drop oldest notification");
+        }
+    }
+    queue.pending.push_back(notification);
+    queue.stats.backlog = static_cast<uint32_t>(queue.pending.size());
+    if (queue.draining) {
+        return false;
+    }
+    queue.draining = true;
+    return true;
+}
+
+template <typename T1>
+void ClientAgentDispatcher<T1>::Drain(const sptr<T1>& agent, const std::shared_ptr<AgentQueue>& queue)
+{
+    while (true) {
+        NotificationPtr notification;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (queue->removed || queue->pending.empty()) {
+                queue->draining = false;
+                queue->stats.backlog = 0;
+                return;
+            }
+            notification = std::move(queue->pending.front());
+            queue->pending.pop_front();
+            queue->stats.backlog = static_cast<uint32_t>(queue->pending.size());
+        }
+        notification->Notify(agent);
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue->stats.delivered++;
+    }
+}
+
+template <typename T1>
+void ClientAgentDispatcher<T1>::RemoveAgent(const sptr<T1>& agent)
+{
+    /* released on this thread after unlocking, a running drain task may still hold the queue */
+    Executor executor;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = agentQueues_.find(agent);
+    if (iter == agentQueues_.end()) {
+        return;
+    }
+    iter->second->removed = true;
+    iter->second->pending.clear();
+    executor = std::move(iter->second->executor);
+    agentQueues_.erase(iter);
+}
+
+template <typename T1>
+void ClientAgentDispatcher<T1>::RemoveAgent(const sptr<IRemoteObject>& remoteObject)
+{
+    if (remoteObject == nullptr) {
+        return;
+    }
+    std::vector<Executor> executors;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = agentQueues_.begin(); iter != agentQueues_.end();) {
+        if (iter->first->AsObject() != remoteObject) {
+            ++iter;
+            continue;
+        }
+        iter->second->removed = true;
+        iter->second->pending.clear();
+        executors.push_back(std::move(iter->second->executor));
+        iter = agentQueues_.erase(iter);
+    }
+}
+
+template <typename T1>
+std::map<sptr<T1>, typename ClientAgentDispatcher<T1>::AgentStats> ClientAgentDispatcher<T1>::GetAgentStats()
+{
+    std::map<sptr<T1>, AgentStats> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [agent, queue] : agentQueues_) {
+        result[agent] = queue->stats;
+    }
+    return result;
+}
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_CLIENT_AGENT_DISPATCHER_H
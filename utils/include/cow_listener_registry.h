@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_COW_LISTENER_REGISTRY_H
+#define OHOS_ROSEN_COW_LISTENER_REGISTRY_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace Rosen {
+/* identity of a registered entry, listeners registered with an option are keyed by the listener */
+template <typename T>
+struct CowListenerKey {
+    static const T& Get(const T& entry) { return entry; }
+};
+
+template <typename T, typename Option>
+struct CowListenerKey<std::pair<T, Option>> {
+    static const T& Get(const std::pair<T, Option>& entry) { return entry.first; }
+};
+
+/*
+ * Listeners of every window kept as immutable snapshots. Readers take the snapshot of a window
+ * without locking or allocating and may notify from it while the registry changes, writers copy
+ * the affected list and publish a new table. A snapshot taken before Unregister still holds the
+ * removed listener, so it can be called once more after Unregister returns.
+ */
+template <typename T>
+class CowListenerRegistry {
+public:
+    using ListenerList = std::vector<T>;
+    using ListenerListPtr = std::shared_ptr<const ListenerList>;
+    using KeyType = std::decay_t<decltype(CowListenerKey<T>::Get(std::declval<const T&>()))>;
+
+    CowListenerRegistry() : table_(std::make_shared<const ListenerTable>()) {}
+
+    /* never null, windows without listeners share one empty list */
+    ListenerListPtr GetListeners(int32_t windowId) const
+    {
+        auto table = std::atomic_load(&table_);
+        auto iter = table->find(windowId);
+        return iter != table->end() ? iter->second : EmptyList();
+    }
+
+    bool HasListeners(int32_t windowId) const
+    {
+        auto table = std::atomic_load(&table_);
+        return table->find(windowId) != table->end();
+    }
+
+    size_t GetListenerCount(int32_t windowId) const { return GetListeners(windowId)->size(); }
+
+    /* true when no window has a listener registered */
+    bool IsEmpty() const { return std::atomic_load(&table_)->empty(); }
+
+    /* returns false when the listener is already registered for the window */
+    bool Register(int32_t windowId, const T& entry)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto listeners = GetListeners(windowId);
+        if (std::any_of(listeners->begin(), listeners->end(),
+            [&entry](const T& registered) { return Key(registered) == Key(entry); })) {
+            return false;
+        }
+        auto newListeners = std::make_shared<ListenerList>(*listeners);
+        newListeners->push_back(entry);
+        PublishLocked(windowId, std::move(newListeners));
+        return true;
+    }
+
+    /* returns false when the listener is not registered for the window */
+    bool Unregister(int32_t windowId, const KeyType& listener)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto listeners = GetListeners(windowId);
+        auto newListeners = std::make_shared<ListenerList>();
+        std::copy_if(listeners->begin(), listeners->end(), std::back_inserter(*newListeners),
+            [&listener](const T& registered) { return Key(registered) != listener; });
+        if (newListeners->size() == listeners->size()) {
+            return false;
+        }
+        PublishLocked(windowId, std::move(newListeners));
+        return true;
+    }
+
+    void Clear(int32_t windowId)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        PublishLocked(windowId, nullptr);
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::atomic_store(&table_, std::shared_ptr<const ListenerTable>(std::make_shared<const ListenerTable>()));
+    }
+
+private:
+    using ListenerTable = std::map<int32_t, ListenerListPtr>;
+
+    static const KeyType& Key(const T& entry) { return CowListenerKey<T>::Get(entry); }
+
+    static const ListenerListPtr& EmptyList()
+    {
+        static const ListenerListPtr emptyList = std::make_shared<const ListenerList>();
+        return emptyList;
+    }
+
+    /* an empty list removes the window from the table */
+    void PublishLocked(int32_t windowId, std::shared_ptr<ListenerList> listeners)
+    {
+        auto newTable = std::make_shared<ListenerTable>(*std::atomic_load(&table_));
+        if (listeners == nullptr || listeners->empty()) {
+            newTable->erase(windowId);
+        } else {
+            (*newTable)[windowId] = std::move(listeners);
+        }
+        std::atomic_store(&table_, std::shared_ptr<const ListenerTable>(std::move(newTable)));
+    }
+
+    std::mutex mutex_;
+    std::shared_ptr<const ListenerTable> table_;
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_COW_LISTENER_REGISTRY_H
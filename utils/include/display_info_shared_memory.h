@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_DISPLAY_INFO_SHARED_MEMORY_H
+#define OHOS_ROSEN_DISPLAY_INFO_SHARED_MEMORY_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include <ashmem.h>
+
+#include "display_info.h"
+
+namespace OHOS::Rosen {
+/*
+ * Geometry part of DisplayInfo mirrored into shared memory.
+ * Plain data only, the layout is shared between processes.
+ * rotation, originRotation and displayOrientation depend on the API version of the IPC caller,
+ * they are not mirrored and a change of them bumps unmirroredGeneration like any other field.
+ */
+struct DisplayInfoShmRecord {
+    DisplayId displayId = DISPLAY_ID_INVALID;
+    int32_t width = 0;
+    int32_t height = 0;
+    int32_t physicalWidth = 0;
+    int32_t physicalHeight = 0;
+    uint32_t refreshRate = 0;
+    float virtualPixelRatio = 1.0f;
+    float densityInCurResolution = 1.0f;
+    float defaultVirtualPixelRatio = 1.0f;
+    float xDpi = 0.0f;
+    float yDpi = 0.0f;
+    int32_t dpi = 0;
+    uint32_t orientation = 0;
+    uint32_t displayState = 0;
+    int32_t offsetX = 0;
+    int32_t offsetY = 0;
+    int32_t x = 0;
+    int32_t y = 0;
+    uint32_t availableWidth = 0;
+    uint32_t availableHeight = 0;
+    float scaleX = 1.0f;
+    float scaleY = 1.0f;
+    float pivotX = 0.5f;
+    float pivotY = 0.5f;
+    float translateX = 0.0f;
+    float translateY = 0.0f;
+    /* changes whenever a field of DisplayInfo that is not mirrored here does */
+    uint32_t unmirroredGeneration = 0;
+
+    void CopyFrom(const sptr<DisplayInfo>& info);
+    /* clones base and overrides the mirrored fields, the cached base is never written in place */
+    sptr<DisplayInfo> MergeInto(const sptr<DisplayInfo>& base) const;
+};
+
+/*
+ * Per display DisplayInfo channel published by the server in a read-only ashmem region.
+ * Every slot is guarded by a sequence counter: the writer makes it odd while updating,
+ * readers copy the record and retry if the counter was odd or changed during the copy.
+ */
+class DisplayInfoSharedMemory {
+public:
+    static constexpr uint32_t MAX_SLOT_COUNT = 16;
+    static constexpr uint32_t MAX_BYPASS_UID_COUNT = 32;
+
+    DisplayInfoSharedMemory() = default;
+    ~DisplayInfoSharedMemory();
+
+    /* server side */
+    bool Create();
+    sptr<Ashmem> GetAshmem() const { return ashmem_; }
+    void Publish(const sptr<DisplayInfo>& info);
+    void Remove(DisplayId displayId);
+    /* callers whose DisplayInfo is rewritten by the server must keep using IPC */
+    void SetBypassUids(const std::set<int32_t>& uids);
+    void SetBypassAll(bool bypassAll);
+
+    /* client side */
+    bool Attach(const sptr<Ashmem>& ashmem);
+    bool IsBypassed(int32_t uid) const;
+    /* version combines slot index and sequence, it changes whenever the record does */
+    bool Read(DisplayId displayId, DisplayInfoShmRecord& record, uint64_t& version) const;
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> seq;
+        uint32_t reserved;
+        DisplayInfoShmRecord record;
+    };
+    struct Layout {
+        uint32_t magic;
+        uint32_t version;
+        std::atomic<uint32_t> bypassSeq;
+        std::atomic<uint32_t> bypassAll;
+        std::atomic<uint32_t> bypassUidCount;
+        std::atomic<int32_t> bypassUids[MAX_BYPASS_UID_COUNT];
+        Slot slots[MAX_SLOT_COUNT];
+    };
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "seq counter must be address free");
+
+    struct UnmirroredState {
+        std::string data;
+        uint32_t generation = 0;
+    };
+
+    bool InitLayout(void* addr, size_t size, bool writable);
+    void WriteSlot(Slot& slot, const DisplayInfoShmRecord& record);
+    static std::string GetUnmirroredData(const sptr<DisplayInfo>& info);
+
+    sptr<Ashmem> ashmem_;
+    Layout* layout_ = nullptr;
+    bool writable_ = false;
+    bool bypassAllRequested_ = false;
+    bool bypassOverflow_ = false;
+    std::mutex writeMutex_;
+    std::unordered_map<DisplayId, uint32_t> slotIndexMap_;
+    /* generations are never reused, a display created again does not match a reader's old one */
+    uint32_t unmirroredGeneration_ = 0;
+    std::unordered_map<DisplayId, UnmirroredState> unmirroredStateMap_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_DISPLAY_INFO_SHARED_MEMORY_H
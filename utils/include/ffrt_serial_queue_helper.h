@@ -16,6 +16,8 @@
 #ifndef OHOS_ROSEN_WINDOW_SCENE_SERIAL_FFRT_QUEUE_HELPER_H
 #define OHOS_ROSEN_WINDOW_SCENE_SERIAL_FFRT_QUEUE_HELPER_H
 
+#include <string>
+
 #include "timeout_future.h"
 
 namespace ffrt {
@@ -26,11 +28,13 @@ namespace OHOS::Rosen {
 class FfrtSerialQueueHelper {
 public:
     static FfrtSerialQueueHelper& GetInstance();
+    /* a private serial queue, for callers that must not share the instance queue */
+    explicit FfrtSerialQueueHelper(const std::string& name);
+    ~FfrtSerialQueueHelper();
     void SubmitTask(std::function<void()>&& task);
 
 private:
     FfrtSerialQueueHelper();
-    ~FfrtSerialQueueHelper();
 
     std::unique_ptr<ffrt::queue> ffrtQueue_;
 };
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_LATENCY_HISTOGRAM_H
+#define OHOS_ROSEN_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace OHOS {
+namespace Rosen {
+/*
+ * Latency histogram in microseconds with power of two buckets, bucket i counts samples in [2^(i-1), 2^i).
+ * Recording is wait free so it can be used on the input thread, readers may observe a torn total.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t BUCKET_COUNT = 20; // last bucket collects everything from 2^18 us (~262ms)
+
+    void Record(uint64_t latencyUs)
+    {
+        buckets_[GetBucketIndex(latencyUs)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sumUs_.fetch_add(latencyUs, std::memory_order_relaxed);
+        uint64_t maxUs = maxUs_.load(std::memory_order_relaxed);
+        while (latencyUs > maxUs &&
+            !maxUs_.compare_exchange_weak(maxUs, latencyUs, std::memory_order_relaxed)) {
+        }
+    }
+
+    void Reset()
+    {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        sumUs_.store(0, std::memory_order_relaxed);
+        maxUs_.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t GetCount() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t GetMaxUs() const { return maxUs_.load(std::memory_order_relaxed); }
+    uint64_t GetBucketCount(uint32_t index) const
+    {
+        return index < BUCKET_COUNT ? buckets_[index].load(std::memory_order_relaxed) : 0;
+    }
+
+    /* upper bound of the bucket holding the given percentile, 0 when empty */
+    uint64_t GetPercentileUs(uint32_t percent) const
+    {
+        uint64_t count = GetCount();
+        if (count == 0) {
+            return 0;
+        }
+        uint64_t target = (count * percent + 99) / 100; // 100: percent base, rounded up
+        uint64_t accumulated = 0;
+        for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+            accumulated += buckets_[i].load(std::memory_order_relaxed);
+            if (accumulated >= target) {
+                return i + 1 < BUCKET_COUNT ? GetBucketUpperBoundUs(i) : GetMaxUs();
+            }
+        }
+        return GetMaxUs();
+    }
+
+    /* one line: count, avg, p50/p90/p99, max and the non empty buckets as "<upperBound:count" */
+    std::string ToString() const
+    {
+        uint64_t count = GetCount();
+        std::ostringstream oss;
+        oss << "count:" << count << " avg:" << (count == 0 ? 0 : sumUs_.load(std::memory_order_relaxed) / count)
+            << " p50:" << GetPercentileUs(50) << " p90:" << GetPercentileUs(90) // 50, 90: percentiles
+            << " p99:" << GetPercentileUs(99) << " max:" << GetMaxUs() << " buckets:"; // 99: percentile
+        for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+            uint64_t bucketCount = buckets_[i].load(std::memory_order_relaxed);
+            if (bucketCount == 0) {
+                continue;
+            }
+            if (i + 1 < BUCKET_COUNT) {
+                oss << " <" << GetBucketUpperBoundUs(i) << ":" << bucketCount;
+            } else {
+                oss << " >=" << GetBucketUpperBoundUs(i - 1) << ":" << bucketCount;
+            }
+        }
+        return oss.str();
+    }
+
+    static uint32_t GetBucketIndex(uint64_t latencyUs)
+    {
+        uint32_t index = 0;
+        while (latencyUs != 0 && index + 1 < BUCKET_COUNT) {
+            latencyUs >>= 1;
+            index++;
+        }
+        return index;
+    }
+
+    static uint64_t GetBucketUpperBoundUs(uint32_t index) { return static_cast<uint64_t>(1) << index; }
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_ {};
+    std::atomic<uint64_t> count_ { 0 };
+    std::atomic<uint64_t> sumUs_ { 0 };
+    std::atomic<uint64_t> maxUs_ { 0 };
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_LATENCY_HISTOGRAM_H
@@ -16,7 +16,9 @@
 #ifndef RATE_LIMITED_LOGGER_H
 #define RATE_LIMITED_LOGGER_H
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <parameters.h>
@@ -52,11 +54,37 @@ private:
     struct FunctionRecord {
         int32_t count = 0;                                // Current count in time window
         std::chrono::steady_clock::time_point startTime;  // Time window start
+        uint32_t timeWindowMs = 0;                        // Time window length
     };
 
+    /*
+     * Lock free record of one call site. state packs the time window start in milliseconds
+     * (high bits) and the count in that window (low bits), so a decision is one load plus
+     * at most one CAS. A slot whose time window has passed carries no information, so a new
+     * call site may take it over, e.g. one keyed by the id of a destroyed window.
+     */
+    struct RecordSlot {
+        std::atomic<std::uintptr_t> key { EMPTY_KEY };
+        std::atomic<uint64_t> state { 0 };
+        std::atomic<uint32_t> timeWindowMs { 0 };
+    };
+    static constexpr std::uintptr_t EMPTY_KEY = UINTPTR_MAX;
+    static constexpr uint32_t SLOT_COUNT = 1024; // power of two
+    static constexpr uint32_t MAX_PROBE_COUNT = 16;
+    static constexpr uint32_t COUNT_BITS = 24;
+    static constexpr uint64_t COUNT_MASK = (static_cast<uint64_t>(1) << COUNT_BITS) - 1;
+
+    RecordSlot* FindOrInsertSlot(std::uintptr_t key, bool insert);
+    static bool IsSlotExpired(const RecordSlot& slot, uint64_t now);
+    bool LogFunctionInSlot(RecordSlot& slot, uint32_t timeWindowMs, uint32_t maxCount);
+    bool LogFunctionLocked(std::uintptr_t functionAddress, uint32_t timeWindowMs, uint32_t maxCount);
+
+    RecordSlot recordSlots_[SLOT_COUNT];
+    // only used once MAX_PROBE_COUNT slots around a key are taken
     std::unordered_map<std::uintptr_t, FunctionRecord> functionRecords_;
+    size_t functionRecordsPruneSize_ = SLOT_COUNT; // guarded by functionRecordsMutex_
     std::mutex functionRecordsMutex_;
-    bool enabled_;
+    std::atomic<bool> enabled_;
 
     // Private constructor for singleton
     RateLimitedLogger()
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_VSYNC_FRAME_SCHEDULER_H
+#define OHOS_ROSEN_VSYNC_FRAME_SCHEDULER_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "wm_common.h"
+
+namespace OHOS {
+namespace Rosen {
+/* callbacks due on the same vsync run in priority order, then in scheduling order */
+enum class VsyncCallbackPriority : uint8_t {
+    HIGH = 0,
+    NORMAL,
+    LOW,
+};
+
+struct VsyncScheduleOption {
+    uint32_t delayFrames = 1; // 1: next vsync
+    VsyncCallbackPriority priority = VsyncCallbackPriority::NORMAL;
+    int64_t deadlineNs = 0; // latest vsync timestamp to run on, 0: no deadline
+};
+
+struct ScheduledVsyncCallback {
+    std::shared_ptr<VsyncCallback> callback;
+    VsyncCallbackPriority priority = VsyncCallbackPriority::NORMAL;
+    int64_t deadlineNs = 0;
+};
+
+struct VsyncFrameResult {
+    uint32_t callbackCount = 0;
+    uint32_t missedDeadlineCount = 0;
+    int64_t executionUs = 0;
+};
+
+struct VsyncFrameStats {
+    uint64_t frameCount = 0; // frames which ran at least one callback
+    uint64_t callbackCount = 0;
+    uint64_t missedDeadlineCount = 0;
+    int64_t lastFrameExecutionUs = 0;
+    int64_t maxFrameExecutionUs = 0;
+    int64_t totalExecutionUs = 0;
+
+    std::string ToString() const;
+};
+
+/*
+ * Vsync callbacks kept in a wheel indexed by frame. A frame is one delivered vsync, so a
+ * callback delayed by N frames runs on the N-th vsync after it was scheduled without being
+ * scheduled again in between. The owner still requests every vsync while anything is pending,
+ * since frames are only counted when a vsync is delivered. Not thread safe, the owner
+ * serializes access.
+ */
+class VsyncFrameScheduler {
+public:
+    static constexpr uint32_t WHEEL_SIZE = 64; // longer delays wait in their slot for more rounds
+
+    /* returns false when the callback is already pending on the same frame */
+    bool Schedule(const std::shared_ptr<VsyncCallback>& callback, const VsyncScheduleOption& option = {});
+    bool HasPending() const { return pendingCount_ > 0; }
+    size_t GetPendingCount() const { return pendingCount_; }
+    void Clear();
+
+    /* moves to the next frame and takes its callbacks in running order */
+    std::vector<ScheduledVsyncCallback> AdvanceFrame();
+    void RecordFrame(const VsyncFrameResult& result);
+    const VsyncFrameStats& GetStats() const { return stats_; }
+
+    /* runs the callbacks of one frame, the caller must not hold its lock */
+    static VsyncFrameResult RunCallbacks(const std::vector<ScheduledVsyncCallback>& callbacks,
+        int64_t timestamp, int64_t frameCount);
+
+private:
+    struct Entry {
+        uint64_t dueFrame = 0;
+        ScheduledVsyncCallback scheduled;
+    };
+
+    std::array<std::vector<Entry>, WHEEL_SIZE> wheel_;
+    uint64_t currentFrame_ = 0;
+    size_t pendingCount_ = 0;
+    VsyncFrameStats stats_;
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_VSYNC_FRAME_SCHEDULER_H
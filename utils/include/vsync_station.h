@@ -17,12 +17,13 @@
 #define OHOS_VSYNC_STATION_H
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <optional>
-#include <unordered_set>
 
 #include <event_handler.h>
 
+#include "vsync_frame_scheduler.h"
 #include "wm_common.h"
 
 namespace OHOS {
@@ -54,6 +55,21 @@ public:
      */
     virtual void RequestVsync(const std::shared_ptr<VsyncCallback>& vsyncCallback);
 
+    /**
+     * @brief Schedule a one-shot callback on a later vsync.
+     *
+     * The callback runs on the option.delayFrames-th vsync from now, ordered by
+     * option.priority among the callbacks of that vsync. Running after
+     * option.deadlineNs counts as a missed deadline in the frame stats.
+     * A vsync is requested on every frame while callbacks are pending, including the
+     * frames before a delayed callback is due.
+     *
+     * @param vsyncCallback Callback to be invoked.
+     * @param option        Delay, priority and deadline of the callback.
+     */
+    virtual void ScheduleVsyncCallback(const std::shared_ptr<VsyncCallback>& vsyncCallback,
+        const VsyncScheduleOption& option);
+
     /**
      * @brief Run a callback once on the next vsync.
      *
@@ -73,7 +89,8 @@ public:
      * is called.
      *
      * For example, a delayVsyncCount of 1 is equivalent to executing the callback
-     * on the next vsync.
+     * on the next vsync. The callback is scheduled once, but a vsync is still
+     * requested on each of the frames before it runs.
      *
      * @param delayVsyncCount Number of vsyncs to wait before executing the callback.
      * @param callback        Callback to be executed after the specified vsync delay.
@@ -111,11 +128,18 @@ public:
     void DecreaseRequestVsyncTimes();
     int32_t GetRequestVsyncTimes() { return requestVsyncTimes_.load(); }
 
+    /**
+     * @brief Get the callback execution time and missed deadlines of the vsyncs so far.
+     */
+    VsyncFrameStats GetFrameStats();
+
 private:
     std::shared_ptr<VSyncReceiver> GetOrCreateVsyncReceiver();
     std::shared_ptr<VSyncReceiver> GetOrCreateVsyncReceiverLocked();
     std::shared_ptr<RSFrameRateLinker> GetFrameRateLinker();
     std::shared_ptr<RSFrameRateLinker> GetFrameRateLinkerLocked();
+    void RequestNextVsyncIfPending();
+    void PostVsyncTimeoutTaskLocked(int64_t delayMs);
     void VsyncCallbackInner(int64_t nanoTimestamp, int64_t frameCount);
     void OnVsyncTimeOut();
 
@@ -128,10 +152,11 @@ private:
     bool isFirstVsyncBack_ = true;
     bool destroyed_ = false;
     bool hasRequestedVsync_ = false;
+    bool isVsyncTimeoutTaskPosted_ = false;
+    std::chrono::steady_clock::time_point vsyncRequestTime_;
     std::shared_ptr<VSyncReceiver> receiver_ = nullptr;
     std::shared_ptr<RSFrameRateLinker> frameRateLinker_ = nullptr;
-    using Callbacks = std::unordered_set<std::shared_ptr<VsyncCallback>>;
-    Callbacks vsyncCallbacks_;
+    VsyncFrameScheduler frameScheduler_;
     std::shared_ptr<FrameRateRange> lastFrameRateRange_ = nullptr;
     int32_t lastAnimatorExpectedFrameRate_ = 0;
     // Above guarded by mutex_
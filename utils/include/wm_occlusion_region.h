@@ -228,8 +228,11 @@ public:
 
     /* core Region logic operation function, the return region's rects is guaranteed no-intersection
         (rect in rects_ do not intersect with each other)
+        result rects are y-x banded: sorted by top then left, rects in one band share top and bottom,
+        vertically adjacent bands with the same spans are merged
     */
     void RegionOp(Region& r1, Region& r2, Region& res, Region::OP op);
+    // segment tree based operation, kept as reference implementation
     void RegionOpLocal(Region& r1, Region& r2, Region& res, Region::OP op);
     // bound of all region rects
     void MakeBound();
@@ -265,6 +268,8 @@ private:
     void UpdateRects(Rects& r, std::vector<Range>& ranges, std::vector<int>& indexAt, Region& res);
     // get ranges from segmentTree node according to logical operation type
     void getRange(std::vector<Range>& ranges, Node& node, OP op);
+    // whether rects are already y-x banded, banded inputs skip normalization
+    static bool IsBanded(const std::vector<Rect>& rects);
 
 private:
     std::vector<Rect> rects_;
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "display_info_shared_memory.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+
+#include <parcel.h>
+
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+namespace {
+constexpr uint32_t SHM_MAGIC = 0x444d4931; // "DMI1"
+constexpr uint32_t SHM_VERSION = 2;
+constexpr uint32_t MAX_READ_RETRY = 64;
+constexpr uint32_t VERSION_SLOT_SHIFT = 32;
+const char* const SHM_NAME = "DisplayInfoShm";
+}
+
+void DisplayInfoShmRecord::CopyFrom(const sptr<DisplayInfo>& info)
+{
+    displayId = info->GetDisplayId();
+    width = info->GetWidth();
+    height = info->GetHeight();
+    physicalWidth = info->GetPhysicalWidth();
+    physicalHeight = info->GetPhysicalHeight();
+    refreshRate = info->GetRefreshRate();
+    virtualPixelRatio = info->GetVirtualPixelRatio();
+    densityInCurResolution = info->GetDensityInCurResolution();
+    defaultVirtualPixelRatio = info->GetDefaultVirtualPixelRatio();
+    xDpi = info->GetXDpi();
+    yDpi = info->GetYDpi();
+    dpi = info->GetDpi();
+    orientation = static_cast<uint32_t>(info->GetOrientation());
+    displayState = static_cast<uint32_t>(info->GetDisplayState());
+    offsetX = info->GetOffsetX();
+    offsetY = info->GetOffsetY();
+    x = info->GetX();
+    y = info->GetY();
+    availableWidth = info->GetAvailableWidth();
+    availableHeight = info->GetAvailableHeight();
+    scaleX = info->GetScaleX();
+    scaleY = info->GetScaleY();
+    pivotX = info->GetPivotX();
+    pivotY = info->GetPivotY();
+    translateX = info->GetTranslateX();
+    translateY = info->GetTranslateY();
+}
+
+sptr<DisplayInfo> DisplayInfoShmRecord::MergeInto(const sptr<DisplayInfo>& base) const
+{
+    sptr<DisplayInfo> info = nullptr;
+    if (base != nullptr) {
+        Parcel parcel;
+        if (base->Marshalling(parcel)) {
+            info = DisplayInfo::Unmarshalling(parcel);
+        }
+    }
+    if (info == nullptr) {
+        return nullptr;
+    }
+    info->SetDisplayId(displayId);
+    info->SetWidth(width);
+    info->SetHeight(height);
+    info->SetPhysicalWidth(physicalWidth);
+    info->SetPhysicalHeight(physicalHeight);
+    info->SetRefreshRate(refreshRate);
+    info->SetVirtualPixelRatio(virtualPixelRatio);
+    info->SetDensityInCurResolution(densityInCurResolution);
+    info->SetDefaultVirtualPixelRatio(defaultVirtualPixelRatio);
+    info->SetXDpi(xDpi);
+    info->SetYDpi(yDpi);
+    info->SetDpi(dpi);
+    info->SetOrientation(static_cast<Orientation>(orientation));
+    info->SetDisplayState(static_cast<DisplayState>(displayState));
+    info->SetOffsetX(offsetX);
+    info->SetOffsetY(offsetY);
+    info->SetX(x);
+    info->SetY(y);
+    info->SetAvailableWidth(availableWidth);
+    info->SetAvailableHeight(availableHeight);
+    info->SetScaleX(scaleX);
+    info->SetScaleY(scaleY);
+    info->SetPivotX(pivotX);
+    info->SetPivotY(pivotY);
+    info->SetTranslateX(translateX);
+    info->SetTranslateY(translateY);
+    return info;
+}
+
+DisplayInfoSharedMemory::~DisplayInfoSharedMemory()
+{
+    layout_ = nullptr;
+    if (ashmem_ != nullptr) {
+        ashmem_->UnmapAshmem();
+        ashmem_->CloseAshmem();
+    }
+}
+
+bool DisplayInfoSharedMemory::Create()
+{
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem(SHM_NAME, sizeof(Layout));
+    if (ashmem == nullptr) {
+        TLOGE(WmsLogTag::DMS, "create ashmem failed");
+        return false;
+    }
+    if (!ashmem->MapReadAndWriteAshmem()) {
+        TLOGE(WmsLogTag::DMS, "map ashmem failed");
+        ashmem->CloseAshmem();
+        return false;
+    }
+    /* ReadFromAshmem hands out the mapped address, the writer keeps its read-write mapping */
+    void* addr = const_cast<void*>(ashmem->ReadFromAshmem(sizeof(Layout), 0));
+    if (!InitLayout(addr, ashmem->GetAshmemSize(), true)) {
+        ashmem->UnmapAshmem();
+        ashmem->CloseAshmem();
+        return false;
+    }
+    /* any mapping created from the fd handed to clients is read-only */
+    if (!ashmem->SetProtection(PROT_READ)) {
+        TLOGE(WmsLogTag::DMS, "set protection failed");
+        layout_ = nullptr;
+        ashmem->UnmapAshmem();
+        ashmem->CloseAshmem();
+        return false;
+    }
+    ashmem_ = ashmem;
+    return true;
+}
+
+bool DisplayInfoSharedMemory::Attach(const sptr<Ashmem>& ashmem)
+{
+    if (ashmem == nullptr) {
+        return false;
+    }
+    if (!ashmem->MapReadOnlyAshmem()) {
+        TLOGE(WmsLogTag::DMS, "map ashmem failed");
+        return false;
+    }
+    const void* addr = ashmem->ReadFromAshmem(sizeof(Layout), 0);
+    if (!InitLayout(const_cast<void*>(addr), ashmem->GetAshmemSize(), false)) {
+        ashmem->UnmapAshmem();
+        return false;
+    }
+    ashmem_ = ashmem;
+    return true;
+}
+
+bool DisplayInfoSharedMemory::InitLayout(void* addr, size_t size, bool writable)
+{
+    if (addr == nullptr || size < sizeof(Layout)) {
+        TLOGE(WmsLogTag::DMS, "invalid region, size: %{public}zu", size);
+        return false;
+    }
+    Layout* layout = static_cast<Layout*>(addr);
+    if (writable) {
+        /* ashmem pages are zero filled, which is a valid empty layout */
+        layout->version = SHM_VERSION;
+        layout->magic = SHM_MAGIC;
+        for (auto& slot : layout->slots) {
+            slot.record.displayId = DISPLAY_ID_INVALID;
+        }
+    } else if (layout->magic != SHM_MAGIC || layout->version != SHM_VERSION) {
+        TLOGE(WmsLogTag::DMS, "layout mismatch, magic: %{public}x version: %{public}u",
+            layout->magic, layout->version);
+        return false;
+    }
+    layout_ = layout;
+    writable_ = writable;
+    return true;
+}
+
+void DisplayInfoSharedMemory::WriteSlot(Slot& slot, const DisplayInfoShmRecord& record)
+{
+    uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = record;
+    slot.seq.store(seq + 2, std::memory_order_release);
+}
+
+/* serialized DisplayInfo with the mirrored fields reset, equal data means no unmirrored field changed */
+std::string DisplayInfoSharedMemory::GetUnmirroredData(const sptr<DisplayInfo>& info)
+{
+    sptr<DisplayInfo> unmirroredInfo = DisplayInfoShmRecord().MergeInto(info);
+    Parcel parcel;
+    if (unmirroredInfo == nullptr || !unmirroredInfo->Marshalling(parcel)) {
+        return "";
+    }
+    return std::string(reinterpret_cast<const char*>(parcel.GetData()), parcel.GetDataSize());
+}
+
+void DisplayInfoSharedMemory::Publish(const sptr<DisplayInfo>& info)
+{
+    if (info == nullptr || layout_ == nullptr || !writable_) {
+        return;
+    }
+    DisplayInfoShmRecord record;
+    record.CopyFrom(info);
+    std::string unmirroredData = GetUnmirroredData(info);
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    uint32_t index = 0;
+    auto iter = slotIndexMap_.find(record.displayId);
+    if (iter != slotIndexMap_.end()) {
+        index = iter->second;
+    } else {
+        while (index < MAX_SLOT_COUNT && layout_->slots[index].record.displayId != DISPLAY_ID_INVALID) {
+            index++;
+        }
+        if (index == MAX_SLOT_COUNT) {
+            TLOGW(WmsLogTag::DMS, "no free slot for display: %{public}" PRIu64, record.displayId);
+            return;
+        }
+        slotIndexMap_[record.displayId] = index;
+    }
+    UnmirroredState& state = unmirroredStateMap_[record.displayId];
+    /* data that failed to serialize is treated as changed every time */
+    if (state.generation == 0 || unmirroredData.empty() || unmirroredData != state.data) {
+        state.data = std::move(unmirroredData);
+        state.generation = ++unmirroredGeneration_;
+    }
+    record.unmirroredGeneration = state.generation;
+    WriteSlot(layout_->slots[index], record);
+}
+
+void DisplayInfoSharedMemory::Remove(DisplayId displayId)
+{
+    if (layout_ == nullptr || !writable_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    auto iter = slotIndexMap_.find(displayId);
+    if (iter == slotIndexMap_.end()) {
+        return;
+    }
+    WriteSlot(layout_->slots[iter->second], DisplayInfoShmRecord());
+    slotIndexMap_.erase(iter);
+    unmirroredStateMap_.erase(displayId);
+}
+
+void DisplayInfoSharedMemory::SetBypassUids(const std::set<int32_t>& uids)
+{
+    if (layout_ == nullptr || !writable_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    bypassOverflow_ = uids.size() > MAX_BYPASS_UID_COUNT;
+    if (bypassOverflow_) {
+        TLOGW(WmsLogTag::DMS, "too many bypass uids: %{public}zu", uids.size());
+    }
+    uint32_t seq = layout_->bypassSeq.load(std::memory_order_relaxed);
+    layout_->bypassSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    uint32_t count = 0;
+    for (auto iter = uids.begin(); iter != uids.end() && count < MAX_BYPASS_UID_COUNT; ++iter) {
+        layout_->bypassUids[count++].store(*iter, std::memory_order_relaxed);
+    }
+    layout_->bypassUidCount.store(count, std::memory_order_relaxed);
+    layout_->bypassAll.store((bypassAllRequested_ || bypassOverflow_) ? 1 : 0, std::memory_order_relaxed);
+    layout_->bypassSeq.store(seq + 2, std::memory_order_release);
+}
+
+void DisplayInfoSharedMemory::SetBypassAll(bool bypassAll)
+{
+    if (layout_ == nullptr || !writable_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    bypassAllRequested_ = bypassAll;
+    layout_->bypassAll.store((bypassAllRequested_ || bypassOverflow_) ? 1 : 0, std::memory_order_release);
+}
+
+bool DisplayInfoSharedMemory::IsBypassed(int32_t uid) const
+{
+    if (layout_ == nullptr) {
+        return true;
+    }
+    for (uint32_t retry = 0; retry < MAX_READ_RETRY; retry++) {
+        uint32_t begin = layout_->bypassSeq.load(std::memory_order_acquire);
+        if ((begin & 1) != 0) {
+            continue;
+        }
+        bool bypassed = layout_->bypassAll.load(std::memory_order_relaxed) != 0;
+        uint32_t count = std::min(layout_->bypassUidCount.load(std::memory_order_relaxed), MAX_BYPASS_UID_COUNT);
+        for (uint32_t i = 0; i < count && !bypassed; i++) {
+            bypassed = layout_->bypassUids[i].load(std::memory_order_relaxed) == uid;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (layout_->bypassSeq.load(std::memory_order_relaxed) == begin) {
+            return bypassed;
+        }
+    }
+    return true;
+}
+
+bool DisplayInfoSharedMemory::Read(DisplayId displayId, DisplayInfoShmRecord& record, uint64_t& version) const
+{
+    if (layout_ == nullptr || displayId == DISPLAY_ID_INVALID) {
+        return false;
+    }
+    for (uint32_t index = 0; index < MAX_SLOT_COUNT; index++) {
+        const Slot& slot = layout_->slots[index];
+        for (uint32_t retry = 0; retry < MAX_READ_RETRY; retry++) {
+            uint32_t begin = slot.seq.load(std::memory_order_acquire);
+            if ((begin & 1) != 0) {
+                continue;
+            }
+            DisplayInfoShmRecord copy = slot.record;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != begin) {
+                continue;
+            }
+            if (copy.displayId != displayId) {
+                break;
+            }
+            record = copy;
+            version = (static_cast<uint64_t>(index) << VERSION_SLOT_SHIFT) | begin;
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace OHOS::Rosen
@@ -19,9 +19,11 @@
 
 namespace OHOS::Rosen {
 
-FfrtSerialQueueHelper::FfrtSerialQueueHelper()
+FfrtSerialQueueHelper::FfrtSerialQueueHelper() : FfrtSerialQueueHelper("FfrtSerialQueueHelper") {}
+
+FfrtSerialQueueHelper::FfrtSerialQueueHelper(const std::string& name)
 {
-    ffrtQueue_ = std::make_unique<ffrt::queue>(ffrt::queue_serial, "FfrtSerialQueueHelper",
+    ffrtQueue_ = std::make_unique<ffrt::queue>(ffrt::queue_serial, name.c_str(),
         ffrt::queue_attr().qos(ffrt_qos_user_interactive));
 }
 
@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -20,6 +21,18 @@
 namespace OHOS {
 namespace Rosen {
 const std::unordered_set<WmsLogTag> TAG_WHITE_LIST = {WmsLogTag::WMS_LAYOUT};
+namespace {
+constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+constexpr uint32_t HASH_SHIFT = 32;
+
+uint64_t GetNowMs()
+{
+    static const auto baseTime = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - baseTime).count());
+}
+} // namespace
+
 RateLimitedLogger& RateLimitedLogger::getInstance()
 {
     static RateLimitedLogger instance_;
@@ -34,13 +47,112 @@ bool RateLimitedLogger::logFunction(const std::uintptr_t& functionAddress, uint3
     }
 
     // Disable log rate limiting, always print logs
-    if (!enabled_) {
+    if (!enabled_.load(std::memory_order_relaxed)) {
         return true;
     }
 
+    RecordSlot* slot = FindOrInsertSlot(functionAddress, true);
+    if (slot != nullptr) {
+        return LogFunctionInSlot(*slot, timeWindowMs, maxCount);
+    }
+    return LogFunctionLocked(functionAddress, timeWindowMs, maxCount);
+}
+
+RateLimitedLogger::RecordSlot* RateLimitedLogger::FindOrInsertSlot(std::uintptr_t key, bool insert)
+{
+    // EMPTY_KEY marks a free slot, the one call site packing to it shares a record with its neighbour
+    if (key == EMPTY_KEY) {
+        key--;
+    }
+    uint32_t index = static_cast<uint32_t>((static_cast<uint64_t>(key) * HASH_MULTIPLIER) >> HASH_SHIFT);
+    uint64_t now = insert ? GetNowMs() : 0;
+    RecordSlot* freeSlot = nullptr;
+    std::uintptr_t freeSlotKey = EMPTY_KEY;
+    for (uint32_t probe = 0; probe < MAX_PROBE_COUNT; probe++) {
+        RecordSlot& slot = recordSlots_[(index + probe) & (SLOT_COUNT - 1)];
+        std::uintptr_t slotKey = slot.key.load(std::memory_order_acquire);
+        if (slotKey == key) {
+            return &slot;
+        }
+        if (slotKey == EMPTY_KEY) {
+            // slots are only emptied by clear, so no key lives past an empty slot
+            if (freeSlot == nullptr) {
+                freeSlot = &slot;
+                freeSlotKey = EMPTY_KEY;
+            }
+            break;
+        }
+        if (insert && freeSlot == nullptr && IsSlotExpired(slot, now)) {
+            freeSlot = &slot;
+            freeSlotKey = slotKey;
+        }
+    }
+    if (!insert || freeSlot == nullptr) {
+        return nullptr;
+    }
+    std::uintptr_t expectedKey = freeSlotKey;
+    if (freeSlot->key.compare_exchange_strong(expectedKey, key, std::memory_order_acq_rel)) {
+        if (freeSlotKey != EMPTY_KEY) {
+            // a caller still holding the slot for the old key may count once more, harmless for a log limiter
+            freeSlot->state.store(0, std::memory_order_relaxed);
+        }
+        return freeSlot;
+    }
+    return expectedKey == key ? freeSlot : nullptr;
+}
+
+bool RateLimitedLogger::IsSlotExpired(const RecordSlot& slot, uint64_t now)
+{
+    uint64_t state = slot.state.load(std::memory_order_relaxed);
+    uint64_t startTime = state >> COUNT_BITS;
+    // a zero state belongs to a slot that was just taken and has not counted yet
+    return state != 0 && now >= startTime &&
+        now - startTime >= slot.timeWindowMs.load(std::memory_order_relaxed);
+}
+
+bool RateLimitedLogger::LogFunctionInSlot(RecordSlot& slot, uint32_t timeWindowMs, uint32_t maxCount)
+{
+    uint64_t now = GetNowMs();
+    uint64_t state = slot.state.load(std::memory_order_relaxed);
+    while (true) {
+        uint64_t count = state & COUNT_MASK;
+        uint64_t startTime = state >> COUNT_BITS;
+        uint64_t newState = 0;
+        if (count == 0 || now < startTime || now - startTime >= timeWindowMs) {
+            slot.timeWindowMs.store(timeWindowMs, std::memory_order_relaxed);
+            newState = (now << COUNT_BITS) | 1;
+        } else if (count >= maxCount) {
+            return false;
+        } else if (count == COUNT_MASK) {
+            return true;
+        } else {
+            newState = state + 1;
+        }
+        if (slot.state.compare_exchange_weak(state, newState, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+bool RateLimitedLogger::LogFunctionLocked(std::uintptr_t functionAddress, uint32_t timeWindowMs, uint32_t maxCount)
+{
     std::lock_guard<std::mutex> lock(functionRecordsMutex_);
     auto now = std::chrono::steady_clock::now();
 
+    // Drop expired records before the map grows further, keys of destroyed windows are never looked up again
+    if (functionRecords_.size() >= functionRecordsPruneSize_ &&
+        functionRecords_.find(functionAddress) == functionRecords_.end()) {
+        for (auto iter = functionRecords_.begin(); iter != functionRecords_.end();) {
+            if (std::chrono::duration_cast<std::chrono::milliseconds>(now - iter->second.startTime).count() >=
+                iter->second.timeWindowMs) {
+                iter = functionRecords_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        functionRecordsPruneSize_ = std::max<size_t>(SLOT_COUNT, functionRecords_.size() * 2);
+    }
+
     // Find or create function record
     auto& record = functionRecords_[functionAddress];
     
@@ -49,6 +161,7 @@ bool RateLimitedLogger::logFunction(const std::uintptr_t& functionAddress, uint3
         std::chrono::duration_cast<std::chrono::milliseconds>(now - record.startTime).count() >= timeWindowMs) {
         record.count = 0;
         record.startTime = now;
+        record.timeWindowMs = timeWindowMs;
     }
 
     // Check if within limit
@@ -62,17 +175,26 @@ bool RateLimitedLogger::logFunction(const std::uintptr_t& functionAddress, uint3
 
 void RateLimitedLogger::clear()
 {
+    for (auto& slot : recordSlots_) {
+        slot.state.store(0, std::memory_order_relaxed);
+        slot.timeWindowMs.store(0, std::memory_order_relaxed);
+        slot.key.store(EMPTY_KEY, std::memory_order_release);
+    }
     std::lock_guard<std::mutex> lock(functionRecordsMutex_);
     functionRecords_.clear();
+    functionRecordsPruneSize_ = SLOT_COUNT;
 }
 
 void RateLimitedLogger::setEnabled(bool enabled)
 {
-    enabled_ = enabled;
+    enabled_.store(enabled, std::memory_order_relaxed);
 }
 
 int32_t RateLimitedLogger::getCurrentCount(const std::uintptr_t& functionAddress)
 {
+    if (RecordSlot* slot = FindOrInsertSlot(functionAddress, false)) {
+        return static_cast<int32_t>(slot->state.load(std::memory_order_relaxed) & COUNT_MASK);
+    }
     std::lock_guard<std::mutex> lock(functionRecordsMutex_);
     auto it = functionRecords_.find(functionAddress);
     return (it != functionRecords_.end()) ? it->second.count : 0;
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vsync_frame_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <sstream>
+
+namespace OHOS {
+namespace Rosen {
+std::string VsyncFrameStats::ToString() const
+{
+    std::ostringstream oss;
+    oss << "frames:" << frameCount << " callbacks:" << callbackCount << " missedDeadline:" << missedDeadlineCount
+        << " lastUs:" << lastFrameExecutionUs << " maxUs:" << maxFrameExecutionUs
+        << " avgUs:" << (frameCount == 0 ? 0 : totalExecutionUs / static_cast<int64_t>(frameCount));
+    return oss.str();
+}
+
+bool VsyncFrameScheduler::Schedule(const std::shared_ptr<VsyncCallback>& callback, const VsyncScheduleOption& option)
+{
+    if (callback == nullptr) {
+        return false;
+    }
+    uint64_t dueFrame = currentFrame_ + std::max<uint32_t>(option.delayFrames, 1);
+    auto& slot = wheel_[dueFrame % WHEEL_SIZE];
+    if (std::any_of(slot.begin(), slot.end(), [&callback, dueFrame](const Entry& entry) {
+        return entry.dueFrame == dueFrame && entry.scheduled.callback == callback;
+    })) {
+        return false;
+    }
+    slot.push_back({ dueFrame, { callback, option.priority, option.deadlineNs } });
+    pendingCount_++;
+    return true;
+}
+
+void VsyncFrameScheduler::Clear()
+{
+    for (auto& slot : wheel_) {
+        slot.clear();
+    }
+    pendingCount_ = 0;
+}
+
+std::vector<ScheduledVsyncCallback> VsyncFrameScheduler::AdvanceFrame()
+{
+    currentFrame_++;
+    std::vector<ScheduledVsyncCallback> dueCallbacks;
+    if (pendingCount_ == 0) {
+        return dueCallbacks;
+    }
+    auto& slot = wheel_[currentFrame_ % WHEEL_SIZE];
+    auto notDueIter = std::stable_partition(slot.begin(), slot.end(),
+        [this](const Entry& entry) { return entry.dueFrame == currentFrame_; });
+    dueCallbacks.reserve(std::distance(slot.begin(), notDueIter));
+    for (auto iter = slot.begin(); iter != notDueIter; ++iter) {
+        dueCallbacks.push_back(std::move(iter->scheduled));
+    }
+    slot.erase(slot.begin(), notDueIter);
+    pendingCount_ -= dueCallbacks.size();
+    std::stable_sort(dueCallbacks.begin(), dueCallbacks.end(),
+        [](const ScheduledVsyncCallback& lhs, const ScheduledVsyncCallback& rhs) {
+            return lhs.priority < rhs.priority;
+        });
+    return dueCallbacks;
+}
+
+void VsyncFrameScheduler::RecordFrame(const VsyncFrameResult& result)
+{
+    if (result.callbackCount == 0) {
+        return;
+    }
+    stats_.frameCount++;
+    stats_.callbackCount += result.callbackCount;
+    stats_.missedDeadlineCount += result.missedDeadlineCount;
+    stats_.lastFrameExecutionUs = result.executionUs;
+    stats_.maxFrameExecutionUs = std::max(stats_.maxFrameExecutionUs, result.executionUs);
+    stats_.totalExecutionUs += result.executionUs;
+}
+
+VsyncFrameResult VsyncFrameScheduler::RunCallbacks(const std::vector<ScheduledVsyncCallback>& callbacks,
+    int64_t timestamp, int64_t frameCount)
+{
+    VsyncFrameResult result;
+    auto startTime = std::chrono::steady_clock::now();
+    for (const auto& scheduled : callbacks) {
+        if (scheduled.callback == nullptr || !scheduled.callback->onCallback) {
+            continue;
+        }
+        if (scheduled.deadlineNs > 0 && timestamp > scheduled.deadlineNs) {
+            result.missedDeadlineCount++;
+        }
+        scheduled.callback->onCallback(timestamp, frameCount);
+        result.callbackCount++;
+    }
+    result.executionUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    return result;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -115,22 +115,40 @@ std::shared_ptr<VSyncReceiver> VsyncStation::GetOrCreateVsyncReceiverLocked()
 // LCOV_EXCL_START
 void VsyncStation::RequestVsync(const std::shared_ptr<VsyncCallback>& vsyncCallback)
 {
-    std::shared_ptr<VSyncReceiver> receiver;
+    ScheduleVsyncCallback(vsyncCallback, {});
+}
+
+void VsyncStation::ScheduleVsyncCallback(const std::shared_ptr<VsyncCallback>& vsyncCallback,
+    const VsyncScheduleOption& option)
+{
     {
         std::lock_guard<std::mutex> lock(mutex_);
         // check if receiver is ready
-        receiver = GetOrCreateVsyncReceiverLocked();
-        if (receiver == nullptr) {
+        if (GetOrCreateVsyncReceiverLocked() == nullptr) {
             return;
         }
+        frameScheduler_.Schedule(vsyncCallback, option);
+    }
+    RequestNextVsyncIfPending();
+}
 
-        vsyncCallbacks_.insert(vsyncCallback);
-
+void VsyncStation::RequestNextVsyncIfPending()
+{
+    std::shared_ptr<VSyncReceiver> receiver;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!frameScheduler_.HasPending()) {
+            return;
+        }
         // if Vsync has been requested, just wait callback or timeout
         if (hasRequestedVsync_) {
             TLOGD(WmsLogTag::WMS_MAIN, "Vsync has requested, nodeId: %{public}" PRIu64, nodeId_);
             return;
         }
+        receiver = GetOrCreateVsyncReceiverLocked();
+        if (receiver == nullptr) {
+            return;
+        }
         hasRequestedVsync_ = true;
 
         if (isFirstVsyncRequest_) {
@@ -138,14 +156,11 @@ void VsyncStation::RequestVsync(const std::shared_ptr<VsyncCallback>& vsyncCallb
             TLOGI(WmsLogTag::WMS_MAIN, "First vsync has requested, nodeId: %{public}" PRIu64, nodeId_);
         }
 
-        // post timeout task for a new vsync
-        vsyncHandler_->RemoveTask(vsyncTimeoutTaskName_);
-        auto task = [weakThis = weak_from_this()] {
-            if (auto sp = weakThis.lock()) {
-                sp->OnVsyncTimeOut();
-            }
-        };
-        vsyncHandler_->PostTask(task, vsyncTimeoutTaskName_, VSYNC_TIME_OUT_MILLISECONDS);
+        // a posted timeout task re-arms itself for the latest request
+        vsyncRequestTime_ = std::chrono::steady_clock::now();
+        if (!isVsyncTimeoutTaskPosted_) {
+            PostVsyncTimeoutTaskLocked(VSYNC_TIME_OUT_MILLISECONDS);
+        }
     }
 
     requestVsyncTimes_++;
@@ -181,24 +196,10 @@ void VsyncStation::RunOnceAfterNVsyncs(uint32_t delayVsyncCount, OnCallback&& ca
     }
 
     auto vsyncCallback = std::make_shared<VsyncCallback>();
-    std::weak_ptr<VsyncCallback> weakVsyncCallback = vsyncCallback;
-    auto remaining = std::make_shared<uint32_t>(delayVsyncCount);
-    vsyncCallback->onCallback = [weakThis = weak_from_this(),
-                                 callback = std::move(callback),
-                                 weakVsyncCallback,
-                                 remaining](int64_t timestamp, int64_t frameCount) mutable {
-        if (--(*remaining) == 0) {
-            callback(timestamp, frameCount);
-            return;
-        }
-        // Re-register the callback for the next vsync
-        auto vsyncStation = weakThis.lock();
-        auto vsyncCallback = weakVsyncCallback.lock();
-        if (vsyncStation && vsyncCallback) {
-            vsyncStation->RequestVsync(vsyncCallback);
-        }
-    };
-    RequestVsync(vsyncCallback);
+    vsyncCallback->onCallback = std::move(callback);
+    VsyncScheduleOption option;
+    option.delayFrames = delayVsyncCount;
+    ScheduleVsyncCallback(vsyncCallback, option);
 }
 
 int64_t VsyncStation::GetVSyncPeriod()
@@ -225,39 +226,68 @@ void VsyncStation::RemoveCallback()
 {
     TLOGI(WmsLogTag::WMS_MAIN, "in");
     std::lock_guard<std::mutex> lock(mutex_);
-    vsyncCallbacks_.clear();
+    frameScheduler_.Clear();
 }
 
 void VsyncStation::VsyncCallbackInner(int64_t timestamp, int64_t frameCount)
 {
     HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER,
         "OnVsyncCallback %" PRId64 ":%" PRId64, timestamp, frameCount);
-    Callbacks vsyncCallbacks;
+    std::vector<ScheduledVsyncCallback> dueCallbacks;
     {
         std::lock_guard<std::mutex> lock(mutex_);
         hasRequestedVsync_ = false;
-        vsyncCallbacks = std::move(vsyncCallbacks_);
-        vsyncCallbacks_.clear();
-        vsyncHandler_->RemoveTask(vsyncTimeoutTaskName_);
+        dueCallbacks = frameScheduler_.AdvanceFrame();
         if (isFirstVsyncBack_) {
             isFirstVsyncBack_ = false;
             TLOGI(WmsLogTag::WMS_MAIN, "First vsync has come back, nodeId: %{public}" PRIu64, nodeId_);
         }
     }
-    for (const auto& callback : vsyncCallbacks) {
-        if (callback && callback->onCallback) {
-            callback->onCallback(timestamp, frameCount);
-        }
+    auto result = VsyncFrameScheduler::RunCallbacks(dueCallbacks, timestamp, frameCount);
+    if (result.missedDeadlineCount > 0) {
+        TLOGD(WmsLogTag::WMS_MAIN, "nodeId: %{public}" PRIu64 ", missed %{public}u of %{public}u, cost %{public}"
+            PRId64 "us", nodeId_, result.missedDeadlineCount, result.callbackCount, result.executionUs);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frameScheduler_.RecordFrame(result);
     }
+    RequestNextVsyncIfPending();
+}
+
+void VsyncStation::PostVsyncTimeoutTaskLocked(int64_t delayMs)
+{
+    auto task = [weakThis = weak_from_this()] {
+        if (auto sp = weakThis.lock()) {
+            sp->OnVsyncTimeOut();
+        }
+    };
+    isVsyncTimeoutTaskPosted_ = vsyncHandler_->PostTask(task, vsyncTimeoutTaskName_, delayMs);
 }
 
 void VsyncStation::OnVsyncTimeOut()
 {
-    TLOGW(WmsLogTag::WMS_MAIN, "in");
     std::lock_guard<std::mutex> lock(mutex_);
+    isVsyncTimeoutTaskPosted_ = false;
+    if (!hasRequestedVsync_) {
+        return;
+    }
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - vsyncRequestTime_).count();
+    if (elapsedMs < VSYNC_TIME_OUT_MILLISECONDS) {
+        PostVsyncTimeoutTaskLocked(VSYNC_TIME_OUT_MILLISECONDS - elapsedMs);
+        return;
+    }
+    TLOGW(WmsLogTag::WMS_MAIN, "in");
     hasRequestedVsync_ = false;
 }
 
+VsyncFrameStats VsyncStation::GetFrameStats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frameScheduler_.GetStats();
+}
+
 std::shared_ptr<RSFrameRateLinker> VsyncStation::GetFrameRateLinker()
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -15,10 +15,207 @@
 
 #include "wm_occlusion_region.h"
 
+#include <climits>
+#include <cstdint>
 #include <map>
 #include <set>
 
 namespace OHOS::Rosen::WmOcclusion {
+namespace {
+constexpr int LHS_ONLY = 1;
+constexpr int LHS_AND_RHS = 2;
+constexpr int RHS_ONLY = 4;
+
+/* scratch buffers reused by every region operation on the same thread */
+struct RegionArena {
+    std::vector<Rect> lhs;
+    std::vector<Rect> rhs;
+    std::vector<Rect> out;
+    std::vector<Rect> sorted;
+    std::vector<Rect> active;
+    std::vector<Rect> band;
+    std::vector<int> ys;
+};
+
+RegionArena& GetRegionArena()
+{
+    thread_local RegionArena arena;
+    return arena;
+}
+
+size_t GetBandEnd(const std::vector<Rect>& rects, size_t bandStart)
+{
+    size_t bandEnd = bandStart + 1;
+    while (bandEnd < rects.size() && rects[bandEnd].top_ == rects[bandStart].top_) {
+        bandEnd++;
+    }
+    return bandEnd;
+}
+
+int GetSpanBoundary(const Rect* spans, size_t count, size_t index)
+{
+    if (index >= count * 2) { // 2: left and right boundary of each span
+        return INT_MAX;
+    }
+    const Rect& span = spans[index / 2]; // 2: left and right boundary of each span
+    return (index & 1) ? span.right_ : span.left_;
+}
+
+/*
+ * Append band [top, bottom) combining lhs and rhs spans by op, spans of each side are sorted
+ * and do not overlap. The band is merged into the previous one if they touch and have same spans.
+ */
+void AppendBand(std::vector<Rect>& out, size_t& prevBandStart, int top, int bottom,
+    const Rect* lhs, size_t lhsCount, const Rect* rhs, size_t rhsCount, int op)
+{
+    if (top >= bottom) {
+        return;
+    }
+    size_t bandStart = out.size();
+    size_t lhsIndex = 0;
+    size_t rhsIndex = 0;
+    bool inLhs = false;
+    bool inRhs = false;
+    bool covered = false;
+    int spanLeft = 0;
+    while (lhsIndex < lhsCount * 2 || rhsIndex < rhsCount * 2) { // 2: left and right boundary of each span
+        int x = std::min(GetSpanBoundary(lhs, lhsCount, lhsIndex), GetSpanBoundary(rhs, rhsCount, rhsIndex));
+        while (lhsIndex < lhsCount * 2 && GetSpanBoundary(lhs, lhsCount, lhsIndex) == x) { // 2: boundaries
+            inLhs = !inLhs;
+            lhsIndex++;
+        }
+        while (rhsIndex < rhsCount * 2 && GetSpanBoundary(rhs, rhsCount, rhsIndex) == x) { // 2: boundaries
+            inRhs = !inRhs;
+            rhsIndex++;
+        }
+        int part = inLhs ? (inRhs ? LHS_AND_RHS : LHS_ONLY) : (inRhs ? RHS_ONLY : 0);
+        bool nowCovered = (op & part) != 0;
+        if (nowCovered && !covered) {
+            spanLeft = x;
+        } else if (!nowCovered && covered) {
+            out.emplace_back(spanLeft, top, x, bottom);
+        }
+        covered = nowCovered;
+    }
+
+    size_t bandSize = out.size() - bandStart;
+    if (bandSize == 0) {
+        return;
+    }
+    if (prevBandStart < bandStart && bandStart - prevBandStart == bandSize && out[prevBandStart].bottom_ == top &&
+        std::equal(out.begin() + prevBandStart, out.begin() + bandStart, out.begin() + bandStart,
+            [](const Rect& r1, const Rect& r2) { return r1.left_ == r2.left_ && r1.right_ == r2.right_; })) {
+        for (size_t i = prevBandStart; i < bandStart; i++) {
+            out[i].bottom_ = bottom;
+        }
+        out.resize(bandStart);
+        return;
+    }
+    prevBandStart = bandStart;
+}
+
+/*
+ * Convert arbitrary, possibly overlapping rects to banded form. Sweeps down the y boundaries
+ * keeping the rects crossing the current band sorted by left.
+ */
+void MakeBanded(const std::vector<Rect>& rects, RegionArena& arena, std::vector<Rect>& out)
+{
+    out.clear();
+    arena.ys.clear();
+    arena.sorted.clear();
+    arena.active.clear();
+    for (const auto& rect : rects) {
+        if (rect.IsEmpty()) {
+            continue;
+        }
+        arena.sorted.push_back(rect);
+        arena.ys.push_back(rect.top_);
+        arena.ys.push_back(rect.bottom_);
+    }
+    std::sort(arena.ys.begin(), arena.ys.end());
+    arena.ys.erase(std::unique(arena.ys.begin(), arena.ys.end()), arena.ys.end());
+    std::sort(arena.sorted.begin(), arena.sorted.end(),
+        [](const Rect& r1, const Rect& r2) { return r1.top_ < r2.top_; });
+    auto byLeft = [](const Rect& r1, const Rect& r2) { return r1.left_ < r2.left_; };
+    size_t nextRect = 0;
+    size_t prevBandStart = SIZE_MAX;
+    for (size_t i = 0; i + 1 < arena.ys.size(); i++) {
+        int top = arena.ys[i];
+        int bottom = arena.ys[i + 1];
+        arena.active.erase(std::remove_if(arena.active.begin(), arena.active.end(),
+            [top](const Rect& rect) { return rect.bottom_ <= top; }), arena.active.end());
+        for (; nextRect < arena.sorted.size() && arena.sorted[nextRect].top_ == top; nextRect++) {
+            const Rect& rect = arena.sorted[nextRect];
+            arena.active.insert(std::upper_bound(arena.active.begin(), arena.active.end(), rect, byLeft), rect);
+        }
+        // every y boundary is in ys, so each active rect covers the whole band
+        arena.band.clear();
+        for (const auto& rect : arena.active) {
+            if (!arena.band.empty() && rect.left_ <= arena.band.back().right_) {
+                arena.band.back().right_ = std::max(arena.band.back().right_, rect.right_);
+            } else {
+                arena.band.emplace_back(rect.left_, top, rect.right_, bottom);
+            }
+        }
+        AppendBand(out, prevBandStart, top, bottom, arena.band.data(), arena.band.size(), nullptr, 0, LHS_ONLY);
+    }
+}
+
+/* merge two banded rect lists band by band */
+void BandedOp(const std::vector<Rect>& lhs, const std::vector<Rect>& rhs, int op, std::vector<Rect>& out)
+{
+    out.clear();
+    size_t prevBandStart = SIZE_MAX;
+    size_t lhsIndex = 0;
+    size_t rhsIndex = 0;
+    int ybot = INT_MIN;
+    while (lhsIndex < lhs.size() && rhsIndex < rhs.size()) {
+        size_t lhsEnd = GetBandEnd(lhs, lhsIndex);
+        size_t rhsEnd = GetBandEnd(rhs, rhsIndex);
+        const Rect& lhsBand = lhs[lhsIndex];
+        const Rect& rhsBand = rhs[rhsIndex];
+        int lhsTop = std::max(lhsBand.top_, ybot);
+        int rhsTop = std::max(rhsBand.top_, ybot);
+        int ytop = lhsTop;
+        if (lhsTop < rhsTop) {
+            if (op & LHS_ONLY) {
+                AppendBand(out, prevBandStart, lhsTop, std::min(lhsBand.bottom_, rhsTop),
+                    &lhsBand, lhsEnd - lhsIndex, nullptr, 0, op);
+            }
+            ytop = rhsTop;
+        } else if (rhsTop < lhsTop) {
+            if (op & RHS_ONLY) {
+                AppendBand(out, prevBandStart, rhsTop, std::min(rhsBand.bottom_, lhsTop),
+                    nullptr, 0, &rhsBand, rhsEnd - rhsIndex, op);
+            }
+        }
+        ybot = std::min(lhsBand.bottom_, rhsBand.bottom_);
+        if (ybot > ytop) {
+            AppendBand(out, prevBandStart, ytop, ybot,
+                &lhsBand, lhsEnd - lhsIndex, &rhsBand, rhsEnd - rhsIndex, op);
+        }
+        if (lhsBand.bottom_ == ybot) {
+            lhsIndex = lhsEnd;
+        }
+        if (rhsBand.bottom_ == ybot) {
+            rhsIndex = rhsEnd;
+        }
+    }
+    while ((op & LHS_ONLY) && lhsIndex < lhs.size()) {
+        size_t lhsEnd = GetBandEnd(lhs, lhsIndex);
+        AppendBand(out, prevBandStart, std::max(lhs[lhsIndex].top_, ybot), lhs[lhsIndex].bottom_,
+            &lhs[lhsIndex], lhsEnd - lhsIndex, nullptr, 0, op);
+        lhsIndex = lhsEnd;
+    }
+    while ((op & RHS_ONLY) && rhsIndex < rhs.size()) {
+        size_t rhsEnd = GetBandEnd(rhs, rhsIndex);
+        AppendBand(out, prevBandStart, std::max(rhs[rhsIndex].top_, ybot), rhs[rhsIndex].bottom_,
+            nullptr, 0, &rhs[rhsIndex], rhsEnd - rhsIndex, op);
+        rhsIndex = rhsEnd;
+    }
+}
+} // namespace
+
 static Rect _s_empty_rect_ { 0, 0, 0, 0 };
 static Rect _s_invalid_rect_ { 0, 0, -1, -1 };
 bool Region::_s_so_loaded_ = false;
@@ -262,15 +459,50 @@ void Region::RegionOpLocal(Region& r1, Region& r2, Region& res, Region::OP op)
     res.MakeBound();
 }
 
+bool Region::IsBanded(const std::vector<Rect>& rects)
+{
+    for (size_t i = 0; i < rects.size(); i++) {
+        const Rect& rect = rects[i];
+        if (rect.IsEmpty()) {
+            return false;
+        }
+        if (i == 0) {
+            continue;
+        }
+        const Rect& prev = rects[i - 1];
+        bool sameBand = rect.top_ == prev.top_ && rect.bottom_ == prev.bottom_ && rect.left_ >= prev.right_;
+        bool nextBand = rect.top_ >= prev.bottom_;
+        if (!sameBand && !nextBand) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Region::RegionOp(Region& r1, Region& r2, Region& res, Region::OP op)
 {
-    RegionOpLocal(r1, r2, res, op);
+    r1.MakeBound();
+    r2.MakeBound();
+    auto& arena = GetRegionArena();
+    const std::vector<Rect>* lhs = &r1.rects_;
+    if (!IsBanded(r1.rects_)) {
+        MakeBanded(r1.rects_, arena, arena.lhs);
+        lhs = &arena.lhs;
+    }
+    const std::vector<Rect>* rhs = &r2.rects_;
+    if (!IsBanded(r2.rects_)) {
+        MakeBanded(r2.rects_, arena, arena.rhs);
+        rhs = &arena.rhs;
+    }
+    /* build into the arena first, res may alias r1 or r2 */
+    BandedOp(*lhs, *rhs, static_cast<int>(op), arena.out);
+    res.rects_.assign(arena.out.begin(), arena.out.end());
+    res.MakeBound();
 }
 
 Region& Region::OperationSelf(Region& r, Region::OP op)
 {
-    Region r1(*this);
-    RegionOp(r1, r, *this, op);
+    RegionOp(*this, r, *this, op);
     return *this;
 }
 
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "client_agent_dispatcher.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+class TestAgent : public RefBase {
+public:
+    sptr<IRemoteObject> AsObject() { return nullptr; }
+    std::vector<std::string> received;
+};
+
+class AppendNotification : public ClientAgentNotification<TestAgent> {
+public:
+    AppendNotification(uint32_t coalesceKey, const std::string& value)
+        : ClientAgentNotification<TestAgent>(coalesceKey), value_(value) {}
+
+    void Notify(const sptr<TestAgent>& agent) override { agent->received.push_back(value_); }
+
+    std::shared_ptr<ClientAgentNotification<TestAgent>> CoalesceWith(
+        const ClientAgentNotification<TestAgent>& newer) const override
+    {
+        const auto& newerValue = static_cast<const AppendNotification&>(newer).value_;
+        return std::make_shared<AppendNotification>(GetCoalesceKey(), value_ + "+" + newerValue);
+    }
+
+private:
+    std::string value_;
+};
+} // namespace
+
+class ClientAgentDispatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    void RunPendingTasks();
+    ClientAgentDispatcher<TestAgent>::ExecutorFactory MakeExecutorFactory();
+
+    std::vector<std::function<void()>> tasks_;
+    uint32_t executorCount_ = 0;
+};
+
+void ClientAgentDispatcherTest::SetUpTestCase() {}
+
+void ClientAgentDispatcherTest::TearDownTestCase() {}
+
+void ClientAgentDispatcherTest::SetUp() {}
+
+void ClientAgentDispatcherTest::TearDown()
+{
+    tasks_.clear();
+    executorCount_ = 0;
+}
+
+ClientAgentDispatcher<TestAgent>::ExecutorFactory ClientAgentDispatcherTest::MakeExecutorFactory()
+{
+    return [this] {
+        executorCount_++;
+        return [this](std::function<void()>&& task) { tasks_.push_back(std::move(task)); };
+    };
+}
+
+void ClientAgentDispatcherTest::RunPendingTasks()
+{
+    auto tasks = std::move(tasks_);
+    tasks_.clear();
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+namespace {
+/**
+ * @tc.name: DispatchInline
+ * @tc.desc: test notifications are delivered in order without an executor
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAgentDispatcherTest, DispatchInline, TestSize.Level1)
+{
+    ClientAgentDispatcher<TestAgent> dispatcher;
+    sptr<TestAgent> agent = sptr<TestAgent>::MakeSptr();
+    dispatcher.Dispatch(agent, std::make_shared<AppendNotification>(AGENT_NOTIFY_NO_COALESCE, "a"));
+    dispatcher.Dispatch(agent, std::make_shared<ClientAgentFuncNotification<TestAgent>>(
+        [](const sptr<TestAgent>& agent) { agent->received.push_back("b"); }));
+    dispatcher.Dispatch(agent, nullptr);
+    dispatcher.Dispatch(nullptr, std::make_shared<AppendNotification>(AGENT_NOTIFY_NO_COALESCE, "c"));
+    EXPECT_EQ(agent->received, std::vector<std::string>({ "a", "b" }));
+    EXPECT_EQ(dispatcher.GetAgentStats()[agent].delivered, 2);
+}
+
+/**
+ * @tc.name: Coalesce
+ * @tc.desc: test pending notifications with the same key are merged while the agent is busy
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAgentDispatcherTest, Coalesce, TestSize.Level1)
+{
+    ClientAgentDispatcher<TestAgent> dispatcher(MakeExecutorFactory());
+    sptr<TestAgent> agent = sptr<TestAgent>::MakeSptr();
+    dispatcher.Dispatch(agent, std::make_shared<AppendNotification>(1, "v1"));
+    dispatcher.Dispatch(agent, std::make_shared<AppendNotification>(AGENT_NOTIFY_NO_COALESCE, "x"));
+    dispatcher.Dispatch(agent, std::make_shared<AppendNotification>(1, "v2"));
+    dispatcher.Dispatch(agent, std::make_shared<AppendNotification>(1, "v3"));
+    EXPECT_EQ(tasks_.size(), 1);
+    auto stats = dispatcher.GetAgentStats()[agent];
+    EXPECT_EQ(stats.backlog, 2);
+    EXPECT_EQ(stats.coalesced, 2);
+
+    RunPendingTasks();
+    EXPECT_EQ(agent->received, std::vector<std::string>({ "v1+v2+v3", "x" }));
+    stats = dispatcher.GetAgentStats()[agent];
+    EXPECT_EQ(stats.backlog, 0);
+    EXPECT_EQ(stats.delivered, 2);
+}
+
+/**
+ * @tc.name: BacklogAndIsolation
+ * @tc.desc: test a busy agent drops its oldest notifications without affecting other agents
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAgentDispatcherTest, BacklogAndIsolation, TestSize.Level1)
+{
+    constexpr uint32_t maxBacklog = 2;
+    ClientAgentDispatcher<TestAgent> dispatcher(MakeExecutorFactory(), maxBacklog);
+    sptr<TestAgent> slowAgent = sptr<TestAgent>::MakeSptr();
+    sptr<TestAgent> fastAgent = sptr<TestAgent>::MakeSptr();
+    for (const char* value : { "a", "b", "c" }) {
+        dispatcher.Dispatch(slowAgent, std::make_shared<AppendNotification>(AGENT_NOTIFY_NO_COALESCE, value));
+    }
+    dispatcher.Dispatch(fastAgent, std::make_shared<AppendNotification>(AGENT_NOTIFY_NO_COALESCE, "a"));
+    ASSERT_EQ(tasks_.size(), 2);
+    tasks_[1]();
+    EXPECT_EQ(fastAgent->received, std::vector<std::string>({ "a" }));
+    EXPECT_TRUE(slowAgent->received.empty());
+    EXPECT_EQ(dispatcher.GetAgentStats()[slowAgent].dropped, 1);
+
+    tasks_[0]();
+    EXPECT_EQ(slowAgent->received, std::vector<std::string>({ "b", "c" }));
+    EXPECT_EQ(executorCount_, 2);
+}
+
+/**
+ * @tc.name: RemoveAgent
+ * @tc.desc: test pending notifications of a removed agent are discarded
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClientAgentDispatcherTest, RemoveAgent, TestSize.Level1)
+{
+    ClientAgentDispatcher<TestAgent> dispatcher(MakeExecutorFactory());
+    sptr<TestAgent> agent = sptr<TestAgent>::MakeSptr();
+    dispatcher.Dispatch(agent, std::make_shared<AppendNotification>(AGENT_NOTIFY_NO_COALESCE, "a"));
+    dispatcher.RemoveAgent(agent);
+    RunPendingTasks();
+    EXPECT_TRUE(agent->received.empty());
+    EXPECT_TRUE(dispatcher.GetAgentStats().empty());
+
+    dispatcher.Dispatch(agent, std::make_shared<AppendNotification>(AGENT_NOTIFY_NO_COALESCE, "b"));
+    RunPendingTasks();
+    EXPECT_EQ(agent->received, std::vector<std::string>({ "b" }));
+    /* the executor of a removed agent is released, a new one is created when it comes back */
+    EXPECT_EQ(executorCount_, 2);
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
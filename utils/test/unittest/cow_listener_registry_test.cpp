@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <refbase.h>
+
+#include "cow_listener_registry.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+class TestListener : public RefBase {
+public:
+    void OnChange() { count_++; }
+    uint32_t count_ = 0;
+};
+} // namespace
+
+class CowListenerRegistryTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+/**
+ * @tc.name: RegisterAndUnregister
+ * @tc.desc: test listeners are kept per window in registration order without duplicates
+ * @tc.type: FUNC
+ */
+HWTEST_F(CowListenerRegistryTest, RegisterAndUnregister, TestSize.Level1)
+{
+    CowListenerRegistry<sptr<TestListener>> registry;
+    auto listener1 = sptr<TestListener>::MakeSptr();
+    auto listener2 = sptr<TestListener>::MakeSptr();
+    EXPECT_FALSE(registry.HasListeners(1));
+    EXPECT_EQ(registry.GetListenerCount(1), 0);
+    EXPECT_TRUE(registry.IsEmpty());
+
+    EXPECT_TRUE(registry.Register(1, listener1));
+    EXPECT_TRUE(registry.Register(1, listener2));
+    EXPECT_FALSE(registry.Register(1, listener1));
+    EXPECT_TRUE(registry.Register(2, listener1));
+    auto listeners = registry.GetListeners(1);
+    ASSERT_EQ(listeners->size(), 2);
+    EXPECT_EQ((*listeners)[0], listener1);
+    EXPECT_EQ((*listeners)[1], listener2);
+
+    EXPECT_TRUE(registry.Unregister(1, listener1));
+    EXPECT_FALSE(registry.Unregister(1, listener1));
+    EXPECT_EQ(registry.GetListenerCount(1), 1);
+    EXPECT_TRUE(registry.Unregister(1, listener2));
+    EXPECT_FALSE(registry.HasListeners(1));
+    EXPECT_TRUE(registry.HasListeners(2));
+
+    EXPECT_FALSE(registry.IsEmpty());
+
+    registry.Clear(2);
+    EXPECT_FALSE(registry.HasListeners(2));
+    EXPECT_TRUE(registry.IsEmpty());
+}
+
+/**
+ * @tc.name: Snapshot
+ * @tc.desc: test a taken snapshot is not affected by later changes and empty windows share one list
+ * @tc.type: FUNC
+ */
+HWTEST_F(CowListenerRegistryTest, Snapshot, TestSize.Level1)
+{
+    CowListenerRegistry<sptr<TestListener>> registry;
+    auto listener = sptr<TestListener>::MakeSptr();
+    registry.Register(1, listener);
+    auto snapshot = registry.GetListeners(1);
+    registry.Register(1, sptr<TestListener>::MakeSptr());
+    registry.Clear();
+    ASSERT_EQ(snapshot->size(), 1);
+    EXPECT_EQ(snapshot->front(), listener);
+    EXPECT_EQ(registry.GetListeners(1), registry.GetListeners(2));
+    EXPECT_TRUE(registry.GetListeners(1)->empty());
+}
+
+/**
+ * @tc.name: PairEntry
+ * @tc.desc: test listeners registered with an option are keyed by the listener
+ * @tc.type: FUNC
+ */
+HWTEST_F(CowListenerRegistryTest, PairEntry, TestSize.Level1)
+{
+    CowListenerRegistry<std::pair<sptr<TestListener>, bool>> registry;
+    auto listener = sptr<TestListener>::MakeSptr();
+    EXPECT_TRUE(registry.Register(1, { listener, true }));
+    EXPECT_FALSE(registry.Register(1, { listener, false }));
+    EXPECT_TRUE(registry.GetListeners(1)->front().second);
+    EXPECT_TRUE(registry.Unregister(1, listener));
+    EXPECT_FALSE(registry.HasListeners(1));
+}
+
+/**
+ * @tc.name: ConcurrentNotify
+ * @tc.desc: test notifying from snapshots while another thread registers and unregisters
+ * @tc.type: FUNC
+ */
+HWTEST_F(CowListenerRegistryTest, ConcurrentNotify, TestSize.Level1)
+{
+    CowListenerRegistry<sptr<TestListener>> registry;
+    auto stableListener = sptr<TestListener>::MakeSptr();
+    registry.Register(1, stableListener);
+    std::atomic<bool> stop { false };
+    std::thread writer([&registry, &stop] {
+        while (!stop.load()) {
+            auto listener = sptr<TestListener>::MakeSptr();
+            registry.Register(1, listener);
+            registry.Unregister(1, listener);
+        }
+    });
+    constexpr uint32_t notifyCount = 10000;
+    for (uint32_t i = 0; i < notifyCount; i++) {
+        auto listeners = registry.GetListeners(1);
+        for (const auto& listener : *listeners) {
+            listener->OnChange();
+        }
+    }
+    stop.store(true);
+    writer.join();
+    EXPECT_EQ(stableListener->count_, notifyCount);
+    EXPECT_EQ(registry.GetListenerCount(1), 1);
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
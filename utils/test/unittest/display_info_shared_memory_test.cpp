@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "display_info_shared_memory.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class DisplayInfoSharedMemoryTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    void InitPair();
+    sptr<DisplayInfo> CreateDisplayInfo(DisplayId displayId, int32_t width, int32_t height);
+
+    std::vector<uint64_t> buffer_;
+    DisplayInfoSharedMemory writer_;
+    DisplayInfoSharedMemory reader_;
+};
+
+void DisplayInfoSharedMemoryTest::SetUpTestCase() {}
+
+void DisplayInfoSharedMemoryTest::TearDownTestCase() {}
+
+void DisplayInfoSharedMemoryTest::SetUp() {}
+
+void DisplayInfoSharedMemoryTest::TearDown() {}
+
+void DisplayInfoSharedMemoryTest::InitPair()
+{
+    size_t size = sizeof(DisplayInfoSharedMemory::Layout);
+    buffer_.assign(size / sizeof(uint64_t) + 1, 0);
+    ASSERT_TRUE(writer_.InitLayout(buffer_.data(), size, true));
+    ASSERT_TRUE(reader_.InitLayout(buffer_.data(), size, false));
+}
+
+sptr<DisplayInfo> DisplayInfoSharedMemoryTest::CreateDisplayInfo(DisplayId displayId, int32_t width, int32_t height)
+{
+    sptr<DisplayInfo> info = sptr<DisplayInfo>::MakeSptr();
+    info->SetDisplayId(displayId);
+    info->SetName("display");
+    info->SetWidth(width);
+    info->SetHeight(height);
+    info->SetRotation(Rotation::ROTATION_90);
+    info->SetVirtualPixelRatio(2.0f);
+    return info;
+}
+
+namespace {
+/**
+ * @tc.name: InitLayout
+ * @tc.desc: test reader rejects a region that was not initialized by a writer
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayInfoSharedMemoryTest, InitLayout, TestSize.Level1)
+{
+    size_t size = sizeof(DisplayInfoSharedMemory::Layout);
+    std::vector<uint64_t> buffer(size / sizeof(uint64_t) + 1, 0);
+    EXPECT_FALSE(reader_.InitLayout(buffer.data(), size, false));
+    EXPECT_FALSE(reader_.InitLayout(buffer.data(), size - 1, true));
+    EXPECT_FALSE(reader_.InitLayout(nullptr, size, true));
+
+    DisplayInfoShmRecord record;
+    uint64_t version = 0;
+    EXPECT_FALSE(reader_.Read(0, record, version));
+    EXPECT_TRUE(reader_.IsBypassed(0));
+}
+
+/**
+ * @tc.name: PublishAndRead
+ * @tc.desc: test published records are readable and the version changes on update
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayInfoSharedMemoryTest, PublishAndRead, TestSize.Level1)
+{
+    InitPair();
+    DisplayInfoShmRecord record;
+    uint64_t version = 0;
+    EXPECT_FALSE(reader_.Read(0, record, version));
+
+    writer_.Publish(CreateDisplayInfo(0, 1260, 2720));
+    writer_.Publish(CreateDisplayInfo(5, 1920, 1080));
+    ASSERT_TRUE(reader_.Read(5, record, version));
+    EXPECT_EQ(record.width, 1920);
+    EXPECT_EQ(record.height, 1080);
+    ASSERT_TRUE(reader_.Read(0, record, version));
+    EXPECT_EQ(record.width, 1260);
+
+    uint64_t lastVersion = version;
+    writer_.Publish(CreateDisplayInfo(0, 2720, 1260));
+    ASSERT_TRUE(reader_.Read(0, record, version));
+    EXPECT_NE(version, lastVersion);
+    EXPECT_EQ(record.width, 2720);
+
+    writer_.Remove(0);
+    EXPECT_FALSE(reader_.Read(0, record, version));
+    EXPECT_TRUE(reader_.Read(5, record, version));
+}
+
+/**
+ * @tc.name: MergeInto
+ * @tc.desc: test mirrored fields override a clone of the cached info
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayInfoSharedMemoryTest, MergeInto, TestSize.Level1)
+{
+    DisplayInfoShmRecord record;
+    EXPECT_EQ(record.MergeInto(nullptr), nullptr);
+
+    sptr<DisplayInfo> base = CreateDisplayInfo(0, 1260, 2720);
+    sptr<DisplayInfo> published = CreateDisplayInfo(0, 2720, 1260);
+    published->SetRotation(Rotation::ROTATION_180);
+    record.CopyFrom(published);
+    sptr<DisplayInfo> merged = record.MergeInto(base);
+    ASSERT_NE(merged, nullptr);
+    EXPECT_NE(merged, base);
+    EXPECT_EQ(merged->GetName(), "display");
+    EXPECT_EQ(merged->GetWidth(), 2720);
+    EXPECT_EQ(merged->GetRotation(), Rotation::ROTATION_90);
+    EXPECT_EQ(base->GetWidth(), 1260);
+}
+
+/**
+ * @tc.name: UnmirroredGeneration
+ * @tc.desc: test the generation changes with unmirrored fields only and is not reused by a new display
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayInfoSharedMemoryTest, UnmirroredGeneration, TestSize.Level1)
+{
+    InitPair();
+    DisplayInfoShmRecord record;
+    uint64_t version = 0;
+    writer_.Publish(CreateDisplayInfo(0, 1260, 2720));
+    ASSERT_TRUE(reader_.Read(0, record, version));
+    uint32_t generation = record.unmirroredGeneration;
+    EXPECT_NE(generation, 0);
+
+    writer_.Publish(CreateDisplayInfo(0, 2720, 1260));
+    ASSERT_TRUE(reader_.Read(0, record, version));
+    EXPECT_EQ(record.unmirroredGeneration, generation);
+
+    sptr<DisplayInfo> info = CreateDisplayInfo(0, 2720, 1260);
+    info->SetRotation(Rotation::ROTATION_180);
+    writer_.Publish(info);
+    ASSERT_TRUE(reader_.Read(0, record, version));
+    EXPECT_NE(record.unmirroredGeneration, generation);
+    generation = record.unmirroredGeneration;
+
+    info->SetName("renamed");
+    writer_.Publish(info);
+    ASSERT_TRUE(reader_.Read(0, record, version));
+    EXPECT_NE(record.unmirroredGeneration, generation);
+    generation = record.unmirroredGeneration;
+
+    writer_.Remove(0);
+    writer_.Publish(info);
+    ASSERT_TRUE(reader_.Read(0, record, version));
+    EXPECT_NE(record.unmirroredGeneration, generation);
+}
+
+/**
+ * @tc.name: Bypass
+ * @tc.desc: test callers with rewritten display info are told to use IPC
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayInfoSharedMemoryTest, Bypass, TestSize.Level1)
+{
+    InitPair();
+    EXPECT_FALSE(reader_.IsBypassed(20010001));
+    writer_.SetBypassUids({ 20010001, 20010002 });
+    EXPECT_TRUE(reader_.IsBypassed(20010001));
+    EXPECT_FALSE(reader_.IsBypassed(20010003));
+
+    writer_.SetBypassAll(true);
+    EXPECT_TRUE(reader_.IsBypassed(20010003));
+    writer_.SetBypassAll(false);
+    writer_.SetBypassUids({});
+    EXPECT_FALSE(reader_.IsBypassed(20010001));
+
+    std::set<int32_t> uids;
+    for (int32_t uid = 0; uid <= static_cast<int32_t>(DisplayInfoSharedMemory::MAX_BYPASS_UID_COUNT); uid++) {
+        uids.insert(uid);
+    }
+    writer_.SetBypassUids(uids);
+    EXPECT_TRUE(reader_.IsBypassed(20010003));
+}
+
+/**
+ * @tc.name: ConcurrentRead
+ * @tc.desc: test readers never observe a torn record while the writer updates it
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayInfoSharedMemoryTest, ConcurrentRead, TestSize.Level1)
+{
+    InitPair();
+    writer_.Publish(CreateDisplayInfo(0, 0, 0));
+    std::atomic<bool> stop = false;
+    std::thread writer([this, &stop] {
+        for (int32_t i = 1; i < 20000; i++) {
+            writer_.Publish(CreateDisplayInfo(0, i, -i));
+        }
+        stop = true;
+    });
+    uint32_t torn = 0;
+    while (!stop) {
+        DisplayInfoShmRecord record;
+        uint64_t version = 0;
+        if (reader_.Read(0, record, version) && record.width != -record.height) {
+            torn++;
+        }
+    }
+    writer.join();
+    EXPECT_EQ(torn, 0);
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
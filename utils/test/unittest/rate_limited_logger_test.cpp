@@ -14,10 +14,12 @@
  */
 #include "rate_limited_logger.h"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 
 using namespace testing;
 using namespace testing::ext;
@@ -359,6 +361,105 @@ HWTEST_F(RateLimitedLoggerTest, AbnormalTimeWindowMsParameter, TestSize.Level1)
     EXPECT_FALSE(result);
 }
 
+/**
+ * @tc.name: ConcurrentLogFunction
+ * @tc.desc: Should keep exact counts when many threads log from the same and from separate call sites
+ * @tc.type: FUNC
+ */
+HWTEST_F(RateLimitedLoggerTest, ConcurrentLogFunction, TestSize.Level1)
+{
+    // Given - One shared call site and one call site per thread
+    constexpr int32_t threadCount = 8;
+    constexpr int32_t callCount = 20000;
+    std::uintptr_t sharedAddress = 1234567890UL;
+    uint32_t timeWindowMs = 60 * 60 * 1000;
+    uint32_t maxCount = 100;
+    std::atomic<int32_t> sharedLogged { 0 };
+    std::atomic<int32_t> ownLogged { 0 };
+
+    // When - All threads log concurrently
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i] {
+            std::uintptr_t ownAddress = static_cast<std::uintptr_t>(i + 1) * 100000UL;
+            for (int32_t j = 0; j < callCount; ++j) {
+                if (RateLimitedLogger::getInstance().logFunction(sharedAddress, timeWindowMs, maxCount)) {
+                    sharedLogged++;
+                }
+                if (RateLimitedLogger::getInstance().logFunction(ownAddress, timeWindowMs, maxCount)) {
+                    ownLogged++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Then - The shared call site is limited once, every own call site separately
+    EXPECT_EQ(sharedLogged.load(), maxCount);
+    EXPECT_EQ(ownLogged.load(), maxCount * threadCount);
+    EXPECT_EQ(RateLimitedLogger::getInstance().getCurrentCount(sharedAddress), maxCount);
+}
+
+/**
+ * @tc.name: ShouldFallBackWhenSlotsAreTaken
+ * @tc.desc: Should still limit call sites that do not fit into the lock free records
+ * @tc.type: FUNC
+ */
+HWTEST_F(RateLimitedLoggerTest, ShouldFallBackWhenSlotsAreTaken, TestSize.Level1)
+{
+    // Given - More call sites than lock free records
+    uint32_t timeWindowMs = 1000;
+    uint32_t maxCount = 1;
+    constexpr std::uintptr_t siteCount = 2048;
+
+    // When - Every call site logs twice
+    int32_t logged = 0;
+    for (std::uintptr_t address = 1; address <= siteCount; ++address) {
+        logged += RateLimitedLogger::getInstance().logFunction(address, timeWindowMs, maxCount) ? 1 : 0;
+        logged += RateLimitedLogger::getInstance().logFunction(address, timeWindowMs, maxCount) ? 1 : 0;
+    }
+
+    // Then - Only the first log of each call site passes
+    EXPECT_EQ(logged, static_cast<int32_t>(siteCount));
+    EXPECT_EQ(RateLimitedLogger::getInstance().getCurrentCount(siteCount), 1);
+}
+
+/**
+ * @tc.name: ShouldReclaimExpiredRecords
+ * @tc.desc: Records whose time window has passed should be taken over by new call sites
+ * @tc.type: FUNC
+ */
+HWTEST_F(RateLimitedLoggerTest, ShouldReclaimExpiredRecords, TestSize.Level1)
+{
+    // Given - More short lived call sites than lock free records, e.g. per window ids of destroyed windows
+    constexpr std::uintptr_t siteCount = 2048;
+    for (std::uintptr_t address = 1; address <= siteCount; ++address) {
+        RateLimitedLogger::getInstance().logFunction(address, 1, 1);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // When - As many new call sites log twice
+    uint32_t timeWindowMs = 1000;
+    int32_t logged = 0;
+    for (std::uintptr_t address = siteCount + 1; address <= siteCount * 2; ++address) {
+        logged += RateLimitedLogger::getInstance().logFunction(address, timeWindowMs, 1) ? 1 : 0;
+        logged += RateLimitedLogger::getInstance().logFunction(address, timeWindowMs, 1) ? 1 : 0;
+    }
+
+    // Then - New call sites are limited and expired records were dropped for them
+    EXPECT_EQ(logged, static_cast<int32_t>(siteCount));
+    int32_t remaining = 0;
+    for (std::uintptr_t address = 1; address <= siteCount; ++address) {
+        remaining += RateLimitedLogger::getInstance().getCurrentCount(address);
+    }
+    EXPECT_LT(remaining, static_cast<int32_t>(siteCount));
+    for (std::uintptr_t address = siteCount + 1; address <= siteCount * 2; ++address) {
+        EXPECT_EQ(RateLimitedLogger::getInstance().getCurrentCount(address), 1);
+    }
+}
+
 /**
  * @tc.name: AbnormalMaxCountParameter
  * @tc.desc: Abnormal maxCount Parameter test
@@ -440,6 +440,86 @@ HWTEST_F(WmOcclusionRegionTest, RegionOpLocal01, TestSize.Level1)
     regionBase.RegionOpLocal(region1, region2, regionRes, op);
     ASSERT_EQ(3, regionRes.GetRegionRects().size());
 }
+
+int64_t GetRegionArea(const Region& region)
+{
+    int64_t area = 0;
+    for (const auto& rect : region.GetRegionRects()) {
+        area += static_cast<int64_t>(rect.right_ - rect.left_) * (rect.bottom_ - rect.top_);
+    }
+    return area;
+}
+
+/* rects sorted by band, rects in one band share top and bottom and do not overlap */
+bool IsBandedRects(const std::vector<Rect>& rects)
+{
+    for (size_t i = 1; i < rects.size(); i++) {
+        const Rect& prev = rects[i - 1];
+        const Rect& rect = rects[i];
+        bool sameBand = rect.top_ == prev.top_ && rect.bottom_ == prev.bottom_ && rect.left_ >= prev.right_;
+        if (!sameBand && rect.top_ < prev.bottom_) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @tc.name: Region::RegionOp01
+ * @tc.desc: test banded RegionOp produces banded rects covering the same area as RegionOpLocal
+ * @tc.type: FUNC
+ */
+HWTEST_F(WmOcclusionRegionTest, RegionOp01, TestSize.Level1)
+{
+    constexpr int rectCounts[] = { 10, 50, 200 };
+    constexpr Region::OP ops[] = { Region::OP::AND, Region::OP::OR, Region::OP::XOR, Region::OP::SUB };
+    Region regionBase;
+    for (int rectCount : rectCounts) {
+        Region region1;
+        Region region2;
+        for (int i = 0; i < rectCount; i++) {
+            int left = (i * 37) % 1000;
+            int top = (i * 53) % 2000;
+            Rect rect { left, top, left + 100 + (i * 7) % 300, top + 100 + (i * 11) % 500 };
+            (i % 2 == 0 ? region1 : region2).GetRegionRects().push_back(rect);
+        }
+        for (auto op : ops) {
+            Region resLocal;
+            Region res;
+            regionBase.RegionOpLocal(region1, region2, resLocal, op);
+            regionBase.RegionOp(region1, region2, res, op);
+            EXPECT_TRUE(IsBandedRects(res.GetRegionRects()));
+            EXPECT_EQ(GetRegionArea(resLocal), GetRegionArea(res));
+        }
+    }
+}
+
+/**
+ * @tc.name: Region::OrSelf01
+ * @tc.desc: test OrSelf and SubSelf accumulate in place like the occlusion loop
+ * @tc.type: FUNC
+ */
+HWTEST_F(WmOcclusionRegionTest, OrSelf01, TestSize.Level1)
+{
+    Rect displayRect { 0, 0, 100, 200 };
+    Region displayRegion(displayRect);
+    Region allRegion;
+    Rect topRect { 0, 0, 100, 120 };
+    Region topRegion(topRect);
+    allRegion.OrSelf(topRegion);
+    EXPECT_FALSE(displayRegion.Sub(allRegion).IsEmpty());
+
+    Rect bottomRect { 0, 100, 100, 200 };
+    Region bottomRegion(bottomRect);
+    allRegion.OrSelf(bottomRegion);
+    ASSERT_EQ(1, allRegion.GetSize());
+    EXPECT_EQ(200, allRegion.GetBound().bottom_);
+    EXPECT_TRUE(displayRegion.Sub(allRegion).IsEmpty());
+
+    displayRegion.SubSelf(topRegion);
+    ASSERT_EQ(1, displayRegion.GetSize());
+    EXPECT_EQ(120, displayRegion.GetRegionRects()[0].top_);
+}
 } // namespace
 } // namespace WmOcclusion
 } // namespace Rosen
@@ -18,6 +18,11 @@
 
 #include <event_handler.h>
 
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <vector>
 #include <unistd.h>
 #include "window_manager_hilog.h"
 
@@ -29,7 +34,7 @@ void FinishTraceForSyncTask();
 class TaskScheduler {
 public:
     explicit TaskScheduler(const std::string& threadName);
-    virtual ~TaskScheduler() = default;
+    virtual ~TaskScheduler();
 
     std::shared_ptr<AppExecFwk::EventHandler> GetEventHandler();
 
@@ -38,6 +43,13 @@ public:
     virtual void PostAsyncTask(Task&& task, const std::string& name, int64_t delayTime = 0);
     void PostTask(Task&& task, const std::string& name, int64_t delayTime = 0);
     void RemoveTask(const std::string& name);
+    /*
+     * Post task through a lock-free queue which is drained in batches in OS_SceneSession,
+     * pending tasks with the same name are coalesced and only the latest one is executed.
+     * Names are compared by address, so name must be a string literal or outlive the scheduler.
+     * Tasks with a delay join the pending delayed batch, which runs after the delay of the post that opened it.
+     */
+    void PostCoalescedTask(Task&& task, const char* name, int64_t delayTime = 0);
     virtual void PostVoidSyncTask(Task&& task, const std::string& name = "ssmTask");
     template<typename SyncTask, typename Return = std::invoke_result_t<SyncTask>>
     Return PostSyncTask(SyncTask&& task, const std::string& name = "ssmTask")
@@ -74,9 +86,43 @@ public:
      */
     void AddExportTask(std::string taskName, Task&& task);
 
+    struct ExportTaskStats {
+        uint64_t batchCount = 0;
+        uint64_t taskCount = 0;
+        uint64_t coalescedCount = 0; // overwritten by a newer task with the same name before running
+        int64_t totalQueueLatencyUs = 0;
+        int64_t maxQueueLatencyUs = 0;
+    };
+    /*
+     * Export tasks handed over while a batch is still pending on the export handler are merged into it,
+     * delayTime lets the batch wait for more tasks, e.g. up to the next vsync.
+     */
+    void SetExportBatchDelay(int64_t delayTime);
+    ExportTaskStats GetExportTaskStats();
+
 private:
+    struct CoalescedTaskNode {
+        Task task;
+        const char* name = nullptr; // compared by address
+        CoalescedTaskNode* next = nullptr;
+    };
+    void DrainCoalescedTasks(std::atomic<CoalescedTaskNode*>& taskHead);
+    static size_t DeleteCoalescedTasks(CoalescedTaskNode* head);
+    void FlushExportBatch();
+
     std::unordered_map<std::string, Task> exportFuncMap_; // ONLY Accessed in OS_SceneSession
     std::shared_ptr<AppExecFwk::EventHandler> exportHandler_;
+    std::mutex exportMutex_;
+    /* run in handover order, a newer task with the same name drops the older one and goes to the tail */
+    std::list<std::pair<std::string, Task>> pendingExportTasks_; // guarded by exportMutex_
+    std::unordered_map<std::string, std::list<std::pair<std::string, Task>>::iterator>
+        pendingExportTaskIndex_; // guarded by exportMutex_
+    bool exportBatchPending_ = false; // guarded by exportMutex_
+    std::chrono::steady_clock::time_point exportBatchStartTime_; // guarded by exportMutex_
+    ExportTaskStats exportTaskStats_; // guarded by exportMutex_
+    std::atomic<int64_t> exportBatchDelay_ { 0 };
+    std::atomic<CoalescedTaskNode*> coalescedTaskHead_ { nullptr };
+    std::atomic<CoalescedTaskNode*> delayedCoalescedTaskHead_ { nullptr };
 
 protected:
     void ExecuteExportTask();
@@ -231,6 +231,13 @@ public:
     bool MarshallingSupportWindowModes(Parcel& parcel) const;
     static void UnmarshallingSupportWindowModes(Parcel& parcel, WindowSessionProperty* property);
 
+    /*
+     * Delta sent when the pad compatible mode is triggered: persistent id plus the mode flags packed
+     * into one word, instead of the whole property.
+     */
+    bool MarshallingTriggerModeDelta(Parcel& parcel) const;
+    static bool UnmarshallingTriggerModeDelta(Parcel& parcel, WindowSessionProperty* property);
+
     void SetTextFieldPositionY(double textFieldPositionY);
     void SetTextFieldHeight(double textFieldHeight);
 
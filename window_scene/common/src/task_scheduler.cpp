@@ -14,16 +14,30 @@
  */
 
 #include "common/include/task_scheduler.h"
+
+#include <algorithm>
+#include <unordered_set>
+
 #include "hitrace_meter.h"
 #include "window_manager_hilog.h"
 
 namespace OHOS::Rosen {
+namespace {
+const std::string DRAIN_COALESCED_TASKS_NAME = "wms:DrainCoalescedTasks";
+} // namespace
+
 TaskScheduler::TaskScheduler(const std::string& threadName)
 {
     auto runner = AppExecFwk::EventRunner::Create(threadName);
     handler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
 }
 
+TaskScheduler::~TaskScheduler()
+{
+    DeleteCoalescedTasks(coalescedTaskHead_.exchange(nullptr, std::memory_order_acquire));
+    DeleteCoalescedTasks(delayedCoalescedTaskHead_.exchange(nullptr, std::memory_order_acquire));
+}
+
 std::shared_ptr<AppExecFwk::EventHandler> TaskScheduler::GetEventHandler()
 {
     return handler_;
@@ -69,6 +83,58 @@ void TaskScheduler::RemoveTask(const std::string& name)
     handler_->RemoveTask("wms:" + name);
 }
 
+void TaskScheduler::PostCoalescedTask(Task&& task, const char* name, int64_t delayTime)
+{
+    auto& taskHead = delayTime > 0 ? delayedCoalescedTaskHead_ : coalescedTaskHead_;
+    auto node = new CoalescedTaskNode { std::move(task), name, nullptr };
+    CoalescedTaskNode* oldHead = taskHead.load(std::memory_order_relaxed);
+    do {
+        node->next = oldHead;
+    } while (!taskHead.compare_exchange_weak(oldHead, node, std::memory_order_release, std::memory_order_relaxed));
+    if (oldHead != nullptr) {
+        // a drain task is already pending and will pick this node up
+        return;
+    }
+    bool result = handler_->PostTask([this, &taskHead] { DrainCoalescedTasks(taskHead); },
+        DRAIN_COALESCED_TASKS_NAME, delayTime, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    if (!result) {
+        // nothing will drain this batch, drop it so that the next post schedules a drain again
+        size_t droppedCount = DeleteCoalescedTasks(taskHead.exchange(nullptr, std::memory_order_acquire));
+        TLOGE(WmsLogTag::DEFAULT, "post drain task failed, drop %{public}zu tasks", droppedCount);
+    }
+}
+
+size_t TaskScheduler::DeleteCoalescedTasks(CoalescedTaskNode* head)
+{
+    size_t count = 0;
+    while (head != nullptr) {
+        std::unique_ptr<CoalescedTaskNode> node(head);
+        head = head->next;
+        count++;
+    }
+    return count;
+}
+
+void TaskScheduler::DrainCoalescedTasks(std::atomic<CoalescedTaskNode*>& taskHead)
+{
+    CoalescedTaskNode* head = taskHead.exchange(nullptr, std::memory_order_acquire);
+    // nodes are linked newest first, keep the newest one of each name
+    std::vector<std::unique_ptr<CoalescedTaskNode>> batch;
+    std::unordered_set<const char*> names;
+    while (head != nullptr) {
+        std::unique_ptr<CoalescedTaskNode> node(head);
+        head = head->next;
+        if (names.insert(node->name).second) {
+            batch.push_back(std::move(node));
+        }
+    }
+    for (auto iter = batch.rbegin(); iter != batch.rend(); iter++) {
+        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:%s", (*iter)->name);
+        (*iter)->task();
+    }
+    ExecuteExportTask();
+}
+
 void TaskScheduler::PostVoidSyncTask(Task&& task, const std::string& name)
 {
     if (handler_->GetEventRunner()->IsCurrentRunnerThread()) {
@@ -98,19 +164,65 @@ void TaskScheduler::AddExportTask(std::string taskName, Task&& task)
     }
 }
 
+void TaskScheduler::SetExportBatchDelay(int64_t delayTime)
+{
+    exportBatchDelay_.store(delayTime);
+}
+
+TaskScheduler::ExportTaskStats TaskScheduler::GetExportTaskStats()
+{
+    std::lock_guard<std::mutex> lock(exportMutex_);
+    return exportTaskStats_;
+}
+
 void TaskScheduler::ExecuteExportTask()
 {
     if (!exportHandler_ || exportFuncMap_.empty()) {
         return;
     }
-    auto task = [funcMap = std::move(exportFuncMap_)] {
-        for (auto iter = funcMap.begin(); iter != funcMap.end(); iter++) {
-            HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:%s", iter->first.c_str());
-            iter->second();
+    {
+        std::lock_guard<std::mutex> lock(exportMutex_);
+        for (auto& [taskName, task] : exportFuncMap_) {
+            // the older task would otherwise overtake tasks handed over after it
+            if (auto iter = pendingExportTaskIndex_.find(taskName); iter != pendingExportTaskIndex_.end()) {
+                pendingExportTasks_.erase(iter->second);
+                exportTaskStats_.coalescedCount++;
+            }
+            pendingExportTaskIndex_[taskName] =
+                pendingExportTasks_.emplace(pendingExportTasks_.end(), taskName, std::move(task));
         }
-    };
-    exportFuncMap_.clear();
-    exportHandler_->PostTask(std::move(task), "wms:exportTask");
+        exportFuncMap_.clear();
+        if (exportBatchPending_) {
+            return;
+        }
+        exportBatchPending_ = true;
+        exportBatchStartTime_ = std::chrono::steady_clock::now();
+    }
+    if (!exportHandler_->PostTask([this] { FlushExportBatch(); }, "wms:exportTask", exportBatchDelay_.load())) {
+        TLOGE(WmsLogTag::DEFAULT, "post export batch failed, run it inline");
+        FlushExportBatch();
+    }
+}
+
+void TaskScheduler::FlushExportBatch()
+{
+    std::list<std::pair<std::string, Task>> exportTasks;
+    {
+        std::lock_guard<std::mutex> lock(exportMutex_);
+        exportTasks.swap(pendingExportTasks_);
+        pendingExportTaskIndex_.clear();
+        exportBatchPending_ = false;
+        int64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - exportBatchStartTime_).count();
+        exportTaskStats_.batchCount++;
+        exportTaskStats_.taskCount += exportTasks.size();
+        exportTaskStats_.totalQueueLatencyUs += latencyUs;
+        exportTaskStats_.maxQueueLatencyUs = std::max(exportTaskStats_.maxQueueLatencyUs, latencyUs);
+    }
+    for (auto& [taskName, task] : exportTasks) {
+        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:%s", taskName.c_str());
+        task();
+    }
 }
 
 void StartTraceForSyncTask(const std::string& name)
@@ -27,6 +27,11 @@ namespace Rosen {
 namespace {
 constexpr uint32_t TOUCH_HOT_AREA_MAX_NUM = 50;
 constexpr uint32_t TRANSITION_ANIMATION_MAP_SIZE_MAX_NUM = 100;
+constexpr uint32_t TRIGGER_MODE_PC_APP_IN_PAD = 1;
+constexpr uint32_t TRIGGER_MODE_PC_APP_IN_PAD_COMPATIBLE = 1 << 1;
+constexpr uint32_t TRIGGER_MODE_SYSTEM_BAR_INVISIBLE = 1 << 2;
+constexpr uint32_t TRIGGER_MODE_ORIENTATION_LANDSCAPE = 1 << 3;
+constexpr uint32_t TRIGGER_MODE_MOBILE_APP_LAYOUT_FULL_SCREEN = 1 << 4;
 
 bool IsValidPiPTemplateType(uint32_t type)
 {
@@ -3207,6 +3212,33 @@ void WindowSessionProperty::UnmarshallingSupportWindowModes(Parcel& parcel, Wind
     property->SetSupportedWindowModes(supportedWindowModes);
 }
 
+bool WindowSessionProperty::MarshallingTriggerModeDelta(Parcel& parcel) const
+{
+    uint32_t modeFlags = 0;
+    modeFlags |= GetIsPcAppInPad() ? TRIGGER_MODE_PC_APP_IN_PAD : 0;
+    modeFlags |= GetPcAppInpadCompatibleMode() ? TRIGGER_MODE_PC_APP_IN_PAD_COMPATIBLE : 0;
+    modeFlags |= GetPcAppInpadSpecificSystemBarInvisible() ? TRIGGER_MODE_SYSTEM_BAR_INVISIBLE : 0;
+    modeFlags |= GetPcAppInpadOrientationLandscape() ? TRIGGER_MODE_ORIENTATION_LANDSCAPE : 0;
+    modeFlags |= GetMobileAppInPadLayoutFullScreen() ? TRIGGER_MODE_MOBILE_APP_LAYOUT_FULL_SCREEN : 0;
+    return parcel.WriteInt32(GetPersistentId()) && parcel.WriteUint32(modeFlags);
+}
+
+bool WindowSessionProperty::UnmarshallingTriggerModeDelta(Parcel& parcel, WindowSessionProperty* property)
+{
+    int32_t persistentId = INVALID_SESSION_ID;
+    uint32_t modeFlags = 0;
+    if (property == nullptr || !parcel.ReadInt32(persistentId) || !parcel.ReadUint32(modeFlags)) {
+        return false;
+    }
+    property->SetPersistentId(persistentId);
+    property->SetIsPcAppInPad((modeFlags & TRIGGER_MODE_PC_APP_IN_PAD) != 0);
+    property->SetPcAppInpadCompatibleMode((modeFlags & TRIGGER_MODE_PC_APP_IN_PAD_COMPATIBLE) != 0);
+    property->SetPcAppInpadSpecificSystemBarInvisible((modeFlags & TRIGGER_MODE_SYSTEM_BAR_INVISIBLE) != 0);
+    property->SetPcAppInpadOrientationLandscape((modeFlags & TRIGGER_MODE_ORIENTATION_LANDSCAPE) != 0);
+    property->SetMobileAppInPadLayoutFullScreen((modeFlags & TRIGGER_MODE_MOBILE_APP_LAYOUT_FULL_SCREEN) != 0);
+    return true;
+}
+
 void WindowSessionProperty::SetMissionInfo(const MissionInfo& missionInfo)
 {
     std::lock_guard<std::mutex> lock(missionInfoMutex_);
@@ -29,6 +29,8 @@ class EventHandler;
 } // namespace OHOS::AppExecFwk
 
 namespace OHOS::Rosen {
+struct SceneSessionMapSnapshot;
+
 class IntentionEventManager {
     DECLARE_DELAYED_SINGLETON(IntentionEventManager);
 public:
@@ -55,9 +57,17 @@ private:
     void SendKeyEventConsumedResultToSCB(const std::shared_ptr<MMI::KeyEvent>& keyEvent, bool isConsumed) const;
     void SetPointerEventStatus(
         int32_t fingerId, int32_t action, int32_t sourceType, const sptr<SceneSession>& sceneSession) const;
+    sptr<SceneSession> GetPointerTargetSession(int32_t windowId) const;
     Ace::UIContent* uiContent_ = nullptr;
     std::weak_ptr<AppExecFwk::EventHandler> weakEventConsumer_;
     wptr<Window> window_;
+
+    /*
+     * Only touched on the input thread, refreshed when the scene session map epoch moves.
+     */
+    mutable std::shared_ptr<const SceneSessionMapSnapshot> sessionSnapshot_;
+    mutable int32_t lastTargetWindowId_ = INVALID_SESSION_ID;
+    mutable sptr<SceneSession> lastTargetSession_;
 };
 };
 extern "C" __attribute__((visibility("default"))) bool CreateAndEnableInputEventListener(Ace::UIContent* uiContent,
@@ -15,6 +15,8 @@
 
 #include "intention_event_manager.h"
 
+#include <chrono>
+
 #ifdef IMF_ENABLE
 #include <input_method_controller.h>
 #endif // IMF_ENABLE
@@ -33,6 +35,7 @@ constexpr int32_t TRANSPARENT_FINGER_ID = 10000;
 constexpr int32_t DELAY_TIME = 15;
 constexpr unsigned int FREQUENT_CLICK_TIME_LIMIT = 3;
 constexpr int FREQUENT_CLICK_COUNT_LIMIT = 8;
+constexpr uint32_t NON_MOVE_EVENT_LOG_INTERVAL = 32;
 static const bool IS_BETA = OHOS::system::GetParameter("const.logsystem.versiontype", "").find("beta") !=
     std::string::npos;
 
@@ -69,6 +72,11 @@ void LogPointInfo(const std::shared_ptr<MMI::PointerEvent>& pointerEvent)
         }
     }
 }
+uint64_t GetElapsedUs(const std::chrono::steady_clock::time_point& receiveTime)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - receiveTime).count());
+}
 } // namespace
 
 IntentionEventManager::IntentionEventManager() {}
@@ -130,6 +138,36 @@ void IntentionEventManager::InputEventListener::SetPointerEventStatus(
     }
 }
 
+sptr<SceneSession> IntentionEventManager::InputEventListener::GetPointerTargetSession(int32_t windowId) const
+{
+    auto& sceneSessionManager = SceneSessionManager::GetInstance();
+    if (sessionSnapshot_ == nullptr || sessionSnapshot_->epoch != sceneSessionManager.GetSceneSessionMapEpoch()) {
+        sessionSnapshot_ = sceneSessionManager.GetSceneSessionMapSnapshot();
+        lastTargetWindowId_ = INVALID_SESSION_ID;
+        lastTargetSession_ = nullptr;
+    }
+    if (windowId == lastTargetWindowId_ && lastTargetSession_ != nullptr) {
+        return lastTargetSession_;
+    }
+    sptr<SceneSession> sceneSession = nullptr;
+    if (sessionSnapshot_ != nullptr) {
+        auto iter = sessionSnapshot_->sessionMap.find(windowId);
+        if (iter != sessionSnapshot_->sessionMap.end()) {
+            sceneSession = iter->second;
+        }
+    }
+    if (sceneSession == nullptr) {
+        // the snapshot may lag behind a session added concurrently, fall back to the locked map
+        sceneSession = sceneSessionManager.GetSceneSession(windowId);
+        if (sceneSession == nullptr) {
+            return nullptr;
+        }
+    }
+    lastTargetWindowId_ = windowId;
+    lastTargetSession_ = sceneSession;
+    return sceneSession;
+}
+
 bool IntentionEventManager::InputEventListener::CheckPointerEvent(
     const std::shared_ptr<MMI::PointerEvent> pointerEvent) const
 {
@@ -155,13 +193,14 @@ bool IntentionEventManager::InputEventListener::CheckPointerEvent(
 void IntentionEventManager::InputEventListener::OnInputEvent(
     std::shared_ptr<MMI::PointerEvent> pointerEvent) const
 {
+    auto receiveTime = std::chrono::steady_clock::now();
     if (!CheckPointerEvent(pointerEvent)) {
         return;
     }
     LogPointInfo(pointerEvent);
     int32_t action = pointerEvent->GetPointerAction();
     uint32_t windowId = static_cast<uint32_t>(pointerEvent->GetTargetWindowId());
-    auto sceneSession = SceneSessionManager::GetInstance().GetSceneSession(windowId);
+    auto sceneSession = GetPointerTargetSession(static_cast<int32_t>(windowId));
     if (sceneSession == nullptr) {
         TLOGE(WmsLogTag::WMS_INPUT_KEY_FLOW, "Session is null");
         pointerEvent->MarkProcessed();
@@ -183,11 +222,20 @@ void IntentionEventManager::InputEventListener::OnInputEvent(
             sourceType == MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN) {
             SetPointerEventStatus(pointerEvent->GetPointerId(), action, sourceType, sceneSession);
         }
+        // only sampled at INFO, per event latency is kept in the -l dump of the session manager
         static uint32_t eventId = 0;
-        TLOGI(WmsLogTag::WMS_INPUT_KEY_FLOW, "eid:%{public}d,InputId:%{public}d,wid:%{public}u"
-            ",ac:%{public}d,sys:%{public}d", eventId++, pointerEvent->GetId(), windowId,
-            action, sceneSession->GetSessionInfo().isSystem_);
+        if (eventId++ % NON_MOVE_EVENT_LOG_INTERVAL == 0) {
+            TLOGI(WmsLogTag::WMS_INPUT_KEY_FLOW, "eid:%{public}u,InputId:%{public}d,wid:%{public}u"
+                ",ac:%{public}d,sys:%{public}d", eventId, pointerEvent->GetId(), windowId,
+                action, sceneSession->GetSessionInfo().isSystem_);
+        } else {
+            TLOGD(WmsLogTag::WMS_INPUT_KEY_FLOW, "eid:%{public}u,InputId:%{public}d,wid:%{public}u"
+                ",ac:%{public}d,sys:%{public}d", eventId, pointerEvent->GetId(), windowId,
+                action, sceneSession->GetSessionInfo().isSystem_);
+        }
     }
+    SceneSessionManager::GetInstance().RecordPointerLatency(action, PointerLatencyStage::TRANSFER,
+        GetElapsedUs(receiveTime));
     if (sceneSession->GetSessionInfo().isSystem_) {
         sceneSession->SendPointerEventToUI(pointerEvent);
         auto window = window_.promote();
@@ -222,6 +270,8 @@ void IntentionEventManager::InputEventListener::OnInputEvent(
             pointerEvent->MarkProcessed();
         }
     }
+    SceneSessionManager::GetInstance().RecordPointerLatency(action, PointerLatencyStage::DONE,
+        GetElapsedUs(receiveTime));
 }
 
 void IntentionEventManager::InputEventListener::SendKeyEventConsumedResultToSCB(
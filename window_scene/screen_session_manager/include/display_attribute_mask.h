@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_DISPLAY_ATTRIBUTE_MASK_H
+#define OHOS_ROSEN_DISPLAY_ATTRIBUTE_MASK_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OHOS::Rosen {
+/*
+ * Listenable display attributes, one bit each. The names are the strings clients
+ * subscribe with, they are only materialized when a change is delivered.
+ */
+using DisplayAttributeMask = uint32_t;
+
+enum DisplayAttributeBit : uint32_t {
+    DISPLAY_ATTRIBUTE_ID = 0,
+    DISPLAY_ATTRIBUTE_NAME,
+    DISPLAY_ATTRIBUTE_ALIVE,
+    DISPLAY_ATTRIBUTE_STATE,
+    DISPLAY_ATTRIBUTE_REFRESH_RATE,
+    DISPLAY_ATTRIBUTE_ROTATION,
+    DISPLAY_ATTRIBUTE_WIDTH,
+    DISPLAY_ATTRIBUTE_HEIGHT,
+    DISPLAY_ATTRIBUTE_ORIENTATION,
+    DISPLAY_ATTRIBUTE_X_DPI,
+    DISPLAY_ATTRIBUTE_Y_DPI,
+    DISPLAY_ATTRIBUTE_COLOR_SPACES,
+    DISPLAY_ATTRIBUTE_HDR_FORMATS,
+    DISPLAY_ATTRIBUTE_AVAILABLE_WIDTH,
+    DISPLAY_ATTRIBUTE_AVAILABLE_HEIGHT,
+    DISPLAY_ATTRIBUTE_SCREEN_SHAPE,
+    DISPLAY_ATTRIBUTE_X,
+    DISPLAY_ATTRIBUTE_Y,
+    DISPLAY_ATTRIBUTE_SOURCE_MODE,
+    DISPLAY_ATTRIBUTE_SUPPORTED_REFRESH_RATES,
+    DISPLAY_ATTRIBUTE_DENSITY_DPI,
+    DISPLAY_ATTRIBUTE_DENSITY_PIXELS,
+    DISPLAY_ATTRIBUTE_SCALED_DENSITY,
+    DISPLAY_ATTRIBUTE_COUNT,
+};
+static_assert(DISPLAY_ATTRIBUTE_COUNT <= sizeof(DisplayAttributeMask) * 8, "display attribute mask overflow");
+
+constexpr DisplayAttributeMask DisplayAttributeToMask(DisplayAttributeBit bit)
+{
+    return static_cast<DisplayAttributeMask>(1u) << bit;
+}
+
+/* indexed by DisplayAttributeBit */
+constexpr const char* DISPLAY_ATTRIBUTE_NAMES[DISPLAY_ATTRIBUTE_COUNT] = {
+    "id", "name", "alive", "state", "refreshRate", "rotation", "width", "height", "orientation",
+    "xDPI", "yDPI", "colorSpaces", "hdrFormats", "availableWidth", "availableHeight", "screenShape",
+    "x", "y", "sourceMode", "supportedRefreshRates", "densityDPI", "densityPixels", "scaledDensity",
+};
+
+inline std::vector<std::string> DisplayAttributeMaskToNames(DisplayAttributeMask mask)
+{
+    std::vector<std::string> names;
+    for (uint32_t bit = 0; bit < DISPLAY_ATTRIBUTE_COUNT; bit++) {
+        if ((mask & DisplayAttributeToMask(static_cast<DisplayAttributeBit>(bit))) != 0) {
+            names.emplace_back(DISPLAY_ATTRIBUTE_NAMES[bit]);
+        }
+    }
+    return names;
+}
+
+inline std::string DisplayAttributeMaskToString(DisplayAttributeMask mask)
+{
+    std::string str;
+    for (uint32_t bit = 0; bit < DISPLAY_ATTRIBUTE_COUNT; bit++) {
+        if ((mask & DisplayAttributeToMask(static_cast<DisplayAttributeBit>(bit))) != 0) {
+            str.append(DISPLAY_ATTRIBUTE_NAMES[bit]).append(",");
+        }
+    }
+    return str;
+}
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_DISPLAY_ATTRIBUTE_MASK_H
@@ -23,6 +23,8 @@
 #include <pixel_map.h>
 
 #include "common/include/task_scheduler.h"
+#include "display_attribute_mask.h"
+#include "display_info_shared_memory.h"
 #include "dm_common.h"
 #include "event_tracker.h"
 #include "session/screen/include/screen_session.h"
@@ -223,6 +225,8 @@ public:
         int32_t uid = INVALID_UID);
     void GetChangedListenableAttribute(sptr<DisplayInfo> displayInfo1, sptr<DisplayInfo> displayInfo2,
         std::vector<std::string>& attributes);
+    DisplayAttributeMask GetChangedListenableAttributeMask(const sptr<DisplayInfo>& displayInfo1,
+        const sptr<DisplayInfo>& displayInfo2);
 
     std::vector<ScreenId> GetAllScreenIds() const;
     const std::shared_ptr<RSDisplayNode> GetRSDisplayNodeByScreenId(ScreenId smsScreenId) const;
@@ -550,6 +554,7 @@ public:
     void SetLastScreenMode(sptr<ScreenSession> firstSession, sptr<ScreenSession> secondarySession);
     void SetHoverBlockList(const std::vector<std::string>& hoverBlockList) override;
     bool IsHoverBlockPid(const int32_t agentPid);
+    sptr<Ashmem> GetDisplayInfoSharedMemory() override;
     /*
      * multi user
      */
@@ -719,6 +724,14 @@ protected:
     void RegisterRefreshRateChangeListener();
     mutable std::recursive_mutex phyScreenPropMapMutex_;
     mutable std::recursive_mutex screenSessionMapMutex_;
+    /*
+     * displayId -> screenSessionMap_ key for displays not keyed by their own id (fake displays,
+     * sms id remapping), learned from full scans and validated against the live map on every use.
+     */
+    std::shared_mutex displayOwnerIndexMutex_;
+    std::unordered_map<DisplayId, ScreenId> displayOwnerIndex_;
+    sptr<ScreenSession> GetScreenSessionByDisplayId(DisplayId displayId);
+    void UpdateDisplayOwnerIndex(DisplayId displayId, ScreenId ownerId);
     ScreenId GetPhyScreenId(ScreenId screenId);
     ScreenId GenerateSmsScreenId(ScreenId rsScreenId);
     EventTracker screenEventTracker_;
@@ -1267,6 +1280,9 @@ private:
 
     std::mutex lastDisplayInfoMapMutex_;
     std::map<DisplayId, sptr<DisplayInfo>> lastDisplayInfoMap_;
+    /* canonical display info mirrored to clients, callers with rewritten info are bypassed */
+    DisplayInfoSharedMemory displayInfoShm_;
+    void UpdateDisplayInfoShmBypass();
     std::mutex lastDisplayInfoHookMapMutex_;
     std::map<int32_t, std::map<DisplayId, sptr<DisplayInfo>>> lastDisplayInfoHookMap_;
 
@@ -16,6 +16,7 @@
 #ifndef OHOS_ROSEN_SCREEN_SESSION_MANAGER_INTERFACE_H
 #define OHOS_ROSEN_SCREEN_SESSION_MANAGER_INTERFACE_H
 
+#include <ashmem.h>
 #include <ui/rs_display_node.h>
 
 #include "display_manager_interface_code.h"
@@ -469,6 +470,7 @@ public:
     virtual DMError GetBundleName(DisplayId displayId, std::string& bundleName) { return DMError::DM_OK; }
     virtual sptr<IRemoteObject> GetRenderSession(ScreenId screenId) { return nullptr; }
     virtual void SetHoverBlockList(const std::vector<std::string>& hoverBlockList) {}
+    virtual sptr<Ashmem> GetDisplayInfoSharedMemory() { return nullptr; }
 };
 } // namespace Rosen
 } // namespace OHOS
@@ -286,6 +286,7 @@ public:
     DMError GetRoundedCorner(DisplayId displayId, int& radius) override;
     sptr<IRemoteObject> GetRenderSession(ScreenId screenId) override;
     void SetHoverBlockList(const std::vector<std::string>& hoverBlockList) override;
+    sptr<Ashmem> GetDisplayInfoSharedMemory() override;
 private:
     static inline BrokerDelegator<ScreenSessionManagerProxy> delegator_;
 };
@@ -661,6 +661,10 @@ void ScreenSessionManager::Init()
         TLOGNFW(WmsLogTag::DMS, "load motion plugin failed.");
     }
     AodLibInit();
+    if (!displayInfoShm_.Create()) {
+        TLOGNFW(WmsLogTag::DMS, "create display info shared memory failed.");
+    }
+    UpdateDisplayInfoShmBypass();
     RegisterScreenChangeListener();
     RegisterRSListeners();
     if(FoldScreenStateInternel::IsSecondaryDisplayFoldDevice() ||
@@ -3272,9 +3276,64 @@ sptr<DisplayInfo> ScreenSessionManager::GetDisplayInfoById(DisplayId displayId)
     return GetDisplayInfoById(displayId, false);
 }
 
+sptr<ScreenSession> ScreenSessionManager::GetScreenSessionByDisplayId(DisplayId displayId)
+{
+    ScreenId ownerId = displayId;
+    {
+        std::shared_lock<std::shared_mutex> lock(displayOwnerIndexMutex_);
+        auto iter = displayOwnerIndex_.find(displayId);
+        if (iter != displayOwnerIndex_.end()) {
+            ownerId = iter->second;
+        }
+    }
+    sptr<ScreenSession> screenSession = nullptr;
+    {
+        std::lock_guard<std::recursive_mutex> lock(screenSessionMapMutex_);
+        auto iter = screenSessionMap_.find(ownerId);
+        if (iter == screenSessionMap_.end()) {
+            return nullptr;
+        }
+        screenSession = iter->second;
+    }
+    if (screenSession == nullptr) {
+        return nullptr;
+    }
+    if (screenSession->GetScreenId() == displayId) {
+        return screenSession;
+    }
+    if (!FoldScreenStateInternel::IsSuperFoldDisplayDevice() ||
+        !screenSession->GetScreenProperty().GetIsFakeInUse()) {
+        return nullptr;
+    }
+    sptr<ScreenSession> fakeScreenSession = screenSession->GetFakeScreenSession();
+    if (fakeScreenSession == nullptr || fakeScreenSession->GetScreenId() != displayId) {
+        return nullptr;
+    }
+    return fakeScreenSession;
+}
+
+void ScreenSessionManager::UpdateDisplayOwnerIndex(DisplayId displayId, ScreenId ownerId)
+{
+    std::unique_lock<std::shared_mutex> lock(displayOwnerIndexMutex_);
+    if (ownerId == SCREEN_ID_INVALID || ownerId == displayId) {
+        displayOwnerIndex_.erase(displayId);
+        return;
+    }
+    displayOwnerIndex_[displayId] = ownerId;
+}
+
 sptr<DisplayInfo> ScreenSessionManager::GetDisplayInfoById(DisplayId displayId, bool isGetActualInfo)
 {
     TLOGD(WmsLogTag::DMS, "enter, displayId: %{public}" PRIu64" ", displayId);
+    sptr<ScreenSession> indexedSession = GetScreenSessionByDisplayId(displayId);
+    if (indexedSession != nullptr) {
+        sptr<DisplayInfo> displayInfo = FindDisplayInfoInSession(indexedSession, displayId, isGetActualInfo);
+        if (displayInfo != nullptr) {
+            TLOGD(WmsLogTag::DMS, "success");
+            return displayInfo;
+        }
+    }
+    /* index miss, fall back to probing every session and remember where the display lives */
     std::map<ScreenId, sptr<ScreenSession>> screenSessionMapCopy;
     {
         std::lock_guard<std::recursive_mutex> lock(screenSessionMapMutex_);
@@ -3291,6 +3350,7 @@ sptr<DisplayInfo> ScreenSessionManager::GetDisplayInfoById(DisplayId displayId,
         sptr<DisplayInfo> displayInfo = FindDisplayInfoInSession(screenSession, displayId, isGetActualInfo);
         if (displayInfo != nullptr) {
             TLOGD(WmsLogTag::DMS, "success");
+            UpdateDisplayOwnerIndex(displayId, sessionIt.first);
             return displayInfo;
         }
 
@@ -3304,10 +3364,11 @@ sptr<DisplayInfo> ScreenSessionManager::GetDisplayInfoById(DisplayId displayId,
             displayId, isGetActualInfo);
         if (fakeDisplayInfo != nullptr) {
             TLOGD(WmsLogTag::DMS, "find fake success");
+            UpdateDisplayOwnerIndex(displayId, sessionIt.first);
             return fakeDisplayInfo;
         }
     }
-    
+    UpdateDisplayOwnerIndex(displayId, SCREEN_ID_INVALID);
     TLOGNFE(WmsLogTag::DMS, "failed. displayId: %{public}" PRIu64" ", displayId);
     return nullptr;
 }
@@ -3414,11 +3475,16 @@ void ScreenSessionManager::GetRotationCorrectionExemptionListFromDatabase(bool i
         needReinstallExemptionList_ = true;
         return;
     }
-    std::unique_lock<std::shared_mutex> lock(rotationCorrectionExemptionMutex_);
-    rotationCorrectionExemptionList_ = rotationCorrectionExemptionList;
+    {
+        std::unique_lock<std::shared_mutex> lock(rotationCorrectionExemptionMutex_);
+        rotationCorrectionExemptionList_ = rotationCorrectionExemptionList;
+        if (rotationCorrectionExemptionList.size() <= 0) {
+            needReinstallExemptionList_ = false;
+        }
+    }
+    UpdateDisplayInfoShmBypass();
     if (rotationCorrectionExemptionList.size() <= 0) {
         TLOGNFE(WmsLogTag::DMS, "rotationCorrectionExemptionList is empty");
-        needReinstallExemptionList_ = false;
         return;
     }
     TLOGNFI(WmsLogTag::DMS, "success");
@@ -3494,6 +3560,7 @@ void ScreenSessionManager::GetRotationCorrectionWhiteListFromDatabase()
         std::unique_lock<std::shared_mutex> lock(rotationCorrectionWhiteMutex_);
         rotationCorrectionWhiteList_ = std::move(rotationCorrectionWhiteList);
     }
+    UpdateDisplayInfoShmBypass();
 }
 
 void ScreenSessionManager::RegisterRotationCorrectionWhiteListObserver()
@@ -4149,6 +4216,7 @@ void ScreenSessionManager::UpdateDisplayHookInfo(int32_t uid, bool enable, const
             displayHookMap_.erase(uid);
         }
     }
+    UpdateDisplayInfoShmBypass();
     NotifyDisplayChangedByUid(screenSessionMapCopy, DisplayChangeEvent::DISPLAY_SIZE_CHANGED, uid);
 }
 
@@ -7846,6 +7914,7 @@ void ScreenSessionManager::UpdateScreenRotationProperty(ScreenId screenId, const
 
 void ScreenSessionManager::NotifyDisplayChanged(sptr<DisplayInfo> displayInfo, DisplayChangeEvent event)
 {
+    displayInfoShm_.Publish(displayInfo);
     CheckAttributeChange(displayInfo);
     auto task = [=] {
         ScreenSessionManagerAdapter::GetInstance().OnDisplayChange(displayInfo, event);
@@ -7860,7 +7929,6 @@ void ScreenSessionManager::CheckAttributeChange(sptr<DisplayInfo> displayInfo)
         return;
     }
     DisplayId displayId = displayInfo->GetDisplayId();
-    std::vector<std::string> attributes;
     std::lock_guard<std::mutex> lock(lastDisplayInfoMapMutex_);
     if (lastDisplayInfoMap_.find(displayId) == lastDisplayInfoMap_.end()) {
         lastDisplayInfoMap_.insert({displayId, sptr<DisplayInfo>::MakeSptr()});
@@ -7870,24 +7938,19 @@ void ScreenSessionManager::CheckAttributeChange(sptr<DisplayInfo> displayInfo)
         TLOGNFE(WmsLogTag::DMS, "LastDisplayInfo of displayId: %{public}" PRIu64 "is nullptr", displayId);
         return;
     }
-    GetChangedListenableAttribute(lastDisplayInfo, displayInfo, attributes);
-    if (attributes.empty()) {
+    DisplayAttributeMask changedMask = GetChangedListenableAttributeMask(lastDisplayInfo, displayInfo);
+    if (changedMask == 0) {
         TLOGW(WmsLogTag::DMS, "No attribute changed");
         return;
     }
-    TLOGD(WmsLogTag::DMS, "has %{public}d attributes changed", (int32_t)attributes.size());
-
-    std::ostringstream oss;
-    oss << "current changed attributes:[";
-    for (const auto& attribute : attributes) {
-        oss << attribute << ",";
-    }
-    if (attributes.size() == 1 && attributes[0] == "refreshRate") {
-        TLOGD(WmsLogTag::DMS, "%{public}s]", oss.str().c_str());
+    /* refresh rate changes arrive every few frames on variable refresh panels, keep them cheap */
+    if (changedMask == DisplayAttributeToMask(DISPLAY_ATTRIBUTE_REFRESH_RATE)) {
+        TLOGD(WmsLogTag::DMS, "current changed attributes:[refreshRate,]");
     } else {
-        TLOGNFI(WmsLogTag::DMS, "%{public}s]", oss.str().c_str());
+        TLOGNFI(WmsLogTag::DMS, "current changed attributes:[%{public}s]",
+            DisplayAttributeMaskToString(changedMask).c_str());
     }
-    NotifyDisplayAttributeChanged(displayInfo, attributes);
+    NotifyDisplayAttributeChanged(displayInfo, DisplayAttributeMaskToNames(changedMask));
     lastDisplayInfoMap_[displayId] = displayInfo;
 }
 
@@ -7911,22 +7974,15 @@ void ScreenSessionManager::CheckAttributeChangeWithUid(sptr<DisplayInfo> display
         TLOGNFE(WmsLogTag::DMS, "LastDisplayInfo of displayId: %{public}" PRIu64 "is nullptr", displayId);
         return;
     }
-    std::vector<std::string> attributes;
-    GetChangedListenableAttribute(lastDisplayInfo, displayInfo, attributes);
-    if (attributes.empty()) {
+    DisplayAttributeMask changedMask = GetChangedListenableAttributeMask(lastDisplayInfo, displayInfo);
+    if (changedMask == 0) {
         TLOGNFW(WmsLogTag::DMS, "No attribute changed");
         return;
     }
+    TLOGD(WmsLogTag::DMS, "uid is: %{public}d, current changed attributes:[%{public}s]", uid,
+        DisplayAttributeMaskToString(changedMask).c_str());
 
-    std::ostringstream oss;
-    oss << "current changed attributes:[";
-    for (const auto& attribute : attributes) {
-        oss << attribute << ",";
-    }
-    std::string logStr = oss.str();
-    TLOGD(WmsLogTag::DMS, "uid is: %{public}d, %{public}s]", uid, logStr.c_str());
-
-    NotifyDisplayAttributeChanged(displayInfo, attributes, uid);
+    NotifyDisplayAttributeChanged(displayInfo, DisplayAttributeMaskToNames(changedMask), uid);
     lastDisplayInfoHookMap_[uid][displayId] = displayInfo;
 }
  
@@ -8039,48 +8095,56 @@ bool IsVirtualPixelRatioChanged(const sptr<DisplayInfo>& d1, const sptr<DisplayI
 using DisplayAttrCompareFunc = bool(*)(const sptr<DisplayInfo>&, const sptr<DisplayInfo>&);
 struct DisplayAttributeCompareEntry {
     DisplayAttrCompareFunc compare;
-    std::initializer_list<const char*> names;
+    DisplayAttributeMask mask;
 };
 
 constexpr DisplayAttributeCompareEntry DISPLAY_ATTRIBUTE_COMPARE_ENTRIES[] = {
-    {IsDisplayIdChanged, {"id"}},
-    {IsDisplayNameChanged, {"name"}},
-    {IsAliveStatusChanged, {"alive"}},
-    {IsDisplayStateChanged, {"state"}},
-    {IsRefreshRateChanged, {"refreshRate"}},
-    {IsRotationChanged, {"rotation"}},
-    {IsWidthChanged, {"width"}},
-    {IsHeightChanged, {"height"}},
-    {IsDisplayOrientationChanged, {"orientation"}},
-    {IsXDpiChanged, {"xDPI"}},
-    {IsYDpiChanged, {"yDPI"}},
-    {IsColorSpacesChanged, {"colorSpaces"}},
-    {IsHdrFormatsChanged, {"hdrFormats"}},
-    {IsAvailableWidthChanged, {"availableWidth"}},
-    {IsAvailableHeightChanged, {"availableHeight"}},
-    {IsScreenShapeChanged, {"screenShape"}},
-    {IsXChanged, {"x"}},
-    {IsYChanged, {"y"}},
-    {IsDisplaySourceModeChanged, {"sourceMode"}},
-    {IsSupportedRefreshRateChanged, {"supportedRefreshRates"}},
-    {IsVirtualPixelRatioChanged, {"densityDPI", "densityPixels", "scaledDensity"}},
+    {IsDisplayIdChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_ID)},
+    {IsDisplayNameChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_NAME)},
+    {IsAliveStatusChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_ALIVE)},
+    {IsDisplayStateChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_STATE)},
+    {IsRefreshRateChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_REFRESH_RATE)},
+    {IsRotationChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_ROTATION)},
+    {IsWidthChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_WIDTH)},
+    {IsHeightChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_HEIGHT)},
+    {IsDisplayOrientationChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_ORIENTATION)},
+    {IsXDpiChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_X_DPI)},
+    {IsYDpiChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_Y_DPI)},
+    {IsColorSpacesChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_COLOR_SPACES)},
+    {IsHdrFormatsChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_HDR_FORMATS)},
+    {IsAvailableWidthChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_AVAILABLE_WIDTH)},
+    {IsAvailableHeightChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_AVAILABLE_HEIGHT)},
+    {IsScreenShapeChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_SCREEN_SHAPE)},
+    {IsXChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_X)},
+    {IsYChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_Y)},
+    {IsDisplaySourceModeChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_SOURCE_MODE)},
+    {IsSupportedRefreshRateChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_SUPPORTED_REFRESH_RATES)},
+    {IsVirtualPixelRatioChanged, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_DENSITY_DPI) |
+        DisplayAttributeToMask(DISPLAY_ATTRIBUTE_DENSITY_PIXELS) |
+        DisplayAttributeToMask(DISPLAY_ATTRIBUTE_SCALED_DENSITY)},
 };
 }
 
-void ScreenSessionManager::GetChangedListenableAttribute(sptr<DisplayInfo> displayInfo1, sptr<DisplayInfo> displayInfo2,
-    std::vector<std::string>& attributes)
+DisplayAttributeMask ScreenSessionManager::GetChangedListenableAttributeMask(const sptr<DisplayInfo>& displayInfo1,
+    const sptr<DisplayInfo>& displayInfo2)
 {
+    DisplayAttributeMask changedMask = 0;
     if (displayInfo1 == nullptr || displayInfo2 == nullptr) {
-        return;
+        return changedMask;
     }
-
     for (const auto& entry : DISPLAY_ATTRIBUTE_COMPARE_ENTRIES) {
         if (entry.compare(displayInfo1, displayInfo2)) {
-            for (const char* name : entry.names) {
-                attributes.emplace_back(name);
-            }
+            changedMask |= entry.mask;
         }
     }
+    return changedMask;
+}
+
+void ScreenSessionManager::GetChangedListenableAttribute(sptr<DisplayInfo> displayInfo1, sptr<DisplayInfo> displayInfo2,
+    std::vector<std::string>& attributes)
+{
+    auto names = DisplayAttributeMaskToNames(GetChangedListenableAttributeMask(displayInfo1, displayInfo2));
+    attributes.insert(attributes.end(), names.begin(), names.end());
 }
  
 void ScreenSessionManager::NotifyDisplayAttributeChanged(sptr<DisplayInfo> displayInfo,
@@ -10993,11 +11057,13 @@ void ScreenSessionManager::NotifyScreenDisconnected(ScreenId screenId)
 
 void ScreenSessionManager::NotifyDisplayCreate(sptr<DisplayInfo> displayInfo)
 {
+    displayInfoShm_.Publish(displayInfo);
     ScreenSessionManagerAdapter::GetInstance().OnDisplayCreate(displayInfo);
 }
 
 void ScreenSessionManager::NotifyDisplayDestroy(DisplayId displayId)
 {
+    displayInfoShm_.Remove(displayId);
     ScreenSessionManagerAdapter::GetInstance().OnDisplayDestroy(displayId);
 }
 
@@ -14085,6 +14151,8 @@ void ScreenSessionManager::UpdateAvailableArea(ScreenId screenId, DMRect area)
             physicalScreen->UpdateAvailableArea(area);
         }
     }
+    // the available size is mirrored in shared memory but this path does not go through NotifyDisplayChanged
+    displayInfoShm_.Publish(screenSession->ConvertToDisplayInfo());
     NotifyAvailableAreaChanged(area, screenId);
 }
 
@@ -18124,6 +18192,30 @@ void ScreenSessionManager::SetHoverBlockList(const std::vector<std::string>& hov
 #endif
 }
 
+sptr<Ashmem> ScreenSessionManager::GetDisplayInfoSharedMemory()
+{
+    return displayInfoShm_.GetAshmem();
+}
+
+void ScreenSessionManager::UpdateDisplayInfoShmBypass()
+{
+    std::set<int32_t> hookUids;
+    {
+        std::shared_lock<std::shared_mutex> lock(hookInfoMutex_);
+        for (const auto& [uid, _] : displayHookMap_) {
+            hookUids.insert(static_cast<int32_t>(uid));
+        }
+    }
+    displayInfoShm_.SetBypassUids(hookUids);
+    /* rotation correction is applied per bundle, readers cannot tell whether it concerns them */
+    bool hasCorrectionList = false;
+    if (CORRECTION_ENABLE) {
+        std::shared_lock<std::shared_mutex> lock(rotationCorrectionExemptionMutex_);
+        hasCorrectionList = !rotationCorrectionExemptionList_.empty() || !IsRotationCorrectionWhiteListEmpty();
+    }
+    displayInfoShm_.SetBypassAll(hasCorrectionList);
+}
+
 bool ScreenSessionManager::IsHoverBlockPid(const int32_t agentPid)
 {
 #ifdef FOLD_ABILITY_ENABLE
@@ -109,15 +109,7 @@ void ScreenSessionManagerAdapter::OnDisplayAttributeChange(sptr<DisplayInfo> dis
         return;
     }
  
-    std::set<sptr<IDisplayManagerAgent>> agents;
-    dmAttributeAgentContainer_.ParseAttributeAgentsMap([&](auto& map) {
-        for (auto it = map.begin(); it != map.end(); ++it) {
-            if (IsAgentListenedAttributes(it->second.second, attributes)) {
-                agents.insert(it->second.first);
-            }
-        }
-        });
-
+    auto agents = dmAttributeAgentContainer_.GetAgentsByAttributes(attributes);
     for (auto& agent : agents) {
         int32_t agentPid = dmAttributeAgentContainer_.GetAgentPid(agent);
         if (uid != INVALID_UID && ScreenSessionManager::GetInstance().GetStoredPidFromUid(uid, agentPid)) {
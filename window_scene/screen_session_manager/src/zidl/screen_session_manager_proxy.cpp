@@ -5655,4 +5655,29 @@ void ScreenSessionManagerProxy::SetHoverBlockList(const std::vector<std::string>
         return;
     }
 }
+
+sptr<Ashmem> ScreenSessionManagerProxy::GetDisplayInfoSharedMemory()
+{
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        TLOGE(WmsLogTag::DMS, "Remote is nullptr");
+        return nullptr;
+    }
+    MessageParcel reply;
+    MessageParcel data;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
+        return nullptr;
+    }
+    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_INFO_SHARED_MEMORY),
+        data, reply, option) != ERR_NONE) {
+        TLOGE(WmsLogTag::DMS, "SendRequest failed");
+        return nullptr;
+    }
+    if (!reply.ReadBool()) {
+        return nullptr;
+    }
+    return reply.ReadAshmem();
+}
 } // namespace OHOS::Rosen
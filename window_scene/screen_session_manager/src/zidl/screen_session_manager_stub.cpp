@@ -1786,6 +1786,15 @@ int32_t ScreenSessionManagerStub::OnRemoteRequestInner(uint32_t code, MessagePar
             SetHoverBlockList(hoverBlockList);
             break;
         }
+        case DisplayManagerMessage::TRANS_ID_GET_DISPLAY_INFO_SHARED_MEMORY: {
+            sptr<Ashmem> ashmem = GetDisplayInfoSharedMemory();
+            reply.WriteBool(ashmem != nullptr);
+            if (ashmem != nullptr && !reply.WriteAshmem(ashmem)) {
+                TLOGE(WmsLogTag::DMS, "Write ashmem failed");
+                return ERR_INVALID_DATA;
+            }
+            break;
+        }
         default:
             TLOGW(WmsLogTag::DMS, "unknown transaction code");
             return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
@@ -3137,8 +3137,8 @@ WSError SessionStageProxy::UpdatePropertyWhenTriggerMode(const sptr<WindowSessio
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "WriteInterfaceToken failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (!data.WriteParcelable(property.GetRefPtr())) {
-        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write enable failed");
+    if (property == nullptr || !property->MarshallingTriggerModeDelta(data)) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write property failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
     sptr<IRemoteObject> remote = Remote();
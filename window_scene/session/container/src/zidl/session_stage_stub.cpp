@@ -1862,9 +1862,9 @@ int SessionStageStub::HandleUpdateWindowUIType(MessageParcel& data, MessageParce
 int SessionStageStub::HandleUpdatePropertyWhenTriggerMode(MessageParcel& data, MessageParcel& reply)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "called!");
-    sptr<WindowSessionProperty> property = data.ReadParcelable<WindowSessionProperty>();
-    if (property == nullptr) {
-        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "property is nullptr!");
+    sptr<WindowSessionProperty> property = sptr<WindowSessionProperty>::MakeSptr();
+    if (!WindowSessionProperty::UnmarshallingTriggerModeDelta(data, property.GetRefPtr())) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "read property failed!");
         return ERR_INVALID_DATA;
     }
     UpdatePropertyWhenTriggerMode(property);
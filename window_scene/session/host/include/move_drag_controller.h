@@ -122,6 +122,16 @@ struct MoveResampleConfig {
      */
     int32_t secondaryPhaseLeadTimeMs = 0;
 
+    /**
+     * @brief Whether resampled positions are predicted forward to the present time of the next frame.
+     */
+    bool predictionEnable = false;
+
+    /**
+     * @brief Upper bound of the prediction lead, in milliseconds.
+     */
+    int32_t maxPredictionMs = 0;
+
     /**
      * @brief Check whether the given pointer event source type is allowed.
      *
@@ -158,7 +168,9 @@ struct MoveResampleConfig {
             << ", maxFps: " << (maxFps ? std::to_string(*maxFps) : "unlimited")
             << ", pointerTypes: " << StringUtil::JoinValueSet(pointerTypes)
             << ", secondaryPhaseEnable: " << secondaryPhaseEnable
-            << ", secondaryPhaseLeadTimeMs: " << secondaryPhaseLeadTimeMs;
+            << ", secondaryPhaseLeadTimeMs: " << secondaryPhaseLeadTimeMs
+            << ", predictionEnable: " << predictionEnable
+            << ", maxPredictionMs: " << maxPredictionMs;
 
         return oss.str();
     }
@@ -221,12 +233,15 @@ public:
      *
      * If moving is inactive, no update is performed. Otherwise the resampled
      * position is applied and the resulting rectangle is returned in legacy
-     * global (unified) coordinates.
+     * global (unified) coordinates. When prediction is enabled and a present
+     * time is given, the position is predicted forward to that time.
      *
      * @param sampleTimeUs Sample timestamp in microseconds.
+     * @param presentTimeUs Predicted present time of the frame in microseconds.
      * @return Pair of update mode and the resulting target rectangle.
      */
-    std::pair<TargetRectUpdateMode, WSRect> ResampleTargetRectAt(int64_t sampleTimeUs);
+    std::pair<TargetRectUpdateMode, WSRect> ResampleTargetRectAt(int64_t sampleTimeUs,
+        std::optional<int64_t> presentTimeUs = std::nullopt);
 
     /**
      * @brief Gets the delay of the secondary resampling phase from the current vsync.
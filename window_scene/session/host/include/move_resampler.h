@@ -18,9 +18,11 @@
 
 #include <cstdint>
 #include <deque>
+#include <map>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace OHOS {
 namespace Rosen {
@@ -197,6 +199,11 @@ constexpr int64_t DEFAULT_MAX_EVENT_INTERVAL_US = 60'000; // 60ms
  */
 constexpr int64_t STARTUP_DURATION_US = 120'000; // 120ms
 
+/**
+ * @brief Default upper bound of the velocity-based prediction lead (microseconds).
+ */
+constexpr int64_t DEFAULT_MAX_PREDICTION_US = 16'000; // 16ms
+
 /**
  * @brief Move resampler that buffers input events and produces smooth positions
  *        at requested timestamps via interpolation, extrapolation, and filtering.
@@ -241,6 +248,30 @@ public:
      */
     MoveEvent ResampleAt(int64_t targetTimeUs);
 
+    /**
+     * @brief Returns a smoothed position sampled at sampleTimeUs and predicted forward
+     *        to presentTimeUs using the velocity of the latest buffered events.
+     *
+     * The prediction lead is clamped to [0, maxPredictionUs] and ramps up with the
+     * startup phase. Without a fresh velocity estimate the result equals ResampleAt.
+     * The last resampled event keeps the unpredicted position.
+     *
+     * @param sampleTimeUs    The timestamp to resample at (in microseconds).
+     * @param presentTimeUs   The timestamp the position is expected to be presented at.
+     * @param maxPredictionUs Upper bound of the prediction lead (in microseconds).
+     * @return The predicted MoveEvent, timestamped with the effective present time.
+     */
+    MoveEvent PredictAt(int64_t sampleTimeUs, int64_t presentTimeUs,
+                        int64_t maxPredictionUs = DEFAULT_MAX_PREDICTION_US);
+
+    /**
+     * @brief Estimates the pointer velocity from the latest buffered events.
+     *
+     * @return Velocity (vx, vy) in pixels per microsecond, or std::nullopt with
+     *         fewer than two buffered events.
+     */
+    std::optional<std::pair<double, double>> EstimateVelocity() const;
+
     /**
      * @brief Gets the latest resampled position.
      *
@@ -300,6 +331,26 @@ private:
      */
     std::pair<double, double> LinearFitAt(size_t startIdx, size_t endIdx, int64_t targetTimeUs) const;
 
+    /**
+     * @brief Least-squares line fitted over an event range, mean-centered on time.
+     */
+    struct LinearFitResult {
+        double meanT = 0.0;
+        double meanX = 0.0;
+        double meanY = 0.0;
+        double slopeX = 0.0;
+        double slopeY = 0.0;
+    };
+
+    /**
+     * @brief Fits a line over the given valid, non-empty event range.
+     *
+     * @param startIdx Start index of the event range (inclusive).
+     * @param endIdx   End index of the event range (inclusive).
+     * @return The fitted line.
+     */
+    LinearFitResult LinearFit(size_t startIdx, size_t endIdx) const;
+
     /**
      * @brief Computes an interpolated position at targetTimeUs using nearby events.
      *
@@ -401,6 +452,61 @@ private:
      */
     OneEuroFilter filterY_;
 };
+
+/**
+ * @brief Resamples several pointers independently, one MoveResampler track per pointer id.
+ *
+ * Tracks are created on the first event of a pointer with the parameters given
+ * at construction and live until the pointer is removed or the resampler is reset.
+ */
+class MultiPointerMoveResampler {
+public:
+    /**
+     * @brief Creates a MultiPointerMoveResampler whose tracks copy the given resampler.
+     *
+     * @param prototype Resampler configuration used for every new pointer track.
+     */
+    explicit MultiPointerMoveResampler(const MoveResampler& prototype = MoveResampler()) : prototype_(prototype) {}
+
+    /**
+     * @brief Pushes a new input event of the given pointer.
+     */
+    void PushEvent(int32_t pointerId, int64_t timeUs, int32_t posX, int32_t posY);
+
+    /**
+     * @brief Returns the smoothed position of the given pointer at the given timestamp.
+     *
+     * @return The resampled event, or std::nullopt if the pointer has no track.
+     */
+    std::optional<MoveEvent> ResampleAt(int32_t pointerId, int64_t targetTimeUs);
+
+    /**
+     * @brief Returns the predicted position of the given pointer, see MoveResampler::PredictAt.
+     *
+     * @return The predicted event, or std::nullopt if the pointer has no track.
+     */
+    std::optional<MoveEvent> PredictAt(int32_t pointerId, int64_t sampleTimeUs, int64_t presentTimeUs,
+                                       int64_t maxPredictionUs = DEFAULT_MAX_PREDICTION_US);
+
+    /**
+     * @brief Drops the track of a lifted pointer.
+     */
+    void RemovePointer(int32_t pointerId);
+
+    /**
+     * @brief Gets the ids of all tracked pointers in ascending order.
+     */
+    std::vector<int32_t> GetPointerIds() const;
+
+    /**
+     * @brief Drops all pointer tracks.
+     */
+    void Reset();
+
+private:
+    MoveResampler prototype_;
+    std::map<int32_t, MoveResampler> resamplers_;
+};
 } // namespace Rosen
 } // namespace OHOS
 
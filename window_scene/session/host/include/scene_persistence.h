@@ -16,6 +16,11 @@
 #ifndef OHOS_ROSEN_WINDOW_SCENE_SCENE_PERSISTENCE_H
 #define OHOS_ROSEN_WINDOW_SCENE_SCENE_PERSISTENCE_H
 
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
 
 #include <refbase.h>
@@ -29,6 +34,21 @@ class PixelMap;
 } // namespace OHOS::Media
 
 namespace OHOS::Rosen {
+constexpr size_t SNAPSHOT_LATENCY_BUCKET_COUNT = 12;
+
+/*
+ * Latency histograms use log2 buckets in milliseconds, bucket i counts [2^(i-1), 2^i) ms
+ * and the last bucket counts everything above.
+ */
+struct SnapshotPersistStats {
+    int32_t queueDepth = 0;
+    int64_t pendingBytes = 0;
+    uint64_t supersededCount = 0;
+    uint64_t droppedCount = 0;
+    std::array<uint64_t, SNAPSHOT_LATENCY_BUCKET_COUNT> queueLatencyHistogram = {};
+    std::array<uint64_t, SNAPSHOT_LATENCY_BUCKET_COUNT> persistLatencyHistogram = {};
+};
+
 class ScenePersistence : public RefBase {
 public:
     ScenePersistence(const std::string& bundleName, int32_t persistentId, SnapshotStatus capacity = defaultCapacity);
@@ -65,6 +85,7 @@ public:
         const std::function<void()> resetSnapshotCallback = []() {}, SnapshotStatus key = defaultStatus,
         DisplayOrientation rotate = DisplayOrientation::PORTRAIT, bool freeMultiWindow = false);
     bool PersistSnapshot(std::string path, const std::shared_ptr<Media::PixelMap>& pixelMap);
+    static SnapshotPersistStats GetSnapshotPersistStats();
     void SetSnapshotScale(const float snapshotScale) { snapshotScale_ = snapshotScale; };
     void InitPersistentScaledSnapshotParam(bool enabled) { enablePersistentScaledSnapshot_ = enabled; };
     bool IsSavingSnapshot();
@@ -83,6 +104,13 @@ public:
     DisplayOrientation rotate_[SCREEN_COUNT] = {};
 
 private:
+    static void RecordSnapshotLatency(std::array<std::atomic<uint64_t>, SNAPSHOT_LATENCY_BUCKET_COUNT>& histogram,
+        int64_t latencyMs);
+    static void EnqueueSnapshotTask(std::function<void()>&& task, uint64_t taskId, const std::string& taskName,
+        std::function<void()>&& dropCallback);
+    static bool ErasePendingSnapshotTask(uint64_t taskId);
+    void RollbackDroppedSnapshot(SnapshotStatus key, bool freeMultiWindow, int32_t savingSnapshotSum);
+
     static std::string snapshotDirectory_;
     std::string bundleName_;
     int32_t persistentId_;
@@ -106,12 +134,29 @@ private:
     static std::string startWindowDirectory_;
 
     std::atomic<int> savingSnapshotSum_ { 0 };
+    std::atomic<uint64_t> snapshotSaveSeq_[SCREEN_COUNT + 1] = {}; // the last one is for free multi window
     std::atomic<bool> isSavingSnapshot_ = { false };
     float snapshotScale_ = 0.5;
     float snapshotScaleLow_ = 0.5;
     bool enablePersistentScaledSnapshot_ = false;
 
     static std::shared_ptr<WSFFRTHelper> snapshotFfrtHelper_;
+    static std::atomic<int32_t> pendingSnapshotCount_;
+    static std::atomic<int64_t> pendingSnapshotBytes_;
+    static std::atomic<uint64_t> supersededSnapshotCount_;
+    static std::atomic<uint64_t> droppedSnapshotCount_;
+    struct PendingSnapshotTask {
+        uint64_t taskId;
+        std::string taskName;
+        /* undoes what the session recorded for the save when the task is dropped over budget */
+        std::function<void()> dropCallback;
+    };
+    /* queued persist tasks, oldest first */
+    static std::deque<PendingSnapshotTask> pendingSnapshotTasks_;
+    static std::mutex pendingSnapshotTasksMutex_;
+    static std::atomic<uint64_t> pendingSnapshotTaskId_;
+    static std::array<std::atomic<uint64_t>, SNAPSHOT_LATENCY_BUCKET_COUNT> snapshotQueueLatency_;
+    static std::array<std::atomic<uint64_t>, SNAPSHOT_LATENCY_BUCKET_COUNT> snapshotPersistLatency_;
     mutable std::mutex savingSnapshotMutex_;
     mutable std::mutex hasSnapshotMutex_;
     mutable std::mutex snapshotSizeMutex_;
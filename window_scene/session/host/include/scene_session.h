@@ -200,6 +200,14 @@ struct FullInfoForMMI {
     std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
 };
 
+/*
+ * Window infos of the dirty sessions only, action of each window info is add, change or delete.
+ */
+struct IncrementalInfoForMMI {
+    std::vector<MMI::WindowInfo> windowInfoList;
+    std::vector<std::shared_ptr<Media::PixelMap>> pixelMapList;
+};
+
 class SceneSession : public Session {
 public:
     friend class HidumpController;
@@ -618,6 +626,7 @@ public:
     WMError SetFloatNavigationEnabled(bool isEnabled) override;
     WSError HandleLayoutAvoidAreaUpdate(AvoidAreaType avoidArea = AvoidAreaType::TYPE_END);
     WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) override;
+    void ClearLastDragAvoidArea(AvoidAreaType type);
     void UpdateRotationAvoidArea();
     bool CheckGetAvoidAreaAvailable(AvoidAreaType type) override;
     bool CheckGetSubWindowAvoidAreaAvailable(WindowMode winMode, AvoidAreaType type);
@@ -974,6 +983,9 @@ public:
     /**
      * @brief Request a vsync event for drag operation.
      *
+     * The parameters are stored in a latest-wins mailbox, at most one vsync is
+     * requested per frame no matter how many drag events arrive.
+     *
      * @param globalRect The global rectangle of the window.
      * @param isGlobal Whether the rect is in global coordinates.
      * @param needFlush Whether a surface flush is required.
@@ -983,15 +995,9 @@ public:
         const WSRect& globalRect, bool isGlobal, bool needFlush, bool needSetBoundsNextVsync);
 
     /**
-     * @brief Handle the vsync event for drag operation.
-     *
-     * @param globalRect The global rectangle of the window.
-     * @param isGlobal Whether the rect is in global coordinates.
-     * @param needFlush Whether a surface flush is required.
-     * @param needSetBoundsNextVsync Whether to set bounds on the next vsync.
+     * @brief Handle the vsync event for drag operation, flushes the latest drag mailbox.
      */
-    void OnNextVsyncReceivedWhenDrag(
-        const WSRect& globalRect, bool isGlobal, bool needFlush, bool needSetBoundsNextVsync);
+    void OnNextVsyncReceivedWhenDrag();
 
     void RegisterLayoutFullScreenChangeCallback(NotifyLayoutFullScreenChangeFunc&& callback);
 
@@ -1027,6 +1033,11 @@ public:
     bool IsAnyParentSessionDragZooming() const override;
     bool IsNeedNotifyDragEventOnNextVsync() const;
     void NotifiedDragEventOnNextVsync();
+    struct DragRectUpdateStats {
+        uint32_t eventCount = 0;
+        uint32_t ipcCount = 0;
+    };
+    DragRectUpdateStats GetDragRectUpdateStats() const;
     void RegisterSelectModeFunc(GetSelectModeFunc&& func);
     WMError GetSelectMode(SelectMode& selectMode) override;
     void SetFindScenePanelRsNodeByZOrderFunc(FindScenePanelRsNodeByZOrderFunc&& func);
@@ -1661,8 +1672,10 @@ private:
      *
      * @param sampleTimeUs Sample timestamp in microseconds.
      * @param shouldRequestNextVsync Whether to continue the resampling loop.
+     * @param presentTimeUs Predicted present time of the frame in microseconds.
      */
-    void PerformMoveResampleAt(int64_t sampleTimeUs, bool shouldRequestNextVsync = true);
+    void PerformMoveResampleAt(int64_t sampleTimeUs, bool shouldRequestNextVsync = true,
+        std::optional<int64_t> presentTimeUs = std::nullopt);
 
     /*
      * Window Decor
@@ -1788,6 +1801,25 @@ private:
     void ApplySessionEventParam(SessionEvent event, const SessionEventParam& param);
     std::atomic<bool> shouldFollowParentWhenShow_ = true;
     bool isDragging_ = false;
+
+    /*
+     * Drag rect mailbox, flushed to the client once per vsync
+     */
+    struct DragRectMailbox {
+        WSRect globalRect;
+        bool isGlobal = false;
+        bool needFlush = false;
+        bool needSetBoundsNextVsync = false;
+        bool vsyncRequested = false;
+    };
+    static bool IsDragRectUpdateReason(SizeChangeReason reason);
+    void ResetDragRectUpdateStats();
+    void FilterUnchangedDragAvoidAreas(SizeChangeReason reason, std::map<AvoidAreaType, AvoidArea>& avoidAreas);
+    std::mutex dragRectMailboxMutex_;
+    DragRectMailbox dragRectMailbox_;
+    std::atomic<uint32_t> dragRectEventCount_ { 0 };
+    std::atomic<uint32_t> dragRectIpcCount_ { 0 };
+    std::map<AvoidAreaType, AvoidArea> lastDragAvoidAreas_; // only accessed on the session task thread
     std::atomic<bool> isCrossAxisOfLayout_ = false;
     std::atomic<uint32_t> crossAxisState_ = 0;
 
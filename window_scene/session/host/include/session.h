@@ -721,6 +721,7 @@ public:
     virtual void SetZOrder(uint32_t zOrder);
     uint32_t GetZOrder() const;
     uint32_t GetLastZOrder() const;
+    static uint64_t GetZOrderChangeCount();
 
     void SetUINodeId(uint32_t uiNodeId);
     uint32_t GetUINodeId() const;
@@ -1206,6 +1207,7 @@ protected:
      */
     uint32_t zOrder_ = 0;
     uint32_t lastZOrder_ = 0;
+    static std::atomic<uint64_t> zOrderChangeCount_; // bumped on every zOrder change of any session
 
     /*
      * Window Focus
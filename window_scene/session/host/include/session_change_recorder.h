@@ -16,11 +16,14 @@
 #ifndef OHOS_ROSEN_SESSION_CHANGE_RECORDER_H
 #define OHOS_ROSEN_SESSION_CHANGE_RECORDER_H
 
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <queue>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "window_manager_hilog.h"
 #include "wm_single_instance.h"
@@ -47,7 +50,38 @@ struct SceneSessionChangeInfo {
     int32_t persistentId_ = INVALID_SESSION_ID;
     std::string changeInfo_ = "";
     WmsLogTag logTag_ = WmsLogTag::DEFAULT;
-    std::string time_ = "";
+    int64_t timestamp_ = 0; // microseconds since epoch, set at record time and formatted at dump time
+};
+
+/**
+ * @brief Fixed-size byte ring of binary change records.
+ *
+ * Only the owner thread appends, so appending takes no lock. Readers copy the ring
+ * and keep the records the writer did not overwrite meanwhile. The buffer is
+ * allocated on the first append.
+ */
+class SessionChangeRing {
+public:
+    SessionChangeRing();
+    void Append(RecordType recordType, const SceneSessionChangeInfo& changeInfo, int64_t timestamp);
+    void Collect(std::vector<std::pair<RecordType, SceneSessionChangeInfo>>& records) const;
+    void Clear();
+
+private:
+    void WriteBytes(uint64_t pos, const void* src, size_t len);
+    static void ReadBytes(const uint8_t* buffer, uint64_t pos, void* dst, size_t len);
+
+    std::unique_ptr<uint8_t[]> buffer_;
+    std::atomic<uint64_t> reserved_ { 0 };
+    std::atomic<uint64_t> head_ { 0 };
+    std::atomic<uint64_t> clearedPos_ { 0 };
+};
+
+/**
+ * @brief Rings of one recording thread, one per record type so frequent types do not evict rare ones.
+ */
+struct SessionChangeRingSet {
+    std::array<SessionChangeRing, static_cast<size_t>(RecordType::RECORD_TYPE_END) + 1> rings;
 };
 
 class SessionChangeRecorder {
@@ -72,26 +106,28 @@ public:
 
     void Init();
     void GetSceneSessionNeedDumpInfo(const std::vector<std::string>& dumpParams, std::string& dumpInfo);
+    void ClearRecords();
     std::atomic<bool> stopLogFlag_ { false };
     std::atomic<bool> isInitFlag_ { false };
 
 private:
     SessionChangeRecorder() = default;
-    virtual ~SessionChangeRecorder();
-    void RecordLog(RecordType recordType, SceneSessionChangeInfo& changeInfo);
-    void PrintLog(std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedDumpMap);
-    void RecordDump(RecordType recordType, SceneSessionChangeInfo& changeInfo);
+    virtual ~SessionChangeRecorder() = default;
+    SessionChangeRingSet& GetThreadRingSet(bool& isShared);
+    std::unordered_map<RecordType, std::vector<SceneSessionChangeInfo>> CollectRecords();
     std::string FormatDumpInfoToJsonString (uint32_t specifiedRecordType, int32_t specifiedWindowId,
-    std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>>& dumpMap);
+    std::unordered_map<RecordType, std::vector<SceneSessionChangeInfo>>& dumpMap);
     void SimplifyDumpInfo(std::string& dumpInfo, std::string preCompressInfo);
     int CompressString(const char* in_str, size_t in_len, std::string& out_str, int level);
 
-    std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedLogMap_;
-    std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedDumpMap_;
     std::unordered_map<RecordType, uint32_t> recordSizeMap_;
     std::mutex sessionChangeRecorderMutex_;
-    uint32_t currentLogSize_ = 0;
-    std::thread mThread;
+    /* one ring set per recording thread, ring sets of exited threads are kept until the limit is reached */
+    std::vector<std::shared_ptr<SessionChangeRingSet>> ringSets_;
+    /* used by threads registering past the limit, appends to it are serialized by sharedRingSetMutex_ */
+    std::shared_ptr<SessionChangeRingSet> sharedRingSet_;
+    std::mutex ringsMutex_;
+    std::mutex sharedRingSetMutex_;
 };
 } // namespace OHOS::Rosen
 #endif // OHOS_ROSEN_SESSION_CHANGE_RECORDER_H
\ No newline at end of file
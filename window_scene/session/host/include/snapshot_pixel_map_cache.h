@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_SNAPSHOT_PIXEL_MAP_CACHE_H
+#define OHOS_ROSEN_WINDOW_SCENE_SNAPSHOT_PIXEL_MAP_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OHOS::Media {
+class PixelMap;
+} // namespace OHOS::Media
+
+namespace OHOS::Rosen {
+/*
+ * Byte budgeted LRU of decoded snapshots, keyed by snapshot file path.
+ * The path encodes bundle, persistentId and screen status; entries must be invalidated
+ * whenever the file behind the path is rewritten, renamed or removed.
+ * The cache keeps its own copies: Put stores a copy and Get returns a fresh copy, so callers
+ * may hand the result to ArkUI or modify it without touching the cached pixels.
+ */
+class SnapshotPixelMapCache {
+public:
+    static SnapshotPixelMapCache& GetInstance();
+
+    std::shared_ptr<Media::PixelMap> Get(const std::string& path, float scale);
+    void Put(const std::string& path, float scale, const std::shared_ptr<Media::PixelMap>& pixelMap);
+    void Invalidate(const std::string& path);
+    void Clear();
+
+    /* called on screen lock and low memory kills, entries can be decoded again from disk */
+    void TrimToBytes(int64_t targetBytes);
+
+    int64_t GetUsedBytes() const;
+    size_t GetEntryCount() const;
+
+private:
+    SnapshotPixelMapCache();
+    ~SnapshotPixelMapCache() = default;
+    void EvictLocked(int64_t targetBytes);
+
+    struct CacheEntry {
+        std::string path;
+        float scale = 1.0f;
+        int64_t bytes = 0;
+        std::shared_ptr<Media::PixelMap> pixelMap;
+    };
+
+    mutable std::mutex cacheMutex_;
+    std::list<CacheEntry> lruList_; // front is the most recently used
+    std::unordered_map<std::string, std::list<CacheEntry>::iterator> entryMap_;
+    int64_t byteBudget_ = 0;
+    int64_t usedBytes_ = 0;
+};
+} // namespace OHOS::Rosen
+
+#endif // OHOS_ROSEN_WINDOW_SCENE_SNAPSHOT_PIXEL_MAP_CACHE_H
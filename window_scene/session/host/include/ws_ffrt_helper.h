@@ -45,11 +45,15 @@ public:
     ~WSFFRTHelper();
     void SubmitTask(std::function<void()>&& task, const std::string& taskName, uint64_t delayTime = 0,
         TaskQos qos = TaskQos::USER_INTERACTIVE);
+    /* unlike SubmitTask, never runs inline on an ffrt task, so the task stays cancellable until it starts */
+    void SubmitQueuedTask(std::function<void()>&& task, const std::string& taskName);
     void CancelTask(const std::string& taskName);
     bool IsTaskExisted(const std::string& taskName) const;
     std::size_t CountTask() const;
 
 private:
+    void SubmitToQueue(std::function<void()>&& task, const std::string& taskName);
+
     std::unique_ptr<TaskHandleMap> taskHandleMap_;
     std::unique_ptr<ffrt::queue> ffrtQueue_;
 };
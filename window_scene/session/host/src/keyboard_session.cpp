@@ -381,6 +381,9 @@ void KeyboardSession::NotifyOccupiedAreaChanged(const sptr<SceneSession>& callin
         if (needRecalculateAvoidAreas) {
             callingSession->GetAllAvoidAreas(avoidAreas);
         }
+        for (const auto& [type, _] : avoidAreas) {
+            callingSession->ClearLastDragAvoidArea(type);
+        }
         const WSRect& callingSessionRect = callingSession->GetSessionRect();
         callingSession->NotifyOccupiedAreaChangeInfo(occupiedAreaInfo, rsTransaction,
             SessionHelper::TransferToRect(callingSessionRect), avoidAreas);
@@ -66,6 +66,9 @@ constexpr const char* MOVE_RESAMPLE_SECONDARY_PHASE_ENABLE_PARAM_KEY =
     "persist.windowlayout.moveresample.secondaryphase.enable";
 constexpr const char* MOVE_RESAMPLE_SECONDARY_PHASE_LEAD_TIME_MS_PARAM_KEY =
     "persist.windowlayout.moveresample.secondaryphase.leadtimems";
+constexpr const char* MOVE_RESAMPLE_PREDICTION_ENABLE_PARAM_KEY = "persist.windowlayout.moveresample.prediction.enable";
+constexpr const char* MOVE_RESAMPLE_MAX_PREDICTION_MS_PARAM_KEY =
+    "persist.windowlayout.moveresample.prediction.maxleadms";
 
 // The system parameter key for moving event throttle interval configuration.
 constexpr const char* MOVING_EVENT_THROTTLE_INTERVAL_PARAM_KEY = "persist.windowlayout.movingevent.throttleinterval";
@@ -1466,7 +1469,8 @@ TargetRectUpdateMode MoveDragController::UpdateTargetRectOnMoveEnd(
     return TargetRectUpdateMode::UPDATED_IMMEDIATELY;
 }
 
-std::pair<TargetRectUpdateMode, WSRect> MoveDragController::ResampleTargetRectAt(int64_t sampleTimeUs)
+std::pair<TargetRectUpdateMode, WSRect> MoveDragController::ResampleTargetRectAt(int64_t sampleTimeUs,
+    std::optional<int64_t> presentTimeUs)
 {
     if (!GetStartMoveFlag()) {
         TLOGW(WmsLogTag::WMS_LAYOUT, "Not in moving state, skip resampled targetRect update.");
@@ -1492,7 +1496,10 @@ std::pair<TargetRectUpdateMode, WSRect> MoveDragController::ResampleTargetRectAt
 
     // Resample on the requested frame time so adjacent vsync intervals advance
     // evenly even when input events are not delivered at a stable cadence.
-    auto sample = moveResampler_.ResampleAt(sampleTimeUs);
+    constexpr int64_t US_PER_MS = 1000;
+    auto sample = (moveResampleConfig_.predictionEnable && presentTimeUs) ?
+        moveResampler_.PredictAt(sampleTimeUs, *presentTimeUs, moveResampleConfig_.maxPredictionMs * US_PER_MS) :
+        moveResampler_.ResampleAt(sampleTimeUs);
 
     // Update internal targetRect_ using the resampled offset.
     UpdateTargetRectWithOffset(sample.posX, sample.posY, moveDragProperty_.targetRectChangeReason_);
@@ -2089,6 +2096,8 @@ void MoveDragController::SaveMoveResampleSystemConfig(const MoveResampleConfig&
                          config.secondaryPhaseEnable ? "true" : "false");
     system::SetParameter(MOVE_RESAMPLE_SECONDARY_PHASE_LEAD_TIME_MS_PARAM_KEY,
                          std::to_string(config.secondaryPhaseLeadTimeMs));
+    system::SetParameter(MOVE_RESAMPLE_PREDICTION_ENABLE_PARAM_KEY, config.predictionEnable ? "true" : "false");
+    system::SetParameter(MOVE_RESAMPLE_MAX_PREDICTION_MS_PARAM_KEY, std::to_string(config.maxPredictionMs));
 
     TLOGD(WmsLogTag::WMS_LAYOUT, "%{public}s", config.ToString().c_str());
 }
@@ -2107,6 +2116,10 @@ MoveResampleConfig MoveDragController::LoadMoveResampleSystemConfig()
     config.secondaryPhaseLeadTimeMs =
         GetOptionalNumericParameter<int32_t>(MOVE_RESAMPLE_SECONDARY_PHASE_LEAD_TIME_MS_PARAM_KEY)
             .value_or(2); // 2: default lead time
+    config.predictionEnable = system::GetBoolParameter(MOVE_RESAMPLE_PREDICTION_ENABLE_PARAM_KEY, false);
+    config.maxPredictionMs =
+        GetOptionalNumericParameter<int32_t>(MOVE_RESAMPLE_MAX_PREDICTION_MS_PARAM_KEY)
+            .value_or(DEFAULT_MAX_PREDICTION_US / 1000); // 1000: us to ms
 
     TLOGD(WmsLogTag::WMS_LAYOUT, "%{public}s", config.ToString().c_str());
     return config;
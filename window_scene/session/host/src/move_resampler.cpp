@@ -20,6 +20,11 @@
 
 namespace OHOS {
 namespace Rosen {
+namespace {
+constexpr int64_t STALE_EVENT_THRESHOLD_US = 16000; // 16ms
+constexpr size_t MAX_FIT_EVENT_COUNT = 4;
+} // namespace
+
 double OneEuroFilter::Filter(int64_t curTimeUs, double curValue)
 {
     if (auto initValue = InitializeIfNeeded(curTimeUs, curValue)) {
@@ -116,8 +121,7 @@ void MoveResampler::PushEvent(int64_t timeUs, int32_t posX, int32_t posY)
 
 MoveEvent MoveResampler::ResampleAt(int64_t targetTimeUs)
 {
-    constexpr int64_t staleEventThresholdUs = 16000; // 16ms
-    if (events_.empty() || targetTimeUs - lastRawEvent_.timeUs >= staleEventThresholdUs) {
+    if (events_.empty() || targetTimeUs - lastRawEvent_.timeUs >= STALE_EVENT_THRESHOLD_US) {
         const auto& event = lastResampledEvent_ ? *lastResampledEvent_ : lastRawEvent_;
         return {
             .timeUs = targetTimeUs,
@@ -141,6 +145,43 @@ MoveEvent MoveResampler::ResampleAt(int64_t targetTimeUs)
     return *lastResampledEvent_;
 }
 
+MoveEvent MoveResampler::PredictAt(int64_t sampleTimeUs, int64_t presentTimeUs, int64_t maxPredictionUs)
+{
+    MoveEvent sample = ResampleAt(sampleTimeUs);
+    if (events_.empty() || sampleTimeUs - lastRawEvent_.timeUs >= STALE_EVENT_THRESHOLD_US) {
+        return sample;
+    }
+    auto velocity = EstimateVelocity();
+    if (!velocity) {
+        return sample;
+    }
+
+    double leadUs = static_cast<double>(std::clamp<int64_t>(presentTimeUs - sampleTimeUs, 0,
+                                                            std::max<int64_t>(maxPredictionUs, 0)));
+    // Ramp the prediction in with the startup smoothing so a drag does not start with a jump.
+    if (startupPhase_ && startupDurationUs_ > 0) {
+        double progress = static_cast<double>(sampleTimeUs - startupTimeUs_) / startupDurationUs_;
+        leadUs *= std::clamp(progress, 0.0, 1.0);
+    }
+    const auto [velocityX, velocityY] = *velocity;
+    return {
+        .timeUs = sampleTimeUs + static_cast<int64_t>(leadUs),
+        .posX = static_cast<int32_t>(std::round(sample.posX + velocityX * leadUs)),
+        .posY = static_cast<int32_t>(std::round(sample.posY + velocityY * leadUs))
+    };
+}
+
+std::optional<std::pair<double, double>> MoveResampler::EstimateVelocity() const
+{
+    if (events_.size() < 2) { // 2: a velocity needs at least two events
+        return std::nullopt;
+    }
+    size_t nEvents = events_.size();
+    size_t startIdx = (nEvents > MAX_FIT_EVENT_COUNT) ? (nEvents - MAX_FIT_EVENT_COUNT) : 0;
+    auto fit = LinearFit(startIdx, nEvents - 1);
+    return std::make_pair(fit.slopeX, fit.slopeY);
+}
+
 std::optional<MoveEvent> MoveResampler::GetLastResampledEvent() const
 {
     return lastResampledEvent_;
@@ -244,6 +285,17 @@ std::pair<double, double> MoveResampler::LinearFitAt(size_t startIdx, size_t end
         return {static_cast<double>(e.posX), static_cast<double>(e.posY)};
     }
 
+    auto fit = LinearFit(startIdx, endIdx);
+
+    // Evaluate at target time (mean-centered)
+    double tQuery = static_cast<double>(targetTimeUs) - fit.meanT;
+    double x = fit.meanX + fit.slopeX * tQuery;
+    double y = fit.meanY + fit.slopeY * tQuery;
+    return { x, y };
+}
+
+MoveResampler::LinearFitResult MoveResampler::LinearFit(size_t startIdx, size_t endIdx) const
+{
     size_t n = endIdx - startIdx + 1;
 
     // First pass: compute means
@@ -279,19 +331,12 @@ std::pair<double, double> MoveResampler::LinearFitAt(size_t startIdx, size_t end
     }
 
     constexpr double EPS = 1e-12;
-    double slopeX = 0.0;
-    double slopeY = 0.0;
-
+    LinearFitResult fit = { .meanT = meanT, .meanX = meanX, .meanY = meanY };
     if (std::abs(sumTT) >= EPS) {
-        slopeX = sumTdx / sumTT;
-        slopeY = sumTdy / sumTT;
+        fit.slopeX = sumTdx / sumTT;
+        fit.slopeY = sumTdy / sumTT;
     }
-
-    // Evaluate at target time (mean-centered)
-    double tQuery = static_cast<double>(targetTimeUs) - meanT;
-    double x = meanX + slopeX * tQuery;
-    double y = meanY + slopeY * tQuery;
-    return { x, y };
+    return fit;
 }
 
 std::pair<double, double> MoveResampler::InterpolateLinear(int64_t targetTimeUs) const
@@ -342,9 +387,8 @@ std::pair<double, double> MoveResampler::ExtrapolateFit(int64_t targetTimeUs) co
     constexpr int64_t maxExtrapolateDurationUs = 8000;  // 8ms
     targetTimeUs = std::min(targetTimeUs, lastRawEvent_.timeUs + maxExtrapolateDurationUs);
 
-    constexpr size_t maxFitEventCount = 4;
     size_t nEvents = events_.size();
-    size_t startIdx = (nEvents > maxFitEventCount) ? (nEvents - maxFitEventCount) : 0;
+    size_t startIdx = (nEvents > MAX_FIT_EVENT_COUNT) ? (nEvents - MAX_FIT_EVENT_COUNT) : 0;
     size_t endIdx = nEvents - 1;
     return LinearFitAt(startIdx, endIdx, targetTimeUs);
 }
@@ -356,5 +400,53 @@ void MoveResampler::CleanupOldEvents(int64_t currentTimeUs)
         events_.pop_front();
     }
 }
+
+void MultiPointerMoveResampler::PushEvent(int32_t pointerId, int64_t timeUs, int32_t posX, int32_t posY)
+{
+    auto iter = resamplers_.find(pointerId);
+    if (iter == resamplers_.end()) {
+        iter = resamplers_.emplace(pointerId, prototype_).first;
+    }
+    iter->second.PushEvent(timeUs, posX, posY);
+}
+
+std::optional<MoveEvent> MultiPointerMoveResampler::ResampleAt(int32_t pointerId, int64_t targetTimeUs)
+{
+    auto iter = resamplers_.find(pointerId);
+    if (iter == resamplers_.end()) {
+        return std::nullopt;
+    }
+    return iter->second.ResampleAt(targetTimeUs);
+}
+
+std::optional<MoveEvent> MultiPointerMoveResampler::PredictAt(
+    int32_t pointerId, int64_t sampleTimeUs, int64_t presentTimeUs, int64_t maxPredictionUs)
+{
+    auto iter = resamplers_.find(pointerId);
+    if (iter == resamplers_.end()) {
+        return std::nullopt;
+    }
+    return iter->second.PredictAt(sampleTimeUs, presentTimeUs, maxPredictionUs);
+}
+
+void MultiPointerMoveResampler::RemovePointer(int32_t pointerId)
+{
+    resamplers_.erase(pointerId);
+}
+
+std::vector<int32_t> MultiPointerMoveResampler::GetPointerIds() const
+{
+    std::vector<int32_t> pointerIds;
+    pointerIds.reserve(resamplers_.size());
+    for (const auto& [pointerId, _] : resamplers_) {
+        pointerIds.push_back(pointerId);
+    }
+    return pointerIds;
+}
+
+void MultiPointerMoveResampler::Reset()
+{
+    resamplers_.clear();
+}
 } // namespace Rosen
 } // namespace OHOS
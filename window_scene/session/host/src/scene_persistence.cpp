@@ -17,10 +17,15 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <vector>
 #include <hitrace_meter.h>
 #include <image_packer.h>
 #include <parameters.h>
 
+#include "session/host/include/snapshot_pixel_map_cache.h"
 #include "window_manager_hilog.h"
 
 namespace OHOS::Rosen {
@@ -40,6 +45,13 @@ constexpr int32_t ICON_IMAGE_WIDTH_HEIGHT_SIZE = 1024;
 constexpr double ICON_IMAGE_MAX_SCALE = 1;
 
 constexpr uint8_t SUCCESS = 0;
+constexpr const char* SNAPSHOT_TEMP_SUFFIX = ".tmp";
+constexpr int64_t MAX_PENDING_SNAPSHOT_BYTES = 256 * 1024 * 1024;
+
+int64_t GetElapsedMs(std::chrono::steady_clock::time_point startTime)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
 } // namespace
 
 std::string ScenePersistence::snapshotDirectory_;
@@ -48,6 +60,15 @@ std::string ScenePersistence::abilityIconDirectory_;
 std::string ScenePersistence::startWindowDirectory_;
 std::shared_ptr<WSFFRTHelper> ScenePersistence::snapshotFfrtHelper_;
 bool ScenePersistence::isAstcEnabled_ = false;
+std::atomic<int32_t> ScenePersistence::pendingSnapshotCount_ { 0 };
+std::atomic<int64_t> ScenePersistence::pendingSnapshotBytes_ { 0 };
+std::atomic<uint64_t> ScenePersistence::supersededSnapshotCount_ { 0 };
+std::atomic<uint64_t> ScenePersistence::droppedSnapshotCount_ { 0 };
+std::deque<ScenePersistence::PendingSnapshotTask> ScenePersistence::pendingSnapshotTasks_;
+std::mutex ScenePersistence::pendingSnapshotTasksMutex_;
+std::atomic<uint64_t> ScenePersistence::pendingSnapshotTaskId_ { 0 };
+std::array<std::atomic<uint64_t>, SNAPSHOT_LATENCY_BUCKET_COUNT> ScenePersistence::snapshotQueueLatency_ {};
+std::array<std::atomic<uint64_t>, SNAPSHOT_LATENCY_BUCKET_COUNT> ScenePersistence::snapshotPersistLatency_ {};
 
 bool ScenePersistence::CreateSnapshotDir(const std::string& directory)
 {
@@ -173,11 +194,14 @@ void ScenePersistence::ClearSnapshotPath()
         snapshotFreeMultiWindowPath = snapshotFreeMultiWindowPath_, snapshotScaledPath = snapshotScaledPath_,
         persistentId = persistentId_, where = __func__]() {
         TLOGI(WmsLogTag::WMS_PATTERN, "%{public}s persistentId: %{public}d", where, persistentId);
+        auto& snapshotCache = SnapshotPixelMapCache::GetInstance();
         for (const auto& snapshotPath: snapshotPaths) {
             remove(snapshotPath.c_str());
+            snapshotCache.Invalidate(snapshotPath);
         }
         remove(snapshotScaledPath.c_str());
         remove(snapshotFreeMultiWindowPath.c_str());
+        snapshotCache.Invalidate(snapshotFreeMultiWindowPath);
     };
     snapshotFfrtHelper_->SubmitTask(std::move(task), "ClearSnapshotPath" + std::to_string(persistentId_));
 }
@@ -213,9 +237,27 @@ void ScenePersistence::SaveSnapshot(const std::shared_ptr<Media::PixelMap>& pixe
     TLOGI(WmsLogTag::WMS_PATTERN, "isSavingSnapshot:%{public}d", isSavingSnapshot_.load());
     std::string path = freeMultiWindow ? snapshotFreeMultiWindowPath_ : snapshotPath_[key];
     float scaleValue = snapshotScaleLow_ / snapshotScale_;
+    // a newer save of the same file supersedes this one if it has not started yet
+    int32_t seqIndex = freeMultiWindow ? SCREEN_COUNT : key;
+    uint64_t saveSeq = snapshotSaveSeq_[seqIndex].fetch_add(1) + 1;
+    int64_t pixelBytes = pixelMap != nullptr ? static_cast<int64_t>(pixelMap->GetByteCount()) : 0;
+    uint64_t pendingTaskId = pendingSnapshotTaskId_.fetch_add(1) + 1;
+    pendingSnapshotCount_.fetch_add(1);
+    pendingSnapshotBytes_.fetch_add(pixelBytes);
+    std::shared_ptr<void> pendingGuard(nullptr, [pixelBytes](void*) {
+        pendingSnapshotCount_.fetch_sub(1);
+        pendingSnapshotBytes_.fetch_sub(pixelBytes);
+    });
     auto task = [weakThis = wptr(this), pixelMap, resetSnapshotCallback, savingSnapshotSum = savingSnapshotSum_.load(),
         key, rotate, path, freeMultiWindow, scaledPath = snapshotScaledPath_, scaleValue,
-        enablePersistentScaledSnapshot = enablePersistentScaledSnapshot_]() {
+        enablePersistentScaledSnapshot = enablePersistentScaledSnapshot_, seqIndex, saveSeq, pendingGuard,
+        pendingTaskId, enqueueTime = std::chrono::steady_clock::now()]() {
+        if (!ErasePendingSnapshotTask(pendingTaskId)) {
+            // dropped or superseded after it had started, whoever removed it handled the session state
+            TLOGNI(WmsLogTag::WMS_PATTERN, "removed from queue, path %{public}s", path.c_str());
+            return;
+        }
+        RecordSnapshotLatency(snapshotQueueLatency_, GetElapsedMs(enqueueTime));
         auto scenePersistence = weakThis.promote();
         if (scenePersistence == nullptr || pixelMap == nullptr ||
             path.find('/') == std::string::npos) {
@@ -224,6 +266,12 @@ void ScenePersistence::SaveSnapshot(const std::shared_ptr<Media::PixelMap>& pixe
             resetSnapshotCallback();
             return;
         }
+        if (saveSeq != scenePersistence->snapshotSaveSeq_[seqIndex].load()) {
+            // the newer task persists the file and resets the snapshot cache
+            TLOGNI(WmsLogTag::WMS_PATTERN, "superseded, path %{public}s", path.c_str());
+            supersededSnapshotCount_.fetch_add(1);
+            return;
+        }
 
         if (!scenePersistence->PersistSnapshot(path, pixelMap)) {
             resetSnapshotCallback();
@@ -251,7 +299,73 @@ void ScenePersistence::SaveSnapshot(const std::shared_ptr<Media::PixelMap>& pixe
             resetSnapshotCallback();
         }
     };
-    snapshotFfrtHelper_->SubmitTask(std::move(task), "SaveSnapshot" + path);
+    auto dropCallback = [weakThis = wptr(this), resetSnapshotCallback,
+        savingSnapshotSum = savingSnapshotSum_.load(), key, freeMultiWindow]() {
+        if (auto scenePersistence = weakThis.promote()) {
+            scenePersistence->RollbackDroppedSnapshot(key, freeMultiWindow, savingSnapshotSum);
+        }
+        resetSnapshotCallback();
+    };
+    pendingGuard.reset();
+    EnqueueSnapshotTask(std::move(task), pendingTaskId, "SaveSnapshot" + path, std::move(dropCallback));
+}
+
+void ScenePersistence::EnqueueSnapshotTask(std::function<void()>&& task, uint64_t taskId,
+    const std::string& taskName, std::function<void()>&& dropCallback)
+{
+    std::vector<std::function<void()>> dropCallbacks;
+    {
+        std::lock_guard<std::mutex> lock(pendingSnapshotTasksMutex_);
+        // a queued save of the same file is superseded by this one
+        snapshotFfrtHelper_->CancelTask(taskName);
+        pendingSnapshotTasks_.erase(std::remove_if(pendingSnapshotTasks_.begin(), pendingSnapshotTasks_.end(),
+            [&taskName](const auto& pendingTask) { return pendingTask.taskName == taskName; }),
+            pendingSnapshotTasks_.end());
+        pendingSnapshotTasks_.push_back({ taskId, taskName, std::move(dropCallback) });
+        // queue even when called on an ffrt task, otherwise neither the cancel above nor the budget below applies
+        snapshotFfrtHelper_->SubmitQueuedTask(std::move(task), taskName);
+        // over budget, drop the oldest queued saves but never the newest one
+        while (pendingSnapshotBytes_.load() > MAX_PENDING_SNAPSHOT_BYTES && pendingSnapshotTasks_.size() > 1) {
+            auto& pendingTask = pendingSnapshotTasks_.front();
+            TLOGW(WmsLogTag::WMS_PATTERN, "pending bytes over budget, drop %{public}s", pendingTask.taskName.c_str());
+            snapshotFfrtHelper_->CancelTask(pendingTask.taskName);
+            dropCallbacks.push_back(std::move(pendingTask.dropCallback));
+            pendingSnapshotTasks_.pop_front();
+            droppedSnapshotCount_.fetch_add(1);
+        }
+    }
+    // the callbacks reach into the session, run them without holding the queue lock
+    for (auto& callback : dropCallbacks) {
+        if (callback) {
+            callback();
+        }
+    }
+}
+
+// the file is never written, so the snapshot recorded for it is taken back like a failed save
+void ScenePersistence::RollbackDroppedSnapshot(SnapshotStatus key, bool freeMultiWindow, int32_t savingSnapshotSum)
+{
+    if (freeMultiWindow) {
+        SetHasSnapshotFreeMultiWindow(false);
+    } else {
+        SetHasSnapshot(false, key);
+    }
+    // a later save still in flight keeps the saving state
+    if (savingSnapshotSum == savingSnapshotSum_.load()) {
+        SetIsSavingSnapshot(false);
+    }
+}
+
+bool ScenePersistence::ErasePendingSnapshotTask(uint64_t taskId)
+{
+    std::lock_guard<std::mutex> lock(pendingSnapshotTasksMutex_);
+    auto iter = std::find_if(pendingSnapshotTasks_.begin(), pendingSnapshotTasks_.end(),
+        [taskId](const auto& pendingTask) { return pendingTask.taskId == taskId; });
+    if (iter == pendingSnapshotTasks_.end()) {
+        return false;
+    }
+    pendingSnapshotTasks_.erase(iter);
+    return true;
 }
 
 bool ScenePersistence::PersistSnapshot(std::string path, const std::shared_ptr<Media::PixelMap>& pixelMap)
@@ -265,27 +379,63 @@ bool ScenePersistence::PersistSnapshot(std::string path, const std::shared_ptr<M
     option.quality = IsAstcEnabled() ? ASTC_IMAGE_QUALITY : IMAGE_QUALITY;
     option.numberHint = 1;
 
+    auto startTime = std::chrono::steady_clock::now();
+    // pack into a temp file and rename it, so readers never see a partially written snapshot
+    std::string tempPath = path + SNAPSHOT_TEMP_SUFFIX;
     std::lock_guard lock(savingSnapshotMutex_);
-    if (auto ret = remove(path.c_str())) {
-        TLOGD(WmsLogTag::WMS_PATTERN, "Remove %{public}s failed ret:%{public}d", path.c_str(), ret);
+    if (auto ret = remove(tempPath.c_str())) {
+        TLOGD(WmsLogTag::WMS_PATTERN, "Remove %{public}s failed ret:%{public}d", tempPath.c_str(), ret);
     }
-    if (imagePacker.StartPacking(path, option)) {
+    if (imagePacker.StartPacking(tempPath, option)) {
         TLOGE(WmsLogTag::WMS_PATTERN, "Save snapshot failed, starting packing error");
         return false;
     }
     if (imagePacker.AddImage(*pixelMap)) {
         TLOGE(WmsLogTag::WMS_PATTERN, "Save snapshot failed, adding image error");
+        remove(tempPath.c_str());
         return false;
     }
     int64_t packedSize = 0;
     if (imagePacker.FinalizePacking(packedSize)) {
         TLOGE(WmsLogTag::WMS_PATTERN, "Save snapshot failed, finalizing packing error");
+        remove(tempPath.c_str());
         return false;
     }
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        TLOGE(WmsLogTag::WMS_PATTERN, "Save snapshot failed, rename error:%{public}d", errno);
+        remove(tempPath.c_str());
+        return false;
+    }
+    SnapshotPixelMapCache::GetInstance().Invalidate(path);
+    RecordSnapshotLatency(snapshotPersistLatency_, GetElapsedMs(startTime));
     TLOGI(WmsLogTag::WMS_PATTERN, "Save snapshot end, packed size %{public}" PRId64, packedSize);
     return true;
 }
 
+void ScenePersistence::RecordSnapshotLatency(
+    std::array<std::atomic<uint64_t>, SNAPSHOT_LATENCY_BUCKET_COUNT>& histogram, int64_t latencyMs)
+{
+    size_t bucket = 0;
+    while (bucket + 1 < SNAPSHOT_LATENCY_BUCKET_COUNT && latencyMs >= (static_cast<int64_t>(1) << bucket)) {
+        bucket++;
+    }
+    histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+SnapshotPersistStats ScenePersistence::GetSnapshotPersistStats()
+{
+    SnapshotPersistStats stats;
+    stats.queueDepth = pendingSnapshotCount_.load();
+    stats.pendingBytes = pendingSnapshotBytes_.load();
+    stats.supersededCount = supersededSnapshotCount_.load();
+    stats.droppedCount = droppedSnapshotCount_.load();
+    for (size_t i = 0; i < SNAPSHOT_LATENCY_BUCKET_COUNT; i++) {
+        stats.queueLatencyHistogram[i] = snapshotQueueLatency_[i].load(std::memory_order_relaxed);
+        stats.persistLatencyHistogram[i] = snapshotPersistLatency_[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
 bool ScenePersistence::IsSavingSnapshot()
 {
     return isSavingSnapshot_.load();
@@ -318,6 +468,8 @@ void ScenePersistence::RenameSnapshotFromOldPersistentId(const int32_t& oldPersi
         auto& snapshotPath = scenePersistence->snapshotFreeMultiWindowPath_;
         std::lock_guard lock(scenePersistence->savingSnapshotMutex_);
         int ret = std::rename(oldSnapshotFreeMultiWindowPath.c_str(), snapshotPath.c_str());
+        SnapshotPixelMapCache::GetInstance().Invalidate(oldSnapshotFreeMultiWindowPath);
+        SnapshotPixelMapCache::GetInstance().Invalidate(snapshotPath);
         if (ret == 0) {
             TLOGNI(WmsLogTag::WMS_PATTERN, "Rename snapshot from %{public}s to %{public}s.",
                 oldSnapshotFreeMultiWindowPath.c_str(), snapshotPath.c_str());
@@ -349,6 +501,8 @@ void ScenePersistence::RenameSnapshotFromOldPersistentId(const int32_t& oldPersi
         std::to_string(oldPersistentId) + UNDERLINE_SEPARATOR + std::to_string(key) + suffix;
     std::lock_guard lock(savingSnapshotMutex_);
     int ret = std::rename(oldSnapshotPath.c_str(), snapshotPath.c_str());
+    SnapshotPixelMapCache::GetInstance().Invalidate(oldSnapshotPath);
+    SnapshotPixelMapCache::GetInstance().Invalidate(snapshotPath);
     if (ret == 0) {
         TLOGI(WmsLogTag::WMS_PATTERN, "Rename snapshot from %{public}s to %{public}s.",
             oldSnapshotPath.c_str(), snapshotPath.c_str());
@@ -554,6 +708,13 @@ std::shared_ptr<Media::PixelMap> ScenePersistence::GetLocalSnapshotPixelMap(cons
         return nullptr;
     }
 
+    float scale = (oriScale != 0 && newScale < oriScale) ? newScale / oriScale : 1.0f;
+    auto& snapshotCache = SnapshotPixelMapCache::GetInstance();
+    if (auto pixelMap = snapshotCache.Get(path, scale)) {
+        TLOGD(WmsLogTag::WMS_PATTERN, "hit cache, path %{public}s", path.c_str());
+        return pixelMap;
+    }
+
     uint32_t errorCode = 0;
     Media::SourceOptions sourceOpts;
     const char *astcImageFormat = this->isPcWindow_ ? ASTC_IMAGE_FORMAT_LOW : ASTC_IMAGE_FORMAT_HIGH;
@@ -582,6 +743,9 @@ std::shared_ptr<Media::PixelMap> ScenePersistence::GetLocalSnapshotPixelMap(cons
         decodeOpts.desiredSize.height = isNeedToScale ?
             static_cast<int>(decoderHeight * newScale / oriScale) : decoderHeight;
     }
-    return imageSource->CreatePixelMap(decodeOpts, errorCode);
+    std::shared_ptr<Media::PixelMap> pixelMap = imageSource->CreatePixelMap(decodeOpts, errorCode);
+    /* still under savingSnapshotMutex_, so a concurrent persist cannot invalidate before this put */
+    snapshotCache.Put(path, scale, pixelMap);
+    return pixelMap;
 }
 } // namespace OHOS::Rosen
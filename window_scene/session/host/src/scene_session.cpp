@@ -58,6 +58,7 @@
 #include "session/host/include/scene_persistent_storage.h"
 #include "session/host/include/session_change_recorder.h"
 #include "session/host/include/session_utils.h"
+#include "session/host/include/snapshot_pixel_map_cache.h"
 #include "display_manager.h"
 #include "session_helper.h"
 #include "window_coordinate_helper.h"
@@ -2080,6 +2081,7 @@ WSError SceneSession::NotifyClientToUpdateRectTask(const std::string& updateReas
               persistentId, winRect.ToString().c_str());
         return WSError::WS_ERROR_INVALID_WINDOW_MODE_OR_SIZE;
     }
+    FilterUnchangedDragAvoidAreas(reason, avoidAreas);
 
     // once reason is undefined, not use rsTransaction
     // when rotation, sync cnt++ in marshalling. Although reason is undefined caused by resize
@@ -2087,6 +2089,9 @@ WSError SceneSession::NotifyClientToUpdateRectTask(const std::string& updateReas
                        reason == SizeChangeReason::MOVE || reason == SizeChangeReason::DRAG_MOVE;
     auto transaction = noNeedTrans ? nullptr : rsTransaction;
     WSError ret = Session::UpdateRectWithLayoutInfo(winRect, reason, updateReason, transaction, avoidAreas);
+    if (ret == WSError::WS_OK && IsDragRectUpdateReason(reason)) {
+        dragRectIpcCount_.fetch_add(1, std::memory_order_relaxed);
+    }
 #ifdef DEVICE_STATUS_ENABLE
     // In window rotation scenarios, a transaction will be provided. By reusing this
     // transaction, RS can synchronously apply rotation to both the main window and
@@ -2104,6 +2109,42 @@ WSError SceneSession::NotifyClientToUpdateRectTask(const std::string& updateReas
     return ret;
 }
 
+bool SceneSession::IsDragRectUpdateReason(SizeChangeReason reason)
+{
+    return reason == SizeChangeReason::DRAG || reason == SizeChangeReason::DRAG_MOVE;
+}
+
+/*
+ * During a drag the client keeps the last avoid areas it received,
+ * so only the entries changed since the last drag update are sent.
+ */
+void SceneSession::FilterUnchangedDragAvoidAreas(SizeChangeReason reason,
+    std::map<AvoidAreaType, AvoidArea>& avoidAreas)
+{
+    if (!IsDragRectUpdateReason(reason)) {
+        lastDragAvoidAreas_.clear();
+        return;
+    }
+    for (auto iter = avoidAreas.begin(); iter != avoidAreas.end();) {
+        auto lastIter = lastDragAvoidAreas_.find(iter->first);
+        if (lastIter != lastDragAvoidAreas_.end() && lastIter->second == iter->second) {
+            iter = avoidAreas.erase(iter);
+            continue;
+        }
+        lastDragAvoidAreas_[iter->first] = iter->second;
+        ++iter;
+    }
+}
+
+/*
+ * An avoid area sent outside the drag rect updates replaces what the client holds,
+ * so the next drag update must send that type again.
+ */
+void SceneSession::ClearLastDragAvoidArea(AvoidAreaType type)
+{
+    lastDragAvoidAreas_.erase(type);
+}
+
 WSError SceneSession::NotifyClientToUpdateRect(const std::string& updateReason,
                                                std::optional<WSRect> updateRect,
                                                std::shared_ptr<RSTransaction> rsTransaction)
@@ -4047,6 +4088,7 @@ WSError SceneSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAre
         TLOGD(WmsLogTag::WMS_IMMS, "win [%{public}d] avoid area update rejected by recent", GetPersistentId());
         return WSError::WS_DO_NOTHING;
     }
+    ClearLastDragAvoidArea(type);
     return sessionStage_->UpdateAvoidArea(avoidArea, type);
 }
 
@@ -4648,20 +4690,39 @@ void SceneSession::HandleMoveDragSurfaceBounds(
 void SceneSession::RequestNextVsyncWhenDrag(
     const WSRect& globalRect, bool isGlobal, bool needFlush, bool needSetBoundsNextVsync)
 {
-    RunOnNextVsync([weakThis = wptr(this), globalRect, isGlobal,
-                    needFlush, needSetBoundsNextVsync, where = __func__](int64_t, int64_t) {
+    {
+        std::lock_guard<std::mutex> lock(dragRectMailboxMutex_);
+        dragRectMailbox_.globalRect = globalRect;
+        dragRectMailbox_.isGlobal = isGlobal;
+        dragRectMailbox_.needFlush = needFlush;
+        dragRectMailbox_.needSetBoundsNextVsync = needSetBoundsNextVsync;
+        if (dragRectMailbox_.vsyncRequested || vsyncStation_ == nullptr) {
+            return;
+        }
+        dragRectMailbox_.vsyncRequested = true;
+    }
+    RunOnNextVsync([weakThis = wptr(this), where = __func__](int64_t, int64_t) {
         auto session = weakThis.promote();
         RETURN_IF_NULL_IMPL(session, WmsLogTag::WMS_LAYOUT, where);
-        session->OnNextVsyncReceivedWhenDrag(globalRect, isGlobal, needFlush, needSetBoundsNextVsync);
+        session->OnNextVsyncReceivedWhenDrag();
     });
 }
 
-void SceneSession::OnNextVsyncReceivedWhenDrag(
-    const WSRect& globalRect, bool isGlobal, bool needFlush, bool needSetBoundsNextVsync)
+void SceneSession::OnNextVsyncReceivedWhenDrag()
 {
-    PostTask([weakThis = wptr(this), globalRect, isGlobal, needFlush, needSetBoundsNextVsync, where = __func__] {
+    PostTask([weakThis = wptr(this), where = __func__] {
         auto session = weakThis.promote();
         RETURN_IF_NULL_IMPL(session, WmsLogTag::WMS_LAYOUT, where);
+        DragRectMailbox mailbox;
+        {
+            std::lock_guard<std::mutex> lock(session->dragRectMailboxMutex_);
+            session->dragRectMailbox_.vsyncRequested = false;
+            mailbox = session->dragRectMailbox_;
+        }
+        const WSRect& globalRect = mailbox.globalRect;
+        bool isGlobal = mailbox.isGlobal;
+        bool needFlush = mailbox.needFlush;
+        bool needSetBoundsNextVsync = mailbox.needSetBoundsNextVsync;
         if (session->IsDirtyDragWindow()) {
             WSRect winRect = session->GetSessionRect();
             HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER,
@@ -4704,19 +4765,23 @@ void SceneSession::RequestMoveResampleOnNextVsync()
 void SceneSession::ScheduleMoveResampleTask(int64_t vsyncTimeUs, int64_t delayMs, bool needRequestNextVsync)
 {
     constexpr int64_t US_PER_MS = 1000;
+    constexpr int64_t NS_PER_US = 1000;
     const int64_t sampleTimeUs = vsyncTimeUs + delayMs * US_PER_MS;
-    PostTask([weakThis = wptr(this), sampleTimeUs , needRequestNextVsync] {
+    // Both phases of this vsync feed the frame presented on the next vsync.
+    const int64_t presentTimeUs = vsyncTimeUs + GetVSyncPeriod() / NS_PER_US;
+    PostTask([weakThis = wptr(this), sampleTimeUs, presentTimeUs, needRequestNextVsync] {
         auto session = weakThis.promote();
         RETURN_IF_NULL(session);
-        session->PerformMoveResampleAt(sampleTimeUs, needRequestNextVsync);
+        session->PerformMoveResampleAt(sampleTimeUs, needRequestNextVsync, presentTimeUs);
     }, __func__, delayMs);
 }
 
-void SceneSession::PerformMoveResampleAt(int64_t sampleTimeUs, bool shouldRequestNextVsync)
+void SceneSession::PerformMoveResampleAt(int64_t sampleTimeUs, bool shouldRequestNextVsync,
+    std::optional<int64_t> presentTimeUs)
 {
     RETURN_IF_NULL(moveDragController_);
 
-    auto [mode, rect] = moveDragController_->ResampleTargetRectAt(sampleTimeUs);
+    auto [mode, rect] = moveDragController_->ResampleTargetRectAt(sampleTimeUs, presentTimeUs);
     if (mode == TargetRectUpdateMode::NONE) {
         return;
     }
@@ -5056,6 +5121,13 @@ void SceneSession::OnMoveDragCallback(SizeChangeReason reason, TargetRectUpdateM
     RETURN_IF_NULL_WITH_TAG(moveDragController_, WmsLogTag::WMS_LAYOUT);
     if (reason == SizeChangeReason::DRAG_START) {
         InitializeCrossMoveDrag();
+        ResetDragRectUpdateStats();
+    } else if (IsDragRectUpdateReason(reason)) {
+        dragRectEventCount_.fetch_add(1, std::memory_order_relaxed);
+    } else if (reason == SizeChangeReason::DRAG_END) {
+        auto stats = GetDragRectUpdateStats();
+        TLOGI(WmsLogTag::WMS_LAYOUT, "id:%{public}d, drag events:%{public}u, rect ipcs:%{public}u",
+            GetPersistentId(), stats.eventCount, stats.ipcCount);
     }
     WSRect rect = moveDragController_->GetTargetRect(
         MoveDragController::TargetRectCoordinate::RELATED_TO_START_DISPLAY);
@@ -8003,6 +8075,9 @@ WSError SceneSession::NotifySessionExceptionInner(const sptr<AAFwk::SessionInfo>
             return WSError::WS_ERROR_INVALID_PARAM;
         }
         session->isTerminating_ = true;
+        if (abilitySessionInfo->errorReason == ERROR_REASON_LOW_MEMORY_KILL) {
+            SnapshotPixelMapCache::GetInstance().TrimToBytes(0);
+        }
         SessionInfo info;
         info.abilityName_ = abilitySessionInfo->want.GetElement().GetAbilityName();
         info.bundleName_ = abilitySessionInfo->want.GetElement().GetBundleName();
@@ -8484,6 +8559,23 @@ void SceneSession::ResetDirtyDragFlags()
     isDragging_ = false;
 }
 
+SceneSession::DragRectUpdateStats SceneSession::GetDragRectUpdateStats() const
+{
+    DragRectUpdateStats stats;
+    stats.eventCount = dragRectEventCount_.load(std::memory_order_relaxed);
+    stats.ipcCount = dragRectIpcCount_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SceneSession::ResetDragRectUpdateStats()
+{
+    dragRectEventCount_.store(0, std::memory_order_relaxed);
+    dragRectIpcCount_.store(0, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(dragRectMailboxMutex_);
+    // a vsync request lost with the previous drag must not stall this one
+    dragRectMailbox_.vsyncRequested = false;
+}
+
 bool SceneSession::IsNeedNotifyDragEventOnNextVsync() const
 {
     return needNotifyDragEventOnNextVsync_;
@@ -10024,6 +10116,7 @@ bool SceneSession::UpdateZOrderInner(uint32_t zOrder)
     }
     TLOGI(WmsLogTag::WMS_HIERARCHY, "id: %{public}d, zOrder: %{public}u -> %{public}u, lastZOrder: %{public}u",
           GetPersistentId(), zOrder_, zOrder, lastZOrder_);
+    zOrderChangeCount_.fetch_add(1, std::memory_order_release);
     lastZOrder_ = zOrder_;
     zOrder_ = zOrder;
     return true;
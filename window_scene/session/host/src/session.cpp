@@ -100,6 +100,7 @@ const std::string DETACH_EVENT_NAME { "wms::ReportWindowTimeout_Detach" };
 
 std::shared_ptr<AppExecFwk::EventHandler> Session::mainHandler_;
 bool Session::isScbCoreEnabled_ = false;
+std::atomic<uint64_t> Session::zOrderChangeCount_ = 0;
 
 Session::Session(const SessionInfo& info) : sessionInfo_(info)
 {
@@ -5324,6 +5325,9 @@ WSError Session::UpdateMaximizeMode(bool isMaximize)
 /** @note @window.hierarchy */
 void Session::SetZOrder(uint32_t zOrder)
 {
+    if (zOrder_ != zOrder) {
+        zOrderChangeCount_.fetch_add(1, std::memory_order_release);
+    }
     lastZOrder_ = zOrder_;
     zOrder_ = zOrder;
     NotifySessionInfoChange();
@@ -5341,6 +5345,12 @@ uint32_t Session::GetLastZOrder() const
     return lastZOrder_;
 }
 
+/** @note @window.hierarchy */
+uint64_t Session::GetZOrderChangeCount()
+{
+    return zOrderChangeCount_.load(std::memory_order_acquire);
+}
+
 void Session::SetUINodeId(uint32_t uiNodeId)
 {
     if (uiNodeId_ != 0 && uiNodeId != 0 && !IsSystemSession() && SessionPermission::IsBetaVersion()) {
@@ -18,6 +18,8 @@
 #include <algorithm>
 #include <charconv>
 #include <chrono>
+#include <iomanip>
+#include <sstream>
 
 #include "window_helper.h"
 #include "zlib.h"
@@ -28,28 +30,126 @@ namespace {
 #define COMPRESS_VERSION 9
 
 constexpr uint32_t MAX_RECORD_TYPE_SIZE = 10;
-constexpr uint32_t MAX_RECORD_LOG_SIZE = 102400;
 constexpr uint32_t MAX_EVENT_DUMP_SIZE = 512 * 1024;
-constexpr int32_t SCHEDULE_SECONDS = 5;
+constexpr size_t RING_CAPACITY = 16 * 1024;
+constexpr size_t MAX_RECORD_INFO_SIZE = 8 * 1024;
+constexpr size_t MAX_RING_COUNT = 64;
+constexpr int64_t US_PER_SECOND = 1000000;
+constexpr int64_t US_PER_MS = 1000;
+
+struct RecordHeader {
+    int64_t timestamp;
+    int32_t persistentId;
+    uint32_t recordType;
+    uint32_t logTag;
+    uint32_t infoSize;
+};
+using RecordTrailer = uint32_t; // total record size, lets readers walk the ring backwards
+constexpr size_t RECORD_OVERHEAD = sizeof(RecordHeader) + sizeof(RecordTrailer);
+
+int64_t GetCurrentTimestamp()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
 
 // LCOV_EXCL_START
-std::string GetFormattedTime()
+std::string FormatTimestamp(int64_t timestamp)
 {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
+    std::time_t t = static_cast<std::time_t>(timestamp / US_PER_SECOND);
     struct tm timeBuffer;
     std::tm* tmPtr = localtime_r(&t, &timeBuffer);
-    // 1000：million record
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-    
+    int64_t ms = (timestamp % US_PER_SECOND) / US_PER_MS;
+
     std::ostringstream oss;
     const int formatThreeSpace = 3;
-    oss << std::put_time(tmPtr, "%m-%d %H:%M:%S") << "." << std::setw(formatThreeSpace) << ms.count();
+    oss << std::put_time(tmPtr, "%m-%d %H:%M:%S") << "." << std::setfill('0') << std::setw(formatThreeSpace) << ms;
     return oss.str();
 }
 // LCOV_EXCL_STOP
 } // namespace
 
+SessionChangeRing::SessionChangeRing() = default;
+
+void SessionChangeRing::WriteBytes(uint64_t pos, const void* src, size_t len)
+{
+    size_t offset = pos % RING_CAPACITY;
+    size_t firstPart = std::min(len, RING_CAPACITY - offset);
+    std::copy_n(static_cast<const uint8_t*>(src), firstPart, buffer_.get() + offset);
+    std::copy_n(static_cast<const uint8_t*>(src) + firstPart, len - firstPart, buffer_.get());
+}
+
+void SessionChangeRing::ReadBytes(const uint8_t* buffer, uint64_t pos, void* dst, size_t len)
+{
+    size_t offset = pos % RING_CAPACITY;
+    size_t firstPart = std::min(len, RING_CAPACITY - offset);
+    std::copy_n(buffer + offset, firstPart, static_cast<uint8_t*>(dst));
+    std::copy_n(buffer, len - firstPart, static_cast<uint8_t*>(dst) + firstPart);
+}
+
+void SessionChangeRing::Append(RecordType recordType, const SceneSessionChangeInfo& changeInfo, int64_t timestamp)
+{
+    size_t infoSize = std::min(changeInfo.changeInfo_.size(), MAX_RECORD_INFO_SIZE);
+    RecordHeader header = { timestamp, changeInfo.persistentId_, static_cast<uint32_t>(recordType),
+        static_cast<uint32_t>(changeInfo.logTag_), static_cast<uint32_t>(infoSize) };
+    RecordTrailer recordSize = static_cast<RecordTrailer>(RECORD_OVERHEAD + infoSize);
+    if (buffer_ == nullptr) {
+        /* published to readers by the release store of head_ below */
+        buffer_ = std::make_unique<uint8_t[]>(RING_CAPACITY);
+    }
+    uint64_t pos = head_.load(std::memory_order_relaxed);
+    /* announce the bytes about to be overwritten before touching them */
+    reserved_.store(pos + recordSize, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    WriteBytes(pos, &header, sizeof(header));
+    WriteBytes(pos + sizeof(header), changeInfo.changeInfo_.data(), infoSize);
+    WriteBytes(pos + sizeof(header) + infoSize, &recordSize, sizeof(recordSize));
+    head_.store(pos + recordSize, std::memory_order_release);
+}
+
+void SessionChangeRing::Collect(std::vector<std::pair<RecordType, SceneSessionChangeInfo>>& records) const
+{
+    uint64_t head = head_.load(std::memory_order_acquire);
+    if (head == 0) {
+        return;
+    }
+    auto snapshot = std::make_unique<uint8_t[]>(RING_CAPACITY);
+    std::copy_n(buffer_.get(), RING_CAPACITY, snapshot.get());
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t reserved = reserved_.load(std::memory_order_relaxed);
+    uint64_t validBegin = std::max(clearedPos_.load(), reserved > RING_CAPACITY ? reserved - RING_CAPACITY : 0);
+
+    size_t firstRecord = records.size();
+    uint64_t pos = head;
+    while (pos >= validBegin + RECORD_OVERHEAD) {
+        RecordTrailer recordSize = 0;
+        ReadBytes(snapshot.get(), pos - sizeof(RecordTrailer), &recordSize, sizeof(recordSize));
+        if (recordSize < RECORD_OVERHEAD || recordSize > pos - validBegin) {
+            break;
+        }
+        pos -= recordSize;
+        RecordHeader header;
+        ReadBytes(snapshot.get(), pos, &header, sizeof(header));
+        if (header.infoSize + RECORD_OVERHEAD != recordSize) {
+            break;
+        }
+        SceneSessionChangeInfo changeInfo;
+        changeInfo.persistentId_ = header.persistentId;
+        changeInfo.logTag_ = static_cast<WmsLogTag>(header.logTag);
+        changeInfo.timestamp_ = header.timestamp;
+        changeInfo.changeInfo_.resize(header.infoSize);
+        ReadBytes(snapshot.get(), pos + sizeof(header), changeInfo.changeInfo_.data(), header.infoSize);
+        records.emplace_back(static_cast<RecordType>(header.recordType), std::move(changeInfo));
+    }
+    /* walked from newest to oldest */
+    std::reverse(records.begin() + firstRecord, records.end());
+}
+
+void SessionChangeRing::Clear()
+{
+    clearedPos_.store(head_.load(std::memory_order_acquire));
+}
+
 WM_IMPLEMENT_SINGLE_INSTANCE(SessionChangeRecorder)
 
 void SessionChangeRecorder::Init()
@@ -60,41 +160,39 @@ void SessionChangeRecorder::Init()
     }
 
     isInitFlag_.store(true);
-    if (!HiLogIsLoggable(HILOG_DOMAIN_WINDOW, g_domainContents[static_cast<uint32_t>(WmsLogTag::DEFAULT)], LOG_DEBUG)) {
-        stopLogFlag_.store(true);
-        return;
-    }
-    
-    // LCOV_EXCL_START
-    stopLogFlag_.store(false);
-    mThread = std::thread([this]() {
-        std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedLogMapCopy;
-        while (!stopLogFlag_.load()) {
-            {
-                std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
-                if (!sceneSessionChangeNeedLogMap_.empty()) {
-                    sceneSessionChangeNeedLogMapCopy = sceneSessionChangeNeedLogMap_;
-                    sceneSessionChangeNeedLogMap_.clear();
-                    currentLogSize_ = 0;
-                }
-            }
-            if (!sceneSessionChangeNeedLogMapCopy.empty()) {
-                PrintLog(sceneSessionChangeNeedLogMapCopy);
-                sceneSessionChangeNeedLogMapCopy.clear();
-            }
-            std::this_thread::sleep_for(std::chrono::seconds(SCHEDULE_SECONDS));
-        }
-    });
-    // LCOV_EXCL_STOP
+    stopLogFlag_.store(
+        !HiLogIsLoggable(HILOG_DOMAIN_WINDOW, g_domainContents[static_cast<uint32_t>(WmsLogTag::DEFAULT)], LOG_DEBUG));
 }
 
-SessionChangeRecorder::~SessionChangeRecorder()
+SessionChangeRingSet& SessionChangeRecorder::GetThreadRingSet(bool& isShared)
 {
-    TLOGD(WmsLogTag::DEFAULT, "In");
-    stopLogFlag_.store(true);
-    if (mThread.joinable()) {
-        mThread.join();
+    thread_local std::shared_ptr<SessionChangeRingSet> threadRingSet;
+    thread_local bool isThreadRingSetShared = false;
+    if (threadRingSet != nullptr) {
+        isShared = isThreadRingSetShared;
+        return *threadRingSet;
+    }
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+    if (ringSets_.size() >= MAX_RING_COUNT) {
+        /* drop the ring set of an exited thread, the recorder holds its only reference */
+        auto iter = std::find_if(ringSets_.begin(), ringSets_.end(),
+            [](const std::shared_ptr<SessionChangeRingSet>& ringSet) { return ringSet.use_count() == 1; });
+        if (iter != ringSets_.end()) {
+            ringSets_.erase(iter);
+        }
+    }
+    if (ringSets_.size() < MAX_RING_COUNT) {
+        threadRingSet = std::make_shared<SessionChangeRingSet>();
+        ringSets_.push_back(threadRingSet);
+    } else {
+        if (sharedRingSet_ == nullptr) {
+            sharedRingSet_ = std::make_shared<SessionChangeRingSet>();
+        }
+        threadRingSet = sharedRingSet_;
+        isThreadRingSetShared = true;
     }
+    isShared = isThreadRingSetShared;
+    return *threadRingSet;
 }
 
 // LCOV_EXCL_START
@@ -106,11 +204,20 @@ WSError SessionChangeRecorder::RecordSceneSessionChange(RecordType recordType, S
         TLOGD(WmsLogTag::DEFAULT, "Invalid log tag");
         return WSError::WS_ERROR_INVALID_PARAM;
     }
-    if (changeInfo.time_ == "") {
-        changeInfo.time_ = GetFormattedTime();
+    if (!stopLogFlag_.load()) {
+        TLOGD(changeInfo.logTag_, "winId: %{public}d, changeInfo: %{public}s",
+            changeInfo.persistentId_, changeInfo.changeInfo_.c_str());
+    }
+    uint32_t ringIndex =
+        std::min(static_cast<uint32_t>(recordType), static_cast<uint32_t>(RecordType::RECORD_TYPE_END));
+    bool isShared = false;
+    SessionChangeRing& ring = GetThreadRingSet(isShared).rings[ringIndex];
+    if (isShared) {
+        std::lock_guard<std::mutex> lock(sharedRingSetMutex_);
+        ring.Append(recordType, changeInfo, GetCurrentTimestamp());
+    } else {
+        ring.Append(recordType, changeInfo, GetCurrentTimestamp());
     }
-    RecordLog(recordType, changeInfo);
-    RecordDump(recordType, changeInfo);
     return WSError::WS_OK;
 }
 
@@ -167,11 +274,7 @@ void SessionChangeRecorder::GetSceneSessionNeedDumpInfo(
             specifiedRecordType = value;
         }
     }
-    std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedDumpMapCopy;
-    {
-        std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
-        sceneSessionChangeNeedDumpMapCopy = sceneSessionChangeNeedDumpMap_;
-    }
+    auto sceneSessionChangeNeedDumpMapCopy = CollectRecords();
     std::string dumpInfoJsonString = FormatDumpInfoToJsonString(specifiedRecordType, specifiedWindowId,
         sceneSessionChangeNeedDumpMapCopy);
     oss << dumpInfoJsonString;
@@ -183,24 +286,75 @@ void SessionChangeRecorder::GetSceneSessionNeedDumpInfo(
     }
 }
 
+void SessionChangeRecorder::ClearRecords()
+{
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+    for (const auto& ringSet : ringSets_) {
+        for (auto& ring : ringSet->rings) {
+            ring.Clear();
+        }
+    }
+    if (sharedRingSet_ != nullptr) {
+        for (auto& ring : sharedRingSet_->rings) {
+            ring.Clear();
+        }
+    }
+}
+
+std::unordered_map<RecordType, std::vector<SceneSessionChangeInfo>> SessionChangeRecorder::CollectRecords()
+{
+    std::vector<std::shared_ptr<SessionChangeRingSet>> ringSets;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        ringSets = ringSets_;
+        if (sharedRingSet_ != nullptr) {
+            ringSets.push_back(sharedRingSet_);
+        }
+    }
+    std::vector<std::pair<RecordType, SceneSessionChangeInfo>> records;
+    for (const auto& ringSet : ringSets) {
+        for (const auto& ring : ringSet->rings) {
+            ring.Collect(records);
+        }
+    }
+    std::stable_sort(records.begin(), records.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.timestamp_ < rhs.second.timestamp_;
+    });
+    std::unordered_map<RecordType, uint32_t> recordSizeMap;
+    {
+        std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
+        recordSizeMap = recordSizeMap_;
+    }
+    /* keep the newest records of each type, walking from the newest */
+    std::unordered_map<RecordType, std::vector<SceneSessionChangeInfo>> dumpMap;
+    for (auto iter = records.rbegin(); iter != records.rend(); ++iter) {
+        auto sizeIter = recordSizeMap.find(iter->first);
+        uint32_t maxRecordTypeSize = sizeIter != recordSizeMap.end() ? sizeIter->second : MAX_RECORD_TYPE_SIZE;
+        auto& typeRecords = dumpMap[iter->first];
+        if (typeRecords.size() < maxRecordTypeSize) {
+            typeRecords.push_back(std::move(iter->second));
+        }
+    }
+    for (auto& [_, typeRecords] : dumpMap) {
+        std::reverse(typeRecords.begin(), typeRecords.end());
+    }
+    return dumpMap;
+}
+
 std::string SessionChangeRecorder::FormatDumpInfoToJsonString (uint32_t specifiedRecordType, int32_t specifiedWindowId,
-    std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>>& dumpMap)
+    std::unordered_map<RecordType, std::vector<SceneSessionChangeInfo>>& dumpMap)
 {
     nlohmann::json jsonArrayDump = nlohmann::json::array();
     for (const auto& elem : dumpMap) {
         if (specifiedRecordType && static_cast<uint32_t>(elem.first) != specifiedRecordType) {
             continue;
         }
-        std::queue<SceneSessionChangeInfo> tempDumpQueue = elem.second;
-        while (!tempDumpQueue.empty()) {
-            auto tempQueue = tempDumpQueue.front();
-            if (specifiedWindowId && tempQueue.persistentId_ != specifiedWindowId) {
-                tempDumpQueue.pop();
+        for (const auto& changeInfo : elem.second) {
+            if (specifiedWindowId && changeInfo.persistentId_ != specifiedWindowId) {
                 continue;
             }
-            jsonArrayDump.push_back({{"winId", tempQueue.persistentId_},
-                {"changeInfo", tempQueue.changeInfo_}, {"time", tempQueue.time_}});
-            tempDumpQueue.pop();
+            jsonArrayDump.push_back({{"winId", changeInfo.persistentId_},
+                {"changeInfo", changeInfo.changeInfo_}, {"time", FormatTimestamp(changeInfo.timestamp_)}});
         }
     }
     return jsonArrayDump.dump();
@@ -268,80 +422,5 @@ int SessionChangeRecorder::CompressString (const char* inStr, size_t inLen, std:
     return Z_OK;
 }
 
-void SessionChangeRecorder::RecordDump(RecordType recordType, SceneSessionChangeInfo& changeInfo)
-{
-    TLOGD(WmsLogTag::DEFAULT, "In");
-    uint32_t maxRecordTypeSize = MAX_RECORD_TYPE_SIZE;
-    uint32_t currentRecordTypeSize = MAX_RECORD_TYPE_SIZE;
-    {
-        std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
-        if (sceneSessionChangeNeedDumpMap_.find(recordType) == sceneSessionChangeNeedDumpMap_.end()) {
-            std::queue<SceneSessionChangeInfo> dumpQueue;
-            dumpQueue.push(changeInfo);
-            sceneSessionChangeNeedDumpMap_[recordType] = dumpQueue;
-        } else {
-            sceneSessionChangeNeedDumpMap_[recordType].push(changeInfo);
-        }
-        maxRecordTypeSize = recordSizeMap_.find(recordType) != recordSizeMap_.end() ?
-            recordSizeMap_[recordType] : MAX_RECORD_TYPE_SIZE;
-        currentRecordTypeSize = sceneSessionChangeNeedDumpMap_[recordType].size();
-    }
-
-    if (currentRecordTypeSize > maxRecordTypeSize) {
-        std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
-        uint32_t diff = sceneSessionChangeNeedDumpMap_[recordType].size() - maxRecordTypeSize;
-        while (diff > 0) {
-            sceneSessionChangeNeedDumpMap_[recordType].pop();
-            diff--;
-        }
-    }
-}
-
-void SessionChangeRecorder::RecordLog(RecordType recordType, SceneSessionChangeInfo& changeInfo)
-{
-    TLOGD(WmsLogTag::DEFAULT, "In");
-    uint32_t maxRecordTypeSize = MAX_RECORD_TYPE_SIZE;
-    uint32_t currentRecordTypeSize = MAX_RECORD_TYPE_SIZE;
-    {
-        std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
-        if (sceneSessionChangeNeedLogMap_.find(recordType) == sceneSessionChangeNeedLogMap_.end()) {
-            std::queue<SceneSessionChangeInfo> logQueue;
-            logQueue.push(changeInfo);
-            sceneSessionChangeNeedLogMap_[recordType] = logQueue;
-        } else {
-            sceneSessionChangeNeedLogMap_[recordType].push(changeInfo);
-        }
-        currentLogSize_ += changeInfo.changeInfo_.size();
-        maxRecordTypeSize = recordSizeMap_.find(recordType) != recordSizeMap_.end() ?
-            recordSizeMap_[recordType] : MAX_RECORD_TYPE_SIZE;
-        currentRecordTypeSize = sceneSessionChangeNeedLogMap_[recordType].size();
-    }
-    if (currentLogSize_ >= MAX_RECORD_LOG_SIZE || currentRecordTypeSize > maxRecordTypeSize) {
-        TLOGD(WmsLogTag::DEFAULT, "currentLogSize: %{public}d", currentLogSize_);
-        std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedLogMapCopy;
-        {
-            std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
-            sceneSessionChangeNeedLogMapCopy = sceneSessionChangeNeedLogMap_;
-            sceneSessionChangeNeedLogMap_.clear();
-            currentLogSize_ = 0;
-        }
-        PrintLog(sceneSessionChangeNeedLogMapCopy);
-    }
-}
-
-void SessionChangeRecorder::PrintLog(
-    std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedLogMap)
-{
-    TLOGD(WmsLogTag::DEFAULT, "In");
-    for (const auto& item : sceneSessionChangeNeedLogMap) {
-        std::queue<SceneSessionChangeInfo> logInfoQueue = item.second;
-        while (!logInfoQueue.empty()) {
-            SceneSessionChangeInfo curChange = logInfoQueue.front();
-            TLOGD(curChange.logTag_, "winId: %{public}d, changeInfo: %{public}s, time: %{public}s",
-                curChange.persistentId_, curChange.changeInfo_.c_str(), curChange.time_.c_str());
-            logInfoQueue.pop();
-        }
-    }
-}
 // LCOV_EXCL_STOP
 } // namespace OHOS::Rosen
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "session/host/include/snapshot_pixel_map_cache.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include <pixel_map.h>
+
+#include "parameters.h"
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+namespace {
+constexpr int64_t BYTES_PER_KB = 1024;
+constexpr int32_t DEFAULT_SNAPSHOT_CACHE_BUDGET_KB = 48 * 1024;
+
+std::shared_ptr<Media::PixelMap> CopyPixelMap(Media::PixelMap& pixelMap)
+{
+    Media::InitializationOptions options;
+    options.size.width = pixelMap.GetWidth();
+    options.size.height = pixelMap.GetHeight();
+    options.pixelFormat = pixelMap.GetPixelFormat();
+    options.alphaType = pixelMap.GetAlphaType();
+    std::unique_ptr<Media::PixelMap> copy = Media::PixelMap::Create(pixelMap, options);
+    return std::shared_ptr<Media::PixelMap>(copy.release());
+}
+} // namespace
+
+SnapshotPixelMapCache& SnapshotPixelMapCache::GetInstance()
+{
+    static SnapshotPixelMapCache instance;
+    return instance;
+}
+
+SnapshotPixelMapCache::SnapshotPixelMapCache()
+{
+    byteBudget_ = BYTES_PER_KB * system::GetIntParameter<int32_t>("persist.window.snapshot_cache_budget_kb",
+        DEFAULT_SNAPSHOT_CACHE_BUDGET_KB);
+}
+
+std::shared_ptr<Media::PixelMap> SnapshotPixelMapCache::Get(const std::string& path, float scale)
+{
+    std::shared_ptr<Media::PixelMap> cachedPixelMap;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto iter = entryMap_.find(path);
+        if (iter == entryMap_.end() || iter->second->scale != scale) {
+            return nullptr;
+        }
+        lruList_.splice(lruList_.begin(), lruList_, iter->second);
+        cachedPixelMap = iter->second->pixelMap;
+    }
+    /* cached pixels are never handed out or modified, so copying them needs no lock */
+    return CopyPixelMap(*cachedPixelMap);
+}
+
+void SnapshotPixelMapCache::Put(const std::string& path, float scale,
+    const std::shared_ptr<Media::PixelMap>& pixelMap)
+{
+    if (pixelMap == nullptr) {
+        return;
+    }
+    int64_t bytes = static_cast<int64_t>(pixelMap->GetByteCount());
+    auto cachedPixelMap = bytes > 0 ? CopyPixelMap(*pixelMap) : nullptr;
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (auto iter = entryMap_.find(path); iter != entryMap_.end()) {
+        usedBytes_ -= iter->second->bytes;
+        lruList_.erase(iter->second);
+        entryMap_.erase(iter);
+    }
+    if (cachedPixelMap == nullptr || bytes > byteBudget_) {
+        TLOGD(WmsLogTag::WMS_PATTERN, "skip, bytes %{public}" PRId64, bytes);
+        return;
+    }
+    EvictLocked(byteBudget_ - bytes);
+    lruList_.push_front({ path, scale, bytes, cachedPixelMap });
+    entryMap_[path] = lruList_.begin();
+    usedBytes_ += bytes;
+}
+
+void SnapshotPixelMapCache::Invalidate(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto iter = entryMap_.find(path);
+    if (iter == entryMap_.end()) {
+        return;
+    }
+    usedBytes_ -= iter->second->bytes;
+    lruList_.erase(iter->second);
+    entryMap_.erase(iter);
+}
+
+void SnapshotPixelMapCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    lruList_.clear();
+    entryMap_.clear();
+    usedBytes_ = 0;
+}
+
+void SnapshotPixelMapCache::TrimToBytes(int64_t targetBytes)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    EvictLocked(targetBytes);
+    TLOGI(WmsLogTag::WMS_PATTERN, "used %{public}" PRId64 ", entries %{public}zu", usedBytes_, lruList_.size());
+}
+
+int64_t SnapshotPixelMapCache::GetUsedBytes() const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return usedBytes_;
+}
+
+size_t SnapshotPixelMapCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return lruList_.size();
+}
+
+void SnapshotPixelMapCache::EvictLocked(int64_t targetBytes)
+{
+    while (!lruList_.empty() && usedBytes_ > targetBytes) {
+        auto& entry = lruList_.back();
+        usedBytes_ -= entry.bytes;
+        entryMap_.erase(entry.path);
+        lruList_.pop_back();
+    }
+}
+} // namespace OHOS::Rosen
@@ -97,14 +97,25 @@ WSFFRTHelper::~WSFFRTHelper() = default;
 void WSFFRTHelper::SubmitTask(std::function<void()>&& task, const std::string& taskName, uint64_t delayTime,
     TaskQos qos)
 {
-    auto localTask = [task = std::move(task), taskName]() {
+    if (delayTime == 0 && ffrt_get_cur_task() != nullptr) {
         HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "f:%s", taskName.c_str());
         task();
-    };
-    if (delayTime == 0 && ffrt_get_cur_task() != nullptr) {
-        localTask();
         return;
     }
+    SubmitToQueue(std::move(task), taskName);
+}
+
+void WSFFRTHelper::SubmitQueuedTask(std::function<void()>&& task, const std::string& taskName)
+{
+    SubmitToQueue(std::move(task), taskName);
+}
+
+void WSFFRTHelper::SubmitToQueue(std::function<void()>&& task, const std::string& taskName)
+{
+    auto localTask = [task = std::move(task), taskName]() {
+        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "f:%s", taskName.c_str());
+        task();
+    };
     ffrt::task_handle handle = ffrtQueue_->submit_h(std::move(localTask));
     if (handle == nullptr) {
         WLOGE("Failed to post task, taskName=%{public}s", taskName.c_str());
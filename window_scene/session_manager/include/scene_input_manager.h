@@ -43,6 +43,8 @@ public:
     void FlushDisplayInfoToMMI(std::vector<MMI::WindowInfo>&& windowInfoList,
         std::vector<MMI::UIExtensionInfo>&& uiExtensionInfoList,
         std::vector<std::shared_ptr<Media::PixelMap>>&& pixelMapList, const bool forceFlush = false);
+    void FlushIncrementalInfoToMMI(std::vector<MMI::WindowInfo>&& windowInfoList,
+        std::vector<std::shared_ptr<Media::PixelMap>>&& pixelMapList);
     void NotifyWindowInfoChange(const sptr<SceneSession>& scenenSession, const WindowUpdateType& type);
     void NotifyWindowInfoChangeFromSession(const sptr<SceneSession>& sceneSession);
     void NotifyMMIWindowPidChange(const sptr<SceneSession>& sceneSession, const bool startMoving);
@@ -54,6 +56,7 @@ public:
     void RegisterFlushWindowInfoCallback(FlushWindowInfoCallback&& callback);
     void ResetSessionDirty();
     FullInfoForMMI GetFullWindowInfoList();
+    bool GetIncrementalWindowInfoList(IncrementalInfoForMMI& incrementalInfo);
     void UpdateHotAreas(const sptr<SceneSession>& sceneSession, std::vector<MMI::Rect>& touchHotAreas,
         std::vector<MMI::Rect>& pointerHotAreas) const;
     void SetRootSceneSessionCreated(bool created);
@@ -91,6 +94,11 @@ private:
         std::map<DisplayGroupId, MMI::DisplayGroupInfo>& displayGroupMap);
     bool CheckNeedUpdate(const std::vector<MMI::ScreenInfo>& screenInfos,
         const std::vector<MMI::DisplayInfo>& displayInfos, const std::vector<MMI::WindowInfo>& windowInfoList);
+    std::vector<MMI::WindowInfo> ApplyIncrementalWindowInfo(const std::vector<MMI::WindowInfo>& windowInfoList);
+    void MergePendingIncrementalInfo(std::vector<MMI::WindowInfo>& windowInfoList,
+        std::vector<std::shared_ptr<Media::PixelMap>>& pixelMapList);
+    void KeepPendingIncrementalInfo(std::vector<MMI::WindowInfo>&& windowInfoList,
+        std::vector<std::shared_ptr<Media::PixelMap>>&& pixelMapList);
     void PrintScreenInfo(const std::vector<MMI::ScreenInfo>& screenInfos);
     void PrintDisplayInfo(const std::vector<MMI::DisplayInfo>& displayInfos);
     void PrintWindowInfo(const std::vector<MMI::WindowInfo>& windowInfoList);
@@ -110,6 +118,9 @@ private:
     std::vector<MMI::ScreenInfo> lastScreenInfos_;
     std::vector<MMI::DisplayInfo> lastDisplayInfos_;
     std::vector<MMI::WindowInfo> lastWindowInfoList_;
+    // incremental window infos not flushed yet, with the window masks they point to
+    std::vector<MMI::WindowInfo> pendingWindowInfoList_;
+    std::vector<std::shared_ptr<Media::PixelMap>> pendingPixelMapList_;
     int32_t lastFocusId_ { -1 };
     int32_t focusedSessionId_ { -1 };
     std::atomic<RootSessionState> rootSessionState_ { RootSessionState::NOT_CREATED };
@@ -18,6 +18,8 @@
 
 
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "common/rs_vector4.h"
 #include "display_manager.h"
@@ -63,6 +65,12 @@ public:
     void NotifyWindowInfoChange(const sptr<SceneSession>& sceneSession,
         const WindowUpdateType& type, const bool startMoving = false);
     FullInfoForMMI GetFullWindowInfoList();
+
+    /*
+     * Recompute window infos of the sessions marked dirty since last flush only.
+     * Returns false if a full window info list is required instead.
+     */
+    bool GetIncrementalWindowInfoList(IncrementalInfoForMMI& incrementalInfo);
     void RegisterFlushWindowInfoCallback(FlushWindowInfoCallback&& callback);
     void ResetSessionDirty();
     void UpdateSecSurfaceInfo(const std::map<uint64_t, std::vector<SecSurfaceInfo>>& secSurfaceInfoMap);
@@ -76,7 +84,22 @@ public:
         std::vector<MMI::Rect>& dragDisabledAreas) const;
 
 private:
+    struct WindowInfoCacheItem {
+        std::vector<int32_t> windowIds;
+        int32_t displayId = 0;
+        int32_t groupId = 0;
+        std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
+    };
+
     std::vector<MMI::WindowInfo> FullSceneSessionInfoUpdate() const;
+    void MarkSessionDirty(int32_t persistentId, const WindowUpdateType& type);
+    void UpdateWindowInfoCache(const sptr<SceneSession>& sceneSession,
+        const std::vector<MMI::WindowInfo>& sessionWindowInfoList,
+        std::vector<MMI::UIExtensionInfo>&& uiExtensionInfoList);
+    void AddRemovedWindowInfo(const WindowInfoCacheItem& cacheItem, IncrementalInfoForMMI& incrementalInfo) const;
+    bool IsWindowInfoCacheMatched(const WindowInfoCacheItem& cacheItem,
+        const std::vector<MMI::WindowInfo>& sessionWindowInfoList,
+        const std::vector<MMI::UIExtensionInfo>& uiExtensionInfoList) const;
     bool IsFilterSession(const sptr<SceneSession>& sceneSession) const;
     std::pair<MMI::WindowInfo, std::shared_ptr<Media::PixelMap>> GetWindowInfo(const sptr<SceneSession>& sceneSession,
         const WindowAction& action) const;
@@ -91,6 +114,8 @@ private:
         MMI::WindowInfo& windowInfo) const;
     std::map<int32_t, sptr<SceneSession>> GetDialogSessionMap(
         const std::map<int32_t, sptr<SceneSession>>& sessionMap) const;
+    std::map<int32_t, sptr<SceneSession>> GetDialogSessionMap(
+        const std::vector<sptr<SceneSession>>& sessionList) const;
     void UpdateDefaultHotAreas(sptr<SceneSession> sceneSession, std::vector<MMI::Rect>& touchHotAreas,
         std::vector<MMI::Rect>& pointerHotAreas) const;
     void UpdatePointerAreas(sptr<SceneSession> sceneSession, std::vector<int32_t>& pointerChangeAreas) const;
@@ -126,6 +151,16 @@ private:
     std::atomic_bool hasPostTask_ { false };
     std::map<uint64_t, std::vector<SecSurfaceInfo>> secSurfaceInfoMap_;
     std::map<uint64_t, std::vector<SecSurfaceInfo>> constrainedModalUIExtInfoMap_;
+
+    /*
+     * Incremental flush, dirty sessions are guarded by mutexlock_,
+     * window info cache is only accessed in OS_SceneSession.
+     */
+    std::unordered_set<int32_t> dirtySessionIds_;
+    bool needFullUpdate_ { true };
+    std::unordered_map<int32_t, WindowInfoCacheItem> windowInfoCache_;
+    bool hasDialogSession_ { false };
+    int32_t lastFocusedSessionId_ { INVALID_SESSION_ID };
 };
 } //namespace OHOS::Rosen
 
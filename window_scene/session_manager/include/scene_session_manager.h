@@ -38,6 +38,7 @@
 #include "display_change_listener.h"
 #include "display_info.h"
 #include "future.h"
+#include "latency_histogram.h"
 #include "include/core/SkRegion.h"
 #include "interfaces/include/ws_common.h"
 #include "mission_snapshot.h"
@@ -51,6 +52,7 @@
 #include "session/host/include/root_scene_session.h"
 #include "session_listener_controller.h"
 #include "ffrt_queue_helper.h"
+#include "session_manager/include/scene_session_registry.h"
 #include "session_manager/include/window_manager_lru.h"
 #include "session_manager/include/zidl/scene_session_manager_stub.h"
 #include "thread_safety_annotations.h"
@@ -123,6 +125,34 @@ struct StartingWindowRdbItemKey;
 class IUIEffectController;
 class IUIEffectControllerClient;
 
+/*
+ * Immutable copy of sceneSessionMap_, shared by readers until a session is added or removed.
+ */
+struct SceneSessionMapSnapshot {
+    uint64_t epoch = 0;
+    std::map<int32_t, sptr<SceneSession>> sessionMap;
+};
+
+/*
+ * Counters of the RS occlusion callback, "touched" counts sessions whose visibility was applied.
+ */
+struct VisibilityCallbackStats {
+    uint64_t callbackCount = 0;
+    uint64_t totalTouchedCount = 0;
+    uint32_t lastEntryCount = 0;
+    uint32_t lastChangedCount = 0;
+    uint32_t lastTouchedCount = 0;
+};
+
+/*
+ * Stages of a pointer event on the SCB input thread, measured from the moment it is received.
+ */
+enum class PointerLatencyStage : uint32_t {
+    TRANSFER = 0, // session resolved and the event handed to TransferPointerEvent/SendPointerEventToUI
+    DONE,         // OnInputEvent returned, the event is marked processed or owned by the client
+    COUNT,
+};
+
 using NotifyCreateSystemSessionFunc = std::function<void(const sptr<SceneSession>& session)>;
 using NotifyCreateKeyboardSessionFunc = std::function<void(const sptr<SceneSession>& keyboardSession,
     const sptr<SceneSession>& panelSession)>;
@@ -305,6 +335,7 @@ public:
     void RegisterWatchFocusActiveChangeCallback(NotifyWatchFocusActiveChangeFunc&& func);
     WMError NotifyWatchFocusActiveChange(bool isActive) override;
     void FlushWindowInfoToMMI(const bool forceFlush = false);
+    void FlushDirtyWindowInfoToMMI();
     void SendCancelEventBeforeEraseSession(const sptr<SceneSession>& sceneSession);
     void BuildCancelPointerEvent(const std::shared_ptr<MMI::PointerEvent>& pointerEvent, int32_t fingerId,
                                  int32_t action, int32_t wid);
@@ -333,6 +364,8 @@ public:
     WSError GetSpecifiedSessionDumpInfo(std::string& dumpInfo, const std::vector<std::string>& params,
         const std::string& strId);
     WSError GetSCBDebugDumpInfo(std::string&& cmd, std::string& dumpInfo);
+    WSError GetPointerLatencyDumpInfo(const std::vector<std::string>& params, std::string& dumpInfo);
+    WSError GetTaskStatsDumpInfo(std::string& dumpInfo);
     WSError GetSessionDumpInfo(const std::vector<std::string>& params, std::string& info) override;
     WSError DumpSessionAll(std::vector<std::string>& infos) override;
     WSError DumpSessionWithId(int32_t persistentId, std::vector<std::string>& infos) override;
@@ -582,6 +615,11 @@ public:
     WMError GetVisibilityWindowInfo(std::vector<sptr<WindowVisibilityInfo>>& infos,
         bool useHookedSize = true) override;
     const std::map<int32_t, sptr<SceneSession>> GetSceneSessionMap();
+    bool IsSessionFilteredForMMI(const sptr<SceneSession>& sceneSession);
+    std::shared_ptr<const SceneSessionMapSnapshot> GetSceneSessionMapSnapshot();
+    uint64_t GetSceneSessionMapEpoch() const { return sceneSessionMapEpoch_.load(std::memory_order_acquire); }
+    void RecordPointerLatency(int32_t pointerAction, PointerLatencyStage stage, uint64_t latencyUs);
+    VisibilityCallbackStats GetVisibilityCallbackStats() const;
     void GetAllSceneSession(std::vector<sptr<SceneSession>>& sceneSessions);
     void GetAllWindowVisibilityInfos(std::vector<std::pair<int32_t, uint32_t>>& windowVisibilityInfos);
 
@@ -1151,6 +1189,8 @@ private:
     bool GetSessionRSVisible(const sptr<Session>& session,
         const std::vector<std::pair<uint64_t, WindowVisibilityState>>& currVisibleData,
         WindowVisibilityState& sessionVisibleState);
+    std::unordered_map<uint64_t, sptr<SceneSession>> BuildSurfaceIdIndex();
+    void RecordVisibilityCallbackStats(size_t visibleEntryCount, size_t changedEntryCount);
     std::string GetFloatWidth(const int width, float value);
 
     /*
@@ -1225,6 +1265,20 @@ private:
     void TraverseSessionTreeFromTopToBottom(TraverseFunc func);
     void TraverseSessionTreeFromBottomToTop(TraverseFunc func);
 
+    /*
+     * Sessions of sceneSessionMap_ ordered by zOrder, then persistentId, shared by traversals until
+     * MarkSceneSessionMapChangedLocked drops it or any zOrder changes. Never modified once handed out.
+     */
+    struct ZOrderIndex {
+        std::vector<sptr<SceneSession>> sessions;
+        uint64_t zOrderChangeCount = 0; // Session::GetZOrderChangeCount() when built
+    };
+    std::shared_ptr<const ZOrderIndex> GetZOrderIndex();
+    void RebuildZOrderIndexLocked();
+    std::mutex zOrderIndexMutex_;
+    std::shared_ptr<ZOrderIndex> zOrderIndex_;
+    uint64_t zOrderIndexRebuildCount_ = 0;
+
     /*
      * Window Focus
      */
@@ -1323,7 +1377,9 @@ private:
     /*
      * Window Immersive
      */
-    void UpdateAvoidSessionAvoidArea(WindowType type);
+    void UpdateAvoidSessionAvoidArea(WindowType type, DisplayId displayId = DISPLAY_ID_INVALID);
+    bool RefreshAvoidAreaSourceVersion(AvoidAreaType type, DisplayId displayId);
+    bool CheckAndUpdateAvoidAreaSourceStamp(const sptr<SceneSession>& sceneSession, AvoidAreaType type);
     void UpdateNormalSessionAvoidArea(int32_t persistentId, const sptr<SceneSession>& sceneSession, bool& needUpdate);
     void UpdateAvoidArea(int32_t persistentId);
     void UpdateRootSceneSessionAvoidArea(int32_t persistentId, bool& needUpdate);
@@ -1421,6 +1477,7 @@ private:
     void DestroyExtensionSession(const sptr<IRemoteObject>& remoteExtSession, bool isConstrainedModal = false);
     void EraseSceneSessionMapById(int32_t persistentId);
     void EraseSceneSessionAndMarkDirtyLocked(int32_t persistentId);
+    void MarkSceneSessionMapChangedLocked();
     WSError GetAbilityInfosFromBundleInfo(const std::vector<AppExecFwk::BundleInfo>& bundleInfos,
         std::vector<SCBAbilityInfo>& scbAbilityInfos, int32_t userId = 0);
     void GetOrientationFromResourceManager(AppExecFwk::AbilityInfo& abilityInfo);
@@ -1511,11 +1568,18 @@ private:
      */
     NotifyWatchGestureConsumeResultFunc onWatchGestureConsumeResultFunc_;
     NotifyWatchFocusActiveChangeFunc onWatchFocusActiveChangeFunc_;
+    // pointer dispatch latency, indexed by pointer action then stage, unknown actions share the last slot
+    static constexpr int32_t POINTER_LATENCY_ACTION_SLOTS = 32;
+    std::array<std::array<LatencyHistogram, static_cast<size_t>(PointerLatencyStage::COUNT)>,
+        POINTER_LATENCY_ACTION_SLOTS> pointerLatencyHistograms_;
 
     sptr<RootSceneSession> rootSceneSession_;
     std::weak_ptr<AbilityRuntime::Context> rootSceneContextWeak_;
     mutable std::shared_mutex sceneSessionMapMutex_;
     std::map<int32_t, sptr<SceneSession>> sceneSessionMap_;
+    std::atomic<uint64_t> sceneSessionMapEpoch_ { 0 };
+    std::shared_ptr<const SceneSessionMapSnapshot> sceneSessionMapSnapshot_; // only accessed by atomic_load/store
+    SceneSessionRegistry sceneSessionRegistry_;
     std::map<int32_t, sptr<SceneSession>> systemTopSceneSessionMap_;
     std::map<int32_t, sptr<SceneSession>> nonSystemFloatSceneSessionMap_;
     sptr<ScbSessionHandler> scbSessionHandler_;
@@ -1650,6 +1714,12 @@ private:
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
     bool isReportTaskStart_ = false;
     std::vector<std::pair<uint64_t, WindowVisibilityState> > lastVisibleData_;
+    uint32_t visibilityTouchedSessionCount_ = 0; // only accessed in task thread
+    std::atomic<uint64_t> visibilityCallbackCount_ { 0 };
+    std::atomic<uint64_t> visibilityTotalTouchedCount_ { 0 };
+    std::atomic<uint32_t> lastVisibilityEntryCount_ { 0 };
+    std::atomic<uint32_t> lastVisibilityChangedCount_ { 0 };
+    std::atomic<uint32_t> lastVisibilityTouchedCount_ { 0 };
     RSInterfaces& rsInterface_;
     void RegisterSessionStateChangeNotifyManagerFunc(sptr<SceneSession>& sceneSession);
     void RegisterSessionInfoChangeNotifyManagerFunc(sptr<SceneSession>& sceneSession);
@@ -1900,6 +1970,28 @@ private:
     std::unordered_map<DisplayId, std::tuple<bool, WSRect, WSRect>> floatNavagationInfoMap_;
     std::unordered_map<DisplayId, bool> statusBarDefaultVisibilityPerDisplay_;
     std::set<int32_t> avoidAreaListenerSessionSet_;
+
+    /*
+     * Status bar and keyboard geometry per display and avoid area type, the version only moves
+     * when the geometry does. Listener sessions remember the version they were computed from.
+     * Only accessed in OS_SceneSession.
+     */
+    struct AvoidAreaSource {
+        int32_t persistentId = 0;
+        WSRect rect;
+        uint32_t state = 0;
+        bool operator==(const AvoidAreaSource& other) const
+        {
+            return persistentId == other.persistentId && rect == other.rect && state == other.state;
+        }
+    };
+    struct AvoidAreaSourceEntry {
+        uint64_t version = 0;
+        std::vector<AvoidAreaSource> sources;
+    };
+    std::vector<AvoidAreaSource> CollectAvoidAreaSources(AvoidAreaType type, DisplayId displayId);
+    std::map<std::pair<DisplayId, AvoidAreaType>, AvoidAreaSourceEntry> avoidAreaSourceCache_;
+    std::unordered_map<int32_t, std::map<AvoidAreaType, std::pair<DisplayId, uint64_t>>> avoidAreaSourceStampMap_;
     static constexpr int32_t INVALID_STATUS_BAR_AVOID_HEIGHT = -1;
     std::unordered_map<DisplayId, int32_t> statusBarAvoidHeight_;
     std::unordered_map<DisplayId, bool> statusBarConstantlyShowMap_;
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_SCENE_SESSION_REGISTRY_H
+#define OHOS_ROSEN_WINDOW_SCENE_SCENE_SESSION_REGISTRY_H
+
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "session/host/include/scene_session.h"
+
+namespace OHOS::Rosen {
+/*
+ * Secondary indexes over sceneSessionMap_ by window type, displayId, callingPid and parentId.
+ * Add and Remove are called where the map changes. displayId, callingPid and parentId change
+ * during the session lifetime, UpdateAttributes moves the session to its new buckets; an entry
+ * whose attribute changed without it is skipped by the queries instead of being returned.
+ * Every bucket is sorted by persistentId, so results come out in map order.
+ */
+class SceneSessionRegistry {
+public:
+    void Add(const sptr<SceneSession>& sceneSession);
+    void Remove(int32_t persistentId);
+    void UpdateAttributes(const sptr<SceneSession>& sceneSession);
+
+    size_t Size() const;
+    std::vector<sptr<SceneSession>> GetByWindowType(WindowType type) const;
+    std::vector<sptr<SceneSession>> GetByTypeAndDisplayId(WindowType type, DisplayId displayId) const;
+    std::vector<sptr<SceneSession>> GetByDisplayId(DisplayId displayId) const;
+    std::vector<sptr<SceneSession>> GetByCallingPid(int32_t pid) const;
+    std::vector<sptr<SceneSession>> GetByParentId(int32_t parentId) const;
+
+private:
+    using SessionEntry = std::pair<int32_t, sptr<SceneSession>>;
+    using Bucket = std::vector<SessionEntry>;
+    struct IndexedKeys {
+        uint32_t windowType = 0;
+        DisplayId displayId = DISPLAY_ID_INVALID;
+        int32_t callingPid = 0;
+        int32_t parentId = 0;
+    };
+
+    static IndexedKeys ReadKeys(const sptr<SceneSession>& sceneSession);
+    static DisplayId GetSessionDisplayId(const sptr<SceneSession>& sceneSession);
+    static void InsertSorted(Bucket& bucket, int32_t persistentId, const sptr<SceneSession>& sceneSession);
+    template <typename Key>
+    static void EraseFromIndex(std::unordered_map<Key, Bucket>& index, const Key& key, int32_t persistentId);
+    template <typename Key, typename Match>
+    static std::vector<sptr<SceneSession>> CollectLocked(const std::unordered_map<Key, Bucket>& index,
+        const Key& key, Match&& match);
+
+    mutable std::shared_mutex registryMutex_;
+    std::unordered_map<int32_t, IndexedKeys> keysById_;
+    std::unordered_map<uint32_t, Bucket> typeIndex_;
+    std::unordered_map<DisplayId, Bucket> displayIndex_;
+    std::unordered_map<int32_t, Bucket> callingPidIndex_;
+    std::unordered_map<int32_t, Bucket> parentIndex_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_SCENE_SESSION_REGISTRY_H
@@ -18,6 +18,8 @@
 #include <mutex>
 
 #include "client_agent_container.h"
+#include "client_agent_dispatcher.h"
+#include "ffrt_serial_queue_helper.h"
 #include "window_manager.h"
 #include "wm_single_instance.h"
 #include "zidl/window_manager_agent_interface.h"
@@ -55,6 +57,8 @@ public:
     void NotifyWindowPropertyChange(uint32_t propertyDirtyFlags, const WindowInfoList& windowInfoList);
     void NotifySupportRotationChange(const SupportRotationInfo& supportRotationInfo);
     void NotifySessionSaveSnapShotComplete(int32_t persistentId);
+    /* backlog, coalesce and drop counters of agents notified through the dispatcher, keyed by pid */
+    std::map<int32_t, ClientAgentDispatcher<IWindowManagerAgent>::AgentStats> GetAgentNotifyStats();
 
 private:
     SessionManagerAgentController()
@@ -67,6 +71,11 @@ private:
     void DoAfterAgentDeath(const sptr<IRemoteObject>& remoteObject);
 
     ClientAgentContainer<IWindowManagerAgent, WindowManagerAgentType> smAgentContainer_;
+    /* every agent is drained on its own serial queue so a stuck client holds no shared worker slot */
+    ClientAgentDispatcher<IWindowManagerAgent> agentDispatcher_ { [] {
+        auto queue = std::make_shared<FfrtSerialQueueHelper>("WindowManagerAgentNotify");
+        return [queue](std::function<void()>&& task) { queue->SubmitTask(std::move(task)); };
+    } };
     std::map<int32_t, std::map<int32_t, std::map<WindowManagerAgentType, sptr<IWindowManagerAgent>>>>
         windowManagerPidUserIdAgentMap_;
     std::map<sptr<IRemoteObject>, std::tuple<int32_t, int32_t, WindowManagerAgentType>> windowManagerAgentPairMap_;
@@ -15,7 +15,9 @@
 
 #include "scene_input_manager.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <iterator>
 #include <sys/resource.h>
 #include <sys/syscall.h>
 
@@ -250,6 +252,11 @@ auto SceneInputManager::GetFullWindowInfoList() -> FullInfoForMMI
     return sceneSessionDirty_->GetFullWindowInfoList();
 }
 
+bool SceneInputManager::GetIncrementalWindowInfoList(IncrementalInfoForMMI& incrementalInfo)
+{
+    return sceneSessionDirty_->GetIncrementalWindowInfoList(incrementalInfo);
+}
+
 void SceneInputManager::UpdateHotAreas(const sptr<SceneSession>& sceneSession,
     std::vector<MMI::Rect>& touchHotAreas, std::vector<MMI::Rect>& pointerHotAreas) const
 {
@@ -386,8 +393,10 @@ void SceneInputManager::FilterWindowInfoList(const std::map<ScreenId, ScreenProp
     std::vector<MMI::WindowInfo>& windowInfoList)
 {
     // Filter windowInfos which displayId is not included in the active screens.
+    // Removals are kept, a window of a display just removed must still be removed from MMI.
     for (auto it = windowInfoList.begin(); it != windowInfoList.end();) {
-        if (screensProperties.count(static_cast<ScreenId>(it->displayId)) == 0) {
+        if (it->action != MMI::WINDOW_UPDATE_ACTION::DEL &&
+            screensProperties.count(static_cast<ScreenId>(it->displayId)) == 0) {
             TLOGD(WmsLogTag::WMS_EVENT, "filter displayId=%{public}" PRIu64 "", static_cast<uint64_t>(it->displayId));
             it = windowInfoList.erase(it);
         } else {
@@ -578,6 +587,79 @@ bool SceneInputManager::CheckNeedUpdate(const std::vector<MMI::ScreenInfo>& scre
     return false;
 }
 
+std::vector<MMI::WindowInfo> SceneInputManager::ApplyIncrementalWindowInfo(
+    const std::vector<MMI::WindowInfo>& windowInfoList)
+{
+    std::vector<MMI::WindowInfo> changedWindowInfoList;
+    for (const auto& windowInfo : windowInfoList) {
+        auto iter = std::find_if(lastWindowInfoList_.begin(), lastWindowInfoList_.end(),
+            [windowId = windowInfo.id](const MMI::WindowInfo& lastWindowInfo) {
+                return lastWindowInfo.id == windowId;
+            });
+        if (windowInfo.action == MMI::WINDOW_UPDATE_ACTION::DEL) {
+            if (iter != lastWindowInfoList_.end()) {
+                lastWindowInfoList_.erase(iter);
+            }
+            changedWindowInfoList.emplace_back(windowInfo);
+            continue;
+        }
+        if (iter == lastWindowInfoList_.end()) {
+            lastWindowInfoList_.emplace_back(windowInfo);
+            changedWindowInfoList.emplace_back(windowInfo);
+            changedWindowInfoList.back().action = MMI::WINDOW_UPDATE_ACTION::ADD;
+        } else if (*iter != windowInfo) {
+            *iter = windowInfo;
+            changedWindowInfoList.emplace_back(windowInfo);
+            changedWindowInfoList.back().action = MMI::WINDOW_UPDATE_ACTION::CHANGE;
+        }
+    }
+    return changedWindowInfoList;
+}
+
+void SceneInputManager::MergePendingIncrementalInfo(std::vector<MMI::WindowInfo>& windowInfoList,
+    std::vector<std::shared_ptr<Media::PixelMap>>& pixelMapList)
+{
+    if (pendingWindowInfoList_.empty()) {
+        return;
+    }
+    // only the latest info of a window is diffed against lastWindowInfoList_, a newer one replaces the pending one
+    std::vector<MMI::WindowInfo> mergedWindowInfoList;
+    for (auto& pendingWindowInfo : pendingWindowInfoList_) {
+        bool isReplaced = std::any_of(windowInfoList.begin(), windowInfoList.end(),
+            [windowId = pendingWindowInfo.id](const MMI::WindowInfo& windowInfo) {
+                return windowInfo.id == windowId;
+            });
+        if (!isReplaced) {
+            mergedWindowInfoList.emplace_back(std::move(pendingWindowInfo));
+        }
+    }
+    mergedWindowInfoList.insert(mergedWindowInfoList.end(),
+        std::make_move_iterator(windowInfoList.begin()), std::make_move_iterator(windowInfoList.end()));
+    windowInfoList = std::move(mergedWindowInfoList);
+    pixelMapList.insert(pixelMapList.end(), pendingPixelMapList_.begin(), pendingPixelMapList_.end());
+    pendingWindowInfoList_.clear();
+    pendingPixelMapList_.clear();
+}
+
+void SceneInputManager::KeepPendingIncrementalInfo(std::vector<MMI::WindowInfo>&& windowInfoList,
+    std::vector<std::shared_ptr<Media::PixelMap>>&& pixelMapList)
+{
+    pendingWindowInfoList_ = std::move(windowInfoList);
+    pendingPixelMapList_.clear();
+    for (auto& pixelMap : pixelMapList) {
+        if (pixelMap == nullptr) {
+            continue;
+        }
+        bool isReferenced = std::any_of(pendingWindowInfoList_.begin(), pendingWindowInfoList_.end(),
+            [rawPixelMap = pixelMap.get()](const MMI::WindowInfo& windowInfo) {
+                return windowInfo.pixelMap == rawPixelMap;
+            });
+        if (isReferenced) {
+            pendingPixelMapList_.emplace_back(std::move(pixelMap));
+        }
+    }
+}
+
 void SceneInputManager::UpdateFocusedSessionId(int32_t focusedSessionId)
 {
     auto focusedSceneSession = SceneSessionManager::GetInstance().GetSceneSession(focusedSessionId);
@@ -845,7 +927,11 @@ void SceneInputManager::FlushDisplayInfoToMMI(std::vector<MMI::WindowInfo>&& win
                 displayInfos.emplace_back(displayInfo);
             }
         }
-        if (!forceFlush && !CheckNeedUpdate(screenInfos, displayInfos, windowInfoList)) {
+        // keep last window info list in sync even if forced, incremental flush is based on it
+        bool needUpdate = CheckNeedUpdate(screenInfos, displayInfos, windowInfoList);
+        pendingWindowInfoList_.clear();
+        pendingPixelMapList_.clear();
+        if (!forceFlush && !needUpdate) {
             return;
         }
         PrintScreenInfo(screenInfos);
@@ -855,6 +941,40 @@ void SceneInputManager::FlushDisplayInfoToMMI(std::vector<MMI::WindowInfo>&& win
     });
 }
 
+void SceneInputManager::FlushIncrementalInfoToMMI(std::vector<MMI::WindowInfo>&& windowInfoList,
+    std::vector<std::shared_ptr<Media::PixelMap>>&& pixelMapList)
+{
+    eventHandler_->PostTask([this,
+                             windowInfoList = std::move(windowInfoList),
+                             pixelMapList = std::move(pixelMapList)]() mutable {
+        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "FlushIncrementalInfoToMMI");
+        // windowInfo.pixelMap points into pixelMapList, so both are kept together until flushed
+        MergePendingIncrementalInfo(windowInfoList, pixelMapList);
+        if (isUserBackground_.load()) {
+            TLOGND(WmsLogTag::WMS_MULTI_USER, "User in background, keep window info for next flush");
+            KeepPendingIncrementalInfo(std::move(windowInfoList), std::move(pixelMapList));
+            return;
+        }
+        if (isRotationBegin_.load()) {
+            TLOGND(WmsLogTag::WMS_EVENT, "rotating, keep window info for next flush");
+            KeepPendingIncrementalInfo(std::move(windowInfoList), std::move(pixelMapList));
+            return;
+        }
+        std::map<ScreenId, ScreenProperty> screensProperties =
+            ScreenSessionManagerClient::GetInstance().GetAllScreensProperties();
+        FilterSyncedScreens(screensProperties);
+        FilterWindowInfoList(screensProperties, windowInfoList);
+        std::vector<MMI::WindowInfo> changedWindowInfoList = ApplyIncrementalWindowInfo(windowInfoList);
+        if (changedWindowInfoList.empty()) {
+            return;
+        }
+        TLOGND(WmsLogTag::WMS_EVENT, "changed windowInfo size: %{public}zu", changedWindowInfoList.size());
+        std::map<uint64_t, std::vector<MMI::WindowInfo>> screenToWindowInfoList;
+        screenToWindowInfoList.emplace(DEFALUT_DISPLAYID, std::move(changedWindowInfoList));
+        FlushChangeInfoToMMI(screenToWindowInfoList);
+    });
+}
+
 void SceneInputManager::UpdateSecSurfaceInfo(const std::map<uint64_t, std::vector<SecSurfaceInfo>>& secSurfaceInfoMap)
 {
     if (sceneSessionDirty_ == nullptr) {
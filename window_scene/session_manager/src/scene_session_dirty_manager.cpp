@@ -36,7 +36,7 @@ constexpr int POINTER_CHANGE_AREA_DEFAULT = 0;
 constexpr int POINTER_CHANGE_AREA_FIVE = 5;
 constexpr unsigned int TRANSFORM_DATA_LEN = 9;
 constexpr int UPDATE_TASK_DURATION = 10;
-const std::string UPDATE_WINDOW_INFO_TASK = "UpdateWindowInfoTask";
+constexpr const char* UPDATE_WINDOW_INFO_TASK = "UpdateWindowInfoTask";
 static int32_t g_screenRotationOffset = system::GetIntParameter<int32_t>("const.fold.screen_rotation.offset", 0);
 constexpr float ZORDER_UIEXTENSION_INDEX = 0.1;
 constexpr int WINDOW_NAME_TYPE_UNKNOWN = 0;
@@ -47,6 +47,7 @@ const std::string PREVIEW_WINDOW_NAME_PREFIX = "PreviewWindow";
 const std::string VOICEINPUT_WINDOW_NAME_PREFIX = "__VoiceHardwareInput";
 const std::string SCREEN_LOCK_WINDOW = "SCBScreenLock";
 constexpr int32_t CURSOR_DRAG_COUNT_MAX = 1;
+constexpr size_t MAX_INCREMENTAL_WINDOW_INFO_NUM = 15;
 } // namespace
 
 static bool operator==(const MMI::Rect left, const MMI::Rect right)
@@ -517,11 +518,11 @@ static void AddCallingPidMapItem(const sptr<SceneSession>& session,
 }
 
 static void UpdateDialogSessionMap(
-    const std::map<int32_t, sptr<SceneSession>>& sessionMap,
+    const std::vector<sptr<SceneSession>>& sessionList,
     const std::unordered_map<int32_t, sptr<SceneSession>>& callingPidMap,
     std::map<int32_t, sptr<SceneSession>>& dialogMap)
 {
-    for (const auto& [_, session] : sessionMap) {
+    for (const auto& session : sessionList) {
         if (session == nullptr || session->GetForceHideState() != ForceHideState::NOT_HIDDEN) {
             continue;
         }
@@ -537,11 +538,22 @@ static void UpdateDialogSessionMap(
 
 std::map<int32_t, sptr<SceneSession>> SceneSessionDirtyManager::GetDialogSessionMap(
     const std::map<int32_t, sptr<SceneSession>>& sessionMap) const
+{
+    std::vector<sptr<SceneSession>> sessionList;
+    sessionList.reserve(sessionMap.size());
+    for (const auto& [_, session] : sessionMap) {
+        sessionList.emplace_back(session);
+    }
+    return GetDialogSessionMap(sessionList);
+}
+
+std::map<int32_t, sptr<SceneSession>> SceneSessionDirtyManager::GetDialogSessionMap(
+    const std::vector<sptr<SceneSession>>& sessionList) const
 {
     std::map<int32_t, sptr<SceneSession>> dialogMap;
     std::unordered_map<int32_t, sptr<SceneSession>> callingPidMap;
     bool hasModalApplication = false;
-    for (const auto& [_, session] : sessionMap) {
+    for (const auto& session : sessionList) {
         if (session == nullptr || session->GetForceHideState() != ForceHideState::NOT_HIDDEN) {
             continue;
         }
@@ -555,7 +567,7 @@ std::map<int32_t, sptr<SceneSession>> SceneSessionDirtyManager::GetDialogSession
         }
     }
     if (hasModalApplication) {
-        UpdateDialogSessionMap(sessionMap, callingPidMap, dialogMap);
+        UpdateDialogSessionMap(sessionList, callingPidMap, dialogMap);
     }
     return dialogMap;
 }
@@ -590,13 +602,26 @@ void SceneSessionDirtyManager::NotifyWindowInfoChange(const sptr<SceneSession>&
         TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] wid=%{public}d, winType=%{public}d",
             sceneSession->GetWindowId(), static_cast<int>(type));
     }
+    MarkSessionDirty(sceneSession->GetPersistentId(), type);
     ResetFlushWindowInfoTask();
 }
 
+void SceneSessionDirtyManager::MarkSessionDirty(int32_t persistentId, const WindowUpdateType& type)
+{
+    std::lock_guard<std::mutex> lock(mutexlock_);
+    // focus change affects the focus window of all display groups, which only full update carries
+    if (type == WindowUpdateType::WINDOW_UPDATE_FOCUSED || type == WindowUpdateType::WINDOW_UPDATE_ALL) {
+        needFullUpdate_ = true;
+        return;
+    }
+    dirtySessionIds_.insert(persistentId);
+}
+
 void SceneSessionDirtyManager::ResetFlushWindowInfoTask()
 {
     sessionDirty_.store(true);
     bool hasPostTask = false;
+    // skip allocating a queue node while a flush is already pending
     if (hasPostTask_.compare_exchange_strong(hasPostTask, true)) {
         auto task = [this]() {
             hasPostTask_.store(false);
@@ -606,7 +631,7 @@ void SceneSessionDirtyManager::ResetFlushWindowInfoTask()
             flushWindowInfoCallback_();
         };
         TLOGD(WmsLogTag::WMS_EVENT, "in");
-        SceneSessionManager::GetInstance().PostFlushWindowInfoTask(task,
+        SceneSessionManager::GetInstance().GetTaskScheduler()->PostCoalescedTask(task,
             UPDATE_WINDOW_INFO_TASK, UPDATE_TASK_DURATION);
     }
 }
@@ -712,24 +737,36 @@ void SceneSessionDirtyManager::GetModalUIExtensionInfo(std::vector<MMI::WindowIn
 
 auto SceneSessionDirtyManager::GetFullWindowInfoList() -> FullInfoForMMI
 {
+    {
+        std::lock_guard<std::mutex> lock(mutexlock_);
+        dirtySessionIds_.clear();
+        needFullUpdate_ = false;
+    }
+    windowInfoCache_.clear();
+    lastFocusedSessionId_ = SceneSessionManager::GetInstance().GetFocusedSessionId();
     std::vector<MMI::WindowInfo> windowInfoList;
     std::vector<std::shared_ptr<Media::PixelMap>> pixelMapList;
-    const auto sceneSessionMap = SceneSessionManager::GetInstance().GetSceneSessionMap();
+    const auto sceneSessionMapSnapshot = SceneSessionManager::GetInstance().GetSceneSessionMapSnapshot();
+    std::vector<sptr<SceneSession>> sceneSessionList;
+    sceneSessionList.reserve(sceneSessionMapSnapshot->sessionMap.size());
+    for (const auto& [_, sceneSession] : sceneSessionMapSnapshot->sessionMap) {
+        if (!SceneSessionManager::GetInstance().IsSessionFilteredForMMI(sceneSession)) {
+            sceneSessionList.emplace_back(sceneSession);
+        }
+    }
     // all input event should trans to dialog window if dialog exists
-    const auto dialogMap = GetDialogSessionMap(sceneSessionMap);
+    const auto dialogMap = GetDialogSessionMap(sceneSessionList);
+    hasDialogSession_ = !dialogMap.empty();
     uint32_t maxHotAreasNum = 0;
     std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
-    for (const auto& sceneSessionValuePair : sceneSessionMap) {
-        const auto& sceneSessionValue = sceneSessionValuePair.second;
-        if (sceneSessionValue == nullptr) {
-            continue;
-        }
+    for (const auto& sceneSessionValue : sceneSessionList) {
         TLOGD(WmsLogTag::WMS_EVENT,
             "[EventDispatch] windowName=%{public}s bundleName=%{public}s"
             " windowId=%{public}d activeStatus=%{public}d", sceneSessionValue->GetWindowName().c_str(),
             sceneSessionValue->GetSessionInfo().bundleName_.c_str(), sceneSessionValue->GetWindowId(),
             sceneSessionValue->GetForegroundInteractiveStatus());
         auto [windowInfo, pixelMap] = GetWindowInfo(sceneSessionValue, WindowAction::WINDOW_ADD);
+        size_t sessionWindowInfoBegin = windowInfoList.size();
         auto iter = (sceneSessionValue->GetMainSessionOrLoosenedSessionId() == INVALID_SESSION_ID) ?
             dialogMap.find(sceneSessionValue->GetPersistentId()) :
             dialogMap.find(sceneSessionValue->GetMainSessionOrLoosenedSessionId());
@@ -751,7 +788,13 @@ auto SceneSessionDirtyManager::GetFullWindowInfoList() -> FullInfoForMMI
         if (windowInfo.defaultHotAreas.size() > maxHotAreasNum) {
             maxHotAreasNum = windowInfo.defaultHotAreas.size();
         }
-        sceneSessionValue->GetAllUIExtensionTokenInfo(uiExtensionInfoList);
+        std::vector<MMI::UIExtensionInfo> sessionUIExtensionInfoList;
+        sceneSessionValue->GetAllUIExtensionTokenInfo(sessionUIExtensionInfoList);
+        uiExtensionInfoList.insert(uiExtensionInfoList.end(), sessionUIExtensionInfoList.begin(),
+            sessionUIExtensionInfoList.end());
+        UpdateWindowInfoCache(sceneSessionValue,
+            std::vector<MMI::WindowInfo>(windowInfoList.begin() + sessionWindowInfoBegin, windowInfoList.end()),
+            std::move(sessionUIExtensionInfoList));
     }
     if (maxHotAreasNum > MMI::WindowInfo::DEFAULT_HOTAREA_COUNT) {
         std::sort(windowInfoList.begin(), windowInfoList.end(), CmpMMIWindowInfo);
@@ -760,6 +803,119 @@ auto SceneSessionDirtyManager::GetFullWindowInfoList() -> FullInfoForMMI
     return {windowInfoList, pixelMapList, uiExtensionInfoList};
 }
 
+bool SceneSessionDirtyManager::GetIncrementalWindowInfoList(IncrementalInfoForMMI& incrementalInfo)
+{
+    std::unordered_set<int32_t> dirtySessionIds;
+    {
+        std::lock_guard<std::mutex> lock(mutexlock_);
+        if (needFullUpdate_) {
+            return false;
+        }
+        dirtySessionIds.swap(dirtySessionIds_);
+    }
+    // agent window of the dialog depends on the zOrder of all sessions
+    if (hasDialogSession_ || lastFocusedSessionId_ != SceneSessionManager::GetInstance().GetFocusedSessionId()) {
+        return false;
+    }
+    for (auto persistentId : dirtySessionIds) {
+        auto sceneSession = SceneSessionManager::GetInstance().GetSceneSession(persistentId);
+        auto cacheIter = windowInfoCache_.find(persistentId);
+        if (SceneSessionManager::GetInstance().IsSessionFilteredForMMI(sceneSession)) {
+            if (cacheIter != windowInfoCache_.end()) {
+                AddRemovedWindowInfo(cacheIter->second, incrementalInfo);
+                windowInfoCache_.erase(cacheIter);
+            }
+            continue;
+        }
+        if (sceneSession->IsModal() || sceneSession->IsDialogWindow()) {
+            return false;
+        }
+        bool isNewWindow = cacheIter == windowInfoCache_.end();
+        auto [windowInfo, pixelMap] = GetWindowInfo(sceneSession,
+            isNewWindow ? WindowAction::WINDOW_ADD : WindowAction::WINDOW_CHANGE);
+        if (windowInfo.defaultHotAreas.size() > MMI::WindowInfo::DEFAULT_HOTAREA_COUNT) {
+            return false;
+        }
+        std::vector<MMI::WindowInfo> sessionWindowInfoList;
+        GetModalUIExtensionInfo(sessionWindowInfoList, sceneSession, windowInfo);
+        sessionWindowInfoList.emplace_back(windowInfo);
+        std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
+        sceneSession->GetAllUIExtensionTokenInfo(uiExtensionInfoList);
+        // uiExtension infos and modal uiExtension windows are only carried by full update
+        if (isNewWindow ? (sessionWindowInfoList.size() != 1 || !uiExtensionInfoList.empty()) :
+            !IsWindowInfoCacheMatched(cacheIter->second, sessionWindowInfoList, uiExtensionInfoList)) {
+            return false;
+        }
+        for (auto& sessionWindowInfo : sessionWindowInfoList) {
+            sessionWindowInfo.action = static_cast<MMI::WINDOW_UPDATE_ACTION>(
+                isNewWindow ? WindowAction::WINDOW_ADD : WindowAction::WINDOW_CHANGE);
+            incrementalInfo.windowInfoList.emplace_back(sessionWindowInfo);
+        }
+        incrementalInfo.pixelMapList.emplace_back(pixelMap);
+        UpdateWindowInfoCache(sceneSession, sessionWindowInfoList, std::move(uiExtensionInfoList));
+    }
+    if (incrementalInfo.windowInfoList.size() > MAX_INCREMENTAL_WINDOW_INFO_NUM) {
+        return false;
+    }
+    TLOGD(WmsLogTag::WMS_EVENT, "dirty session size=%{public}zu, windowInfo size=%{public}zu",
+        dirtySessionIds.size(), incrementalInfo.windowInfoList.size());
+    return true;
+}
+
+void SceneSessionDirtyManager::UpdateWindowInfoCache(const sptr<SceneSession>& sceneSession,
+    const std::vector<MMI::WindowInfo>& sessionWindowInfoList,
+    std::vector<MMI::UIExtensionInfo>&& uiExtensionInfoList)
+{
+    if (sceneSession == nullptr || sessionWindowInfoList.empty()) {
+        return;
+    }
+    auto& cacheItem = windowInfoCache_[sceneSession->GetPersistentId()];
+    cacheItem.windowIds.clear();
+    for (const auto& windowInfo : sessionWindowInfoList) {
+        cacheItem.windowIds.emplace_back(windowInfo.id);
+    }
+    cacheItem.displayId = sessionWindowInfoList.back().displayId;
+    cacheItem.groupId = sessionWindowInfoList.back().groupId;
+    cacheItem.uiExtensionInfoList = std::move(uiExtensionInfoList);
+}
+
+void SceneSessionDirtyManager::AddRemovedWindowInfo(const WindowInfoCacheItem& cacheItem,
+    IncrementalInfoForMMI& incrementalInfo) const
+{
+    for (auto windowId : cacheItem.windowIds) {
+        MMI::WindowInfo windowInfo;
+        windowInfo.id = windowId;
+        windowInfo.displayId = cacheItem.displayId;
+        windowInfo.groupId = cacheItem.groupId;
+        windowInfo.action = static_cast<MMI::WINDOW_UPDATE_ACTION>(WindowAction::WINDOW_DELETE);
+        incrementalInfo.windowInfoList.emplace_back(windowInfo);
+    }
+}
+
+bool SceneSessionDirtyManager::IsWindowInfoCacheMatched(const WindowInfoCacheItem& cacheItem,
+    const std::vector<MMI::WindowInfo>& sessionWindowInfoList,
+    const std::vector<MMI::UIExtensionInfo>& uiExtensionInfoList) const
+{
+    if (cacheItem.windowIds.size() != sessionWindowInfoList.size() ||
+        cacheItem.uiExtensionInfoList.size() != uiExtensionInfoList.size() ||
+        cacheItem.displayId != sessionWindowInfoList.back().displayId ||
+        cacheItem.groupId != sessionWindowInfoList.back().groupId) {
+        return false;
+    }
+    for (size_t index = 0; index < sessionWindowInfoList.size(); index++) {
+        if (cacheItem.windowIds[index] != sessionWindowInfoList[index].id) {
+            return false;
+        }
+    }
+    for (size_t index = 0; index < uiExtensionInfoList.size(); index++) {
+        if (cacheItem.uiExtensionInfoList[index].token != uiExtensionInfoList[index].token ||
+            cacheItem.uiExtensionInfoList[index].pid != uiExtensionInfoList[index].pid) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void SceneSessionDirtyManager::UpdatePointerAreas(sptr<SceneSession> sceneSession,
     std::vector<int32_t>& pointerChangeAreas) const
 {
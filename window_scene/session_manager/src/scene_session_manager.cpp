@@ -83,6 +83,7 @@
 #include "session/host/include/scene_persistent_storage.h"
 #include "session/host/include/session_change_recorder.h"
 #include "session/host/include/session_utils.h"
+#include "session/host/include/snapshot_pixel_map_cache.h"
 #include "session/host/include/sub_session.h"
 #include "session/host/include/ws_snapshot_helper.h"
 #include "session_helper.h"
@@ -162,6 +163,9 @@ const std::string ARG_DUMP_PIPLINE = "-p";
 const std::string ARG_DUMP_SCB = "-b";
 const std::string ARG_DUMP_DETAIL = "-c";
 const std::string ARG_DUMP_RECORD = "-v";
+const std::string ARG_DUMP_POINTER_LATENCY = "-l";
+const std::string ARG_DUMP_TASK_STATS = "-t";
+const std::string ARG_RESET = "reset";
 constexpr uint64_t NANO_SECOND_PER_SEC = 1000000000; // ns
 const int32_t LOGICAL_DISPLACEMENT_32 = 32;
 constexpr int32_t GET_TOP_WINDOW_DELAY = 100;
@@ -471,6 +475,33 @@ void IntersectAttachedLimits(const WindowSessionProperty& prop, WindowLimits& px
         vpLimits = result.vpLimits;
     }
 }
+
+/* surfaceId index of scene sessions, only set on the thread running an occlusion callback */
+thread_local const std::unordered_map<uint64_t, sptr<SceneSession>>* g_visibilitySurfaceIdIndex = nullptr;
+
+class VisibilitySurfaceIdIndexScope {
+public:
+    explicit VisibilitySurfaceIdIndexScope(const std::unordered_map<uint64_t, sptr<SceneSession>>& index)
+    {
+        g_visibilitySurfaceIdIndex = &index;
+    }
+    ~VisibilitySurfaceIdIndexScope()
+    {
+        g_visibilitySurfaceIdIndex = nullptr;
+    }
+};
+
+bool IsLowerZOrder(const sptr<SceneSession>& lhs, const sptr<SceneSession>& rhs)
+{
+    uint32_t lhsZOrder = lhs != nullptr ? lhs->GetZOrder() : 0;
+    uint32_t rhsZOrder = rhs != nullptr ? rhs->GetZOrder() : 0;
+    if (lhsZOrder != rhsZOrder) {
+        return lhsZOrder < rhsZOrder;
+    }
+    int32_t lhsId = lhs != nullptr ? lhs->GetPersistentId() : INVALID_SESSION_ID;
+    int32_t rhsId = rhs != nullptr ? rhs->GetPersistentId() : INVALID_SESSION_ID;
+    return lhsId < rhsId;
+}
 } // namespace
 
 sptr<SceneSessionManager> SceneSessionManager::CreateInstance()
@@ -549,6 +580,7 @@ void SceneSessionManager::Init()
         TLOGW(WmsLogTag::DEFAULT, "Add thread %{public}s to watchdog failed.", WINDOW_INFO_REPORT_THREAD.c_str());
     }
     taskScheduler_->SetExportHandler(eventHandler_);
+    taskScheduler_->SetExportBatchDelay(system::GetIntParameter<int64_t>("persist.window.export_batch_delay_ms", 0));
 
     scbSessionHandler_ = sptr<ScbSessionHandler>::MakeSptr();
     AAFwk::AbilityManagerClient::GetInstance()->RegisterSessionHandler(scbSessionHandler_);
@@ -567,7 +599,7 @@ void SceneSessionManager::Init()
     // Input init.
     SceneInputManager::GetInstance().Init();
     SceneInputManager::GetInstance().
-        RegisterFlushWindowInfoCallback([this] { FlushWindowInfoToMMI(); });
+        RegisterFlushWindowInfoCallback([this] { FlushDirtyWindowInfoToMMI(); });
 
     // DFX
     SessionChangeRecorder::GetInstance().Init();
@@ -2484,27 +2516,12 @@ std::vector<sptr<SceneSession>> SceneSessionManager::GetSceneSessionVectorByType
         TLOGE(WmsLogTag::WMS_LIFE, "displayId is invalid");
         return {};
     }
-    std::vector<sptr<SceneSession>> sceneSessionVector;
-    std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, sceneSession] : sceneSessionMap_) {
-        if (sceneSession->GetWindowType() == type &&
-            sceneSession->GetSessionProperty()->GetDisplayId() == displayId) {
-            sceneSessionVector.emplace_back(sceneSession);
-        }
-    }
-    return sceneSessionVector;
+    return sceneSessionRegistry_.GetByTypeAndDisplayId(type, displayId);
 }
 
 std::vector<sptr<SceneSession>> SceneSessionManager::GetSceneSessionVectorByType(WindowType type)
 {
-    std::vector<sptr<SceneSession>> sceneSessionVector;
-    std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, sceneSession] : sceneSessionMap_) {
-        if (sceneSession->GetWindowType() == type) {
-            sceneSessionVector.emplace_back(sceneSession);
-        }
-    }
-    return sceneSessionVector;
+    return sceneSessionRegistry_.GetByWindowType(type);
 }
 
 WSError SceneSessionManager::UpdateParentSessionForDialog(const sptr<SceneSession>& sceneSession,
@@ -2516,6 +2533,7 @@ WSError SceneSessionManager::UpdateParentSessionForDialog(const sptr<SceneSessio
     }
     auto parentPersistentId = property->GetParentPersistentId();
     sceneSession->SetParentPersistentId(parentPersistentId);
+    sceneSessionRegistry_.UpdateAttributes(sceneSession);
     if (property->GetWindowType() == WindowType::WINDOW_TYPE_DIALOG && parentPersistentId != INVALID_SESSION_ID) {
         auto parentSession = GetSceneSession(parentPersistentId);
         if (parentSession == nullptr) {
@@ -3736,6 +3754,8 @@ sptr<SceneSession> SceneSessionManager::RequestSceneSession(const SessionInfo& s
         {
             std::unique_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
             sceneSessionMap_.insert({ sceneSession->GetPersistentId(), sceneSession });
+            sceneSessionRegistry_.Add(sceneSession);
+            MarkSceneSessionMapChangedLocked();
             if (MultiInstanceManager::IsSupportMultiInstance(systemConfig_) &&
                 MultiInstanceManager::GetInstance().IsMultiInstance(sceneSession->GetSessionInfo().bundleName_)) {
                 MultiInstanceManager::GetInstance().IncreaseInstanceKeyRefCount(sceneSession);
@@ -4900,6 +4920,17 @@ void SceneSessionManager::EraseSceneSessionAndMarkDirtyLocked(int32_t persistent
         sessionMapDirty_ |= static_cast<uint32_t>(SessionUIDirtyFlag::VISIBLE);
     }
     sceneSessionMap_.erase(persistentId);
+    sceneSessionRegistry_.Remove(persistentId);
+    MarkSceneSessionMapChangedLocked();
+}
+
+void SceneSessionManager::MarkSceneSessionMapChangedLocked()
+{
+    // snapshot is rebuilt lazily by the next reader
+    sceneSessionMapEpoch_.fetch_add(1, std::memory_order_release);
+    // drop the zOrder index so it does not keep removed sessions alive
+    std::lock_guard<std::mutex> lock(zOrderIndexMutex_);
+    zOrderIndex_ = nullptr;
 }
 
 WSError SceneSessionManager::RequestSceneSessionDestruction(const sptr<SceneSession>& sceneSession,
@@ -4934,6 +4965,7 @@ WSError SceneSessionManager::RequestSceneSessionDestruction(const sptr<SceneSess
         }
         RequestSessionUnfocus(persistentId, FocusChangeReason::SCB_SESSION_REQUEST_UNFOCUS);
         avoidAreaListenerSessionSet_.erase(persistentId);
+        avoidAreaSourceStampMap_.erase(persistentId);
         screenshotListenerSessionSet_.erase(persistentId);
         screenshotAppEventListenerSessionSet_.erase(persistentId);
         RemoveSessionFromBlackList(sceneSession);
@@ -5843,6 +5875,7 @@ WSError SceneSessionManager::RecoverAndConnectSpecificSession(const sptr<ISessio
             return WSError::WS_ERROR_INVALID_SESSION;
         }
         auto errCode = sceneSession->Reconnect(sessionStage, eventChannel, surfaceNode, property, token, pid, uid);
+        sceneSessionRegistry_.UpdateAttributes(sceneSession);
         if (errCode != WSError::WS_OK) {
             TLOGNE(WmsLogTag::WMS_RECOVER, "SceneSession reconnect failed");
             EraseSceneSessionMapById(persistentId);
@@ -5984,6 +6017,7 @@ WSError SceneSessionManager::RecoverAndReconnectSceneSession(const sptr<ISession
             return WSError::WS_ERROR_INVALID_SESSION;
         }
         auto ret = sceneSession->Reconnect(sessionStage, eventChannel, surfaceNode, property, token, pid, uid);
+        sceneSessionRegistry_.UpdateAttributes(sceneSession);
         if (ret != WSError::WS_OK) {
             TLOGNE(WmsLogTag::WMS_RECOVER, "Reconnect failed");
             EraseSceneSessionMapById(sessionInfo.persistentId_);
@@ -6124,6 +6158,7 @@ void SceneSessionManager::SetFocusedSessionDisplayIdIfNeeded(sptr<SceneSession>&
         }
         newSession->SetScreenId(displayId);
         newSession->GetSessionProperty()->SetDisplayId(displayId);
+        sceneSessionRegistry_.UpdateAttributes(newSession);
     }
 }
 
@@ -8953,6 +8988,72 @@ WSError SceneSessionManager::GetSCBDebugDumpInfo(std::string&& cmd, std::string&
     return WSError::WS_OK;
 }
 
+void SceneSessionManager::RecordPointerLatency(int32_t pointerAction, PointerLatencyStage stage, uint64_t latencyUs)
+{
+    if (stage >= PointerLatencyStage::COUNT) {
+        return;
+    }
+    int32_t slot = (pointerAction >= 0 && pointerAction < POINTER_LATENCY_ACTION_SLOTS) ?
+        pointerAction : POINTER_LATENCY_ACTION_SLOTS - 1;
+    pointerLatencyHistograms_[slot][static_cast<size_t>(stage)].Record(latencyUs);
+}
+
+WSError SceneSessionManager::GetPointerLatencyDumpInfo(const std::vector<std::string>& params, std::string& dumpInfo)
+{
+    bool needReset = params.size() >= 2 && params[1] == ARG_RESET; // 2: params num
+    static const char* stageNames[] = { "transfer", "done" };
+    std::ostringstream oss;
+    oss << "Pointer dispatch latency(us), action stage: histogram" << std::endl;
+    for (int32_t slot = 0; slot < POINTER_LATENCY_ACTION_SLOTS; slot++) {
+        for (size_t stage = 0; stage < static_cast<size_t>(PointerLatencyStage::COUNT); stage++) {
+            auto& histogram = pointerLatencyHistograms_[slot][stage];
+            if (histogram.GetCount() != 0) {
+                oss << (slot == POINTER_LATENCY_ACTION_SLOTS - 1 ? "other" : std::to_string(slot))
+                    << " " << stageNames[stage] << ": " << histogram.ToString() << std::endl;
+            }
+            if (needReset) {
+                histogram.Reset();
+            }
+        }
+    }
+    dumpInfo.append(oss.str());
+    return WSError::WS_OK;
+}
+
+WSError SceneSessionManager::GetTaskStatsDumpInfo(std::string& dumpInfo)
+{
+    std::ostringstream oss;
+    auto snapshotStats = ScenePersistence::GetSnapshotPersistStats();
+    oss << "Snapshot persist: queueDepth " << snapshotStats.queueDepth << ", pendingBytes "
+        << snapshotStats.pendingBytes << ", superseded " << snapshotStats.supersededCount << ", dropped "
+        << snapshotStats.droppedCount << std::endl;
+    auto dumpLatency = [&oss](const char* name, const auto& histogram) {
+        oss << "  " << name << " latency(log2 ms):";
+        for (auto count : histogram) {
+            oss << " " << count;
+        }
+        oss << std::endl;
+    };
+    dumpLatency("queue", snapshotStats.queueLatencyHistogram);
+    dumpLatency("persist", snapshotStats.persistLatencyHistogram);
+    auto exportStats = taskScheduler_->GetExportTaskStats();
+    int64_t avgQueueLatencyUs = exportStats.batchCount != 0 ?
+        exportStats.totalQueueLatencyUs / static_cast<int64_t>(exportStats.batchCount) : 0;
+    oss << "Export task: batches " << exportStats.batchCount << ", tasks " << exportStats.taskCount
+        << ", coalesced " << exportStats.coalescedCount << ", avgQueueLatencyUs " << avgQueueLatencyUs
+        << ", maxQueueLatencyUs " << exportStats.maxQueueLatencyUs << std::endl;
+    if (vsyncStation_ != nullptr) {
+        oss << "Vsync callback: " << vsyncStation_->GetFrameStats().ToString() << std::endl;
+    }
+    for (const auto& [pid, agentStats] : SessionManagerAgentController::GetInstance().GetAgentNotifyStats()) {
+        oss << "Agent notify: pid " << pid << ", backlog " << agentStats.backlog << ", delivered "
+            << agentStats.delivered << ", coalesced " << agentStats.coalesced << ", dropped "
+            << agentStats.dropped << std::endl;
+    }
+    dumpInfo.append(oss.str());
+    return WSError::WS_OK;
+}
+
 void SceneSessionManager::NotifyDumpInfoResult(const std::vector<std::string>& info)
 {
     dumpInfoFuture_.SetValue(info);
@@ -8994,6 +9095,12 @@ WSError SceneSessionManager::GetSessionDumpInfo(const std::vector<std::string>&
         SessionChangeRecorder::GetInstance().GetSceneSessionNeedDumpInfo(resetParams, dumpInfo);
         return WSError::WS_OK;
     }
+    if (params.size() >= 1 && params[0] == ARG_DUMP_POINTER_LATENCY) { // 1: params num
+        return GetPointerLatencyDumpInfo(params, dumpInfo);
+    }
+    if (params.size() == 1 && params[0] == ARG_DUMP_TASK_STATS) { // 1: params num
+        return GetTaskStatsDumpInfo(dumpInfo);
+    }
     return WSError::WS_ERROR_INVALID_OPERATION;
 }
 
@@ -9114,17 +9221,35 @@ void SceneSessionManager::TraverseSessionTree(TraverseFunc func, bool isFromTopT
     return;
 }
 
-void SceneSessionManager::TraverseSessionTreeFromTopToBottom(TraverseFunc func)
+std::shared_ptr<const SceneSessionManager::ZOrderIndex> SceneSessionManager::GetZOrderIndex()
 {
-    CmpFunc cmp = [](std::pair<int32_t, sptr<SceneSession>>& lhs, std::pair<int32_t, sptr<SceneSession>>& rhs) {
-        uint32_t lhsZOrder = lhs.second != nullptr ? lhs.second->GetZOrder() : 0;
-        uint32_t rhsZOrder = rhs.second != nullptr ? rhs.second->GetZOrder() : 0;
-        return lhsZOrder < rhsZOrder;
-    };
-    auto sceneSessionVector = GetSceneSessionVector(cmp);
+    std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
+    std::lock_guard<std::mutex> indexLock(zOrderIndexMutex_);
+    if (zOrderIndex_ == nullptr || zOrderIndex_->zOrderChangeCount != Session::GetZOrderChangeCount()) {
+        RebuildZOrderIndexLocked();
+    }
+    return zOrderIndex_;
+}
 
-    for (auto iter = sceneSessionVector.rbegin(); iter != sceneSessionVector.rend(); ++iter) {
-        auto session = iter->second;
+void SceneSessionManager::RebuildZOrderIndexLocked()
+{
+    auto index = std::make_shared<ZOrderIndex>();
+    // read before the zOrders, a change during the sort is picked up by the next reader
+    index->zOrderChangeCount = Session::GetZOrderChangeCount();
+    index->sessions.reserve(sceneSessionMap_.size());
+    for (const auto& [_, sceneSession] : sceneSessionMap_) {
+        index->sessions.push_back(sceneSession);
+    }
+    std::sort(index->sessions.begin(), index->sessions.end(), IsLowerZOrder);
+    zOrderIndex_ = std::move(index);
+    zOrderIndexRebuildCount_++;
+}
+
+void SceneSessionManager::TraverseSessionTreeFromTopToBottom(TraverseFunc func)
+{
+    auto zOrderIndex = GetZOrderIndex();
+    for (auto iter = zOrderIndex->sessions.rbegin(); iter != zOrderIndex->sessions.rend(); ++iter) {
+        const auto& session = *iter;
         if (session == nullptr) {
             TLOGE(WmsLogTag::DEFAULT, "session is nullptr");
             continue;
@@ -9138,16 +9263,8 @@ void SceneSessionManager::TraverseSessionTreeFromTopToBottom(TraverseFunc func)
 
 void SceneSessionManager::TraverseSessionTreeFromBottomToTop(TraverseFunc func)
 {
-    // std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    CmpFunc cmp = [](std::pair<int32_t, sptr<SceneSession>>& lhs, std::pair<int32_t, sptr<SceneSession>>& rhs) {
-        uint32_t lhsZOrder = lhs.second != nullptr ? lhs.second->GetZOrder() : 0;
-        uint32_t rhsZOrder = rhs.second != nullptr ? rhs.second->GetZOrder() : 0;
-        return lhsZOrder < rhsZOrder;
-    };
-    auto sceneSessionVector = GetSceneSessionVector(cmp);
-    // std::map<int32_t, sptr<SceneSession>>::iterator iter;
-    for (auto iter = sceneSessionVector.begin(); iter != sceneSessionVector.end(); ++iter) {
-        auto session = iter->second;
+    auto zOrderIndex = GetZOrderIndex();
+    for (const auto& session : zOrderIndex->sessions) {
         if (session == nullptr) {
             TLOGE(WmsLogTag::DEFAULT, "session is nullptr");
             continue;
@@ -10621,6 +10738,9 @@ void SceneSessionManager::SetScreenLocked(const bool isScreenLocked)
         isScreenLocked_ = isScreenLocked;
         DeleteStateDetectTask();
         NotifyPiPWindowVisibleChange(isScreenLocked);
+        if (isScreenLocked) {
+            SnapshotPixelMapCache::GetInstance().TrimToBytes(0);
+        }
     }, __func__);
     NotifySessionScreenLockedChange(isScreenLocked);
     if (isTrayAppForeground_) {
@@ -11026,6 +11146,10 @@ __attribute__((no_sanitize("cfi"))) void SceneSessionManager::OnSessionStateChan
         TLOGD(WmsLogTag::DEFAULT, "session is nullptr");
         return;
     }
+    if (state == SessionState::STATE_CONNECT || state == SessionState::STATE_DISCONNECT) {
+        // callingPid and displayId are set on connect and callingPid is reset on disconnect
+        sceneSessionRegistry_.UpdateAttributes(sceneSession);
+    }
     if (state >= SessionState::STATE_DISCONNECT && state < SessionState::STATE_END) {
         if (listenerController_) {
             listenerController_->NotifyAppInstanceLifecycleEvent(state, sceneSession);
@@ -12871,6 +12995,7 @@ WSError SceneSessionManager::BindDialogSessionTarget(uint64_t persistentId, sptr
         sceneSession->SetScreenId(displayId);
         sceneSession->SetParentSession(parentSession);
         sceneSession->SetParentPersistentId(parentSession->GetPersistentId());
+        sceneSessionRegistry_.UpdateAttributes(sceneSession);
         sceneSession->SetClientDisplayId(parentSession->GetClientDisplayId());
         UpdateParentSessionForDialog(sceneSession, sceneSession->GetSessionProperty());
         TLOGNI(WmsLogTag::WMS_DIALOG, "Bind dialog success, dialog id %{public}" PRIu64 ", parentId %{public}d",
@@ -13747,6 +13872,10 @@ bool SceneSessionManager::FillWindowInfo(std::vector<sptr<AccessibilityWindowInf
 
 sptr<SceneSession> SceneSessionManager::SelectSesssionFromMap(const uint64_t& surfaceId)
 {
+    if (g_visibilitySurfaceIdIndex != nullptr) {
+        auto iter = g_visibilitySurfaceIdIndex->find(surfaceId);
+        return iter != g_visibilitySurfaceIdIndex->end() ? iter->second : nullptr;
+    }
     std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
     for (const auto& [_, sceneSession] : sceneSessionMap_) {
         if (sceneSession == nullptr) {
@@ -13771,6 +13900,10 @@ void SceneSessionManager::WindowLayerInfoChangeCallback(std::shared_ptr<RSOcclus
             TLOGNE(WmsLogTag::WMS_ATTRIBUTE, "weak occlusionData is nullptr");
             return;
         }
+        /* resolve surfaceIds with one pass over the sessions instead of a scan per lookup */
+        auto surfaceIdIndex = BuildSurfaceIdIndex();
+        VisibilitySurfaceIdIndexScope indexScope(surfaceIdIndex);
+        visibilityTouchedSessionCount_ = 0;
         std::vector<std::pair<uint64_t, WindowVisibilityState>> currVisibleData;
         std::vector<std::pair<uint64_t, bool>> currDrawingContentData;
         GetWindowLayerChangeInfo(weakOcclusionData, currVisibleData, currDrawingContentData);
@@ -13782,6 +13915,7 @@ void SceneSessionManager::WindowLayerInfoChangeCallback(std::shared_ptr<RSOcclus
             DealwithVisibilityChange(visibilityChangeInfos, currVisibleData);
             CacVisibleWindowNum();
         }
+        RecordVisibilityCallbackStats(currVisibleData.size(), visibilityChangeInfos.size());
 
         std::vector<std::pair<uint64_t, bool>> drawingContentChangeInfos;
         if (currDrawingContentData.size() != 0) {
@@ -13861,12 +13995,14 @@ bool SceneSessionManager::GetSessionRSVisible(const sptr<Session>& session,
     WindowVisibilityState& sessionVisibleState)
 {
     bool sessionRSVisible = false;
+    auto surfaceNode = session->GetSurfaceNode();
+    if (surfaceNode == nullptr) {
+        return sessionRSVisible;
+    }
+    /* sessions are looked up by surface node id, so matching the id is enough */
+    uint64_t sessionSurfaceId = surfaceNode->GetId();
     for (const auto& [surfaceId, visibleState] : currVisibleData) {
-        sptr<SceneSession> visibilitySession = SelectSesssionFromMap(surfaceId);
-        if (visibilitySession == nullptr) {
-            continue;
-        }
-        if (session->GetWindowId() == visibilitySession->GetWindowId()) {
+        if (surfaceId == sessionSurfaceId) {
             if (visibleState < WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION) {
                 sessionRSVisible = true;
                 sessionVisibleState = visibleState;
@@ -13877,6 +14013,43 @@ bool SceneSessionManager::GetSessionRSVisible(const sptr<Session>& session,
     return sessionRSVisible;
 }
 
+std::unordered_map<uint64_t, sptr<SceneSession>> SceneSessionManager::BuildSurfaceIdIndex()
+{
+    std::unordered_map<uint64_t, sptr<SceneSession>> surfaceIdIndex;
+    std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
+    surfaceIdIndex.reserve(sceneSessionMap_.size());
+    for (const auto& [_, sceneSession] : sceneSessionMap_) {
+        if (sceneSession == nullptr || sceneSession->GetSurfaceNode() == nullptr) {
+            continue;
+        }
+        /* keep the first match in map order, as the linear lookup did */
+        surfaceIdIndex.emplace(sceneSession->GetSurfaceNode()->GetId(), sceneSession);
+    }
+    return surfaceIdIndex;
+}
+
+void SceneSessionManager::RecordVisibilityCallbackStats(size_t visibleEntryCount, size_t changedEntryCount)
+{
+    visibilityCallbackCount_.fetch_add(1, std::memory_order_relaxed);
+    visibilityTotalTouchedCount_.fetch_add(visibilityTouchedSessionCount_, std::memory_order_relaxed);
+    lastVisibilityEntryCount_.store(static_cast<uint32_t>(visibleEntryCount), std::memory_order_relaxed);
+    lastVisibilityChangedCount_.store(static_cast<uint32_t>(changedEntryCount), std::memory_order_relaxed);
+    lastVisibilityTouchedCount_.store(visibilityTouchedSessionCount_, std::memory_order_relaxed);
+    TLOGD(WmsLogTag::WMS_ATTRIBUTE, "entries: %{public}zu, changed: %{public}zu, touched: %{public}u",
+        visibleEntryCount, changedEntryCount, visibilityTouchedSessionCount_);
+}
+
+VisibilityCallbackStats SceneSessionManager::GetVisibilityCallbackStats() const
+{
+    VisibilityCallbackStats stats;
+    stats.callbackCount = visibilityCallbackCount_.load(std::memory_order_relaxed);
+    stats.totalTouchedCount = visibilityTotalTouchedCount_.load(std::memory_order_relaxed);
+    stats.lastEntryCount = lastVisibilityEntryCount_.load(std::memory_order_relaxed);
+    stats.lastChangedCount = lastVisibilityChangedCount_.load(std::memory_order_relaxed);
+    stats.lastTouchedCount = lastVisibilityTouchedCount_.load(std::memory_order_relaxed);
+    return stats;
+}
+
 void SceneSessionManager::SetSessionVisibilityInfo(const sptr<SceneSession>& session,
     WindowVisibilityState visibleState, std::vector<sptr<WindowVisibilityInfo>>& windowVisibilityInfos,
     std::string& visibilityInfo)
@@ -13885,6 +14058,7 @@ void SceneSessionManager::SetSessionVisibilityInfo(const sptr<SceneSession>& ses
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Session is invalid!");
         return;
     }
+    visibilityTouchedSessionCount_++;
     session->SetRSVisible(visibleState < WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION);
     session->SetVisibilityState(visibleState);
     int32_t windowId = session->GetWindowId();
@@ -14625,6 +14799,7 @@ WSError SceneSessionManager::UpdateSessionAvoidAreaListener(int32_t persistentId
             UpdateAvoidArea(persistentId);
         } else {
             avoidAreaListenerSessionSet_.erase(persistentId);
+            avoidAreaSourceStampMap_.erase(persistentId);
         }
         return WSError::WS_OK;
     };
@@ -14671,10 +14846,16 @@ WMError SceneSessionManager::UpdateSessionScreenshotAppEventListener(int32_t per
     }, __func__);
 }
 
-void SceneSessionManager::UpdateAvoidSessionAvoidArea(WindowType type)
+void SceneSessionManager::UpdateAvoidSessionAvoidArea(WindowType type, DisplayId displayId)
 {
     AvoidAreaType avoidType = (type == WindowType::WINDOW_TYPE_INPUT_METHOD_FLOAT) ?
         AvoidAreaType::TYPE_KEYBOARD : AvoidAreaType::TYPE_SYSTEM;
+    bool useSourceCache = displayId != DISPLAY_ID_INVALID;
+    if (useSourceCache && !RefreshAvoidAreaSourceVersion(avoidType, displayId)) {
+        TLOGD(WmsLogTag::WMS_IMMS, "display %{public}" PRIu64 " type %{public}u sources unchanged",
+            displayId, avoidType);
+        return;
+    }
     AvoidArea avoidArea = rootSceneSession_->GetAvoidAreaByType(avoidType);
     rootSceneSession_->UpdateAvoidArea(new AvoidArea(avoidArea), avoidType);
 
@@ -14689,11 +14870,91 @@ void SceneSessionManager::UpdateAvoidSessionAvoidArea(WindowType type)
             TLOGE(WmsLogTag::WMS_IMMS, "id: %{public}d invalid scale", sceneSession->GetPersistentId());
             continue;
         }
+        if (useSourceCache && !CheckAndUpdateAvoidAreaSourceStamp(sceneSession, avoidType)) {
+            continue;
+        }
         AvoidArea avoidArea = sceneSession->GetAvoidAreaByType(avoidType);
         sceneSession->UpdateAvoidArea(new AvoidArea(avoidArea), avoidType);
     }
 }
 
+std::vector<SceneSessionManager::AvoidAreaSource> SceneSessionManager::CollectAvoidAreaSources(
+    AvoidAreaType type, DisplayId displayId)
+{
+    constexpr uint32_t SOURCE_VISIBLE = 1u;
+    constexpr uint32_t SOURCE_CONSTANTLY_SHOW = 1u << 1;
+    constexpr uint32_t SOURCE_FOREGROUND = 1u << 2;
+    constexpr uint32_t SOURCE_FLOAT_GRAVITY = 1u << 3;
+    constexpr uint32_t SOURCE_AVOID_AREA_ACTIVE = 1u << 4;
+    std::vector<AvoidAreaSource> sources;
+    if (type == AvoidAreaType::TYPE_SYSTEM) {
+        for (const auto& statusBar : GetSceneSessionVectorByTypeAndDisplayId(WindowType::WINDOW_TYPE_STATUS_BAR,
+            displayId)) {
+            AvoidAreaSource source { statusBar->GetPersistentId(), statusBar->GetSessionRect(), 0 };
+            GetStatusBarAvoidHeight(displayId, source.rect);
+            bool isConstantlyShow = false;
+            GetStatusBarConstantlyShow(displayId, isConstantlyShow);
+            source.state = (statusBar->IsVisible() ? SOURCE_VISIBLE : 0) |
+                (isConstantlyShow ? SOURCE_CONSTANTLY_SHOW : 0);
+            sources.push_back(source);
+        }
+        return sources;
+    }
+    for (const auto& inputMethod : GetSceneSessionVectorByTypeAndDisplayId(
+        WindowType::WINDOW_TYPE_INPUT_METHOD_FLOAT, displayId)) {
+        AvoidAreaSource source { inputMethod->GetPersistentId(), inputMethod->GetSessionRect(), 0 };
+        if (isKeyboardPanelEnabled_ && inputMethod->GetKeyboardPanelSession() != nullptr) {
+            source.rect = inputMethod->GetKeyboardPanelSession()->GetSessionRect();
+            inputMethod->RecalculatePanelRectForAvoidArea(source.rect);
+        }
+        SessionState state = inputMethod->GetSessionState();
+        bool isForeground = state == SessionState::STATE_FOREGROUND || state == SessionState::STATE_ACTIVE;
+        source.state = (isForeground ? SOURCE_FOREGROUND : 0) |
+            (inputMethod->GetKeyboardGravity() == SessionGravity::SESSION_GRAVITY_FLOAT ? SOURCE_FLOAT_GRAVITY : 0) |
+            (inputMethod->IsKeyboardAvoidAreaActive() ? SOURCE_AVOID_AREA_ACTIVE : 0);
+        sources.push_back(source);
+    }
+    return sources;
+}
+
+bool SceneSessionManager::RefreshAvoidAreaSourceVersion(AvoidAreaType type, DisplayId displayId)
+{
+    /* a bar moving to another display changes the sources of both displays */
+    std::set<DisplayId> displayIds = { displayId };
+    for (const auto& [key, _] : avoidAreaSourceCache_) {
+        if (key.second == type) {
+            displayIds.insert(key.first);
+        }
+    }
+    bool isChanged = false;
+    for (DisplayId id : displayIds) {
+        auto sources = CollectAvoidAreaSources(type, id);
+        auto& entry = avoidAreaSourceCache_[{ id, type }];
+        if (entry.version != 0 && entry.sources == sources) {
+            continue;
+        }
+        entry.sources = std::move(sources);
+        entry.version++;
+        isChanged = true;
+    }
+    return isChanged;
+}
+
+bool SceneSessionManager::CheckAndUpdateAvoidAreaSourceStamp(const sptr<SceneSession>& sceneSession,
+    AvoidAreaType type)
+{
+    DisplayId displayId = sceneSession->GetSessionProperty()->GetDisplayId();
+    auto iter = avoidAreaSourceCache_.find({ displayId, type });
+    uint64_t version = iter != avoidAreaSourceCache_.end() ? iter->second.version : 0;
+    auto& stamps = avoidAreaSourceStampMap_[sceneSession->GetPersistentId()];
+    auto stampIter = stamps.find(type);
+    if (stampIter != stamps.end() && stampIter->second == std::make_pair(displayId, version)) {
+        return false;
+    }
+    stamps[type] = { displayId, version };
+    return true;
+}
+
 void SceneSessionManager::UpdateNormalSessionAvoidArea(
     int32_t persistentId, const sptr<SceneSession>& sceneSession, bool& needUpdate)
 {
@@ -14765,7 +15026,8 @@ void SceneSessionManager::UpdateAvoidArea(int32_t persistentId)
         bool needUpdate = false;
         auto sceneSession = GetSceneSession(persistentId);
         if (sceneSession != nullptr && sceneSession->IsImmersiveType()) {
-            UpdateAvoidSessionAvoidArea(sceneSession->GetWindowType());
+            UpdateAvoidSessionAvoidArea(sceneSession->GetWindowType(),
+                sceneSession->GetSessionProperty()->GetDisplayId());
         } else {
             UpdateNormalSessionAvoidArea(persistentId, sceneSession, needUpdate);
         }
@@ -15271,15 +15533,7 @@ void SceneSessionManager::ProcessVirtualPixelRatioChange(DisplayId defaultDispla
         if (onVirtualPixelChangeCallback_ != nullptr && type == DisplayStateChangeType::VIRTUAL_PIXEL_RATIO_CHANGE) {
             onVirtualPixelChangeCallback_(displayInfo->GetVirtualPixelRatio() * DOT_PER_INCH, displayInfo->GetScreenId());
         }
-        std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-        for (const auto& [_, sceneSession] : sceneSessionMap_) {
-            if (sceneSession == nullptr) {
-                TLOGNE(WmsLogTag::WMS_ATTRIBUTE, "%{public}s null scene session", where);
-                continue;
-            }
-            if (sceneSession->GetSessionProperty()->GetDisplayId() != displayInfo->GetDisplayId()) {
-                continue;
-            }
+        for (const auto& sceneSession : sceneSessionRegistry_.GetByDisplayId(displayInfo->GetDisplayId())) {
             if (sceneSession->GetSessionInfo().isSystem_) {
                 continue;
             }
@@ -16321,29 +16575,8 @@ void SceneSessionManager::RunAfterNVsyncs(uint32_t vsyncCount, OnCallback&& call
         TLOGE(WmsLogTag::DEFAULT, "could not request next vsync");
         return;
     }
-    auto counter = std::make_shared<std::atomic<uint32_t>>(0);
-    auto vsyncCallback = std::make_shared<VsyncCallback>();
-
-    vsyncCallback->onCallback = [weakStation = std::weak_ptr<VsyncStation>(vsyncStation_),
-                                 weakVsyncCallback = std::weak_ptr<VsyncCallback>(vsyncCallback),
-                                 counter,
-                                 vsyncCount,
-                                 callback = std::move(callback),
-                                 where =  __func__](int64_t timestamp, int64_t frameCount) mutable {
-        if (++(*counter) >= vsyncCount) {
-            callback(timestamp, frameCount);
-            return;
-        }
-        auto vsyncStation = weakStation.lock();
-        if (!vsyncStation) {
-            TLOGE(WmsLogTag::DEFAULT, "Could not request next vsync");
-            return;
-        }
-        if (auto nextCallback = weakVsyncCallback.lock()) {
-            vsyncStation->RequestVsync(nextCallback);
-        }
-    };
-    vsyncStation_->RequestVsync(vsyncCallback);
+    // the station counts the vsyncs itself, a count of 0 runs on the next vsync as before
+    vsyncStation_->RunOnceAfterNVsyncs(std::max<uint32_t>(vsyncCount, 1), std::move(callback));
 }
 
 WMError SceneSessionManager::UpdateWindowModeByIdForUITest(int32_t windowId, int32_t updateMode)
@@ -16953,29 +17186,51 @@ const std::map<int32_t, sptr<SceneSession>> SceneSessionManager::GetSceneSession
         retSceneSessionMap = sceneSessionMap_;
     }
     EraseIf(retSceneSessionMap, [this](const auto& pair) {
-        if (pair.second == nullptr) {
-            return true;
-        }
+        return IsSessionFilteredForMMI(pair.second);
+    });
+    return retSceneSessionMap;
+}
 
-        if (pair.second->GetWindowType() == WindowType::WINDOW_TYPE_KEYBOARD_PANEL) {
-            if (pair.second->IsVisible()) {
-                return false;
-            }
-            return true;
-        }
+std::shared_ptr<const SceneSessionMapSnapshot> SceneSessionManager::GetSceneSessionMapSnapshot()
+{
+    auto snapshot = std::atomic_load(&sceneSessionMapSnapshot_);
+    if (snapshot != nullptr && snapshot->epoch == sceneSessionMapEpoch_.load(std::memory_order_acquire)) {
+        return snapshot;
+    }
+    auto newSnapshot = std::make_shared<SceneSessionMapSnapshot>();
+    {
+        std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
+        newSnapshot->epoch = sceneSessionMapEpoch_.load(std::memory_order_acquire);
+        newSnapshot->sessionMap = sceneSessionMap_;
+    }
+    snapshot = std::move(newSnapshot);
+    std::atomic_store(&sceneSessionMapSnapshot_, snapshot);
+    return snapshot;
+}
 
-        if (pair.second->IsSystemInput()) {
-            return false;
-        } else if (pair.second->IsSystemSession() && pair.second->IsVisible() && pair.second->IsSystemActive()) {
+bool SceneSessionManager::IsSessionFilteredForMMI(const sptr<SceneSession>& sceneSession)
+{
+    if (sceneSession == nullptr) {
+        return true;
+    }
+
+    if (sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_KEYBOARD_PANEL) {
+        if (sceneSession->IsVisible()) {
             return false;
         }
+        return true;
+    }
 
-        if (!Rosen::SceneSessionManager::GetInstance().IsSessionVisible(pair.second)) {
-            return true;
-        }
+    if (sceneSession->IsSystemInput()) {
         return false;
-    });
-    return retSceneSessionMap;
+    } else if (sceneSession->IsSystemSession() && sceneSession->IsVisible() && sceneSession->IsSystemActive()) {
+        return false;
+    }
+
+    if (!IsSessionVisible(sceneSession)) {
+        return true;
+    }
+    return false;
 }
 
 void SceneSessionManager::NotifyUpdateRectAfterLayout()
@@ -17465,6 +17720,32 @@ void SceneSessionManager::FlushWindowInfoToMMI(const bool forceFlush)
     taskScheduler_->PostAsyncTask(task, __func__);
 }
 
+void SceneSessionManager::FlushDirtyWindowInfoToMMI()
+{
+    auto task = [this] {
+        if (isUserBackground_) {
+            TLOGND(WmsLogTag::WMS_MULTI_USER, "The user is in the background, no need to flush info to MMI");
+            return;
+        }
+        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "SceneSessionManager::FlushDirtyWindowInfoToMMI");
+        SceneInputManager::GetInstance().ResetSessionDirty();
+        IncrementalInfoForMMI incrementalInfoForMMI;
+        if (SceneInputManager::GetInstance().GetIncrementalWindowInfoList(incrementalInfoForMMI)) {
+            if (!incrementalInfoForMMI.windowInfoList.empty()) {
+                SceneInputManager::GetInstance().FlushIncrementalInfoToMMI(
+                    std::move(incrementalInfoForMMI.windowInfoList), std::move(incrementalInfoForMMI.pixelMapList));
+            }
+            return;
+        }
+        FullInfoForMMI fullInfoForMMI = SceneInputManager::GetInstance().GetFullWindowInfoList();
+        TLOGND(WmsLogTag::WMS_EVENT, "windowInfoList size: %{public}d",
+            static_cast<int32_t>(fullInfoForMMI.windowInfoList.size()));
+        SceneInputManager::GetInstance().FlushDisplayInfoToMMI(std::move(fullInfoForMMI.windowInfoList),
+            std::move(fullInfoForMMI.uiExtensionInfoList), std::move(fullInfoForMMI.pixelMapList));
+    };
+    taskScheduler_->PostAsyncTask(task, __func__);
+}
+
 void SceneSessionManager::PostFlushWindowInfoTask(FlushWindowInfoTask&& task,
     const std::string& taskName, const int delayTime)
 {
@@ -17760,15 +18041,8 @@ void SceneSessionManager::HideNonSecureSubWindows(const sptr<SceneSession>& scen
 
     auto parentId = sceneSession->GetPersistentId();
     bool shouldHide = sceneSession->GetCombinedExtWindowFlags().hideNonSecureWindowsFlag;
-    std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, session] : sceneSessionMap_) {
-        if (!session) {
-            continue;
-        }
+    for (const auto& session : sceneSessionRegistry_.GetByParentId(parentId)) {
         auto sessionProperty = session->GetSessionProperty();
-        if (sessionProperty->GetParentPersistentId() != parentId) {
-            continue;
-        }
         if (SessionHelper::IsNonSecureToUIExtension(sessionProperty->GetWindowType()) &&
             !sessionProperty->GetSystemCalling()) {
             session->NotifyForceHideChange(shouldHide);
@@ -18562,7 +18836,7 @@ void SceneSessionManager::CheckSceneZOrder()
     auto task = [this]() {
         AnomalyDetection::SceneZOrderCheckProcess();
     };
-    taskScheduler_->PostAsyncTask(task, "CheckSceneZOrder");
+    taskScheduler_->PostCoalescedTask(task, "CheckSceneZOrder");
 }
 
 WSError SceneSessionManager::NotifyEnterRecentTask(bool enterRecent)
@@ -18661,6 +18935,7 @@ void SceneSessionManager::NotifyDisplayIdChanged(int32_t persistentId, uint64_t
         TLOGE(WmsLogTag::WMS_KEYBOARD, "session is nullptr");
         return;
     }
+    sceneSessionRegistry_.UpdateAttributes(sceneSession);
     // Find keyboard session.
     const auto& keyboardSessionVec = GetSceneSessionVectorByType(WindowType::WINDOW_TYPE_INPUT_METHOD_FLOAT);
     for (const auto& keyboardSession : keyboardSessionVec) {
@@ -19198,7 +19473,7 @@ void SceneSessionManager::UpdateSecSurfaceInfo(std::shared_ptr<RSUIExtensionData
         SceneInputManager::GetInstance().UpdateSecSurfaceInfo(secSurfaceInfoMap);
         return WSError::WS_OK;
     };
-    taskScheduler_->PostAsyncTask(task, "UpdateSecSurfaceInfo");
+    taskScheduler_->PostCoalescedTask(task, "UpdateSecSurfaceInfo");
 }
 
 void SceneSessionManager::RegisterSecSurfaceInfoListener()
@@ -19229,7 +19504,7 @@ void SceneSessionManager::UpdateConstrainedModalUIExtInfo(std::shared_ptr<RSUIEx
         SceneInputManager::GetInstance().UpdateConstrainedModalUIExtInfo(constrainedModalUIExtInfoMap);
         return WSError::WS_OK;
     };
-    taskScheduler_->PostAsyncTask(task, "UpdateConstrainedModalUIExtInfo");
+    taskScheduler_->PostCoalescedTask(task, "UpdateConstrainedModalUIExtInfo");
 }
 
 void SceneSessionManager::RegisterConstrainedModalUIExtInfoListener()
@@ -19629,12 +19904,9 @@ void SceneSessionManager::SetLeashNodeWatermarkForAppProcess(const sptr<SceneSes
 std::string SceneSessionManager::MakeScreenWatermarkOwnerName(int32_t pid, uint32_t tokenId)
 {
     std::string bundleName;
-    std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, session] : sceneSessionMap_) {
-        if (session != nullptr && session->GetCallingPid() == pid) {
-            bundleName = session->GetSessionInfo().bundleName_;
-            break;
-        }
+    auto pidSessions = sceneSessionRegistry_.GetByCallingPid(pid);
+    if (!pidSessions.empty()) {
+        bundleName = pidSessions.front()->GetSessionInfo().bundleName_;
     }
     if (bundleName.empty()) {
         bundleName = "service.sa." + std::to_string(tokenId);
@@ -19794,11 +20066,8 @@ std::vector<NodeId> SceneSessionManager::GetSessionNodeIdsAndWatermarkNameByPid(
 {
     std::vector<NodeId> nodeIds;
     std::string bundleName;
-    std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, session] : sceneSessionMap_) {
-        if (session == nullptr || session->GetCallingPid() != pid) {
-            continue;
-        }
+    auto pidSessions = sceneSessionRegistry_.GetByCallingPid(pid);
+    for (const auto& session : pidSessions) {
         bundleName = session->GetSessionInfo().bundleName_;
         auto surfaceNode = session->GetSurfaceNode();
         if (surfaceNode == nullptr) {
@@ -20849,6 +21118,7 @@ void SceneSessionManager::UpdateSessionDisplayIdBySessionInfo(
             sessionInfo.bundleName_.c_str(), sessionInfo.screenId_, sceneSession->GetScreenId());
         sceneSession->SetScreenId(sessionInfo.screenId_);
         sceneSession->GetSessionProperty()->SetDisplayId(sessionInfo.screenId_);
+        sceneSessionRegistry_.UpdateAttributes(sceneSession);
     }
 }
 
@@ -21008,6 +21278,7 @@ WMError SceneSessionManager::SetParentWindowInner(const sptr<SceneSession>& subS
     newParentSession->AddSubSession(subSession);
     subSession->SetParentSession(newParentSession);
     subSession->SetParentPersistentId(newParentWindowId);
+    sceneSessionRegistry_.UpdateAttributes(subSession);
     subSession->UpdateSubWindowLevel(newSubWindowLevel + 1);
     if (oldSubWindowLevel == 0) {
         oldParentSession->UnregisterNotifySurfaceBoundsChangeFunc(subWindowId);
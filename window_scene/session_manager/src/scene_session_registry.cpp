@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "session_manager/include/scene_session_registry.h"
+
+#include <algorithm>
+
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+void SceneSessionRegistry::Add(const sptr<SceneSession>& sceneSession)
+{
+    if (sceneSession == nullptr) {
+        return;
+    }
+    int32_t persistentId = sceneSession->GetPersistentId();
+    IndexedKeys keys = ReadKeys(sceneSession);
+    std::unique_lock<std::shared_mutex> lock(registryMutex_);
+    if (!keysById_.emplace(persistentId, keys).second) {
+        TLOGW(WmsLogTag::WMS_LIFE, "id: %{public}d already registered", persistentId);
+        return;
+    }
+    InsertSorted(typeIndex_[keys.windowType], persistentId, sceneSession);
+    InsertSorted(displayIndex_[keys.displayId], persistentId, sceneSession);
+    InsertSorted(callingPidIndex_[keys.callingPid], persistentId, sceneSession);
+    InsertSorted(parentIndex_[keys.parentId], persistentId, sceneSession);
+}
+
+void SceneSessionRegistry::Remove(int32_t persistentId)
+{
+    std::unique_lock<std::shared_mutex> lock(registryMutex_);
+    auto iter = keysById_.find(persistentId);
+    if (iter == keysById_.end()) {
+        return;
+    }
+    const IndexedKeys& keys = iter->second;
+    EraseFromIndex(typeIndex_, keys.windowType, persistentId);
+    EraseFromIndex(displayIndex_, keys.displayId, persistentId);
+    EraseFromIndex(callingPidIndex_, keys.callingPid, persistentId);
+    EraseFromIndex(parentIndex_, keys.parentId, persistentId);
+    keysById_.erase(iter);
+}
+
+void SceneSessionRegistry::UpdateAttributes(const sptr<SceneSession>& sceneSession)
+{
+    if (sceneSession == nullptr) {
+        return;
+    }
+    int32_t persistentId = sceneSession->GetPersistentId();
+    IndexedKeys newKeys = ReadKeys(sceneSession);
+    std::unique_lock<std::shared_mutex> lock(registryMutex_);
+    auto iter = keysById_.find(persistentId);
+    if (iter == keysById_.end()) {
+        return;
+    }
+    IndexedKeys& keys = iter->second;
+    if (keys.displayId != newKeys.displayId) {
+        EraseFromIndex(displayIndex_, keys.displayId, persistentId);
+        InsertSorted(displayIndex_[newKeys.displayId], persistentId, sceneSession);
+        keys.displayId = newKeys.displayId;
+    }
+    if (keys.callingPid != newKeys.callingPid) {
+        EraseFromIndex(callingPidIndex_, keys.callingPid, persistentId);
+        InsertSorted(callingPidIndex_[newKeys.callingPid], persistentId, sceneSession);
+        keys.callingPid = newKeys.callingPid;
+    }
+    if (keys.parentId != newKeys.parentId) {
+        EraseFromIndex(parentIndex_, keys.parentId, persistentId);
+        InsertSorted(parentIndex_[newKeys.parentId], persistentId, sceneSession);
+        keys.parentId = newKeys.parentId;
+    }
+}
+
+size_t SceneSessionRegistry::Size() const
+{
+    std::shared_lock<std::shared_mutex> lock(registryMutex_);
+    return keysById_.size();
+}
+
+std::vector<sptr<SceneSession>> SceneSessionRegistry::GetByWindowType(WindowType type) const
+{
+    std::shared_lock<std::shared_mutex> lock(registryMutex_);
+    return CollectLocked(typeIndex_, static_cast<uint32_t>(type), [](const sptr<SceneSession>&) { return true; });
+}
+
+std::vector<sptr<SceneSession>> SceneSessionRegistry::GetByTypeAndDisplayId(WindowType type,
+    DisplayId displayId) const
+{
+    uint32_t windowType = static_cast<uint32_t>(type);
+    std::shared_lock<std::shared_mutex> lock(registryMutex_);
+    auto typeIter = typeIndex_.find(windowType);
+    auto displayIter = displayIndex_.find(displayId);
+    if (typeIter == typeIndex_.end() || displayIter == displayIndex_.end()) {
+        return {};
+    }
+    /* walk the smaller bucket, both paths return the entries present in the two buckets */
+    if (typeIter->second.size() <= displayIter->second.size()) {
+        return CollectLocked(typeIndex_, windowType, [this, displayId](const sptr<SceneSession>& sceneSession) {
+            auto iter = keysById_.find(sceneSession->GetPersistentId());
+            return iter != keysById_.end() && iter->second.displayId == displayId &&
+                GetSessionDisplayId(sceneSession) == displayId;
+        });
+    }
+    return CollectLocked(displayIndex_, displayId, [this, windowType, displayId](
+        const sptr<SceneSession>& sceneSession) {
+        auto iter = keysById_.find(sceneSession->GetPersistentId());
+        return iter != keysById_.end() && iter->second.windowType == windowType &&
+            GetSessionDisplayId(sceneSession) == displayId;
+    });
+}
+
+std::vector<sptr<SceneSession>> SceneSessionRegistry::GetByDisplayId(DisplayId displayId) const
+{
+    std::shared_lock<std::shared_mutex> lock(registryMutex_);
+    return CollectLocked(displayIndex_, displayId, [displayId](const sptr<SceneSession>& sceneSession) {
+        return GetSessionDisplayId(sceneSession) == displayId;
+    });
+}
+
+std::vector<sptr<SceneSession>> SceneSessionRegistry::GetByCallingPid(int32_t pid) const
+{
+    std::shared_lock<std::shared_mutex> lock(registryMutex_);
+    return CollectLocked(callingPidIndex_, pid, [pid](const sptr<SceneSession>& sceneSession) {
+        return sceneSession->GetCallingPid() == pid;
+    });
+}
+
+std::vector<sptr<SceneSession>> SceneSessionRegistry::GetByParentId(int32_t parentId) const
+{
+    std::shared_lock<std::shared_mutex> lock(registryMutex_);
+    return CollectLocked(parentIndex_, parentId, [parentId](const sptr<SceneSession>& sceneSession) {
+        return sceneSession->GetParentPersistentId() == parentId;
+    });
+}
+
+SceneSessionRegistry::IndexedKeys SceneSessionRegistry::ReadKeys(const sptr<SceneSession>& sceneSession)
+{
+    IndexedKeys keys;
+    keys.windowType = static_cast<uint32_t>(sceneSession->GetWindowType());
+    keys.displayId = GetSessionDisplayId(sceneSession);
+    keys.callingPid = sceneSession->GetCallingPid();
+    keys.parentId = sceneSession->GetParentPersistentId();
+    return keys;
+}
+
+DisplayId SceneSessionRegistry::GetSessionDisplayId(const sptr<SceneSession>& sceneSession)
+{
+    auto property = sceneSession->GetSessionProperty();
+    return property != nullptr ? property->GetDisplayId() : DISPLAY_ID_INVALID;
+}
+
+void SceneSessionRegistry::InsertSorted(Bucket& bucket, int32_t persistentId, const sptr<SceneSession>& sceneSession)
+{
+    auto iter = std::lower_bound(bucket.begin(), bucket.end(), persistentId,
+        [](const SessionEntry& entry, int32_t id) { return entry.first < id; });
+    if (iter == bucket.end() || iter->first != persistentId) {
+        bucket.emplace(iter, persistentId, sceneSession);
+    }
+}
+
+template <typename Key>
+void SceneSessionRegistry::EraseFromIndex(std::unordered_map<Key, Bucket>& index, const Key& key,
+    int32_t persistentId)
+{
+    auto indexIter = index.find(key);
+    if (indexIter == index.end()) {
+        return;
+    }
+    Bucket& bucket = indexIter->second;
+    auto iter = std::lower_bound(bucket.begin(), bucket.end(), persistentId,
+        [](const SessionEntry& entry, int32_t id) { return entry.first < id; });
+    if (iter != bucket.end() && iter->first == persistentId) {
+        bucket.erase(iter);
+    }
+    if (bucket.empty()) {
+        index.erase(indexIter);
+    }
+}
+
+template <typename Key, typename Match>
+std::vector<sptr<SceneSession>> SceneSessionRegistry::CollectLocked(const std::unordered_map<Key, Bucket>& index,
+    const Key& key, Match&& match)
+{
+    std::vector<sptr<SceneSession>> result;
+    auto iter = index.find(key);
+    if (iter == index.end()) {
+        return result;
+    }
+    result.reserve(iter->second.size());
+    for (const auto& [_, sceneSession] : iter->second) {
+        if (match(sceneSession)) {
+            result.push_back(sceneSession);
+        }
+    }
+    return result;
+}
+} // namespace OHOS::Rosen
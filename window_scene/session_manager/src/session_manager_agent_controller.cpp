@@ -15,10 +15,59 @@
 
 #include "session_manager_agent_controller.h"
 
+#include <unordered_set>
+
 namespace OHOS {
 namespace Rosen {
 namespace {
 constexpr HiviewDFX::HiLogLabel LABEL = {LOG_CORE, HILOG_DOMAIN_WINDOW, "SessionManagerAgentController"};
+enum AgentNotifyCoalesceKey : uint32_t {
+    COALESCE_KEY_WINDOW_VISIBILITY = 1,
+    COALESCE_KEY_WINDOW_DRAWING_CONTENT,
+};
+
+/*
+ * Per window info list, a pending list is merged with a newer one by window id
+ * so a slow agent still ends up with the latest state of every window.
+ */
+template <typename Info>
+class WindowInfoListNotification : public ClientAgentNotification<IWindowManagerAgent> {
+public:
+    using Method = void (IWindowManagerAgent::*)(const std::vector<sptr<Info>>&);
+    WindowInfoListNotification(uint32_t coalesceKey, Method method, const std::vector<sptr<Info>>& infos)
+        : ClientAgentNotification<IWindowManagerAgent>(coalesceKey), method_(method), infos_(infos) {}
+
+    void Notify(const sptr<IWindowManagerAgent>& agent) override
+    {
+        (agent.GetRefPtr()->*method_)(infos_);
+    }
+
+    std::shared_ptr<ClientAgentNotification<IWindowManagerAgent>> CoalesceWith(
+        const ClientAgentNotification<IWindowManagerAgent>& newer) const override
+    {
+        /* same coalesce key implies the same notification type */
+        const auto& newerInfos = static_cast<const WindowInfoListNotification<Info>&>(newer).infos_;
+        std::unordered_set<uint32_t> newerWindowIds;
+        for (const auto& info : newerInfos) {
+            if (info != nullptr) {
+                newerWindowIds.insert(info->windowId_);
+            }
+        }
+        std::vector<sptr<Info>> merged;
+        merged.reserve(infos_.size() + newerInfos.size());
+        for (const auto& info : infos_) {
+            if (info != nullptr && newerWindowIds.count(info->windowId_) == 0) {
+                merged.push_back(info);
+            }
+        }
+        merged.insert(merged.end(), newerInfos.begin(), newerInfos.end());
+        return std::make_shared<WindowInfoListNotification<Info>>(GetCoalesceKey(), method_, merged);
+    }
+
+private:
+    Method method_;
+    std::vector<sptr<Info>> infos_;
+};
 }
 WM_IMPLEMENT_SINGLE_INSTANCE(SessionManagerAgentController)
 
@@ -60,6 +109,10 @@ WMError SessionManagerAgentController::UnregisterWindowManagerAgent(const sptr<I
     if (!smAgentContainer_.UnregisterAgent(windowManagerAgent, type)) {
         return WMError::WM_ERROR_NULLPTR;
     }
+    if (type == WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY ||
+        type == WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE) {
+        agentDispatcher_.RemoveAgent(windowManagerAgent);
+    }
     std::lock_guard<std::mutex> lock(windowManagerPidUserIdAgentMapMutex_);
     auto pidIter = windowManagerPidUserIdAgentMap_.find(pid);
     if (pidIter == windowManagerPidUserIdAgentMap_.end()) {
@@ -159,10 +212,10 @@ void SessionManagerAgentController::NotifyWaterMarkFlagChangedResult(bool hasWat
 void SessionManagerAgentController::UpdateWindowVisibilityInfo(
     const std::vector<sptr<WindowVisibilityInfo>>& windowVisibilityInfos)
 {
-    for (auto& agent : smAgentContainer_.GetAgentsByType(
-        WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY)) {
-        agent->UpdateWindowVisibilityInfo(windowVisibilityInfos);
-    }
+    agentDispatcher_.Dispatch(
+        smAgentContainer_.GetAgentsByType(WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY),
+        std::make_shared<WindowInfoListNotification<WindowVisibilityInfo>>(COALESCE_KEY_WINDOW_VISIBILITY,
+            &IWindowManagerAgent::UpdateWindowVisibilityInfo, windowVisibilityInfos));
 }
 
 void SessionManagerAgentController::UpdateVisibleWindowNum(
@@ -184,10 +237,10 @@ void SessionManagerAgentController::UpdateWindowDrawingContentInfo(
     const std::vector<sptr<WindowDrawingContentInfo>>& windowDrawingContentInfos)
 {
     WLOGFD("Size:%{public}zu", windowDrawingContentInfos.size());
-    for (auto& agent : smAgentContainer_.GetAgentsByType(
-        WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE)) {
-        agent->UpdateWindowDrawingContentInfo(windowDrawingContentInfos);
-    }
+    agentDispatcher_.Dispatch(
+        smAgentContainer_.GetAgentsByType(WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE),
+        std::make_shared<WindowInfoListNotification<WindowDrawingContentInfo>>(COALESCE_KEY_WINDOW_DRAWING_CONTENT,
+            &IWindowManagerAgent::UpdateWindowDrawingContentInfo, windowDrawingContentInfos));
 }
 
 void SessionManagerAgentController::UpdateCameraWindowStatus(uint32_t accessTokenId, bool isShowing)
@@ -202,8 +255,23 @@ void SessionManagerAgentController::UpdateCameraWindowStatus(uint32_t accessToke
     }
 }
 
+std::map<int32_t, ClientAgentDispatcher<IWindowManagerAgent>::AgentStats>
+    SessionManagerAgentController::GetAgentNotifyStats()
+{
+    std::map<int32_t, ClientAgentDispatcher<IWindowManagerAgent>::AgentStats> result;
+    for (const auto& [agent, stats] : agentDispatcher_.GetAgentStats()) {
+        auto& pidStats = result[smAgentContainer_.GetAgentPid(agent)];
+        pidStats.backlog += stats.backlog;
+        pidStats.delivered += stats.delivered;
+        pidStats.coalesced += stats.coalesced;
+        pidStats.dropped += stats.dropped;
+    }
+    return result;
+}
+
 void SessionManagerAgentController::DoAfterAgentDeath(const sptr<IRemoteObject>& remoteObject)
 {
+    agentDispatcher_.RemoveAgent(remoteObject);
     std::lock_guard<std::mutex> lock(windowManagerPidUserIdAgentMapMutex_);
     auto it = windowManagerAgentPairMap_.find(remoteObject);
     if (it == windowManagerAgentPairMap_.end()) {
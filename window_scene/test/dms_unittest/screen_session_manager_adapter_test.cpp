@@ -174,6 +174,38 @@ HWTEST_F(ScreenSessionManagerAdapterTest, IsAgentListenedAttributes_NotContainsA
     EXPECT_FALSE(result);
 }
 
+/**
+ * @tc.name: GetAgentsByAttributes
+ * @tc.desc: only agents subscribed to a changed attribute are visited
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenSessionManagerAdapterTest, GetAgentsByAttributes, TestSize.Level1)
+{
+    ScreenSessionManagerAdapter adapter;
+    auto& container = adapter.dmAttributeAgentContainer_;
+    sptr<IDisplayManagerAgent> rateAgent = sptr<DisplayManagerAgentDefault>::MakeSptr();
+    sptr<IDisplayManagerAgent> rotationAgent = sptr<DisplayManagerAgentDefault>::MakeSptr();
+    uintptr_t rateKey = reinterpret_cast<uintptr_t>(rateAgent.GetRefPtr());
+    uintptr_t rotationKey = reinterpret_cast<uintptr_t>(rotationAgent.GetRefPtr());
+    container.RegisterAttributeAgent(rateKey, rateAgent, { "refreshRate", "width" });
+    container.RegisterAttributeAgent(rotationKey, rotationAgent, { "rotation", "width" });
+
+    auto agents = container.GetAgentsByAttributes({ "refreshRate" });
+    ASSERT_EQ(agents.size(), 1);
+    EXPECT_EQ(*agents.begin(), rateAgent);
+    EXPECT_EQ(container.GetAgentsByAttributes({ "width", "rotation" }).size(), 2);
+    EXPECT_TRUE(container.GetAgentsByAttributes({ "height" }).empty());
+
+    container.UnRegisterAttribute(rateKey, rateAgent, { "refreshRate" });
+    EXPECT_TRUE(container.GetAgentsByAttributes({ "refreshRate" }).empty());
+    container.UnRegisterAllAttributeAgent(rotationKey, rotationAgent);
+    agents = container.GetAgentsByAttributes({ "width" });
+    ASSERT_EQ(agents.size(), 1);
+    EXPECT_EQ(*agents.begin(), rateAgent);
+    container.UnRegisterAllAttributeAgent(rateKey, rateAgent);
+    EXPECT_TRUE(container.attributeSubscriberMap_.empty());
+}
+
 /**
  * @tc.name: NotifyScreenModeChange_ScreenInfos_Empty
  * @tc.desc: NotifyScreenModeChange_ScreenInfos_Empty
@@ -134,6 +134,32 @@ HWTEST_F(ScreenSessionManagerTest, GetDisplayInfoById, TestSize.Level1)
     ASSERT_EQ(ssm_->GetDisplayInfoById(1), nullptr);
 }
 
+/**
+ * @tc.name: GetScreenSessionByDisplayId
+ * @tc.desc: GetScreenSessionByDisplayId uses the map key and the learned owner index
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenSessionManagerTest, GetScreenSessionByDisplayId, TestSize.Level1)
+{
+    ScreenId screenId = 1050;
+    ScreenId ownerId = 1051;
+    sptr<ScreenSession> screenSession = sptr<ScreenSession>::MakeSptr(screenId, ScreenProperty(), 0);
+    ssm_->screenSessionMap_[screenId] = screenSession;
+    EXPECT_EQ(ssm_->GetScreenSessionByDisplayId(screenId), screenSession);
+    EXPECT_EQ(ssm_->GetScreenSessionByDisplayId(ownerId), nullptr);
+
+    ssm_->screenSessionMap_.erase(screenId);
+    ssm_->screenSessionMap_[ownerId] = screenSession;
+    EXPECT_EQ(ssm_->GetScreenSessionByDisplayId(screenId), nullptr);
+    ssm_->UpdateDisplayOwnerIndex(screenId, ownerId);
+    EXPECT_EQ(ssm_->GetScreenSessionByDisplayId(screenId), screenSession);
+
+    ssm_->screenSessionMap_.erase(ownerId);
+    EXPECT_EQ(ssm_->GetScreenSessionByDisplayId(screenId), nullptr);
+    ssm_->UpdateDisplayOwnerIndex(screenId, SCREEN_ID_INVALID);
+    EXPECT_EQ(ssm_->displayOwnerIndex_.count(screenId), 0);
+}
+
 /**
  * @tc.name: GetDisplayInfoByScreen
  * @tc.desc: GetDisplayInfoByScreen virtual screen
@@ -1725,6 +1751,40 @@ HWTEST_F(ScreenSessionManagerTest, CreateVirtualScreenWithScreenId_Duplicate_Ret
     
     ssm_->DestroyVirtualScreen(screenId);
 }
+
+/**
+ * @tc.name: GetChangedListenableAttributeMask
+ * @tc.desc: refresh rate only changes produce a single bit and a single attribute name
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenSessionManagerTest, GetChangedListenableAttributeMask, TestSize.Level1)
+{
+    ASSERT_NE(ssm_, nullptr);
+    EXPECT_EQ(ssm_->GetChangedListenableAttributeMask(nullptr, nullptr), 0);
+    sptr<DisplayInfo> lastInfo = sptr<DisplayInfo>::MakeSptr();
+    sptr<DisplayInfo> info = sptr<DisplayInfo>::MakeSptr();
+    lastInfo->SetRefreshRate(60);
+    info->SetRefreshRate(120);
+    DisplayAttributeMask mask = ssm_->GetChangedListenableAttributeMask(lastInfo, info);
+    EXPECT_EQ(mask, DisplayAttributeToMask(DISPLAY_ATTRIBUTE_REFRESH_RATE));
+    EXPECT_EQ(DisplayAttributeMaskToNames(mask), std::vector<std::string>({ "refreshRate" }));
+
+    info->SetVirtualPixelRatio(lastInfo->GetVirtualPixelRatio() + 1.0f);
+    std::vector<std::string> attributes;
+    ssm_->GetChangedListenableAttribute(lastInfo, info, attributes);
+    EXPECT_EQ(attributes, std::vector<std::string>({ "refreshRate", "densityDPI", "densityPixels",
+        "scaledDensity" }));
+
+    /* refresh rate churn on a variable refresh panel stays a single bit diff */
+    for (uint32_t rate = 1; rate <= 1000; rate++) {
+        lastInfo->SetRefreshRate(rate);
+        info = sptr<DisplayInfo>::MakeSptr();
+        info->SetVirtualPixelRatio(lastInfo->GetVirtualPixelRatio());
+        info->SetRefreshRate(rate + 1);
+        ASSERT_EQ(ssm_->GetChangedListenableAttributeMask(lastInfo, info),
+            DisplayAttributeToMask(DISPLAY_ATTRIBUTE_REFRESH_RATE));
+    }
+}
 }
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -414,6 +414,80 @@ HWTEST_F(IntentionEventManagerTest, IsKeyboardEvent, TestSize.Level1)
     usleep(WAIT_SYNC_IN_NS);
 }
 
+/**
+ * @tc.name: GetPointerTargetSession
+ * @tc.desc: test the target session is cached until the scene session map changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntentionEventManagerTest, GetPointerTargetSession, TestSize.Level1)
+{
+    auto& ssm = SceneSessionManager::GetInstance();
+    EXPECT_EQ(nullptr, inputEventListener_->GetPointerTargetSession(5));
+    SessionInfo info;
+    info.bundleName_ = "IntentionEventManager";
+    info.moduleName_ = "GetPointerTargetSession";
+    sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    {
+        std::unique_lock<std::shared_mutex> lock(ssm.sceneSessionMapMutex_);
+        ssm.sceneSessionMap_.emplace(5, sceneSession);
+        ssm.MarkSceneSessionMapChangedLocked();
+    }
+    EXPECT_EQ(sceneSession, inputEventListener_->GetPointerTargetSession(5));
+    EXPECT_EQ(5, inputEventListener_->lastTargetWindowId_);
+    EXPECT_EQ(ssm.GetSceneSessionMapEpoch(), inputEventListener_->sessionSnapshot_->epoch);
+    EXPECT_EQ(sceneSession, inputEventListener_->GetPointerTargetSession(5));
+
+    {
+        std::unique_lock<std::shared_mutex> lock(ssm.sceneSessionMapMutex_);
+        ssm.sceneSessionMap_.erase(5);
+        ssm.MarkSceneSessionMapChangedLocked();
+    }
+    EXPECT_EQ(nullptr, inputEventListener_->GetPointerTargetSession(5));
+    EXPECT_EQ(nullptr, inputEventListener_->lastTargetSession_);
+}
+
+/**
+ * @tc.name: PointerLatencyHistogram
+ * @tc.desc: test pointer latency is bucketed per action and dumped
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntentionEventManagerTest, PointerLatencyHistogram, TestSize.Level1)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.GetPercentileUs(50));
+    EXPECT_EQ(0, LatencyHistogram::GetBucketIndex(0));
+    EXPECT_EQ(1, LatencyHistogram::GetBucketIndex(1));
+    EXPECT_EQ(7, LatencyHistogram::GetBucketIndex(100));
+    EXPECT_EQ(LatencyHistogram::BUCKET_COUNT - 1, LatencyHistogram::GetBucketIndex(UINT64_MAX));
+    for (uint64_t latencyUs : { 1, 3, 100, 120, 5000 }) {
+        histogram.Record(latencyUs);
+    }
+    EXPECT_EQ(5, histogram.GetCount());
+    EXPECT_EQ(2, histogram.GetBucketCount(7));
+    EXPECT_EQ(128, histogram.GetPercentileUs(50));
+    EXPECT_EQ(8192, histogram.GetPercentileUs(99));
+    EXPECT_EQ(5000, histogram.GetMaxUs());
+    histogram.Reset();
+    EXPECT_EQ(0, histogram.GetCount());
+
+    auto& ssm = SceneSessionManager::GetInstance();
+    std::string dumpInfo;
+    ssm.GetPointerLatencyDumpInfo({ "-l", "reset" }, dumpInfo);
+    ssm.RecordPointerLatency(MMI::PointerEvent::POINTER_ACTION_DOWN, PointerLatencyStage::TRANSFER, 100);
+    ssm.RecordPointerLatency(MMI::PointerEvent::POINTER_ACTION_DOWN, PointerLatencyStage::DONE, 300);
+    ssm.RecordPointerLatency(-1, PointerLatencyStage::DONE, 300);
+    ssm.RecordPointerLatency(MMI::PointerEvent::POINTER_ACTION_DOWN, PointerLatencyStage::COUNT, 300);
+    dumpInfo.clear();
+    ssm.GetPointerLatencyDumpInfo({ "-l", "reset" }, dumpInfo);
+    std::string downPrefix = std::to_string(MMI::PointerEvent::POINTER_ACTION_DOWN);
+    EXPECT_NE(std::string::npos, dumpInfo.find(downPrefix + " transfer: count:1"));
+    EXPECT_NE(std::string::npos, dumpInfo.find(downPrefix + " done: count:1"));
+    EXPECT_NE(std::string::npos, dumpInfo.find("other done: count:1"));
+    dumpInfo.clear();
+    ssm.GetPointerLatencyDumpInfo({ "-l" }, dumpInfo);
+    EXPECT_EQ(std::string::npos, dumpInfo.find("count:"));
+}
+
 /**
  * @tc.name: CreateAndEnableInputEventListener
  * @tc.desc: CreateAndEnableInputEventListener Test
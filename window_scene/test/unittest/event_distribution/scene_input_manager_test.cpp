@@ -1169,6 +1169,98 @@ HWTEST_F(SceneInputManagerTest, HandleEmptyDisplayGroup007, TestSize.Level1)
     EXPECT_EQ(SceneInputManager::GetInstance().rootSessionState_.load(), RootSessionState::NOT_CREATED);
     EXPECT_TRUE(SceneInputManager::GetInstance().hasDelayedTaskScheduled_.load());
 }
+/**
+ * @tc.name: ApplyIncrementalWindowInfo
+ * @tc.desc: only added, changed and removed window infos are flushed
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneInputManagerTest, ApplyIncrementalWindowInfo, TestSize.Level1)
+{
+    auto& sceneInputManager = SceneInputManager::GetInstance();
+    MMI::WindowInfo windowInfo1 = { .id = 1, .pid = 100 };
+    MMI::WindowInfo windowInfo2 = { .id = 2, .pid = 200 };
+    sceneInputManager.lastWindowInfoList_ = { windowInfo1, windowInfo2 };
+
+    windowInfo1.action = MMI::WINDOW_UPDATE_ACTION::CHANGE;
+    auto changedList = sceneInputManager.ApplyIncrementalWindowInfo({ windowInfo1 });
+    EXPECT_EQ(changedList.size(), 0);
+
+    windowInfo1.zOrder = 10.0f;
+    MMI::WindowInfo windowInfo3 = { .id = 3, .pid = 300 };
+    windowInfo3.action = MMI::WINDOW_UPDATE_ACTION::ADD;
+    MMI::WindowInfo removedInfo = { .id = 2 };
+    removedInfo.action = MMI::WINDOW_UPDATE_ACTION::DEL;
+    changedList = sceneInputManager.ApplyIncrementalWindowInfo({ windowInfo1, windowInfo3, removedInfo });
+    ASSERT_EQ(changedList.size(), 3);
+    EXPECT_EQ(changedList[0].action, MMI::WINDOW_UPDATE_ACTION::CHANGE);
+    EXPECT_EQ(changedList[1].action, MMI::WINDOW_UPDATE_ACTION::ADD);
+    EXPECT_EQ(changedList[2].action, MMI::WINDOW_UPDATE_ACTION::DEL);
+    ASSERT_EQ(sceneInputManager.lastWindowInfoList_.size(), 2);
+    EXPECT_EQ(sceneInputManager.lastWindowInfoList_[0].zOrder, 10.0f);
+    EXPECT_EQ(sceneInputManager.lastWindowInfoList_[1].id, 3);
+
+    // removals are always flushed, also for a window not known as flushed
+    removedInfo.id = 4;
+    changedList = sceneInputManager.ApplyIncrementalWindowInfo({ removedInfo });
+    ASSERT_EQ(changedList.size(), 1);
+    EXPECT_EQ(changedList[0].id, 4);
+    sceneInputManager.lastWindowInfoList_.clear();
+}
+
+/**
+ * @tc.name: FilterWindowInfoListKeepRemoval
+ * @tc.desc: removals of windows on a display which is not active any more are not filtered
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneInputManagerTest, FilterWindowInfoListKeepRemoval, TestSize.Level1)
+{
+    std::map<ScreenId, ScreenProperty> screensProperties = { { 0, ScreenProperty() } };
+    MMI::WindowInfo windowInfo1 = { .id = 1 };
+    windowInfo1.displayId = 0;
+    MMI::WindowInfo windowInfo2 = { .id = 2 };
+    windowInfo2.displayId = 1;
+    MMI::WindowInfo removedInfo = { .id = 3 };
+    removedInfo.displayId = 1;
+    removedInfo.action = MMI::WINDOW_UPDATE_ACTION::DEL;
+    std::vector<MMI::WindowInfo> windowInfoList = { windowInfo1, windowInfo2, removedInfo };
+    SceneInputManager::GetInstance().FilterWindowInfoList(screensProperties, windowInfoList);
+    ASSERT_EQ(windowInfoList.size(), 2);
+    EXPECT_EQ(windowInfoList[0].id, 1);
+    EXPECT_EQ(windowInfoList[1].id, 3);
+}
+
+/**
+ * @tc.name: PendingIncrementalInfo
+ * @tc.desc: window infos not flushed are merged into the next incremental flush
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneInputManagerTest, PendingIncrementalInfo, TestSize.Level1)
+{
+    auto& sceneInputManager = SceneInputManager::GetInstance();
+    auto pixelMap = std::make_shared<Media::PixelMap>();
+    MMI::WindowInfo windowInfo1 = { .id = 1, .pid = 100 };
+    windowInfo1.pixelMap = pixelMap.get();
+    MMI::WindowInfo windowInfo2 = { .id = 2, .pid = 200 };
+    sceneInputManager.KeepPendingIncrementalInfo({ windowInfo1, windowInfo2 },
+        { pixelMap, std::make_shared<Media::PixelMap>(), nullptr });
+    ASSERT_EQ(sceneInputManager.pendingWindowInfoList_.size(), 2);
+    ASSERT_EQ(sceneInputManager.pendingPixelMapList_.size(), 1);
+    EXPECT_EQ(sceneInputManager.pendingPixelMapList_[0], pixelMap);
+
+    windowInfo2.pid = 201;
+    MMI::WindowInfo windowInfo3 = { .id = 3, .pid = 300 };
+    std::vector<MMI::WindowInfo> windowInfoList = { windowInfo2, windowInfo3 };
+    std::vector<std::shared_ptr<Media::PixelMap>> pixelMapList;
+    sceneInputManager.MergePendingIncrementalInfo(windowInfoList, pixelMapList);
+    ASSERT_EQ(windowInfoList.size(), 3);
+    EXPECT_EQ(windowInfoList[0].id, 1);
+    EXPECT_EQ(windowInfoList[1].pid, 201);
+    EXPECT_EQ(windowInfoList[2].id, 3);
+    ASSERT_EQ(pixelMapList.size(), 1);
+    EXPECT_EQ(pixelMapList[0], pixelMap);
+    EXPECT_TRUE(sceneInputManager.pendingWindowInfoList_.empty());
+    EXPECT_TRUE(sceneInputManager.pendingPixelMapList_.empty());
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -138,6 +138,7 @@ HWTEST_F(SceneSessionDirtyManagerTest, GetFullWindowInfoList, TestSize.Level0)
         propertyModal1->SetWindowFlags(static_cast<uint32_t>(WindowFlag::WINDOW_FLAG_IS_MODAL));
         ssm_->sceneSessionMap_.insert({ sceneSessionModal1->GetPersistentId(), sceneSessionModal1 });
     }
+    ssm_->MarkSceneSessionMapChangedLocked();
     auto fullInfoForMMI1 = manager_->GetFullWindowInfoList();
     auto windowInfoList1 = fullInfoForMMI1.windowInfoList;
     auto pixelMapList1 = fullInfoForMMI1.pixelMapList;
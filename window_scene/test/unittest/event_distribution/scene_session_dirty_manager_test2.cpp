@@ -592,6 +592,7 @@ HWTEST_F(SceneSessionDirtyManagerTest2, GetWindowInfoWithWindowTypeDialog, TestS
     retSceneSessionMap.insert(std::make_pair(mainWindowPid, sceneSessionMainWindow));
     retSceneSessionMap.insert(std::make_pair(dialogWindowPid, sceneSessionDialogWindow));
     ssm_->sceneSessionMap_ = retSceneSessionMap;
+    ssm_->MarkSceneSessionMapChangedLocked();
     auto fullInfoForMMI = manager_->GetFullWindowInfoList();
     auto windowInfoList = fullInfoForMMI.windowInfoList;
     auto pixelMapList = fullInfoForMMI.pixelMapList;
@@ -644,6 +645,7 @@ HWTEST_F(SceneSessionDirtyManagerTest2, GetWindowInfoWithWindowTypeAppSub, TestS
     retSceneSessionMap.insert(std::make_pair(mainWindowPid, sceneSessionMainWindow));
     retSceneSessionMap.insert(std::make_pair(subWindowPid, sceneSessionSubWindow));
     ssm_->sceneSessionMap_ = retSceneSessionMap;
+    ssm_->MarkSceneSessionMapChangedLocked();
     auto fullInfoForMMI = manager_->GetFullWindowInfoList();
     auto windowInfoList = fullInfoForMMI.windowInfoList;
     auto pixelMapList = fullInfoForMMI.pixelMapList;
@@ -931,6 +933,88 @@ HWTEST_F(SceneSessionDirtyManagerTest2, UpdateWindowFlagsForWindowSeparation, Te
     manager_->UpdateWindowFlagsForWindowSeparation(session, windowInfo);
     EXPECT_NE(windowInfo.flags, 0);
 }
+
+/**
+ * @tc.name: GetIncrementalWindowInfoList
+ * @tc.desc: only dirty sessions are recomputed after a full window info list
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionDirtyManagerTest2, GetIncrementalWindowInfoList, TestSize.Level1)
+{
+    IncrementalInfoForMMI incrementalInfo;
+    manager_->needFullUpdate_ = true;
+    EXPECT_EQ(manager_->GetIncrementalWindowInfoList(incrementalInfo), false);
+
+    constexpr int32_t sessionNum = 60;
+    constexpr int32_t baseWindowId = 1000;
+    std::map<int32_t, sptr<SceneSession>> sceneSessionMap;
+    for (int32_t index = 0; index < sessionNum; index++) {
+        SessionInfo info;
+        info.abilityName_ = "GetIncrementalWindowInfoList";
+        info.bundleName_ = "GetIncrementalWindowInfoList";
+        sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+        sceneSession->persistentId_ = baseWindowId + index;
+        sceneSession->isVisible_ = true;
+        sceneSession->GetSessionProperty()->SetWindowType(WindowType::WINDOW_TYPE_APP_MAIN_WINDOW);
+        sceneSessionMap.insert({ sceneSession->GetPersistentId(), sceneSession });
+    }
+    ssm_->sceneSessionMap_ = sceneSessionMap;
+    ssm_->MarkSceneSessionMapChangedLocked();
+    auto fullInfoForMMI = manager_->GetFullWindowInfoList();
+    ASSERT_EQ(fullInfoForMMI.windowInfoList.size(), sessionNum);
+
+    EXPECT_EQ(manager_->GetIncrementalWindowInfoList(incrementalInfo), true);
+    EXPECT_EQ(incrementalInfo.windowInfoList.size(), 0);
+
+    manager_->MarkSessionDirty(baseWindowId, WindowUpdateType::WINDOW_UPDATE_BOUNDS);
+    manager_->MarkSessionDirty(baseWindowId + 1, WindowUpdateType::WINDOW_UPDATE_PROPERTY);
+    EXPECT_EQ(manager_->GetIncrementalWindowInfoList(incrementalInfo), true);
+    ASSERT_EQ(incrementalInfo.windowInfoList.size(), 2);
+    for (const auto& windowInfo : incrementalInfo.windowInfoList) {
+        EXPECT_EQ(windowInfo.action, MMI::WINDOW_UPDATE_ACTION::CHANGE);
+    }
+
+    IncrementalInfoForMMI removedInfo;
+    ssm_->sceneSessionMap_.erase(baseWindowId + 2);
+    manager_->MarkSessionDirty(baseWindowId + 2, WindowUpdateType::WINDOW_UPDATE_REMOVED);
+    EXPECT_EQ(manager_->GetIncrementalWindowInfoList(removedInfo), true);
+    ASSERT_EQ(removedInfo.windowInfoList.size(), 1);
+    EXPECT_EQ(removedInfo.windowInfoList[0].id, baseWindowId + 2);
+    EXPECT_EQ(removedInfo.windowInfoList[0].action, MMI::WINDOW_UPDATE_ACTION::DEL);
+
+    manager_->MarkSessionDirty(baseWindowId, WindowUpdateType::WINDOW_UPDATE_FOCUSED);
+    EXPECT_EQ(manager_->GetIncrementalWindowInfoList(incrementalInfo), false);
+    ssm_->sceneSessionMap_.clear();
+}
+
+/**
+ * @tc.name: GetIncrementalWindowInfoListWithDialog
+ * @tc.desc: dialog session requires full window info list
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionDirtyManagerTest2, GetIncrementalWindowInfoListWithDialog, TestSize.Level1)
+{
+    SessionInfo info;
+    info.abilityName_ = "GetIncrementalWindowInfoListWithDialog";
+    info.bundleName_ = "GetIncrementalWindowInfoListWithDialog";
+    sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    sceneSession->persistentId_ = 2000;
+    sceneSession->isVisible_ = true;
+    sceneSession->GetSessionProperty()->SetWindowType(WindowType::WINDOW_TYPE_APP_MAIN_WINDOW);
+    ssm_->sceneSessionMap_ = { { sceneSession->GetPersistentId(), sceneSession } };
+    ssm_->MarkSceneSessionMapChangedLocked();
+    manager_->GetFullWindowInfoList();
+
+    sptr<SceneSession> dialogSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    dialogSession->persistentId_ = 2001;
+    dialogSession->isVisible_ = true;
+    dialogSession->GetSessionProperty()->SetWindowType(WindowType::WINDOW_TYPE_DIALOG);
+    ssm_->sceneSessionMap_.insert({ dialogSession->GetPersistentId(), dialogSession });
+    manager_->MarkSessionDirty(dialogSession->GetPersistentId(), WindowUpdateType::WINDOW_UPDATE_ADDED);
+    IncrementalInfoForMMI incrementalInfo;
+    EXPECT_EQ(manager_->GetIncrementalWindowInfoList(incrementalInfo), false);
+    ssm_->sceneSessionMap_.clear();
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
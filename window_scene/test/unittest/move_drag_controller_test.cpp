@@ -2455,6 +2455,43 @@ HWTEST_F(MoveDragControllerTest, TestResampleTargetRectAtFiltersStaleSampleTime,
     EXPECT_EQ(moveDragController->moveDragProperty_.lastResampledTimeUs_, -1);
 }
 
+/**
+ * @tc.name: TestResampleTargetRectAtWithPrediction
+ * @tc.desc: Verify the target rect leads the resampled position by the predicted offset when prediction is enabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveDragControllerTest, TestResampleTargetRectAtWithPrediction, TestSize.Level1)
+{
+    auto& prop = moveDragController->moveDragProperty_;
+    moveDragController->isStartMove_ = true;
+    prop.isMoveResampleActive_ = true;
+    prop.isResampleFpsRangeChecked_ = true;
+    prop.originalRect_ = { 100, 200, 300, 400 };
+    moveDragController->moveResampler_.Reset();
+    moveDragController->moveResampler_.startupInitialized_ = true;
+    moveDragController->moveResampler_.startupPhase_ = false;
+    for (int32_t i = 0; i <= 8; i++) {
+        moveDragController->moveResampler_.PushEvent(1000 + i * 1000, i * 10, 0);
+    }
+
+    moveDragController->moveResampleConfig_.predictionEnable = false;
+    moveDragController->ResampleTargetRectAt(9000, 13000);
+    auto sample = moveDragController->moveResampler_.GetLastResampledEvent();
+    ASSERT_TRUE(sample.has_value());
+    EXPECT_EQ(prop.targetRect_.posX_, prop.originalRect_.posX_ + sample->posX);
+
+    moveDragController->moveResampleConfig_.predictionEnable = true;
+    moveDragController->moveResampleConfig_.maxPredictionMs = 4;
+    moveDragController->ResampleTargetRectAt(9500, 30000);
+    sample = moveDragController->moveResampler_.GetLastResampledEvent();
+    ASSERT_TRUE(sample.has_value());
+    EXPECT_EQ(prop.targetRect_.posX_, prop.originalRect_.posX_ + sample->posX + 40);
+
+    moveDragController->ResampleTargetRectAt(9600);
+    sample = moveDragController->moveResampler_.GetLastResampledEvent();
+    EXPECT_EQ(prop.targetRect_.posX_, prop.originalRect_.posX_ + sample->posX);
+}
+
 /**
  * @tc.name: TestGetSecondaryPhaseResamplingDelayMs
  * @tc.desc: Verify secondary phase delay is controlled by the resample policy and lead time
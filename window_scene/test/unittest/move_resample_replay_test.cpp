@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "move_resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+/**
+ * @brief One recorded pointer sample.
+ */
+struct MoveTraceEvent {
+    int64_t timeUs = 0;
+    int32_t pointerId = 0;
+    int32_t posX = 0;
+    int32_t posY = 0;
+};
+
+struct MoveReplayConfig {
+    int64_t vsyncPeriodUs = 8333; // 120Hz
+    /**
+     * @brief Time from sampling on a vsync until the frame is presented.
+     */
+    int64_t presentLatencyUs = 8333;
+    bool predictionEnable = false;
+    int64_t maxPredictionUs = DEFAULT_MAX_PREDICTION_US;
+};
+
+/**
+ * @brief Perceived quality of one pointer over a replay.
+ *
+ * lag is the distance between the presented position and the real pointer
+ * position at present time, jitter is the RMS of the per-frame step error
+ * between presented and real motion.
+ */
+struct MoveReplayReport {
+    uint32_t frameCount = 0;
+    double meanLagPx = 0.0;
+    double maxLagPx = 0.0;
+    double jitterPx = 0.0;
+
+    std::string ToString() const
+    {
+        std::ostringstream oss;
+        oss << "frames: " << frameCount << ", meanLagPx: " << meanLagPx << ", maxLagPx: " << maxLagPx
+            << ", jitterPx: " << jitterPx;
+        return oss.str();
+    }
+};
+
+/**
+ * @brief Replays recorded pointer traces through MultiPointerMoveResampler on a simulated
+ *        vsync clock so the resampling parameters can be tuned offline.
+ */
+class MoveResampleReplay {
+public:
+    /**
+     * @brief Parses a trace with one "timeUs pointerId posX posY" sample per line,
+     *        blank lines and lines starting with '#' are skipped.
+     */
+    static std::vector<MoveTraceEvent> ParseTrace(std::istream& input)
+    {
+        std::vector<MoveTraceEvent> trace;
+        std::string line;
+        while (std::getline(input, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream iss(line);
+            MoveTraceEvent event;
+            if (iss >> event.timeUs >> event.pointerId >> event.posX >> event.posY) {
+                trace.push_back(event);
+            }
+        }
+        std::stable_sort(trace.begin(), trace.end(),
+            [](const MoveTraceEvent& lhs, const MoveTraceEvent& rhs) { return lhs.timeUs < rhs.timeUs; });
+        return trace;
+    }
+
+    static std::map<int32_t, MoveReplayReport> Replay(const std::vector<MoveTraceEvent>& trace,
+        const MoveReplayConfig& config, const MoveResampler& prototype = MoveResampler())
+    {
+        std::map<int32_t, MoveReplayReport> reports;
+        if (trace.empty() || config.vsyncPeriodUs <= 0) {
+            return reports;
+        }
+        std::map<int32_t, std::vector<MoveTraceEvent>> tracks;
+        for (const auto& event : trace) {
+            tracks[event.pointerId].push_back(event);
+        }
+
+        struct PointerState {
+            bool hasPrev = false;
+            double prevShownX = 0.0;
+            double prevShownY = 0.0;
+            double prevRealX = 0.0;
+            double prevRealY = 0.0;
+            double lagSum = 0.0;
+            double jitterSquareSum = 0.0;
+            uint32_t stepCount = 0;
+        };
+        std::map<int32_t, PointerState> states;
+        MultiPointerMoveResampler resampler(prototype);
+        size_t next = 0;
+        for (int64_t vsyncUs = trace.front().timeUs; vsyncUs <= trace.back().timeUs;
+             vsyncUs += config.vsyncPeriodUs) {
+            // Like a drag, every pointer is resampled as an offset from its first sample.
+            for (; next < trace.size() && trace[next].timeUs <= vsyncUs; next++) {
+                const auto& event = trace[next];
+                const auto& origin = tracks[event.pointerId].front();
+                resampler.PushEvent(event.pointerId, event.timeUs,
+                    event.posX - origin.posX, event.posY - origin.posY);
+            }
+            const int64_t presentUs = vsyncUs + config.presentLatencyUs;
+            for (int32_t pointerId : resampler.GetPointerIds()) {
+                auto real = InterpolateTrack(tracks[pointerId], presentUs);
+                if (!real) {
+                    continue;
+                }
+                auto shown = config.predictionEnable ?
+                    resampler.PredictAt(pointerId, vsyncUs, presentUs, config.maxPredictionUs) :
+                    resampler.ResampleAt(pointerId, vsyncUs);
+                const auto& origin = tracks[pointerId].front();
+                shown->posX += origin.posX;
+                shown->posY += origin.posY;
+                RecordFrame(reports[pointerId], states[pointerId], *shown, *real);
+            }
+        }
+        for (auto& [pointerId, report] : reports) {
+            const auto& state = states[pointerId];
+            report.meanLagPx = state.lagSum / report.frameCount;
+            report.jitterPx = state.stepCount == 0 ? 0.0 : std::sqrt(state.jitterSquareSum / state.stepCount);
+        }
+        return reports;
+    }
+
+private:
+    /* real position of a pointer, std::nullopt outside of its recorded range */
+    static std::optional<std::pair<double, double>> InterpolateTrack(
+        const std::vector<MoveTraceEvent>& track, int64_t timeUs)
+    {
+        if (track.empty() || timeUs < track.front().timeUs || timeUs > track.back().timeUs) {
+            return std::nullopt;
+        }
+        auto iter = std::lower_bound(track.begin(), track.end(), timeUs,
+            [](const MoveTraceEvent& event, int64_t time) { return event.timeUs < time; });
+        if (iter == track.begin() || iter->timeUs == timeUs) {
+            return std::make_pair(static_cast<double>(iter->posX), static_cast<double>(iter->posY));
+        }
+        const auto& prev = *(iter - 1);
+        double ratio = static_cast<double>(timeUs - prev.timeUs) / (iter->timeUs - prev.timeUs);
+        return std::make_pair(prev.posX + ratio * (iter->posX - prev.posX),
+                              prev.posY + ratio * (iter->posY - prev.posY));
+    }
+
+    template <typename T>
+    static void RecordFrame(MoveReplayReport& report, T& state, const MoveEvent& shown,
+        const std::pair<double, double>& real)
+    {
+        const auto [realX, realY] = real;
+        double lag = std::hypot(shown.posX - realX, shown.posY - realY);
+        report.frameCount++;
+        report.maxLagPx = std::max(report.maxLagPx, lag);
+        state.lagSum += lag;
+        if (state.hasPrev) {
+            double errorX = (shown.posX - state.prevShownX) - (realX - state.prevRealX);
+            double errorY = (shown.posY - state.prevShownY) - (realY - state.prevRealY);
+            state.jitterSquareSum += errorX * errorX + errorY * errorY;
+            state.stepCount++;
+        }
+        state.hasPrev = true;
+        state.prevShownX = shown.posX;
+        state.prevShownY = shown.posY;
+        state.prevRealX = realX;
+        state.prevRealY = realY;
+    }
+};
+
+/* a pointer moving at speedPxPerMs on X, sampled every intervalUs for durationUs */
+std::vector<MoveTraceEvent> MakeLinearTrace(int32_t pointerId, int32_t startX, double speedPxPerMs,
+    int64_t intervalUs, int64_t durationUs)
+{
+    std::vector<MoveTraceEvent> trace;
+    constexpr double US_PER_MS = 1000.0;
+    for (int64_t timeUs = 0; timeUs <= durationUs; timeUs += intervalUs) {
+        trace.push_back({ timeUs, pointerId, startX + static_cast<int32_t>(speedPxPerMs * timeUs / US_PER_MS), 0 });
+    }
+    return trace;
+}
+} // namespace
+
+class MoveResampleReplayTest : public testing::Test {
+public:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: TestParseTrace
+ * @tc.desc: Verify traces are parsed, comments and malformed lines skipped, and samples ordered by time
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResampleReplayTest, TestParseTrace, TestSize.Level1)
+{
+    std::istringstream input("# timeUs pointerId x y\n2000 0 20 5\n\n1000 0 10 5\nbad line\n1500 1 7 8\n");
+    auto trace = MoveResampleReplay::ParseTrace(input);
+    ASSERT_EQ(trace.size(), 3);
+    EXPECT_EQ(trace[0].timeUs, 1000);
+    EXPECT_EQ(trace[1].pointerId, 1);
+    EXPECT_EQ(trace[1].posY, 8);
+    EXPECT_EQ(trace[2].posX, 20);
+}
+
+/**
+ * @tc.name: TestReplayPredictionReducesLag
+ * @tc.desc: Verify prediction reduces the perceived lag of a constant speed drag
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResampleReplayTest, TestReplayPredictionReducesLag, TestSize.Level1)
+{
+    // 2px/ms sampled at 240Hz for 500ms
+    auto trace = MakeLinearTrace(0, 0, 2.0, 4166, 500'000);
+    MoveReplayConfig config;
+    auto resampled = MoveResampleReplay::Replay(trace, config);
+    config.predictionEnable = true;
+    auto predicted = MoveResampleReplay::Replay(trace, config);
+    ASSERT_EQ(resampled.size(), 1);
+    ASSERT_EQ(predicted.size(), 1);
+    EXPECT_GT(resampled[0].frameCount, 50);
+    EXPECT_EQ(resampled[0].frameCount, predicted[0].frameCount);
+    EXPECT_LT(predicted[0].meanLagPx, resampled[0].meanLagPx);
+    EXPECT_GT(resampled[0].meanLagPx, 0.0);
+}
+
+/**
+ * @tc.name: TestReplayMultiPointer
+ * @tc.desc: Verify every pointer of a trace gets its own report
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResampleReplayTest, TestReplayMultiPointer, TestSize.Level1)
+{
+    auto trace = MakeLinearTrace(0, 0, 1.0, 8000, 200'000);
+    auto still = MakeLinearTrace(3, 500, 0.0, 8000, 200'000);
+    trace.insert(trace.end(), still.begin(), still.end());
+    std::stable_sort(trace.begin(), trace.end(),
+        [](const MoveTraceEvent& lhs, const MoveTraceEvent& rhs) { return lhs.timeUs < rhs.timeUs; });
+
+    MoveReplayConfig config;
+    config.predictionEnable = true;
+    auto reports = MoveResampleReplay::Replay(trace, config);
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_GT(reports[0].meanLagPx, reports[3].meanLagPx);
+    EXPECT_GT(reports[3].frameCount, 0);
+    EXPECT_TRUE(MoveResampleReplay::Replay({}, config).empty());
+}
+
+/**
+ * @tc.name: TestReplayRecordedTrace
+ * @tc.desc: Replay the trace file named by MOVE_RESAMPLE_TRACE and print the lag and jitter reports
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResampleReplayTest, TestReplayRecordedTrace, TestSize.Level1)
+{
+    const char* tracePath = std::getenv("MOVE_RESAMPLE_TRACE");
+    if (tracePath == nullptr) {
+        GTEST_SKIP();
+    }
+    std::ifstream input(tracePath);
+    ASSERT_TRUE(input.is_open());
+    auto trace = MoveResampleReplay::ParseTrace(input);
+    MoveReplayConfig config;
+    for (bool predictionEnable : { false, true }) {
+        config.predictionEnable = predictionEnable;
+        for (const auto& [pointerId, report] : MoveResampleReplay::Replay(trace, config)) {
+            std::cout << "prediction: " << predictionEnable << ", pointer: " << pointerId << ", "
+                      << report.ToString() << std::endl;
+        }
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -419,5 +419,113 @@ HWTEST_F(MoveResamplerTest, TestMoveResamplerTriggersOneEuroFilter, TestSize.Lev
     EXPECT_NE(e1.posX, e2.posX);
     EXPECT_NE(e1.posY, e2.posY);
 }
+
+/**
+ * @tc.name: TestMoveResamplerEstimateVelocity
+ * @tc.desc: Verify velocity is fitted over the latest events
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResamplerTest, TestMoveResamplerEstimateVelocity, TestSize.Level1)
+{
+    EXPECT_FALSE(moveResampler_.EstimateVelocity().has_value());
+    moveResampler_.PushEvent(1000, 0, 0);
+    EXPECT_FALSE(moveResampler_.EstimateVelocity().has_value());
+
+    // 1px/ms on X, -2px/ms on Y
+    for (int32_t i = 1; i <= 5; i++) {
+        moveResampler_.PushEvent(1000 + i * 1000, i, -2 * i);
+    }
+    auto velocity = moveResampler_.EstimateVelocity();
+    ASSERT_TRUE(velocity.has_value());
+    EXPECT_NEAR(velocity->first, 0.001, 1e-9);
+    EXPECT_NEAR(velocity->second, -0.002, 1e-9);
+}
+
+/**
+ * @tc.name: TestMoveResamplerPredictAt
+ * @tc.desc: Verify prediction leads the resampled position by velocity and clamps the lead
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResamplerTest, TestMoveResamplerPredictAt, TestSize.Level1)
+{
+    MoveResampler reference;
+    reference.startupInitialized_ = true;
+    reference.startupPhase_ = false;
+    // 1px/100us on X
+    for (int32_t i = 0; i <= 8; i++) {
+        moveResampler_.PushEvent(1000 + i * 1000, i * 10, 0);
+        reference.PushEvent(1000 + i * 1000, i * 10, 0);
+    }
+
+    MoveEvent resampled = reference.ResampleAt(9000);
+    MoveEvent predicted = moveResampler_.PredictAt(9000, 13000);
+    EXPECT_EQ(predicted.timeUs, 13000);
+    EXPECT_EQ(predicted.posX, resampled.posX + 40);
+    EXPECT_EQ(predicted.posY, resampled.posY);
+    // the unpredicted position is kept for the end of the move
+    EXPECT_EQ(moveResampler_.GetLastResampledEvent()->posX, resampled.posX);
+
+    resampled = reference.ResampleAt(9500);
+    predicted = moveResampler_.PredictAt(9500, 30000, 2000);
+    EXPECT_EQ(predicted.timeUs, 11500);
+    EXPECT_EQ(predicted.posX, resampled.posX + 20);
+
+    resampled = reference.ResampleAt(9600);
+    predicted = moveResampler_.PredictAt(9600, 9000);
+    EXPECT_EQ(predicted.posX, resampled.posX);
+
+    // stale events are not predicted
+    resampled = reference.ResampleAt(40000);
+    predicted = moveResampler_.PredictAt(40000, 48000);
+    EXPECT_EQ(predicted.posX, resampled.posX);
+}
+
+/**
+ * @tc.name: TestMoveResamplerPredictAtStartup
+ * @tc.desc: Verify the prediction lead ramps in during the startup phase
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResamplerTest, TestMoveResamplerPredictAtStartup, TestSize.Level1)
+{
+    MoveResampler resampler(DEFAULT_MAX_EVENT_INTERVAL_US, STARTUP_DURATION_US);
+    resampler.PushEvent(0, 0, 0);
+    resampler.PushEvent(1000, 0, 0);
+    MoveEvent predicted = resampler.PredictAt(1000, 9000);
+    EXPECT_EQ(predicted.timeUs, 1000 + 8000 * 1000 / STARTUP_DURATION_US);
+}
+
+/**
+ * @tc.name: TestMultiPointerMoveResampler
+ * @tc.desc: Verify pointers are resampled on independent tracks
+ * @tc.type: FUNC
+ */
+HWTEST_F(MoveResamplerTest, TestMultiPointerMoveResampler, TestSize.Level1)
+{
+    MultiPointerMoveResampler resampler(moveResampler_);
+    EXPECT_FALSE(resampler.ResampleAt(0, 1000).has_value());
+    EXPECT_FALSE(resampler.PredictAt(0, 1000, 2000).has_value());
+
+    resampler.PushEvent(0, 1000, 0, 0);
+    resampler.PushEvent(1, 1000, 500, 500);
+    resampler.PushEvent(0, 2000, 100, 0);
+    resampler.PushEvent(1, 2000, 500, 600);
+    EXPECT_EQ(resampler.GetPointerIds(), std::vector<int32_t>({ 0, 1 }));
+
+    auto first = resampler.ResampleAt(0, 1000);
+    auto second = resampler.ResampleAt(1, 1000);
+    ASSERT_TRUE(first.has_value() && second.has_value());
+    EXPECT_EQ(first->posX, 0);
+    EXPECT_EQ(second->posX, 500);
+    EXPECT_EQ(second->posY, 500);
+
+    auto predicted = resampler.PredictAt(1, 2000, 3000);
+    ASSERT_TRUE(predicted.has_value());
+    EXPECT_EQ(predicted->posX, 500);
+
+    resampler.RemovePointer(0);
+    EXPECT_EQ(resampler.GetPointerIds(), std::vector<int32_t>({ 1 }));
+    resampler.Reset();
+    EXPECT_TRUE(resampler.GetPointerIds().empty());
+}
 } // namespace Rosen
 } // namespace OHOS
@@ -269,6 +269,7 @@ HWTEST_F(RootSceneSessionTest, GetSystemAvoidAreaForRoot_01, TestSize.Level1)
     statusBarSession->GetLayoutController()->SetSessionRect({ 0, 0, 1260, 123 });
     statusBarSession->isVisible_ = true;
     ssm_->sceneSessionMap_.insert({ statusBarSession->GetPersistentId(), statusBarSession });
+    ssm_->sceneSessionRegistry_.Add(statusBarSession);
     AvoidArea avoidArea;
     ssm_->rootSceneSession_->GetSystemAvoidAreaForRoot(ssm_->rootSceneSession_->GetSessionRect(), avoidArea);
     Rect rect = { 0, 0, 1260, 123 };
@@ -308,6 +309,7 @@ HWTEST_F(RootSceneSessionTest, GetKeyboardAvoidAreaForRoot_01, TestSize.Level1)
     keyboardSession->GetLayoutController()->SetSessionRect({ 0, 1700, 1260, 1020 });
     keyboardSession->property_->SetPersistentId(2);
     ssm_->sceneSessionMap_.insert({ keyboardSession->GetPersistentId(), keyboardSession });
+    ssm_->sceneSessionRegistry_.Add(keyboardSession);
     AvoidArea avoidArea;
     ssm_->rootSceneSession_->GetKeyboardAvoidAreaForRoot(ssm_->rootSceneSession_->GetSessionRect(), avoidArea);
     Rect rect = { 0, 1700, 1260, 1020 };
@@ -431,6 +433,7 @@ HWTEST_F(RootSceneSessionTest, GetStatusBarHeight, TestSize.Level1)
     statusBarSession->GetLayoutController()->SetSessionRect({ 0, 0, 1260, 123 });
     statusBarSession->isVisible_ = true;
     ssm_->sceneSessionMap_.insert({ statusBarSession->GetPersistentId(), statusBarSession });
+    ssm_->sceneSessionRegistry_.Add(statusBarSession);
     height = ssm_->rootSceneSession_->GetStatusBarHeight();
     EXPECT_EQ(123, height);
     ssm_->rootSceneSession_->onGetStatusBarAvoidHeightFunc_ = [](DisplayId displayId, WSRect& barArea)
@@ -15,9 +15,12 @@
 
 #include <image_type.h>
 #include "scene_persistence.h"
+#include "session/host/include/snapshot_pixel_map_cache.h"
 #include "session/host/include/scene_session.h"
 #include "session.h"
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 #include "session_info.h"
 #include "ws_common.h"
 
@@ -145,6 +148,134 @@ HWTEST_F(ScenePersistenceTest, SaveAbilityIcon, TestSize.Level1)
     scenePersistenceTmp->SaveAbilityIcon(pixelMap3);
     EXPECT_EQ(pixelMap3->GetWidth(), 1);
 }
+
+/**
+ * @tc.name: RecordSnapshotLatency
+ * @tc.desc: test latency is recorded into log2 millisecond buckets
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScenePersistenceTest, RecordSnapshotLatency, TestSize.Level1)
+{
+    std::array<std::atomic<uint64_t>, SNAPSHOT_LATENCY_BUCKET_COUNT> histogram {};
+    ScenePersistence::RecordSnapshotLatency(histogram, 0);
+    ScenePersistence::RecordSnapshotLatency(histogram, 1);
+    ScenePersistence::RecordSnapshotLatency(histogram, 3);
+    ScenePersistence::RecordSnapshotLatency(histogram, 4);
+    ScenePersistence::RecordSnapshotLatency(histogram, 100000);
+    EXPECT_EQ(histogram[0].load(), 1);
+    EXPECT_EQ(histogram[1].load(), 1);
+    EXPECT_EQ(histogram[2].load(), 1);
+    EXPECT_EQ(histogram[3].load(), 1);
+    EXPECT_EQ(histogram[SNAPSHOT_LATENCY_BUCKET_COUNT - 1].load(), 1);
+}
+
+/**
+ * @tc.name: GetSnapshotPersistStats
+ * @tc.desc: test back-to-back saves of the same snapshot are deduplicated and the queue drains
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScenePersistenceTest, GetSnapshotPersistStats, TestSize.Level1)
+{
+    sptr<ScenePersistence> scenePersistenceTmp = sptr<ScenePersistence>::MakeSptr("testBundleName", 1424);
+    std::shared_ptr<Media::PixelMap> pixelMap = ConstructPixmap(8, 8);
+    int resetCount = 0;
+    auto resetCallback = [&resetCount]() { resetCount++; };
+    scenePersistenceTmp->SaveSnapshot(pixelMap, resetCallback);
+    scenePersistenceTmp->SaveSnapshot(pixelMap, resetCallback);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(scenePersistenceTmp->snapshotSaveSeq_[0].load(), 2);
+
+    auto stats = ScenePersistence::GetSnapshotPersistStats();
+    EXPECT_EQ(stats.queueDepth, 0);
+    EXPECT_EQ(stats.pendingBytes, 0);
+    EXPECT_LE(resetCount, 1);
+}
+
+/**
+ * @tc.name: EnqueueSnapshotTask
+ * @tc.desc: test the oldest queued saves are dropped over budget and the newest is kept
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScenePersistenceTest, EnqueueSnapshotTask, TestSize.Level1)
+{
+    sptr<ScenePersistence> scenePersistenceTmp = sptr<ScenePersistence>::MakeSptr("testBundleName", 1425);
+    {
+        std::lock_guard<std::mutex> lock(ScenePersistence::pendingSnapshotTasksMutex_);
+        ScenePersistence::pendingSnapshotTasks_.clear();
+    }
+    uint64_t droppedCount = ScenePersistence::GetSnapshotPersistStats().droppedCount;
+    int64_t overBudgetBytes = 512 * 1024 * 1024;
+    std::vector<uint64_t> droppedIds;
+    ScenePersistence::pendingSnapshotBytes_.fetch_add(overBudgetBytes);
+    for (uint64_t taskId = 1; taskId <= 3; taskId++) {
+        ScenePersistence::EnqueueSnapshotTask([] {}, taskId, "EnqueueSnapshotTask" + std::to_string(taskId),
+            [&droppedIds, taskId] { droppedIds.push_back(taskId); });
+    }
+    ScenePersistence::pendingSnapshotBytes_.fetch_sub(overBudgetBytes);
+    EXPECT_EQ(ScenePersistence::GetSnapshotPersistStats().droppedCount, droppedCount + 2);
+    EXPECT_EQ(droppedIds, std::vector<uint64_t>({ 1, 2 }));
+    EXPECT_FALSE(ScenePersistence::ErasePendingSnapshotTask(1));
+    std::lock_guard<std::mutex> lock(ScenePersistence::pendingSnapshotTasksMutex_);
+    ASSERT_EQ(ScenePersistence::pendingSnapshotTasks_.size(), 1);
+    EXPECT_EQ(ScenePersistence::pendingSnapshotTasks_.front().taskId, 3);
+    ScenePersistence::pendingSnapshotTasks_.clear();
+}
+
+/**
+ * @tc.name: RollbackDroppedSnapshot
+ * @tc.desc: test a dropped save takes back its snapshot flag and the saving state of the last save
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScenePersistenceTest, RollbackDroppedSnapshot, TestSize.Level1)
+{
+    sptr<ScenePersistence> scenePersistenceTmp = sptr<ScenePersistence>::MakeSptr("testBundleName", 1426);
+    scenePersistenceTmp->SetHasSnapshot(true, SCREEN_UNKNOWN);
+    scenePersistenceTmp->SetHasSnapshotFreeMultiWindow(true);
+    scenePersistenceTmp->SetIsSavingSnapshot(true);
+    scenePersistenceTmp->savingSnapshotSum_.store(2);
+
+    scenePersistenceTmp->RollbackDroppedSnapshot(SCREEN_UNKNOWN, false, 1);
+    EXPECT_FALSE(scenePersistenceTmp->HasSnapshot(SCREEN_UNKNOWN));
+    EXPECT_TRUE(scenePersistenceTmp->IsSavingSnapshot());
+
+    scenePersistenceTmp->RollbackDroppedSnapshot(SCREEN_UNKNOWN, true, 2);
+    EXPECT_FALSE(scenePersistenceTmp->HasSnapshot(SCREEN_UNKNOWN, true));
+    EXPECT_FALSE(scenePersistenceTmp->IsSavingSnapshot());
+}
+
+/**
+ * @tc.name: SnapshotPixelMapCache
+ * @tc.desc: test snapshot cache hit, scale mismatch and lru eviction by byte budget
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScenePersistenceTest, SnapshotPixelMapCache, TestSize.Level1)
+{
+    auto& snapshotCache = SnapshotPixelMapCache::GetInstance();
+    snapshotCache.Clear();
+    std::shared_ptr<Media::PixelMap> pixelMap = ConstructPixmap(8, 8);
+    int64_t bytes = pixelMap->GetByteCount();
+    int64_t oldBudget = snapshotCache.byteBudget_;
+    snapshotCache.byteBudget_ = bytes * 2;
+
+    snapshotCache.Put("a", 1.0f, pixelMap);
+    snapshotCache.Put("b", 1.0f, ConstructPixmap(8, 8));
+    auto cachedPixelMap = snapshotCache.Get("a", 1.0f);
+    ASSERT_NE(cachedPixelMap, nullptr);
+    EXPECT_NE(cachedPixelMap, pixelMap);
+    EXPECT_NE(cachedPixelMap, snapshotCache.Get("a", 1.0f));
+    EXPECT_EQ(cachedPixelMap->GetWidth(), pixelMap->GetWidth());
+    EXPECT_EQ(snapshotCache.Get("a", 0.5f), nullptr);
+    snapshotCache.Put("c", 1.0f, ConstructPixmap(8, 8));
+    EXPECT_EQ(snapshotCache.GetEntryCount(), 2);
+    EXPECT_EQ(snapshotCache.Get("b", 1.0f), nullptr);
+    EXPECT_NE(snapshotCache.Get("c", 1.0f), nullptr);
+
+    snapshotCache.Invalidate("c");
+    EXPECT_EQ(snapshotCache.GetUsedBytes(), bytes);
+    snapshotCache.TrimToBytes(0);
+    EXPECT_EQ(snapshotCache.GetEntryCount(), 0);
+    snapshotCache.byteBudget_ = oldBudget;
+}
 } // namespace
 } // namespace Rosen
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
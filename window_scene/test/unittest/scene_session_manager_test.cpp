@@ -992,11 +992,13 @@ HWTEST_F(SceneSessionManagerTest, HideNonSecureSubWindows, TestSize.Level1)
     subSession->GetSessionProperty()->SetWindowType(WindowType::WINDOW_TYPE_APP_SUB_WINDOW);
     subSession->GetSessionProperty()->SetParentPersistentId(sceneSession->GetPersistentId());
     ssm_->sceneSessionMap_.insert(std::make_pair(subSession->GetPersistentId(), subSession));
+    ssm_->sceneSessionRegistry_.Add(subSession);
 
     EXPECT_FALSE(subSession->GetSessionProperty()->GetForceHide());
     sceneSession->combinedExtWindowFlags_.hideNonSecureWindowsFlag = true;
     ssm_->HideNonSecureSubWindows(sceneSession);
     EXPECT_TRUE(subSession->GetSessionProperty()->GetForceHide());
+    ssm_->sceneSessionRegistry_.Remove(subSession->GetPersistentId());
     ssm_->sceneSessionMap_.clear();
 }
 
@@ -2342,6 +2342,52 @@ HWTEST_F(SceneSessionManagerTest11, NotifyStartWindowsAbility02, TestSize.Level1
     ASSERT_EQ(ret, BrokerStates::BROKER_UNKOWN);
     ssm_->abilityInfoMap_.erase(list);
 }
+
+/**
+ * @tc.name: BuildSurfaceIdIndex
+ * @tc.desc: test surfaceId index used by the occlusion callback and visibility callback counters
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerTest11, BuildSurfaceIdIndex, Function | SmallTest | Level2)
+{
+    auto oldVisibleData = ssm_->lastVisibleData_;
+    auto oldSessionMap = ssm_->sceneSessionMap_;
+    SessionInfo info;
+    info.bundleName_ = "bundle";
+    info.abilityName_ = "ability";
+    sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    sceneSession->persistentId_ = 2003;
+    struct RSSurfaceNodeConfig surfaceNodeConfig;
+    std::shared_ptr<RSSurfaceNode> surfaceNode = RSSurfaceNode::Create(surfaceNodeConfig, RSSurfaceNodeType::DEFAULT);
+    ASSERT_NE(surfaceNode, nullptr);
+    sceneSession->SetSurfaceNode(surfaceNode);
+    sptr<SceneSession> noSurfaceSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    noSurfaceSession->persistentId_ = 2004;
+    ssm_->sceneSessionMap_ = { { sceneSession->GetPersistentId(), sceneSession },
+        { noSurfaceSession->GetPersistentId(), noSurfaceSession } };
+
+    auto surfaceIdIndex = ssm_->BuildSurfaceIdIndex();
+    ASSERT_EQ(surfaceIdIndex.size(), 1);
+    EXPECT_EQ(surfaceIdIndex[surfaceNode->GetId()], sceneSession);
+
+    WindowVisibilityState visibleState = WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION;
+    std::vector<std::pair<uint64_t, WindowVisibilityState>> currVisibleData = {
+        { surfaceNode->GetId(), WINDOW_VISIBILITY_STATE_PARTICALLY_OCCLUSION } };
+    EXPECT_TRUE(ssm_->GetSessionRSVisible(sceneSession, currVisibleData, visibleState));
+    EXPECT_EQ(visibleState, WINDOW_VISIBILITY_STATE_PARTICALLY_OCCLUSION);
+    EXPECT_FALSE(ssm_->GetSessionRSVisible(noSurfaceSession, currVisibleData, visibleState));
+
+    auto statsBefore = ssm_->GetVisibilityCallbackStats();
+    ssm_->visibilityTouchedSessionCount_ = 1;
+    ssm_->RecordVisibilityCallbackStats(currVisibleData.size(), 1);
+    auto statsAfter = ssm_->GetVisibilityCallbackStats();
+    EXPECT_EQ(statsAfter.callbackCount, statsBefore.callbackCount + 1);
+    EXPECT_EQ(statsAfter.totalTouchedCount, statsBefore.totalTouchedCount + 1);
+    EXPECT_EQ(statsAfter.lastEntryCount, 1);
+    EXPECT_EQ(statsAfter.lastTouchedCount, 1);
+    ssm_->lastVisibleData_ = oldVisibleData;
+    ssm_->sceneSessionMap_ = oldSessionMap;
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
@@ -1227,12 +1227,14 @@ HWTEST_F(SceneSessionManagerTest12, UpdateKeyboardAvoidAreaActive, TestSize.Leve
     keyboardSession->GetSessionProperty()->SetDisplayId(info.screenId_);
     ASSERT_EQ(false, keyboardSession->IsSystemKeyboard());
     ssm->sceneSessionMap_.insert({ keyboardSession->GetPersistentId(), keyboardSession });
+    ssm->sceneSessionRegistry_.Add(keyboardSession);
     sptr<KeyboardSession> systemKeyboardSession = sptr<KeyboardSession>::MakeSptr(info, nullptr, nullptr);
     ASSERT_NE(nullptr, systemKeyboardSession->GetSessionProperty());
     systemKeyboardSession->GetSessionProperty()->SetDisplayId(info.screenId_);
     systemKeyboardSession->SetIsSystemKeyboard(true);
     ASSERT_EQ(true, systemKeyboardSession->IsSystemKeyboard());
     ssm->sceneSessionMap_.insert({ systemKeyboardSession->GetPersistentId(), systemKeyboardSession });
+    ssm->sceneSessionRegistry_.Add(systemKeyboardSession);
 
     ssm->UpdateKeyboardAvoidAreaActive(false);
     ASSERT_EQ(true, keyboardSession->keyboardAvoidAreaActive_);
@@ -478,5 +478,29 @@ HWTEST_F(SceneSessionManagerTest13, FixWindowUITypeInSupportModeChange, TestSize
     OHOS::system::SetParameter("persist.sceneboard.ispcmode", oldIsPcMode);
     ssm_->systemConfig_.windowUIType_ = oldWindowUIType;
 }
+/**
+ * @tc.name: GetSceneSessionMapSnapshot
+ * @tc.desc: snapshot is shared until a session is added or removed
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerTest13, GetSceneSessionMapSnapshot, TestSize.Level1)
+{
+    for (int32_t persistentId = 1; persistentId <= 100; persistentId++) {
+        ssm_->sceneSessionMap_.insert({ persistentId, CreateSceneSession(persistentId, "snapshot") });
+    }
+    ssm_->MarkSceneSessionMapChangedLocked();
+    auto snapshot = ssm_->GetSceneSessionMapSnapshot();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_EQ(snapshot->sessionMap.size(), 100);
+    EXPECT_EQ(ssm_->GetSceneSessionMapSnapshot(), snapshot);
+
+    ssm_->EraseSceneSessionAndMarkDirtyLocked(1);
+    auto newSnapshot = ssm_->GetSceneSessionMapSnapshot();
+    ASSERT_NE(newSnapshot, nullptr);
+    EXPECT_NE(newSnapshot, snapshot);
+    EXPECT_GT(newSnapshot->epoch, snapshot->epoch);
+    EXPECT_EQ(newSnapshot->sessionMap.size(), 99);
+    EXPECT_EQ(snapshot->sessionMap.size(), 100);
+}
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -448,6 +448,7 @@ HWTEST_F(SceneSessionManagerTest6, SetWatermarkImageForApp2, TestSize.Level1)
     auto session1 = sptr<SceneSession>::MakeSptr(sessionInfo1, nullptr);
     session1->SetCallingPid(pid + 1000);
     ssm_->sceneSessionMap_.insert(std::make_pair(1, session1));
+    ssm_->sceneSessionRegistry_.Add(session1);
 
     SessionInfo sessionInfo2;
     sessionInfo2.bundleName_ = bundleName;
@@ -457,6 +458,7 @@ HWTEST_F(SceneSessionManagerTest6, SetWatermarkImageForApp2, TestSize.Level1)
     session2->SetSurfaceNode(surfaceNode);
     session2->SetCallingPid(pid);
     ssm_->sceneSessionMap_.insert(std::make_pair(2, session2));
+    ssm_->sceneSessionRegistry_.Add(session2);
 
     SessionInfo sessionInfo3;
     sessionInfo3.bundleName_ = bundleName;
@@ -465,6 +467,7 @@ HWTEST_F(SceneSessionManagerTest6, SetWatermarkImageForApp2, TestSize.Level1)
     session3->SetSurfaceNode(nullptr);
     session3->SetCallingPid(pid);
     ssm_->sceneSessionMap_.insert(std::make_pair(3, session3));
+    ssm_->sceneSessionRegistry_.Add(session3);
 
     ssm_->appWatermarkPidMap_[pid] = "watermarkName#1";
     EXPECT_EQ(ssm_->SetWatermarkImageForApp(pixelMap, watermarkName), WMError::WM_ERROR_SYSTEM_ABNORMALLY);
@@ -472,6 +475,9 @@ HWTEST_F(SceneSessionManagerTest6, SetWatermarkImageForApp2, TestSize.Level1)
     EXPECT_EQ(ssm_->appWatermarkPidMap_.size(), 1);
 
     ssm_->appWatermarkPidMap_.clear();
+    for (const auto& session : { session1, session2, session3 }) {
+        ssm_->sceneSessionRegistry_.Remove(session->GetPersistentId());
+    }
     ssm_->sceneSessionMap_.clear();
     ssm_->sceneSessionMap_ = oldSceneSessionMap;
 }
@@ -107,6 +107,83 @@ HWTEST_F(SceneSessionManagerTest9, TraverseSessionTreeFromTopToBottom, TestSize.
     ssm_->TraverseSessionTreeFromTopToBottom(TraverseFuncTest);
 }
 
+/**
+ * @tc.name: TraverseSessionTreeWithZOrderIndex
+ * @tc.desc: test the zOrder index is reused until the map or a zOrder changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerTest9, TraverseSessionTreeWithZOrderIndex, TestSize.Level1)
+{
+    ASSERT_NE(nullptr, ssm_);
+    ssm_->sceneSessionMap_.clear();
+    constexpr int32_t sessionCount = 300;
+    SessionInfo sessionInfo;
+    sessionInfo.bundleName_ = "SceneSessionManagerTest9";
+    sessionInfo.abilityName_ = "TraverseSessionTreeWithZOrderIndex";
+    for (int32_t id = 1; id <= sessionCount; id++) {
+        sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+        sceneSession->persistentId_ = id;
+        sceneSession->zOrder_ = static_cast<uint32_t>(sessionCount - id);
+        ssm_->sceneSessionMap_.insert(std::make_pair(id, sceneSession));
+    }
+    ssm_->MarkSceneSessionMapChangedLocked();
+
+    std::vector<uint32_t> zOrders;
+    ssm_->TraverseSessionTree([&zOrders](const sptr<SceneSession>& session) {
+        zOrders.push_back(session->GetZOrder());
+        return zOrders.size() == 3; // 3: stop early
+    }, true);
+    EXPECT_EQ(zOrders, std::vector<uint32_t>({ 299, 298, 297 }));
+    auto zOrderIndex = ssm_->GetZOrderIndex();
+    auto rebuildCount = ssm_->zOrderIndexRebuildCount_;
+
+    // unchanged map and zOrders reuse the index, e.g. repeated focus selection
+    for (int32_t i = 0; i < 100; i++) {
+        ssm_->TraverseSessionTree([](const sptr<SceneSession>& session) { return session->GetZOrder() < 150; },
+            i % 2 == 0);
+    }
+    EXPECT_EQ(rebuildCount, ssm_->zOrderIndexRebuildCount_);
+    EXPECT_EQ(zOrderIndex, ssm_->GetZOrderIndex());
+
+    ssm_->sceneSessionMap_[sessionCount]->UpdateZOrderInner(1000);
+    zOrders.clear();
+    ssm_->TraverseSessionTree([&zOrders](const sptr<SceneSession>& session) {
+        zOrders.push_back(session->GetZOrder());
+        return true;
+    }, true);
+    EXPECT_EQ(zOrders, std::vector<uint32_t>({ 1000 }));
+    zOrders.clear();
+    ssm_->TraverseSessionTree([&zOrders](const sptr<SceneSession>& session) {
+        zOrders.push_back(session->GetZOrder());
+        return true;
+    }, false);
+    EXPECT_EQ(zOrders, std::vector<uint32_t>({ 1 }));
+    EXPECT_EQ(rebuildCount + 1, ssm_->zOrderIndexRebuildCount_);
+    EXPECT_NE(zOrderIndex, ssm_->GetZOrderIndex());
+    // the handed-out index is not rewritten
+    EXPECT_EQ(1, zOrderIndex->sessions.back()->GetPersistentId());
+
+    ssm_->sceneSessionMap_.erase(sessionCount);
+    ssm_->MarkSceneSessionMapChangedLocked();
+    zOrders.clear();
+    ssm_->TraverseSessionTree([&zOrders](const sptr<SceneSession>& session) {
+        zOrders.push_back(session->GetZOrder());
+        return true;
+    }, true);
+    EXPECT_EQ(zOrders, std::vector<uint32_t>({ 299 }));
+
+    // equal zOrders keep a stable order by persistentId
+    ssm_->sceneSessionMap_[1]->Session::SetZOrder(1);
+    std::vector<int32_t> ids;
+    ssm_->TraverseSessionTree([&ids](const sptr<SceneSession>& session) {
+        ids.push_back(session->GetPersistentId());
+        return ids.size() == 3; // 3: stop early
+    }, false);
+    EXPECT_EQ(ids, std::vector<int32_t>({ 1, 299, 298 }));
+    ssm_->sceneSessionMap_.clear();
+    ssm_->MarkSceneSessionMapChangedLocked();
+}
+
 /**
  * @tc.name: TestRequestFocusStatus_01
  * @tc.desc: Test RequestFocusStatus with sceneSession is nullptr
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "session_manager/include/scene_session_registry.h"
+
+using namespace testing;
+using namespace testing::ext;
+namespace OHOS {
+namespace Rosen {
+class SceneSessionRegistryTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+protected:
+    sptr<SceneSession> CreateSession(int32_t persistentId, WindowType type, DisplayId displayId);
+
+    SceneSessionRegistry registry_;
+};
+
+void SceneSessionRegistryTest::SetUpTestCase() {}
+
+void SceneSessionRegistryTest::TearDownTestCase() {}
+
+void SceneSessionRegistryTest::SetUp() {}
+
+void SceneSessionRegistryTest::TearDown() {}
+
+sptr<SceneSession> SceneSessionRegistryTest::CreateSession(int32_t persistentId, WindowType type,
+    DisplayId displayId)
+{
+    SessionInfo info;
+    info.abilityName_ = "SceneSessionRegistryTest";
+    info.bundleName_ = "SceneSessionRegistryTest";
+    sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    sceneSession->persistentId_ = persistentId;
+    sceneSession->GetSessionProperty()->SetWindowType(type);
+    sceneSession->GetSessionProperty()->SetDisplayId(displayId);
+    return sceneSession;
+}
+
+/**
+ * @tc.name: AddAndRemove
+ * @tc.desc: test function Add and Remove
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionRegistryTest, AddAndRemove, TestSize.Level1)
+{
+    registry_.Add(nullptr);
+    EXPECT_EQ(registry_.Size(), 0);
+    auto session1 = CreateSession(1, WindowType::APP_MAIN_WINDOW_BASE, 0);
+    auto session2 = CreateSession(2, WindowType::APP_MAIN_WINDOW_BASE, 0);
+    auto session3 = CreateSession(3, WindowType::WINDOW_TYPE_STATUS_BAR, 0);
+    registry_.Add(session1);
+    registry_.Add(session2);
+    registry_.Add(session3);
+    registry_.Add(session3);
+    EXPECT_EQ(registry_.Size(), 3);
+
+    registry_.Remove(1);
+    registry_.Remove(100);
+    EXPECT_EQ(registry_.Size(), 2);
+    auto mainSessions = registry_.GetByWindowType(WindowType::APP_MAIN_WINDOW_BASE);
+    ASSERT_EQ(mainSessions.size(), 1);
+    EXPECT_EQ(mainSessions[0]->GetPersistentId(), 2);
+
+    registry_.Add(session1);
+    EXPECT_EQ(registry_.GetByWindowType(WindowType::APP_MAIN_WINDOW_BASE).size(), 2);
+}
+
+/**
+ * @tc.name: KeepIdOrder
+ * @tc.desc: test results stay sorted by persistentId across add and remove
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionRegistryTest, KeepIdOrder, TestSize.Level1)
+{
+    registry_.Add(CreateSession(3, WindowType::APP_MAIN_WINDOW_BASE, 0));
+    registry_.Add(CreateSession(1, WindowType::APP_MAIN_WINDOW_BASE, 0));
+    registry_.Add(CreateSession(4, WindowType::APP_MAIN_WINDOW_BASE, 0));
+    registry_.Add(CreateSession(2, WindowType::APP_MAIN_WINDOW_BASE, 0));
+    registry_.Remove(2);
+    auto result = registry_.GetByWindowType(WindowType::APP_MAIN_WINDOW_BASE);
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0]->GetPersistentId(), 1);
+    EXPECT_EQ(result[1]->GetPersistentId(), 3);
+    EXPECT_EQ(result[2]->GetPersistentId(), 4);
+}
+
+/**
+ * @tc.name: GetByTypeAndDisplayId
+ * @tc.desc: test function GetByTypeAndDisplayId
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionRegistryTest, GetByTypeAndDisplayId, TestSize.Level1)
+{
+    auto session1 = CreateSession(1, WindowType::WINDOW_TYPE_STATUS_BAR, 0);
+    auto session2 = CreateSession(2, WindowType::WINDOW_TYPE_STATUS_BAR, 1);
+    registry_.Add(session1);
+    registry_.Add(session2);
+    auto result = registry_.GetByTypeAndDisplayId(WindowType::WINDOW_TYPE_STATUS_BAR, 1);
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0]->GetPersistentId(), 2);
+
+    session1->GetSessionProperty()->SetDisplayId(1);
+    registry_.UpdateAttributes(session1);
+    EXPECT_EQ(registry_.GetByTypeAndDisplayId(WindowType::WINDOW_TYPE_STATUS_BAR, 1).size(), 2);
+    EXPECT_EQ(registry_.GetByTypeAndDisplayId(WindowType::WINDOW_TYPE_STATUS_BAR, 0).size(), 0);
+    EXPECT_EQ(registry_.GetByTypeAndDisplayId(WindowType::WINDOW_TYPE_NAVIGATION_BAR, 1).size(), 0);
+}
+
+/**
+ * @tc.name: GetByDisplayId
+ * @tc.desc: test function GetByDisplayId follows UpdateAttributes and skips stale entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionRegistryTest, GetByDisplayId, TestSize.Level1)
+{
+    auto session1 = CreateSession(1, WindowType::APP_MAIN_WINDOW_BASE, 0);
+    auto session2 = CreateSession(2, WindowType::WINDOW_TYPE_STATUS_BAR, 0);
+    registry_.Add(session2);
+    registry_.Add(session1);
+    auto result = registry_.GetByDisplayId(0);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0]->GetPersistentId(), 1);
+
+    session2->GetSessionProperty()->SetDisplayId(1);
+    EXPECT_EQ(registry_.GetByDisplayId(0).size(), 1);
+    EXPECT_EQ(registry_.GetByDisplayId(1).size(), 0);
+    EXPECT_EQ(registry_.GetByTypeAndDisplayId(WindowType::WINDOW_TYPE_STATUS_BAR, 1).size(), 0);
+
+    registry_.UpdateAttributes(session2);
+    EXPECT_EQ(registry_.GetByDisplayId(0).size(), 1);
+    result = registry_.GetByDisplayId(1);
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0]->GetPersistentId(), 2);
+    EXPECT_EQ(registry_.GetByTypeAndDisplayId(WindowType::WINDOW_TYPE_STATUS_BAR, 1).size(), 1);
+
+    registry_.Remove(2);
+    EXPECT_EQ(registry_.GetByDisplayId(1).size(), 0);
+}
+
+/**
+ * @tc.name: GetByCallingPid
+ * @tc.desc: test function GetByCallingPid follows UpdateAttributes and skips stale entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionRegistryTest, GetByCallingPid, TestSize.Level1)
+{
+    auto session1 = CreateSession(1, WindowType::APP_MAIN_WINDOW_BASE, 0);
+    auto session2 = CreateSession(2, WindowType::APP_SUB_WINDOW_BASE, 0);
+    session1->SetCallingPid(100);
+    session2->SetCallingPid(100);
+    registry_.Add(session2);
+    registry_.Add(session1);
+    auto result = registry_.GetByCallingPid(100);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0]->GetPersistentId(), 1);
+
+    session2->SetCallingPid(200);
+    EXPECT_EQ(registry_.GetByCallingPid(100).size(), 1);
+    EXPECT_EQ(registry_.GetByCallingPid(200).size(), 0);
+    registry_.UpdateAttributes(session2);
+    EXPECT_EQ(registry_.GetByCallingPid(100).size(), 1);
+    EXPECT_EQ(registry_.GetByCallingPid(200).size(), 1);
+}
+
+/**
+ * @tc.name: GetByParentId
+ * @tc.desc: test function GetByParentId follows UpdateAttributes and skips stale entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionRegistryTest, GetByParentId, TestSize.Level1)
+{
+    auto session1 = CreateSession(1, WindowType::APP_MAIN_WINDOW_BASE, 0);
+    auto session2 = CreateSession(2, WindowType::APP_SUB_WINDOW_BASE, 0);
+    auto session3 = CreateSession(3, WindowType::APP_SUB_WINDOW_BASE, 0);
+    session3->SetParentPersistentId(1);
+    registry_.Add(session1);
+    registry_.Add(session2);
+    registry_.Add(session3);
+    EXPECT_EQ(registry_.GetByParentId(1).size(), 1);
+
+    session2->SetParentPersistentId(1);
+    EXPECT_EQ(registry_.GetByParentId(1).size(), 1);
+    registry_.UpdateAttributes(session2);
+    auto result = registry_.GetByParentId(1);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0]->GetPersistentId(), 2);
+    EXPECT_EQ(result[1]->GetPersistentId(), 3);
+
+    registry_.UpdateAttributes(CreateSession(4, WindowType::APP_SUB_WINDOW_BASE, 0));
+    EXPECT_EQ(registry_.Size(), 3);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -2707,10 +2707,116 @@ HWTEST_F(SceneSessionTest5, OnNextVsyncReceivedWhenDrag, TestSize.Level1)
     bool needFlush = true;
     bool needSetBoundsNextVsync = true;
     session->UpdateRectForDrag(globalRect);
-    session->OnNextVsyncReceivedWhenDrag(globalRect, isGlobal, needFlush, needSetBoundsNextVsync);
+    session->RequestNextVsyncWhenDrag(globalRect, isGlobal, needFlush, needSetBoundsNextVsync);
+    session->OnNextVsyncReceivedWhenDrag();
     EXPECT_TRUE(g_errLog.find("session moveDragController is null") != std::string::npos);
 }
 
+/**
+ * @tc.name: DragRectMailbox
+ * @tc.desc: test drag rects are coalesced into one vsync request and the latest one wins
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionTest5, DragRectMailbox, TestSize.Level1)
+{
+    SessionInfo info;
+    info.abilityName_ = "DragRectMailbox";
+    info.bundleName_ = "DragRectMailbox";
+    sptr<SceneSession> session = sptr<SceneSession>::MakeSptr(info, nullptr);
+    session->vsyncStation_ = nullptr;
+    session->RequestNextVsyncWhenDrag({ 0, 0, 100, 100 }, true, true, false);
+    EXPECT_FALSE(session->dragRectMailbox_.vsyncRequested);
+
+    session->dragRectMailbox_.vsyncRequested = true;
+    session->RequestNextVsyncWhenDrag({ 10, 20, 100, 100 }, false, false, true);
+    EXPECT_TRUE(session->dragRectMailbox_.vsyncRequested);
+    WSRect expectRect = { 10, 20, 100, 100 };
+    EXPECT_EQ(session->dragRectMailbox_.globalRect, expectRect);
+    EXPECT_FALSE(session->dragRectMailbox_.isGlobal);
+    EXPECT_TRUE(session->dragRectMailbox_.needSetBoundsNextVsync);
+
+    session->dragRectEventCount_ = 5;
+    session->dragRectIpcCount_ = 2;
+    auto stats = session->GetDragRectUpdateStats();
+    EXPECT_EQ(stats.eventCount, 5);
+    EXPECT_EQ(stats.ipcCount, 2);
+    session->ResetDragRectUpdateStats();
+    stats = session->GetDragRectUpdateStats();
+    EXPECT_EQ(stats.eventCount, 0);
+    EXPECT_EQ(stats.ipcCount, 0);
+    EXPECT_FALSE(session->dragRectMailbox_.vsyncRequested);
+}
+
+/**
+ * @tc.name: FilterUnchangedDragAvoidAreas
+ * @tc.desc: test only changed avoid areas are sent during a drag
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionTest5, FilterUnchangedDragAvoidAreas, TestSize.Level1)
+{
+    SessionInfo info;
+    info.abilityName_ = "FilterUnchangedDragAvoidAreas";
+    info.bundleName_ = "FilterUnchangedDragAvoidAreas";
+    sptr<SceneSession> session = sptr<SceneSession>::MakeSptr(info, nullptr);
+    AvoidArea systemArea;
+    systemArea.topRect_ = { 0, 0, 1260, 100 };
+    AvoidArea cutoutArea;
+    std::map<AvoidAreaType, AvoidArea> fullAreas = {
+        { AvoidAreaType::TYPE_SYSTEM, systemArea }, { AvoidAreaType::TYPE_CUTOUT, cutoutArea } };
+
+    auto avoidAreas = fullAreas;
+    session->FilterUnchangedDragAvoidAreas(SizeChangeReason::DRAG, avoidAreas);
+    EXPECT_EQ(avoidAreas.size(), 2);
+    avoidAreas = fullAreas;
+    session->FilterUnchangedDragAvoidAreas(SizeChangeReason::DRAG, avoidAreas);
+    EXPECT_TRUE(avoidAreas.empty());
+
+    systemArea.topRect_.height_ = 0;
+    fullAreas[AvoidAreaType::TYPE_SYSTEM] = systemArea;
+    avoidAreas = fullAreas;
+    session->FilterUnchangedDragAvoidAreas(SizeChangeReason::DRAG_MOVE, avoidAreas);
+    ASSERT_EQ(avoidAreas.size(), 1);
+    EXPECT_EQ(avoidAreas[AvoidAreaType::TYPE_SYSTEM], systemArea);
+
+    avoidAreas = fullAreas;
+    session->FilterUnchangedDragAvoidAreas(SizeChangeReason::DRAG_END, avoidAreas);
+    EXPECT_EQ(avoidAreas.size(), 2);
+    EXPECT_TRUE(session->lastDragAvoidAreas_.empty());
+}
+
+/**
+ * @tc.name: FilterUnchangedDragAvoidAreasAfterUpdateAvoidArea
+ * @tc.desc: test an avoid area sent by UpdateAvoidArea during a drag is not filtered on the next drag update
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionTest5, FilterUnchangedDragAvoidAreasAfterUpdateAvoidArea, TestSize.Level1)
+{
+    SessionInfo info;
+    info.abilityName_ = "FilterUnchangedDragAvoidAreasAfterUpdateAvoidArea";
+    info.bundleName_ = "FilterUnchangedDragAvoidAreasAfterUpdateAvoidArea";
+    sptr<SceneSession> session = sptr<SceneSession>::MakeSptr(info, nullptr);
+    auto sessionStage = sptr<SessionStageMocker>::MakeSptr();
+    session->sessionStage_ = sessionStage;
+    AvoidArea systemArea;
+    systemArea.topRect_ = { 0, 0, 1260, 100 };
+    AvoidArea cutoutArea;
+    std::map<AvoidAreaType, AvoidArea> fullAreas = {
+        { AvoidAreaType::TYPE_SYSTEM, systemArea }, { AvoidAreaType::TYPE_CUTOUT, cutoutArea } };
+
+    auto avoidAreas = fullAreas;
+    session->FilterUnchangedDragAvoidAreas(SizeChangeReason::DRAG, avoidAreas);
+    EXPECT_EQ(avoidAreas.size(), 2);
+
+    // the client now holds an empty system area
+    EXPECT_CALL(*sessionStage, UpdateAvoidArea(_, AvoidAreaType::TYPE_SYSTEM)).WillOnce(Return(WSError::WS_OK));
+    EXPECT_EQ(session->UpdateAvoidArea(sptr<AvoidArea>::MakeSptr(), AvoidAreaType::TYPE_SYSTEM), WSError::WS_OK);
+
+    avoidAreas = fullAreas;
+    session->FilterUnchangedDragAvoidAreas(SizeChangeReason::DRAG, avoidAreas);
+    ASSERT_EQ(avoidAreas.size(), 1);
+    EXPECT_EQ(avoidAreas[AvoidAreaType::TYPE_SYSTEM], systemArea);
+}
+
 /**
  * @tc.name: SetNotifyVisibleChangeFunc
  * @tc.desc: SetNotifyVisibleChangeFunc Test
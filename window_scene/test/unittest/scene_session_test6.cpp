@@ -1557,22 +1557,22 @@ HWTEST_F(SceneSessionTest6, TestRunAfterNVsyncsThreeTimes, TestSize.Level1)
     session->SetVsyncStation(mockVsyncStation);
 
     bool taskExecuted = false;
-    int vsyncTimes = 0;
+    uint32_t delayFrames = 0;
 
-    EXPECT_CALL(*mockVsyncStation, RequestVsync(_))
-        .Times(3)
-        .WillRepeatedly(Invoke([&](const std::shared_ptr<VsyncCallback>& cb) {
+    EXPECT_CALL(*mockVsyncStation, RequestVsync(_)).Times(0);
+    EXPECT_CALL(*mockVsyncStation, ScheduleVsyncCallback(_, _))
+        .Times(1)
+        .WillOnce(Invoke([&](const std::shared_ptr<VsyncCallback>& cb, const VsyncScheduleOption& option) {
             ASSERT_NE(cb, nullptr);
-            if (++vsyncTimes <= 3) {
-                cb->onCallback(0, 0);
-            }
+            delayFrames = option.delayFrames;
+            cb->onCallback(0, 0);
         }));
 
     session->RunAfterNVsyncs(3, [&](int64_t, int64_t) {
         taskExecuted = true;
     });
 
-    EXPECT_EQ(vsyncTimes, 3);
+    EXPECT_EQ(delayFrames, 3);
     EXPECT_TRUE(taskExecuted);
 }
 
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "session/host/include/session_change_recorder.h"
 
@@ -73,7 +74,6 @@ HWTEST_F(SessionChangeRecorderTest, RecordSceneSessionChange, TestSize.Level1)
     EXPECT_EQ(result4, WSError::WS_OK);
 
     changeInfo.changeInfo_ = "Record Scene Session Change Test2";
-    changeInfo.time_ = "04-28 12:27:00.791";
     auto result5 = SessionChangeRecorder::GetInstance().RecordSceneSessionChange(
         RecordType::RECORD_TYPE_BEGIN, changeInfo);
     EXPECT_EQ(result5, WSError::WS_OK);
@@ -106,8 +106,7 @@ HWTEST_F(SessionChangeRecorderTest, SetRecordSize, TestSize.Level1)
  */
 HWTEST_F(SessionChangeRecorderTest, GetSceneSessionNeedDumpInfo, TestSize.Level1)
 {
-    SessionChangeRecorder::GetInstance().sceneSessionChangeNeedLogMap_.clear();
-    SessionChangeRecorder::GetInstance().sceneSessionChangeNeedDumpMap_.clear();
+    SessionChangeRecorder::GetInstance().ClearRecords();
 
     std::vector<std::string> params;
     std::string dumpInfo;
@@ -161,79 +160,148 @@ HWTEST_F(SessionChangeRecorderTest, GetSceneSessionNeedDumpInfo, TestSize.Level1
 }
 
 /**
- * @tc.name: RecordDump
- * @tc.desc: RecordDump
+ * @tc.name: CollectRecords
+ * @tc.desc: CollectRecords keeps the newest records of each type in order
  * @tc.type: FUNC
  */
-HWTEST_F(SessionChangeRecorderTest, RecordDump, TestSize.Level1)
+HWTEST_F(SessionChangeRecorderTest, CollectRecords, TestSize.Level1)
 {
-    SessionChangeRecorder::GetInstance().sceneSessionChangeNeedDumpMap_.clear();
+    SessionChangeRecorder::GetInstance().ClearRecords();
     SceneSessionChangeInfo changeInfo1 {
         .persistentId_ = 123,
         .changeInfo_ = "changeInfo1",
         .logTag_ = WmsLogTag::WMS_MAIN,
     };
-    SessionChangeRecorder::GetInstance().RecordDump(RecordType::RECORD_TYPE_BEGIN, changeInfo1);
-    auto result1 = SessionChangeRecorder::GetInstance().sceneSessionChangeNeedDumpMap_;
-    EXPECT_EQ(result1[RecordType::RECORD_TYPE_BEGIN].size(), 1);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::PRIVACY_MODE, changeInfo1);
+    auto result1 = SessionChangeRecorder::GetInstance().CollectRecords();
+    EXPECT_EQ(result1[RecordType::PRIVACY_MODE].size(), 1);
 
     SceneSessionChangeInfo changeInfo2 {
         .persistentId_ = 123,
         .changeInfo_ = "changeInfo2",
         .logTag_ = WmsLogTag::WMS_MAIN,
     };
-    SessionChangeRecorder::GetInstance().RecordDump(RecordType::RECORD_TYPE_BEGIN, changeInfo2);
-    auto result2 = SessionChangeRecorder::GetInstance().sceneSessionChangeNeedDumpMap_;
-    EXPECT_EQ(result2[RecordType::RECORD_TYPE_BEGIN].size(), 2);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::PRIVACY_MODE, changeInfo2);
+    auto result2 = SessionChangeRecorder::GetInstance().CollectRecords();
+    EXPECT_EQ(result2[RecordType::PRIVACY_MODE].size(), 2);
 
     SceneSessionChangeInfo changeInfo3 {
         .persistentId_ = 123,
         .changeInfo_ = "changeInfo3",
         .logTag_ = WmsLogTag::WMS_MAIN,
     };
-    SessionChangeRecorder::GetInstance().SetRecordSize(RecordType::RECORD_TYPE_BEGIN, 2);
-    SessionChangeRecorder::GetInstance().RecordDump(RecordType::RECORD_TYPE_BEGIN, changeInfo3);
-    auto result3 = SessionChangeRecorder::GetInstance().sceneSessionChangeNeedDumpMap_;
-    EXPECT_EQ(result3[RecordType::RECORD_TYPE_BEGIN].size(), 2);
-    SessionChangeRecorder::GetInstance().SetRecordSize(RecordType::RECORD_TYPE_BEGIN, MAX_RECORD_TYPE_SIZE);
+    SessionChangeRecorder::GetInstance().SetRecordSize(RecordType::PRIVACY_MODE, 2);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::PRIVACY_MODE, changeInfo3);
+    auto result3 = SessionChangeRecorder::GetInstance().CollectRecords();
+    ASSERT_EQ(result3[RecordType::PRIVACY_MODE].size(), 2);
+    EXPECT_EQ(result3[RecordType::PRIVACY_MODE][0].changeInfo_, "changeInfo2");
+    EXPECT_EQ(result3[RecordType::PRIVACY_MODE][1].changeInfo_, "changeInfo3");
+    SessionChangeRecorder::GetInstance().SetRecordSize(RecordType::PRIVACY_MODE, MAX_RECORD_TYPE_SIZE);
 }
 
 /**
- * @tc.name: RecordLog
- * @tc.desc: RecordLog
+ * @tc.name: CollectRecordsPerType
+ * @tc.desc: Frequent record types do not evict rare ones
  * @tc.type: FUNC
  */
-HWTEST_F(SessionChangeRecorderTest, RecordLog, TestSize.Level1)
+HWTEST_F(SessionChangeRecorderTest, CollectRecordsPerType, TestSize.Level1)
 {
-    SessionChangeRecorder::GetInstance().sceneSessionChangeNeedLogMap_.clear();
-    SceneSessionChangeInfo changeInfo1 {
+    SessionChangeRecorder::GetInstance().ClearRecords();
+    SceneSessionChangeInfo rareInfo {
         .persistentId_ = 123,
-        .changeInfo_ = "changeInfo1",
+        .changeInfo_ = "rareInfo",
         .logTag_ = WmsLogTag::WMS_MAIN,
     };
-    SessionChangeRecorder::GetInstance().RecordLog(RecordType::RECORD_TYPE_BEGIN, changeInfo1);
-    auto result1 = SessionChangeRecorder::GetInstance().sceneSessionChangeNeedLogMap_;
-    EXPECT_EQ(result1[RecordType::RECORD_TYPE_BEGIN].size(), 1);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::ORIENTAION_RECORD, rareInfo);
+    constexpr int32_t recordCount = 10000;
+    for (int32_t i = 0; i < recordCount; i++) {
+        SceneSessionChangeInfo eventInfo {
+            .persistentId_ = i,
+            .changeInfo_ = "WindowInfos: " + std::to_string(i),
+            .logTag_ = WmsLogTag::WMS_EVENT,
+        };
+        SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::EVENT_RECORD, eventInfo);
+    }
+    auto result = SessionChangeRecorder::GetInstance().CollectRecords();
+    ASSERT_EQ(result[RecordType::ORIENTAION_RECORD].size(), 1);
+    EXPECT_EQ(result[RecordType::ORIENTAION_RECORD][0].changeInfo_, "rareInfo");
+    ASSERT_EQ(result[RecordType::EVENT_RECORD].size(), MAX_RECORD_TYPE_SIZE);
+    EXPECT_EQ(result[RecordType::EVENT_RECORD].back().persistentId_, recordCount - 1);
+}
 
-    SceneSessionChangeInfo changeInfo2 {
-        .persistentId_ = 123,
-        .changeInfo_ = "changeInfo2",
-        .logTag_ = WmsLogTag::WMS_MAIN,
-    };
-    SessionChangeRecorder::GetInstance().RecordLog(RecordType::RECORD_TYPE_BEGIN, changeInfo2);
-    auto result2 = SessionChangeRecorder::GetInstance().sceneSessionChangeNeedLogMap_;
-    EXPECT_EQ(result2[RecordType::RECORD_TYPE_BEGIN].size(), 2);
+/**
+ * @tc.name: GetThreadRingSet
+ * @tc.desc: Threads registering past the ring limit share one ring set
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionChangeRecorderTest, GetThreadRingSet, TestSize.Level1)
+{
+    constexpr size_t maxRingCount = 64;
+    constexpr size_t threadCount = maxRingCount + 8;
+    std::vector<std::thread> threads;
+    std::atomic<bool> release { false };
+    std::atomic<size_t> recordedCount { 0 };
+    for (size_t i = 0; i < threadCount; i++) {
+        threads.emplace_back([&release, &recordedCount, i] {
+            SceneSessionChangeInfo changeInfo {
+                .persistentId_ = static_cast<int32_t>(i),
+                .changeInfo_ = "changeInfo" + std::to_string(i),
+                .logTag_ = WmsLogTag::WMS_MAIN,
+            };
+            SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::VISIBLE_RECORD, changeInfo);
+            recordedCount++;
+            /* keep every thread alive so no ring set can be reclaimed */
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    while (recordedCount.load() < threadCount) {
+        std::this_thread::yield();
+    }
+    {
+        std::lock_guard<std::mutex> lock(SessionChangeRecorder::GetInstance().ringsMutex_);
+        EXPECT_LE(SessionChangeRecorder::GetInstance().ringSets_.size(), maxRingCount);
+        EXPECT_NE(SessionChangeRecorder::GetInstance().sharedRingSet_, nullptr);
+    }
+    release.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
 
-    SceneSessionChangeInfo changeInfo3 {
-        .persistentId_ = 123,
-        .changeInfo_ = "changeInfo3",
-        .logTag_ = WmsLogTag::WMS_MAIN,
-    };
-    SessionChangeRecorder::GetInstance().SetRecordSize(RecordType::RECORD_TYPE_BEGIN, 2);
-    SessionChangeRecorder::GetInstance().RecordLog(RecordType::RECORD_TYPE_BEGIN, changeInfo3);
-    auto result3 = SessionChangeRecorder::GetInstance().sceneSessionChangeNeedLogMap_;
-    EXPECT_EQ(result3[RecordType::RECORD_TYPE_BEGIN].size(), 0);
-    SessionChangeRecorder::GetInstance().SetRecordSize(RecordType::RECORD_TYPE_BEGIN, MAX_RECORD_TYPE_SIZE);
+/**
+ * @tc.name: SessionChangeRing
+ * @tc.desc: SessionChangeRing drops the oldest records when it wraps
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionChangeRecorderTest, SessionChangeRing, TestSize.Level1)
+{
+    SessionChangeRing ring;
+    constexpr int32_t recordCount = 10000;
+    for (int32_t i = 1; i <= recordCount; i++) {
+        SceneSessionChangeInfo changeInfo {
+            .persistentId_ = i,
+            .changeInfo_ = "changeInfo" + std::to_string(i),
+            .logTag_ = WmsLogTag::WMS_MAIN,
+        };
+        ring.Append(RecordType::EVENT_RECORD, changeInfo, i);
+    }
+    std::vector<std::pair<RecordType, SceneSessionChangeInfo>> records;
+    ring.Collect(records);
+    ASSERT_FALSE(records.empty());
+    EXPECT_LT(records.size(), recordCount);
+    EXPECT_EQ(records.back().second.persistentId_, recordCount);
+    EXPECT_EQ(records.back().second.timestamp_, recordCount);
+    for (size_t i = 1; i < records.size(); i++) {
+        EXPECT_EQ(records[i].second.persistentId_, records[i - 1].second.persistentId_ + 1);
+        EXPECT_EQ(records[i].second.changeInfo_, "changeInfo" + std::to_string(records[i].second.persistentId_));
+    }
+
+    ring.Clear();
+    records.clear();
+    ring.Collect(records);
+    EXPECT_TRUE(records.empty());
 }
 
 /**
@@ -1538,10 +1538,10 @@ HWTEST_F(SessionStageProxyTest, UpdatePropertyWhenTriggerMode, TestSize.Level1)
     MockMessageParcel::SetWriteInterfaceTokenErrorFlag(false);
 
     // Case 2: Failed to write property
-    MockMessageParcel::SetWriteParcelableErrorFlag(true);
-    MockMessageParcel::SetWriteParcelableErrorCount(0);
+    MockMessageParcel::SetWriteUint32ErrorFlag(true);
     EXPECT_EQ(WSError::WS_ERROR_IPC_FAILED, sessionStage_->UpdatePropertyWhenTriggerMode(property));
-    MockMessageParcel::SetWriteParcelableErrorFlag(false);
+    MockMessageParcel::SetWriteUint32ErrorFlag(false);
+    EXPECT_EQ(WSError::WS_ERROR_IPC_FAILED, sessionStage_->UpdatePropertyWhenTriggerMode(nullptr));
 
     // Case 3: remote is nullptr
     sptr<SessionStageProxy> nullProxy = sptr<SessionStageProxy>::MakeSptr(nullptr);
@@ -1844,7 +1844,7 @@ HWTEST_F(SessionStageStubTest, HandleUpdatePropertyWhenTriggerMode01, TestSize.L
     MessageOption option;
     data.WriteInterfaceToken(SessionStageStub::GetDescriptor());
     sptr<WindowSessionProperty> property = sptr<WindowSessionProperty>::MakeSptr();
-    data.WriteParcelable(property.GetRefPtr());
+    property->MarshallingTriggerModeDelta(data);
     uint32_t code = static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_PROPERTY_WHEN_TRIGGER_MODE);
     ASSERT_TRUE(sessionStageStub_ != nullptr);
     EXPECT_EQ(ERR_NONE, sessionStageStub_->OnRemoteRequest(code, data, reply, option));
@@ -14,7 +14,9 @@
  */
 
 #include "common/include/task_scheduler.h"
+#include <future>
 #include <gtest/gtest.h>
+#include <thread>
 
 using namespace testing;
 using namespace testing::ext;
@@ -27,6 +29,11 @@ public:
 };
 
 namespace {
+constexpr const char* PRODUCER_TASK_NAMES[] = {
+    "producerTask0", "producerTask1", "producerTask2", "producerTask3",
+    "producerTask4", "producerTask5", "producerTask6", "producerTask7",
+};
+
 /**
  * @tc.name: task_scheduler_test001
  * @tc.desc: normal function
@@ -155,6 +162,205 @@ HWTEST_F(TaskSchedulerTest, ExecuteExportTask, TestSize.Level1)
     taskScheduler->ExecuteExportTask();
     ASSERT_EQ(taskScheduler->exportFuncMap_.size(), 0);
 }
+
+/**
+ * @tc.name: PostCoalescedTask
+ * @tc.desc: pending tasks with the same name are executed only once
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, PostCoalescedTask, TestSize.Level1)
+{
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    taskScheduler->PostAsyncTask([gateFuture] { gateFuture.wait(); }, "gateTask");
+
+    std::vector<int> executed;
+    for (int i = 0; i < 5; i++) {
+        taskScheduler->PostCoalescedTask([&executed, i] { executed.push_back(i); }, "sameTask");
+    }
+    taskScheduler->PostCoalescedTask([&executed] { executed.push_back(100); }, "otherTask");
+    gate.set_value();
+    taskScheduler->PostVoidSyncTask([] {}, "flushTask");
+
+    ASSERT_EQ(executed.size(), 2);
+    EXPECT_EQ(executed[0], 4);
+    EXPECT_EQ(executed[1], 100);
+    EXPECT_EQ(taskScheduler->coalescedTaskHead_.load(), nullptr);
+}
+
+/**
+ * @tc.name: PostCoalescedTaskPostFailed
+ * @tc.desc: a batch whose drain task cannot be posted is dropped instead of blocking later posts
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, PostCoalescedTaskPostFailed, TestSize.Level1)
+{
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    auto handler = taskScheduler->handler_;
+    taskScheduler->handler_ = std::make_shared<AppExecFwk::EventHandler>(nullptr);
+    bool executed = false;
+    taskScheduler->PostCoalescedTask([&executed] { executed = true; }, "failedTask");
+    EXPECT_EQ(taskScheduler->coalescedTaskHead_.load(), nullptr);
+
+    taskScheduler->handler_ = handler;
+    taskScheduler->PostCoalescedTask([&executed] { executed = true; }, "failedTask");
+    taskScheduler->PostVoidSyncTask([] {}, "flushTask");
+    EXPECT_TRUE(executed);
+}
+
+/**
+ * @tc.name: PostCoalescedTaskDelayed
+ * @tc.desc: delayed tasks are batched separately and do not hold back immediate ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, PostCoalescedTaskDelayed, TestSize.Level1)
+{
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    std::atomic<int> delayedCount { 0 };
+    std::promise<void> delayedDone;
+    auto delayedFuture = delayedDone.get_future();
+    std::promise<void> immediateDone;
+    auto immediateFuture = immediateDone.get_future();
+    for (int i = 0; i < 5; i++) {
+        taskScheduler->PostCoalescedTask([&delayedCount, &delayedDone] {
+            if (++delayedCount == 1) {
+                delayedDone.set_value();
+            }
+        }, "delayedTask", 100);
+    }
+    taskScheduler->PostCoalescedTask([&immediateDone] { immediateDone.set_value(); }, "immediateTask");
+    EXPECT_EQ(immediateFuture.wait_for(std::chrono::milliseconds(50)), std::future_status::ready);
+    EXPECT_EQ(delayedCount.load(), 0);
+    ASSERT_EQ(delayedFuture.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    taskScheduler->PostVoidSyncTask([] {}, "flushTask");
+    EXPECT_EQ(delayedCount.load(), 1);
+    EXPECT_EQ(taskScheduler->delayedCoalescedTaskHead_.load(), nullptr);
+}
+
+/**
+ * @tc.name: PostCoalescedTaskMultiThread
+ * @tc.desc: tasks posted from multiple producer threads are all drained
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, PostCoalescedTaskMultiThread, TestSize.Level1)
+{
+    constexpr int producerNum = 8;
+    constexpr int taskNumPerProducer = 1000;
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    std::vector<int> lastValues(producerNum, -1);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producerNum; producer++) {
+        producers.emplace_back([taskScheduler, &lastValues, producer] {
+            for (int i = 0; i < taskNumPerProducer; i++) {
+                taskScheduler->PostCoalescedTask([&lastValues, producer, i] {
+                    EXPECT_GT(i, lastValues[producer]);
+                    lastValues[producer] = i;
+                }, PRODUCER_TASK_NAMES[producer]);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    taskScheduler->PostVoidSyncTask([] {}, "flushTask");
+    for (int producer = 0; producer < producerNum; producer++) {
+        EXPECT_EQ(lastValues[producer], taskNumPerProducer - 1);
+    }
+}
+
+/**
+ * @tc.name: ExportTaskBatch
+ * @tc.desc: export tasks handed over while a batch is pending are merged into it
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, ExportTaskBatch, TestSize.Level1)
+{
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    auto eventRunner = AppExecFwk::EventRunner::Create("exportThread");
+    auto eventHandler = std::make_shared<AppExecFwk::EventHandler>(eventRunner);
+    taskScheduler->SetExportHandler(eventHandler);
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    eventHandler->PostTask([gateFuture] { gateFuture.wait(); }, "gateTask");
+
+    std::vector<int> executed;
+    taskScheduler->exportFuncMap_["taskA"] = [&executed] { executed.push_back(1); };
+    taskScheduler->ExecuteExportTask();
+    taskScheduler->exportFuncMap_["taskA"] = [&executed] { executed.push_back(2); };
+    taskScheduler->ExecuteExportTask();
+    EXPECT_EQ(taskScheduler->pendingExportTasks_.size(), 1);
+    gate.set_value();
+    eventHandler->PostSyncTask([] {}, "flushTask");
+
+    ASSERT_EQ(executed.size(), 1);
+    EXPECT_EQ(executed[0], 2);
+    auto stats = taskScheduler->GetExportTaskStats();
+    EXPECT_EQ(stats.batchCount, 1);
+    EXPECT_EQ(stats.taskCount, 1);
+    EXPECT_EQ(stats.coalescedCount, 1);
+    EXPECT_GE(stats.maxQueueLatencyUs, 0);
+}
+
+/**
+ * @tc.name: ExportTaskBatchOrder
+ * @tc.desc: merged export tasks run in handover order and a replaced task moves to the tail
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, ExportTaskBatchOrder, TestSize.Level1)
+{
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    auto eventRunner = AppExecFwk::EventRunner::Create("exportThread");
+    auto eventHandler = std::make_shared<AppExecFwk::EventHandler>(eventRunner);
+    taskScheduler->SetExportHandler(eventHandler);
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    eventHandler->PostTask([gateFuture] { gateFuture.wait(); }, "gateTask");
+
+    std::vector<std::string> executed;
+    taskScheduler->exportFuncMap_["taskA"] = [&executed] { executed.push_back("A1"); };
+    taskScheduler->ExecuteExportTask();
+    taskScheduler->exportFuncMap_["taskB"] = [&executed] { executed.push_back("B"); };
+    taskScheduler->ExecuteExportTask();
+    taskScheduler->exportFuncMap_["taskC"] = [&executed] { executed.push_back("C"); };
+    taskScheduler->ExecuteExportTask();
+    taskScheduler->exportFuncMap_["taskA"] = [&executed] { executed.push_back("A2"); };
+    taskScheduler->ExecuteExportTask();
+    gate.set_value();
+    eventHandler->PostSyncTask([] {}, "flushTask");
+
+    std::vector<std::string> expected = { "B", "C", "A2" };
+    EXPECT_EQ(executed, expected);
+    EXPECT_TRUE(taskScheduler->pendingExportTaskIndex_.empty());
+}
+
+/**
+ * @tc.name: ExportTaskBatchPostFailed
+ * @tc.desc: a batch that cannot be posted runs inline and does not block later batches
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, ExportTaskBatchPostFailed, TestSize.Level1)
+{
+    std::string threadName = "threadName";
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>(threadName);
+    taskScheduler->SetExportHandler(std::make_shared<AppExecFwk::EventHandler>(nullptr));
+    std::vector<std::string> executed;
+    taskScheduler->exportFuncMap_["taskA"] = [&executed] { executed.push_back("A"); };
+    taskScheduler->ExecuteExportTask();
+    EXPECT_EQ(executed, std::vector<std::string>({ "A" }));
+    EXPECT_FALSE(taskScheduler->exportBatchPending_);
+
+    taskScheduler->exportFuncMap_["taskB"] = [&executed] { executed.push_back("B"); };
+    taskScheduler->ExecuteExportTask();
+    EXPECT_EQ(executed, std::vector<std::string>({ "A", "B" }));
+    EXPECT_TRUE(taskScheduler->pendingExportTasks_.empty());
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
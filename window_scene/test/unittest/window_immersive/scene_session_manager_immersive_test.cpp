@@ -174,6 +174,48 @@ HWTEST_F(SceneSessionManagerImmersiveTest, UpdateAvoidSessionAvoidArea, TestSize
     sleep(1);
 }
 
+/**
+ * @tc.name: RefreshAvoidAreaSourceVersion
+ * @tc.desc: the source version only moves when status bar geometry changes, sessions on other displays are skipped
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerImmersiveTest, RefreshAvoidAreaSourceVersion, TestSize.Level1)
+{
+    ASSERT_NE(nullptr, ssm_);
+    ssm_->avoidAreaSourceCache_.clear();
+    ssm_->avoidAreaSourceStampMap_.clear();
+    SessionInfo info;
+    info.abilityName_ = "RefreshAvoidAreaSourceVersion";
+    sptr<SceneSession> statusBar = sptr<SceneSession>::MakeSptr(info, nullptr);
+    statusBar->persistentId_ = 1001;
+    statusBar->property_->SetWindowType(WindowType::WINDOW_TYPE_STATUS_BAR);
+    statusBar->property_->SetDisplayId(0);
+    statusBar->SetSessionRect({ 0, 0, 1260, 100 });
+    ssm_->sceneSessionMap_.insert({ statusBar->GetPersistentId(), statusBar });
+
+    EXPECT_TRUE(ssm_->RefreshAvoidAreaSourceVersion(AvoidAreaType::TYPE_SYSTEM, 0));
+    EXPECT_FALSE(ssm_->RefreshAvoidAreaSourceVersion(AvoidAreaType::TYPE_SYSTEM, 0));
+    statusBar->SetSessionRect({ 0, 0, 1260, 120 });
+    EXPECT_TRUE(ssm_->RefreshAvoidAreaSourceVersion(AvoidAreaType::TYPE_SYSTEM, 0));
+    EXPECT_EQ(ssm_->avoidAreaSourceCache_[{ 0, AvoidAreaType::TYPE_SYSTEM }].version, 2);
+
+    sptr<SceneSession> appSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    appSession->persistentId_ = 1002;
+    appSession->property_->SetDisplayId(1);
+    EXPECT_TRUE(ssm_->CheckAndUpdateAvoidAreaSourceStamp(appSession, AvoidAreaType::TYPE_SYSTEM));
+    statusBar->SetSessionRect({ 0, 0, 1260, 100 });
+    EXPECT_TRUE(ssm_->RefreshAvoidAreaSourceVersion(AvoidAreaType::TYPE_SYSTEM, 0));
+    EXPECT_FALSE(ssm_->CheckAndUpdateAvoidAreaSourceStamp(appSession, AvoidAreaType::TYPE_SYSTEM));
+    appSession->property_->SetDisplayId(0);
+    EXPECT_TRUE(ssm_->CheckAndUpdateAvoidAreaSourceStamp(appSession, AvoidAreaType::TYPE_SYSTEM));
+
+    /* moving the bar to another display changes both displays */
+    statusBar->property_->SetDisplayId(1);
+    EXPECT_TRUE(ssm_->RefreshAvoidAreaSourceVersion(AvoidAreaType::TYPE_SYSTEM, 1));
+    EXPECT_TRUE(ssm_->avoidAreaSourceCache_[{ 0, AvoidAreaType::TYPE_SYSTEM }].sources.empty());
+    ssm_->sceneSessionMap_.erase(statusBar->GetPersistentId());
+}
+
 /**
  * @tc.name: PreloadInLakeApp、UpdateSessionAvoidAreaListener
  * @tc.desc: PreloadInLakeApp、UpdateSessionAvoidAreaListener
@@ -20,9 +20,11 @@
 #include "iremote_object_mocker.h"
 #include "interfaces/include/ws_common.h"
 #include "session_manager/include/scene_session_manager.h"
+#include "session_manager/include/session_manager_agent_controller.h"
 #include "session_manager/include/zidl/scene_session_manager_proxy.h"
 #include "session_info.h"
 #include "session/host/include/scene_session.h"
+#include "window_manager_agent.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -484,6 +486,32 @@ HWTEST_F(WindowManagerServiceDumpTest, GetSCBDebugDumpInfo02, TestSize.Level1)
     ASSERT_EQ(WSError::WS_OK, result);
     ASSERT_FALSE(infos.empty());
 }
+
+/**
+ * @tc.name: GetTaskStatsDumpInfo
+ * @tc.desc: GetTaskStatsDumpInfo dumps the snapshot persist, export task and agent notify stats
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowManagerServiceDumpTest, GetTaskStatsDumpInfo, TestSize.Level1)
+{
+    std::string dumpInfo;
+    EXPECT_EQ(WSError::WS_OK, ssm_->GetTaskStatsDumpInfo(dumpInfo));
+    EXPECT_NE(dumpInfo.find("Snapshot persist"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("persist latency"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("Export task"), std::string::npos);
+
+    sptr<IWindowManagerAgent> windowManagerAgent = sptr<WindowManagerAgent>::MakeSptr();
+    WindowManagerAgentType type = WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY;
+    int32_t pid = 65535;
+    ASSERT_EQ(WMError::WM_OK,
+        SessionManagerAgentController::GetInstance().RegisterWindowManagerAgent(windowManagerAgent, type, pid));
+    SessionManagerAgentController::GetInstance().UpdateWindowVisibilityInfo({});
+    dumpInfo.clear();
+    EXPECT_EQ(WSError::WS_OK, ssm_->GetTaskStatsDumpInfo(dumpInfo));
+    EXPECT_NE(dumpInfo.find("Agent notify: pid 65535"), std::string::npos);
+    EXPECT_EQ(WMError::WM_OK,
+        SessionManagerAgentController::GetInstance().UnregisterWindowManagerAgent(windowManagerAgent, type, pid));
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -3012,6 +3012,44 @@ HWTEST_F(WindowSessionPropertyTest, UnmarshallingSupportWindowModes004, TestSize
     property->GetSupportedWindowModes(supportModeResult);
     EXPECT_EQ(supportModeResult.size(), 1);
 }
+
+/**
+ * @tc.name: TriggerModeDelta
+ * @tc.desc: test the trigger mode delta round trip and its size against the whole property
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowSessionPropertyTest, TriggerModeDelta, TestSize.Level1)
+{
+    sptr<WindowSessionProperty> property = sptr<WindowSessionProperty>::MakeSptr();
+    property->SetPersistentId(10);
+    property->SetWindowName("TriggerModeDelta");
+    property->SetIsPcAppInPad(true);
+    property->SetPcAppInpadOrientationLandscape(true);
+    property->SetMobileAppInPadLayoutFullScreen(true);
+
+    Parcel deltaParcel;
+    ASSERT_TRUE(property->MarshallingTriggerModeDelta(deltaParcel));
+    Parcel fullParcel;
+    ASSERT_TRUE(property->Marshalling(fullParcel));
+    Parcel actionParcel;
+    ASSERT_TRUE(property->Write(actionParcel, WSPropertyChangeAction::ACTION_UPDATE_FOCUSABLE));
+    EXPECT_EQ(deltaParcel.GetDataSize(), sizeof(int32_t) + sizeof(uint32_t));
+    EXPECT_LT(deltaParcel.GetDataSize() * 10, fullParcel.GetDataSize());
+    EXPECT_LT(actionParcel.GetDataSize() * 10, fullParcel.GetDataSize());
+
+    sptr<WindowSessionProperty> result = sptr<WindowSessionProperty>::MakeSptr();
+    ASSERT_TRUE(WindowSessionProperty::UnmarshallingTriggerModeDelta(deltaParcel, result.GetRefPtr()));
+    EXPECT_EQ(10, result->GetPersistentId());
+    EXPECT_TRUE(result->GetIsPcAppInPad());
+    EXPECT_FALSE(result->GetPcAppInpadCompatibleMode());
+    EXPECT_FALSE(result->GetPcAppInpadSpecificSystemBarInvisible());
+    EXPECT_TRUE(result->GetPcAppInpadOrientationLandscape());
+    EXPECT_TRUE(result->GetMobileAppInPadLayoutFullScreen());
+
+    Parcel emptyParcel;
+    EXPECT_FALSE(WindowSessionProperty::UnmarshallingTriggerModeDelta(emptyParcel, result.GetRefPtr()));
+    EXPECT_FALSE(WindowSessionProperty::UnmarshallingTriggerModeDelta(deltaParcel, nullptr));
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
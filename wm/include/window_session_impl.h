@@ -31,6 +31,7 @@
 #include "singleton_container.h"
 
 #include "common/include/window_session_property.h"
+#include "cow_listener_registry.h"
 #include "display_info.h"
 #include "future_callback.h"
 #include "interfaces/include/ws_common.h"
@@ -792,48 +793,28 @@ protected:
     }
  
     template<typename T>
-    WMError UnregisterListenerInMap(std::map<int32_t, std::vector<sptr<T>>>& listenerMap,
-        int32_t persistentId, const sptr<T>& listener)
+    WMError RegisterListener(CowListenerRegistry<T>& registry, int32_t persistentId, const T& listener)
     {
-        if (listener == nullptr) {
-            TLOGE(WmsLogTag::DEFAULT, "listener could not be null");
-            return WMError::WM_ERROR_NULLPTR;
-        }
-        auto it = listenerMap.find(persistentId);
-        if (it == listenerMap.end()) {
-            return WMError::WM_OK;
-        }
-        return UnregisterListener(listenerMap[persistentId], listener);
-    }
- 
-    template<typename T>
-    WMError UnregisterListenerInMap(std::unordered_map<int32_t, std::vector<sptr<T>>>& listenerMap,
-        int32_t persistentId, const sptr<T>& listener)
-    {
-        if (listener == nullptr) {
-            TLOGE(WmsLogTag::DEFAULT, "listener could not be null");
+        if (CowListenerKey<T>::Get(listener) == nullptr) {
+            TLOGE(WmsLogTag::DEFAULT, "listener is null");
             return WMError::WM_ERROR_NULLPTR;
         }
-        auto it = listenerMap.find(persistentId);
-        if (it == listenerMap.end()) {
-            return WMError::WM_OK;
+        if (!registry.Register(persistentId, listener)) {
+            TLOGE(WmsLogTag::DEFAULT, "already registered");
         }
-        return UnregisterListener(listenerMap[persistentId], listener);
+        return WMError::WM_OK;
     }
 
     template<typename T>
-    WMError UnregisterListenerInMap(std::map<int32_t, std::vector<std::pair<sptr<T>, bool>>>& listenerMap,
-        int32_t persistentId, const sptr<T>& listener)
+    WMError UnregisterListener(CowListenerRegistry<T>& registry, int32_t persistentId,
+        const typename CowListenerRegistry<T>::KeyType& listener)
     {
         if (listener == nullptr) {
             TLOGE(WmsLogTag::DEFAULT, "listener could not be null");
             return WMError::WM_ERROR_NULLPTR;
         }
-        auto it = listenerMap.find(persistentId);
-        if (it == listenerMap.end()) {
-            return WMError::WM_OK;
-        }
-        return UnregisterListener(listenerMap[persistentId], listener);
+        registry.Unregister(persistentId, listener);
+        return WMError::WM_OK;
     }
     void ClearListenersById(int32_t persistentId);
     void ClearParentWindowListeners(int32_t persistentId);
@@ -843,7 +824,8 @@ protected:
             WMErrorReason errCode, const std::string& reason) const;
 
     template<typename T>
-    EnableIfSame<T, IWindowStatusChangeListener, std::vector<sptr<IWindowStatusChangeListener>>> GetListeners();
+    EnableIfSame<T, IWindowStatusChangeListener,
+        CowListenerRegistry<sptr<IWindowStatusChangeListener>>::ListenerListPtr> GetListeners();
 
     /*
      * Free Multi Window
@@ -1080,7 +1062,8 @@ protected:
     std::atomic<CrossAxisState> crossAxisState_ = CrossAxisState::STATE_INVALID;
     bool IsValidCrossState(int32_t state) const;
     template <typename T>
-    EnableIfSame<T, IWindowCrossAxisListener, std::vector<sptr<IWindowCrossAxisListener>>> GetListeners();
+    EnableIfSame<T, IWindowCrossAxisListener,
+        CowListenerRegistry<sptr<IWindowCrossAxisListener>>::ListenerListPtr> GetListeners();
     void NotifyWindowStatusDidChange(WindowMode mode);
     void NotifyFirstValidLayoutUpdate(const Rect& preRect, const Rect& newRect);
     std::atomic_bool hasSetEnableDrag_ = false;
@@ -1111,7 +1094,7 @@ protected:
     bool isAcrossDisplays_ = false;
     WMError NotifyAcrossDisplaysChange(bool isAcrossDisplays);
     void NotifyWaterfallModeChange(bool isWaterfallMode);
-    std::vector<sptr<IWaterfallModeChangeListener>> GetWaterfallModeChangeListeners();
+    CowListenerRegistry<sptr<IWaterfallModeChangeListener>>::ListenerListPtr GetWaterfallModeChangeListeners();
 
     /*
      * Window Pattern
@@ -1142,7 +1125,7 @@ protected:
     bool GetWatchGestureConsumed() const;
     void SetWatchGestureConsumed(bool isWatchGestureConsumed);
     bool dialogSessionBackGestureEnabled_ = false;
-    static std::map<int32_t, std::vector<sptr<ITouchOutsideListener>>> touchOutsideListeners_;
+    static CowListenerRegistry<sptr<ITouchOutsideListener>> touchOutsideListeners_;
     /*
      * Window Rotation
      */
@@ -1184,87 +1167,119 @@ private:
     static ColorSpace GetColorSpaceFromSurfaceGamut(GraphicColorGamut colorGamut);
     static GraphicColorGamut GetSurfaceGamutFromColorSpace(ColorSpace colorSpace);
 
-    template<typename T> EnableIfSame<T, IWindowLifeCycle, std::vector<sptr<IWindowLifeCycle>>> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowStageLifeCycle, std::vector<sptr<IWindowStageLifeCycle>>> GetListeners();
-    template<typename T> EnableIfSame<T, IDisplayMoveListener, std::vector<sptr<IDisplayMoveListener>>> GetListeners();
+    EnableIfSame<T, IWindowLifeCycle,
+        CowListenerRegistry<sptr<IWindowLifeCycle>>::ListenerListPtr> GetListeners();
+    template<typename T>
+    EnableIfSame<T, IWindowStageLifeCycle,
+        CowListenerRegistry<sptr<IWindowStageLifeCycle>>::ListenerListPtr> GetListeners();
+    template<typename T>
+    EnableIfSame<T, IDisplayMoveListener,
+        CowListenerRegistry<sptr<IDisplayMoveListener>>::ListenerListPtr> GetListeners();
     template<typename T>
     EnableIfSame<T, IWindowChangeListener,
-        std::vector<std::pair<sptr<IWindowChangeListener>, bool>>> GetListeners();
+        CowListenerRegistry<std::pair<sptr<IWindowChangeListener>, bool>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IAvoidAreaChangedListener, std::vector<sptr<IAvoidAreaChangedListener>>> GetListeners();
+    EnableIfSame<T, IAvoidAreaChangedListener,
+        CowListenerRegistry<sptr<IAvoidAreaChangedListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IDialogDeathRecipientListener, std::vector<sptr<IDialogDeathRecipientListener>>> GetListeners();
+    EnableIfSame<T, IDialogDeathRecipientListener,
+        CowListenerRegistry<sptr<IDialogDeathRecipientListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IDialogTargetTouchListener, std::vector<sptr<IDialogTargetTouchListener>>> GetListeners();
+    EnableIfSame<T, IDialogTargetTouchListener,
+        CowListenerRegistry<sptr<IDialogTargetTouchListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IOccupiedAreaChangeListener, std::vector<sptr<IOccupiedAreaChangeListener>>> GetListeners();
+    EnableIfSame<T, IOccupiedAreaChangeListener,
+        CowListenerRegistry<sptr<IOccupiedAreaChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IKeyboardDidShowListener, std::vector<sptr<IKeyboardDidShowListener>>> GetListeners();
+    EnableIfSame<T, IKeyboardDidShowListener,
+        CowListenerRegistry<sptr<IKeyboardDidShowListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IKeyboardDidHideListener, std::vector<sptr<IKeyboardDidHideListener>>> GetListeners();
+    EnableIfSame<T, IKeyboardDidHideListener,
+        CowListenerRegistry<sptr<IKeyboardDidHideListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IKBWillShowListener, std::vector<sptr<IKBWillShowListener>>> GetListeners();
+    EnableIfSame<T, IKBWillShowListener,
+        CowListenerRegistry<sptr<IKBWillShowListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IKBWillHideListener, std::vector<sptr<IKBWillHideListener>>> GetListeners();
+    EnableIfSame<T, IKBWillHideListener,
+        CowListenerRegistry<sptr<IKBWillHideListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IScreenshotListener, std::vector<sptr<IScreenshotListener>>> GetListeners();
+    EnableIfSame<T, IScreenshotListener,
+        CowListenerRegistry<sptr<IScreenshotListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IScreenshotAppEventListener, std::vector<IScreenshotAppEventListenerSptr>> GetListeners();
+    EnableIfSame<T, IScreenshotAppEventListener,
+        CowListenerRegistry<IScreenshotAppEventListenerSptr>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, ITouchOutsideListener, std::vector<sptr<ITouchOutsideListener>>> GetListeners();
+    EnableIfSame<T, ITouchOutsideListener,
+        CowListenerRegistry<sptr<ITouchOutsideListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowVisibilityChangedListener, std::vector<IWindowVisibilityListenerSptr>> GetListeners();
+    EnableIfSame<T, IWindowVisibilityChangedListener,
+        CowListenerRegistry<IWindowVisibilityListenerSptr>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IDisplayIdChangeListener, std::vector<IDisplayIdChangeListenerSptr>> GetListeners();
+    EnableIfSame<T, IDisplayIdChangeListener,
+        CowListenerRegistry<IDisplayIdChangeListenerSptr>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, ISystemDensityChangeListener, std::vector<ISystemDensityChangeListenerSptr>> GetListeners();
+    EnableIfSame<T, ISystemDensityChangeListener,
+        CowListenerRegistry<ISystemDensityChangeListenerSptr>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowDensityChangeListener, std::vector<IWindowDensityChangeListenerSptr>> GetListeners();
+    EnableIfSame<T, IWindowDensityChangeListener,
+        CowListenerRegistry<IWindowDensityChangeListenerSptr>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IAcrossDisplaysChangeListener, std::vector<IAcrossDisplaysChangeListenerSptr>> GetListeners();
+    EnableIfSame<T, IAcrossDisplaysChangeListener,
+        CowListenerRegistry<IAcrossDisplaysChangeListenerSptr>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowNoInteractionListener, std::vector<IWindowNoInteractionListenerSptr>> GetListeners();
+    EnableIfSame<T, IWindowNoInteractionListener,
+        CowListenerRegistry<IWindowNoInteractionListenerSptr>::ListenerListPtr> GetListeners();
     template<typename T> void ClearUselessListeners(std::map<int32_t, T>& listeners, int32_t persistentId);
     template<typename T> void ClearUselessListeners(std::unordered_map<int32_t, T>& listeners, int32_t persistentId);
     RSSurfaceNode::SharedPtr CreateSurfaceNode(const std::string& name, WindowType type);
     template<typename T>
-    EnableIfSame<T, IWindowStatusDidChangeListener, std::vector<sptr<IWindowStatusDidChangeListener>>> GetListeners();
+    EnableIfSame<T, IWindowStatusDidChangeListener,
+        CowListenerRegistry<sptr<IWindowStatusDidChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IParentWindowSizeChangeListener, std::vector<sptr<IParentWindowSizeChangeListener>>> GetListeners();
+    EnableIfSame<T, IParentWindowSizeChangeListener,
+        CowListenerRegistry<sptr<IParentWindowSizeChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IParentWindowStatusChangeListener, std::vector<sptr<IParentWindowStatusChangeListener>>>
-        GetListeners();
+    EnableIfSame<T, IParentWindowStatusChangeListener,
+        CowListenerRegistry<sptr<IParentWindowStatusChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
     EnableIfSame<T, IWindowRectChangeListener,
-        std::vector<std::pair<sptr<IWindowRectChangeListener>, bool>>> GetListeners();
+        CowListenerRegistry<std::pair<sptr<IWindowRectChangeListener>, bool>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowTitleChangeListener, std::vector<sptr<IWindowTitleChangeListener>>> GetListeners();
+    EnableIfSame<T, IWindowTitleChangeListener,
+        CowListenerRegistry<sptr<IWindowTitleChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowTitleOrHotAreasListener, std::vector<sptr<IWindowTitleOrHotAreasListener>>> GetListeners();
+    EnableIfSame<T, IWindowTitleOrHotAreasListener,
+        CowListenerRegistry<sptr<IWindowTitleOrHotAreasListener>>::ListenerListPtr> GetListeners();
     template<typename T>
     EnableIfSame<T, IRectChangeInGlobalDisplayListener,
-        std::vector<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>>
+        CowListenerRegistry<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>::ListenerListPtr>
         GetListeners();
     template<typename T>
-    EnableIfSame<T, IExtensionSecureLimitChangeListener, std::vector<sptr<IExtensionSecureLimitChangeListener>>>
-        GetListeners();
+    EnableIfSame<T, IExtensionSecureLimitChangeListener,
+        CowListenerRegistry<sptr<IExtensionSecureLimitChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
     EnableIfSame<T, IPreferredOrientationChangeListener, sptr<IPreferredOrientationChangeListener>> GetListeners();
     template<typename T>
     EnableIfSame<T, IWindowOrientationChangeListener, sptr<IWindowOrientationChangeListener>> GetListeners();
     template<typename T>
-    EnableIfSame<T, ISwitchFreeMultiWindowListener, std::vector<sptr<ISwitchFreeMultiWindowListener>>> GetListeners();
+    EnableIfSame<T, ISwitchFreeMultiWindowListener,
+        CowListenerRegistry<sptr<ISwitchFreeMultiWindowListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowHighlightChangeListener, std::vector<sptr<IWindowHighlightChangeListener>>> GetListeners();
+    EnableIfSame<T, IWindowHighlightChangeListener,
+        CowListenerRegistry<sptr<IWindowHighlightChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowRotationChangeListener, std::vector<sptr<IWindowRotationChangeListener>>> GetListeners();
+    EnableIfSame<T, IWindowRotationChangeListener,
+        CowListenerRegistry<sptr<IWindowRotationChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IFreeWindowModeChangeListener, std::vector<sptr<IFreeWindowModeChangeListener>>> GetListeners();
+    EnableIfSame<T, IFreeWindowModeChangeListener,
+        CowListenerRegistry<sptr<IFreeWindowModeChangeListener>>::ListenerListPtr> GetListeners();
     template<typename T>
- 	EnableIfSame<T, IParentLifecycleEventListener, std::vector<sptr<IParentLifecycleEventListener>>> GetListeners();
+    EnableIfSame<T, IParentLifecycleEventListener,
+        CowListenerRegistry<sptr<IParentLifecycleEventListener>>::ListenerListPtr> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowHoverStateChangeListener, std::vector<sptr<IWindowHoverStateChangeListener>>> GetListeners();
+    EnableIfSame<T, IWindowHoverStateChangeListener,
+        CowListenerRegistry<sptr<IWindowHoverStateChangeListener>>::ListenerListPtr> GetListeners();
     void ProcessUpdateFocus(const sptr<FocusNotifyInfo>& focusNotifyInfo, bool isFocused);
     void ProcessNotifyHighlightChange(const sptr<HighlightNotifyInfo>& highlightNotifyInfo, bool isHighlight);
     void NotifyAfterFocused();
@@ -1279,13 +1294,14 @@ private:
      */
     template<typename T>
     EnableIfSame<T, IWindowTitleButtonRectChangedListener,
-        std::vector<sptr<IWindowTitleButtonRectChangedListener>>> GetListeners();
+        CowListenerRegistry<sptr<IWindowTitleButtonRectChangedListener>>::ListenerListPtr> GetListeners();
     template<typename T>
     EnableIfSame<T, ISubWindowCloseListener, sptr<ISubWindowCloseListener>> GetListeners();
     template<typename T>
     EnableIfSame<T, IMainWindowCloseListener, sptr<IMainWindowCloseListener>> GetListeners();
     template<typename T>
-    EnableIfSame<T, IWindowWillCloseListener, std::vector<sptr<IWindowWillCloseListener>>> GetListeners();
+    EnableIfSame<T, IWindowWillCloseListener,
+        CowListenerRegistry<sptr<IWindowWillCloseListener>>::ListenerListPtr> GetListeners();
     std::unique_ptr<Ace::UIContent> UIContentCreate(AppExecFwk::Ability* ability, void* env, int isAni);
     Ace::UIContentErrorCode UIContentInitByName(Ace::UIContent*, const std::string&, void* storage, int isAni);
     template<typename T>
@@ -1342,18 +1358,11 @@ private:
      * PC Fold Screen
      */
     bool waterfallModeWhenEnterBackground_ { false };
-    static std::mutex waterfallModeChangeListenerMutex_;
-    static std::unordered_map<int32_t, std::vector<sptr<IWaterfallModeChangeListener>>> waterfallModeChangeListeners_;
+    static CowListenerRegistry<sptr<IWaterfallModeChangeListener>> waterfallModeChangeListeners_;
     bool InitWaterfallMode();
 
-    static std::recursive_mutex lifeCycleListenerMutex_;
     static std::recursive_mutex windowStageLifeCycleListenerMutex_;
-    static std::recursive_mutex windowChangeListenerMutex_;
-    static std::recursive_mutex windowCrossAxisListenerMutex_;
     static std::recursive_mutex avoidAreaChangeListenerMutex_;
-    static std::recursive_mutex dialogDeathRecipientListenerMutex_;
-    static std::recursive_mutex dialogTargetTouchListenerMutex_;
-    static std::recursive_mutex occupiedAreaChangeListenerMutex_;
     static std::recursive_mutex keyboardWillShowListenerMutex_;
     static std::recursive_mutex keyboardWillHideListenerMutex_;
     static std::recursive_mutex keyboardDidShowListenerMutex_;
@@ -1362,74 +1371,55 @@ private:
     static std::recursive_mutex touchOutsideListenerMutex_;
     static std::recursive_mutex windowVisibilityChangeListenerMutex_;
     static std::recursive_mutex windowNoInteractionListenerMutex_;
-    static std::recursive_mutex windowStatusChangeListenerMutex_;
-    static std::recursive_mutex windowStatusDidChangeListenerMutex_;
-    static std::recursive_mutex parentWindowSizeChangeListenerMutex_;
-    static std::recursive_mutex parentWindowStatusChangeListenerMutex_;
     static std::recursive_mutex windowHoverStateChangeListenerMutex_;
-    static std::mutex displayMoveListenerMutex_;
-    static std::mutex windowRectChangeListenerMutex_;
-    static std::mutex windowTitleChangeListenerMutex_;
-    static std::mutex windowTitleOrHotAreasListenerMutex_;
-    static std::mutex rectChangeInGlobalDisplayListenerMutex_;
-    static std::mutex secureLimitChangeListenerMutex_;
-    static std::mutex switchFreeMultiWindowListenerMutex_;
     static std::mutex preferredOrientationChangeListenerMutex_;
     static std::mutex windowOrientationChangeListenerMutex_;
-    static std::mutex highlightChangeListenerMutex_;
-    static std::mutex freeWindowModeChangeListenerMutex_;
-    static std::mutex parentLifecycleEventListenerMutex_;
     static std::mutex windowRotationChangeListenerMutex_;
     static std::mutex occlusionStateChangeListenerMutex_;
-    static std::unordered_map<int32_t,
-        std::vector<sptr<IOcclusionStateChangedListener>>> occlusionStateChangeListeners_;
+    static CowListenerRegistry<sptr<IOcclusionStateChangedListener>> occlusionStateChangeListeners_;
     static std::mutex frameMetricsChangeListenerMutex_;
-    static std::unordered_map<int32_t, std::vector<sptr<IFrameMetricsChangedListener>>> frameMetricsChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowLifeCycle>>> lifecycleListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowStageLifeCycle>>> windowStageLifecycleListeners_;
-    static std::map<int32_t, std::vector<sptr<IDisplayMoveListener>>> displayMoveListeners_;
-    static std::map<int32_t, std::vector<std::pair<sptr<IWindowChangeListener>, bool>>> windowChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowCrossAxisListener>>> windowCrossAxisListeners_;
-    static std::map<int32_t, std::vector<sptr<IAvoidAreaChangedListener>>> avoidAreaChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IDialogDeathRecipientListener>>> dialogDeathRecipientListeners_;
-    static std::map<int32_t, std::vector<sptr<IDialogTargetTouchListener>>> dialogTargetTouchListener_;
-    static std::map<int32_t, std::vector<sptr<IOccupiedAreaChangeListener>>> occupiedAreaChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IKBWillShowListener>>> keyboardWillShowListeners_;
-    static std::map<int32_t, std::vector<sptr<IKBWillHideListener>>> keyboardWillHideListeners_;
-    static std::map<int32_t, std::vector<sptr<IKeyboardDidShowListener>>> keyboardDidShowListeners_;
-    static std::map<int32_t, std::vector<sptr<IKeyboardDidHideListener>>> keyboardDidHideListeners_;
-    static std::map<int32_t, std::vector<sptr<IScreenshotListener>>> screenshotListeners_;
+    static CowListenerRegistry<sptr<IFrameMetricsChangedListener>> frameMetricsChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowLifeCycle>> lifecycleListeners_;
+    static CowListenerRegistry<sptr<IWindowStageLifeCycle>> windowStageLifecycleListeners_;
+    static CowListenerRegistry<sptr<IDisplayMoveListener>> displayMoveListeners_;
+    static CowListenerRegistry<std::pair<sptr<IWindowChangeListener>, bool>> windowChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowCrossAxisListener>> windowCrossAxisListeners_;
+    static CowListenerRegistry<sptr<IAvoidAreaChangedListener>> avoidAreaChangeListeners_;
+    static CowListenerRegistry<sptr<IDialogDeathRecipientListener>> dialogDeathRecipientListeners_;
+    static CowListenerRegistry<sptr<IDialogTargetTouchListener>> dialogTargetTouchListener_;
+    static CowListenerRegistry<sptr<IOccupiedAreaChangeListener>> occupiedAreaChangeListeners_;
+    static CowListenerRegistry<sptr<IKBWillShowListener>> keyboardWillShowListeners_;
+    static CowListenerRegistry<sptr<IKBWillHideListener>> keyboardWillHideListeners_;
+    static CowListenerRegistry<sptr<IKeyboardDidShowListener>> keyboardDidShowListeners_;
+    static CowListenerRegistry<sptr<IKeyboardDidHideListener>> keyboardDidHideListeners_;
+    static CowListenerRegistry<sptr<IScreenshotListener>> screenshotListeners_;
     static std::recursive_mutex screenshotAppEventListenerMutex_;
-    static std::unordered_map<int32_t, std::vector<IScreenshotAppEventListenerSptr>> screenshotAppEventListeners_;
-    static std::map<int32_t, std::vector<IWindowVisibilityListenerSptr>> windowVisibilityChangeListeners_;
-    static std::mutex displayIdChangeListenerMutex_;
-    static std::map<int32_t, std::vector<IDisplayIdChangeListenerSptr>> displayIdChangeListeners_;
-    static std::mutex systemDensityChangeListenerMutex_;
-    static std::unordered_map<int32_t, std::vector<ISystemDensityChangeListenerSptr>> systemDensityChangeListeners_;
-    static std::mutex windowDensityChangeListenerMutex_;
-    static std::unordered_map<int32_t, std::vector<IWindowDensityChangeListenerSptr>> windowDensityChangeListeners_;
+    static CowListenerRegistry<IScreenshotAppEventListenerSptr> screenshotAppEventListeners_;
+    static CowListenerRegistry<IWindowVisibilityListenerSptr> windowVisibilityChangeListeners_;
+    static CowListenerRegistry<IDisplayIdChangeListenerSptr> displayIdChangeListeners_;
+    static CowListenerRegistry<ISystemDensityChangeListenerSptr> systemDensityChangeListeners_;
+    static CowListenerRegistry<IWindowDensityChangeListenerSptr> windowDensityChangeListeners_;
     static std::recursive_mutex acrossDisplaysChangeListenerMutex_;
-    static std::unordered_map<int32_t, std::vector<IAcrossDisplaysChangeListenerSptr>>
-        acrossDisplaysChangeListeners_;
-    static std::map<int32_t, std::vector<IWindowNoInteractionListenerSptr>> windowNoInteractionListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowStatusChangeListener>>> windowStatusChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowStatusDidChangeListener>>> windowStatusDidChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IParentWindowSizeChangeListener>>> parentWindowSizeChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IParentWindowStatusChangeListener>>> parentWindowStatusChangeListeners_;
-    static std::map<int32_t, std::vector<std::pair<sptr<IWindowRectChangeListener>, bool>>> windowRectChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowTitleChangeListener>>> windowTitleChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowTitleOrHotAreasListener>>> windowTitleOrHotAreasListeners_;
-    static std::map<int32_t, std::vector<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>>
+    static CowListenerRegistry<IAcrossDisplaysChangeListenerSptr> acrossDisplaysChangeListeners_;
+    static CowListenerRegistry<IWindowNoInteractionListenerSptr> windowNoInteractionListeners_;
+    static CowListenerRegistry<sptr<IWindowStatusChangeListener>> windowStatusChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowStatusDidChangeListener>> windowStatusDidChangeListeners_;
+    static CowListenerRegistry<sptr<IParentWindowSizeChangeListener>> parentWindowSizeChangeListeners_;
+    static CowListenerRegistry<sptr<IParentWindowStatusChangeListener>> parentWindowStatusChangeListeners_;
+    static CowListenerRegistry<std::pair<sptr<IWindowRectChangeListener>, bool>> windowRectChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowTitleChangeListener>> windowTitleChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowTitleOrHotAreasListener>> windowTitleOrHotAreasListeners_;
+    static CowListenerRegistry<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>
         rectChangeInGlobalDisplayListeners_;
-    static std::map<int32_t, std::vector<sptr<IExtensionSecureLimitChangeListener>>> secureLimitChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<ISwitchFreeMultiWindowListener>>> switchFreeMultiWindowListeners_;
+    static CowListenerRegistry<sptr<IExtensionSecureLimitChangeListener>> secureLimitChangeListeners_;
+    static CowListenerRegistry<sptr<ISwitchFreeMultiWindowListener>> switchFreeMultiWindowListeners_;
     static std::map<int32_t, sptr<IPreferredOrientationChangeListener>> preferredOrientationChangeListener_;
     static std::map<int32_t, sptr<IWindowOrientationChangeListener>> windowOrientationChangeListener_;
-    static std::map<int32_t, std::vector<sptr<IWindowHighlightChangeListener>>> highlightChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowRotationChangeListener>>> windowRotationChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IFreeWindowModeChangeListener>>> freeWindowModeChangeListeners_;
-    static std::map<int32_t, std::vector<sptr<IParentLifecycleEventListener>>> parentLifecycleEventListeners_;
-    static std::map<int32_t, std::vector<sptr<IWindowHoverStateChangeListener>>> windowHoverStateChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowHighlightChangeListener>> highlightChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowRotationChangeListener>> windowRotationChangeListeners_;
+    static CowListenerRegistry<sptr<IFreeWindowModeChangeListener>> freeWindowModeChangeListeners_;
+    static CowListenerRegistry<sptr<IParentLifecycleEventListener>> parentLifecycleEventListeners_;
+    static CowListenerRegistry<sptr<IWindowHoverStateChangeListener>> windowHoverStateChangeListeners_;
 
     // FA only
     sptr<IAceAbilityHandler> aceAbilityHandler_;
@@ -1479,15 +1469,13 @@ private:
     /*
      * Window Decor listener
      */
-    static std::recursive_mutex windowTitleButtonRectChangeListenerMutex_;
-    static std::map<int32_t, std::vector<sptr<IWindowTitleButtonRectChangedListener>>>
-        windowTitleButtonRectChangeListeners_;
+    static CowListenerRegistry<sptr<IWindowTitleButtonRectChangedListener>> windowTitleButtonRectChangeListeners_;
     static std::mutex subWindowCloseListenersMutex_;
     static std::map<int32_t, sptr<ISubWindowCloseListener>> subWindowCloseListeners_;
     static std::mutex mainWindowCloseListenersMutex_;
     static std::map<int32_t, sptr<IMainWindowCloseListener>> mainWindowCloseListeners_;
     static std::recursive_mutex windowWillCloseListenersMutex_;
-    static std::unordered_map<int32_t, std::vector<sptr<IWindowWillCloseListener>>> windowWillCloseListeners_;
+    static CowListenerRegistry<sptr<IWindowWillCloseListener>> windowWillCloseListeners_;
 
     /*
      * Multi Window
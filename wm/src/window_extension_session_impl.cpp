@@ -637,7 +637,7 @@ WMError WindowExtensionSessionImpl::RegisterTouchOutsideListener(const sptr<ITou
     auto persistentId = GetPersistentId();
     {
         std::lock_guard<std::mutex> lockListener(touchOutsideListenerMutex_);
-        ret = RegisterListener(touchOutsideListeners_[persistentId], listener);
+        ret = RegisterListener(touchOutsideListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
@@ -660,11 +660,11 @@ WMError WindowExtensionSessionImpl::UnregisterTouchOutsideListener(const sptr<IT
     auto persistentId = GetPersistentId();
     {
         std::lock_guard<std::mutex> lockListener(touchOutsideListenerMutex_);
-        ret = UnregisterListener(touchOutsideListeners_[persistentId], listener);
+        ret = UnregisterListener(touchOutsideListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        needNotifyHost = touchOutsideListeners_[persistentId].empty() && touchOutsideUIExtListenerIds_.empty();
+        needNotifyHost = !touchOutsideListeners_.HasListeners(persistentId) && touchOutsideUIExtListenerIds_.empty();
     }
     if (needNotifyHost) {
         AAFwk::Want want;
@@ -2388,14 +2388,14 @@ WMError WindowExtensionSessionImpl::HandleUIExtUnregisterTouchOutsideListener(ui
     {
         std::lock_guard<std::mutex> lockListener(touchOutsideListenerMutex_);
         touchOutsideUIExtListenerIds_.erase(persistentId);
-        needNotifyHost = touchOutsideListeners_[persistentId].empty() && touchOutsideUIExtListenerIds_.empty();
+        needNotifyHost = !touchOutsideListeners_.HasListeners(persistentId) && touchOutsideUIExtListenerIds_.empty();
     }
     if (needNotifyHost) {
         return SendExtensionMessageToHost(code, data);
     }
     TLOGI(WmsLogTag::WMS_UIEXT, "No need to send message to host to unregister, size of "
         "listener: %{public}zu, size of touchOutsideUIExtListenerIds_: %{public}zu",
-        touchOutsideListeners_[persistentId].size(), touchOutsideUIExtListenerIds_.size());
+        touchOutsideListeners_.GetListenerCount(persistentId), touchOutsideUIExtListenerIds_.size());
     return WMError::WM_OK;
 }
 
@@ -2426,7 +2426,7 @@ WMError WindowExtensionSessionImpl::OnCrossAxisStateChange(AAFwk::Want&& data, s
     }
     TLOGI(WmsLogTag::WMS_UIEXT, "CrossAxisState:%{public}d", state);
     auto windowCrossAxisListeners = GetListeners<IWindowCrossAxisListener>();
-    for (const auto& listener : windowCrossAxisListeners) {
+    for (const auto& listener : *windowCrossAxisListeners) {
         if (listener != nullptr) {
             listener->OnCrossAxisChange(static_cast<CrossAxisState>(state));
         }
@@ -2455,7 +2455,7 @@ WMError WindowExtensionSessionImpl::OnWaterfallModeChange(AAFwk::Want&& data, st
             data, static_cast<uint8_t>(SubSystemId::WM_UIEXT));
     }
     auto waterfallModeChangeListeners = GetWaterfallModeChangeListeners();
-    for (const auto& listener : waterfallModeChangeListeners) {
+    for (const auto& listener : *waterfallModeChangeListeners) {
         if (listener != nullptr) {
             listener->OnWaterfallModeChange(isWaterfallMode);
         }
@@ -2856,7 +2856,7 @@ WMError WindowExtensionSessionImpl::OnHostWindowStatusChange(AAFwk::Want&& data,
     hostWindowStatus_ = windowStatus;
     TLOGI(WmsLogTag::WMS_UIEXT, "hostWindowStatus: %{public}u", windowStatus);
     auto windowStatusChangeListeners = GetListeners<IWindowStatusChangeListener>();
-    for (const auto& listener : windowStatusChangeListeners) {
+    for (const auto& listener : *windowStatusChangeListeners) {
         if (listener != nullptr) {
             listener->OnWindowStatusChange(hostWindowStatus_);
         }
@@ -2884,8 +2884,8 @@ void WindowExtensionSessionImpl::NotifyOccupiedAreaChange(sptr<OccupiedAreaChang
 WMError WindowExtensionSessionImpl::OnTouchOutside(AAFwk::Want&& data, std::optional<AAFwk::Want>& reply)
 {
     TLOGD(WmsLogTag::WMS_UIEXT, "in");
-    auto persistentId = GetPersistentId();
-    for (const auto& listener : touchOutsideListeners_[persistentId]) {
+    auto touchOutsideListeners = touchOutsideListeners_.GetListeners(GetPersistentId());
+    for (const auto& listener : *touchOutsideListeners) {
         if (listener != nullptr) {
             listener->OnTouchOutside();
         }
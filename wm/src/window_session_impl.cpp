@@ -201,71 +201,53 @@ const char* OrientationToString(Orientation orientation)
 }
 }
 
-std::map<int32_t, std::vector<sptr<IWindowLifeCycle>>> WindowSessionImpl::lifecycleListeners_;
-std::map<int32_t, std::vector<sptr<IWindowStageLifeCycle>>> WindowSessionImpl::windowStageLifecycleListeners_;
-std::map<int32_t, std::vector<sptr<IDisplayMoveListener>>> WindowSessionImpl::displayMoveListeners_;
-std::map<int32_t, std::vector<std::pair<sptr<IWindowChangeListener>, bool>>> WindowSessionImpl::windowChangeListeners_;
-std::map<int32_t, std::vector<sptr<IWindowCrossAxisListener>>> WindowSessionImpl::windowCrossAxisListeners_;
-std::map<int32_t, std::vector<sptr<IAvoidAreaChangedListener>>> WindowSessionImpl::avoidAreaChangeListeners_;
-std::map<int32_t, std::vector<sptr<IDialogDeathRecipientListener>>> WindowSessionImpl::dialogDeathRecipientListeners_;
-std::map<int32_t, std::vector<sptr<IDialogTargetTouchListener>>> WindowSessionImpl::dialogTargetTouchListener_;
-std::map<int32_t, std::vector<sptr<IOccupiedAreaChangeListener>>> WindowSessionImpl::occupiedAreaChangeListeners_;
-std::map<int32_t, std::vector<sptr<IKBWillShowListener>>> WindowSessionImpl::keyboardWillShowListeners_;
-std::map<int32_t, std::vector<sptr<IKBWillHideListener>>> WindowSessionImpl::keyboardWillHideListeners_;
-std::map<int32_t, std::vector<sptr<IKeyboardDidShowListener>>> WindowSessionImpl::keyboardDidShowListeners_;
-std::map<int32_t, std::vector<sptr<IKeyboardDidHideListener>>> WindowSessionImpl::keyboardDidHideListeners_;
-std::map<int32_t, std::vector<sptr<IScreenshotListener>>> WindowSessionImpl::screenshotListeners_;
-std::unordered_map<int32_t, std::vector<IScreenshotAppEventListenerSptr>>
-    WindowSessionImpl::screenshotAppEventListeners_;
-std::map<int32_t, std::vector<sptr<ITouchOutsideListener>>> WindowSessionImpl::touchOutsideListeners_;
-std::map<int32_t, std::vector<IWindowVisibilityListenerSptr>> WindowSessionImpl::windowVisibilityChangeListeners_;
+CowListenerRegistry<sptr<IWindowLifeCycle>> WindowSessionImpl::lifecycleListeners_;
+CowListenerRegistry<sptr<IWindowStageLifeCycle>> WindowSessionImpl::windowStageLifecycleListeners_;
+CowListenerRegistry<sptr<IDisplayMoveListener>> WindowSessionImpl::displayMoveListeners_;
+CowListenerRegistry<std::pair<sptr<IWindowChangeListener>, bool>> WindowSessionImpl::windowChangeListeners_;
+CowListenerRegistry<sptr<IWindowCrossAxisListener>> WindowSessionImpl::windowCrossAxisListeners_;
+CowListenerRegistry<sptr<IAvoidAreaChangedListener>> WindowSessionImpl::avoidAreaChangeListeners_;
+CowListenerRegistry<sptr<IDialogDeathRecipientListener>> WindowSessionImpl::dialogDeathRecipientListeners_;
+CowListenerRegistry<sptr<IDialogTargetTouchListener>> WindowSessionImpl::dialogTargetTouchListener_;
+CowListenerRegistry<sptr<IOccupiedAreaChangeListener>> WindowSessionImpl::occupiedAreaChangeListeners_;
+CowListenerRegistry<sptr<IKBWillShowListener>> WindowSessionImpl::keyboardWillShowListeners_;
+CowListenerRegistry<sptr<IKBWillHideListener>> WindowSessionImpl::keyboardWillHideListeners_;
+CowListenerRegistry<sptr<IKeyboardDidShowListener>> WindowSessionImpl::keyboardDidShowListeners_;
+CowListenerRegistry<sptr<IKeyboardDidHideListener>> WindowSessionImpl::keyboardDidHideListeners_;
+CowListenerRegistry<sptr<IScreenshotListener>> WindowSessionImpl::screenshotListeners_;
+CowListenerRegistry<IScreenshotAppEventListenerSptr> WindowSessionImpl::screenshotAppEventListeners_;
+CowListenerRegistry<sptr<ITouchOutsideListener>> WindowSessionImpl::touchOutsideListeners_;
+CowListenerRegistry<IWindowVisibilityListenerSptr> WindowSessionImpl::windowVisibilityChangeListeners_;
 std::mutex WindowSessionImpl::occlusionStateChangeListenerMutex_;
-std::unordered_map<int32_t,
-    std::vector<sptr<IOcclusionStateChangedListener>>> WindowSessionImpl::occlusionStateChangeListeners_;
+CowListenerRegistry<sptr<IOcclusionStateChangedListener>> WindowSessionImpl::occlusionStateChangeListeners_;
 std::mutex WindowSessionImpl::frameMetricsChangeListenerMutex_;
-std::unordered_map<int32_t,
-    std::vector<sptr<IFrameMetricsChangedListener>>> WindowSessionImpl::frameMetricsChangeListeners_;
-std::mutex WindowSessionImpl::displayIdChangeListenerMutex_;
-std::map<int32_t, std::vector<IDisplayIdChangeListenerSptr>> WindowSessionImpl::displayIdChangeListeners_;
-std::mutex WindowSessionImpl::systemDensityChangeListenerMutex_;
-std::unordered_map<int32_t, std::vector<ISystemDensityChangeListenerSptr>>
-    WindowSessionImpl::systemDensityChangeListeners_;
-std::mutex WindowSessionImpl::windowDensityChangeListenerMutex_;
-std::unordered_map<int32_t, std::vector<IWindowDensityChangeListenerSptr>>
-    WindowSessionImpl::windowDensityChangeListeners_;
+CowListenerRegistry<sptr<IFrameMetricsChangedListener>> WindowSessionImpl::frameMetricsChangeListeners_;
+CowListenerRegistry<IDisplayIdChangeListenerSptr> WindowSessionImpl::displayIdChangeListeners_;
+CowListenerRegistry<ISystemDensityChangeListenerSptr> WindowSessionImpl::systemDensityChangeListeners_;
+CowListenerRegistry<IWindowDensityChangeListenerSptr> WindowSessionImpl::windowDensityChangeListeners_;
 std::recursive_mutex WindowSessionImpl::acrossDisplaysChangeListenerMutex_;
-std::unordered_map<int32_t, std::vector<IAcrossDisplaysChangeListenerSptr>>
-    WindowSessionImpl::acrossDisplaysChangeListeners_;
-std::map<int32_t, std::vector<IWindowNoInteractionListenerSptr>> WindowSessionImpl::windowNoInteractionListeners_;
-std::map<int32_t, std::vector<sptr<IWindowTitleButtonRectChangedListener>>>
+CowListenerRegistry<IAcrossDisplaysChangeListenerSptr> WindowSessionImpl::acrossDisplaysChangeListeners_;
+CowListenerRegistry<IWindowNoInteractionListenerSptr> WindowSessionImpl::windowNoInteractionListeners_;
+CowListenerRegistry<sptr<IWindowTitleButtonRectChangedListener>>
     WindowSessionImpl::windowTitleButtonRectChangeListeners_;
-std::map<int32_t, std::vector<std::pair<sptr<IWindowRectChangeListener>, bool>>>
-    WindowSessionImpl::windowRectChangeListeners_;
-std::map<int32_t, std::vector<sptr<IWindowTitleChangeListener>>> WindowSessionImpl::windowTitleChangeListeners_;
-std::map<int32_t, std::vector<sptr<IWindowTitleOrHotAreasListener>>>
-    WindowSessionImpl::windowTitleOrHotAreasListeners_;
-std::map<int32_t, std::vector<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>>
+CowListenerRegistry<std::pair<sptr<IWindowRectChangeListener>, bool>> WindowSessionImpl::windowRectChangeListeners_;
+CowListenerRegistry<sptr<IWindowTitleChangeListener>> WindowSessionImpl::windowTitleChangeListeners_;
+CowListenerRegistry<sptr<IWindowTitleOrHotAreasListener>> WindowSessionImpl::windowTitleOrHotAreasListeners_;
+CowListenerRegistry<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>
     WindowSessionImpl::rectChangeInGlobalDisplayListeners_;
-std::map<int32_t, std::vector<sptr<IExtensionSecureLimitChangeListener>>>
-    WindowSessionImpl::secureLimitChangeListeners_;
+CowListenerRegistry<sptr<IExtensionSecureLimitChangeListener>> WindowSessionImpl::secureLimitChangeListeners_;
 std::map<int32_t, sptr<ISubWindowCloseListener>> WindowSessionImpl::subWindowCloseListeners_;
 std::map<int32_t, sptr<IMainWindowCloseListener>> WindowSessionImpl::mainWindowCloseListeners_;
 std::map<int32_t, sptr<IPreferredOrientationChangeListener>> WindowSessionImpl::preferredOrientationChangeListener_;
 std::map<int32_t, sptr<IWindowOrientationChangeListener>> WindowSessionImpl::windowOrientationChangeListener_;
-std::unordered_map<int32_t, std::vector<sptr<IWindowWillCloseListener>>> WindowSessionImpl::windowWillCloseListeners_;
-std::map<int32_t, std::vector<sptr<ISwitchFreeMultiWindowListener>>> WindowSessionImpl::switchFreeMultiWindowListeners_;
-std::map<int32_t, std::vector<sptr<IWindowHighlightChangeListener>>> WindowSessionImpl::highlightChangeListeners_;
-std::map<int32_t, std::vector<sptr<IWindowRotationChangeListener>>> WindowSessionImpl::windowRotationChangeListeners_;
-std::map<int32_t, std::vector<sptr<IFreeWindowModeChangeListener>>> WindowSessionImpl::freeWindowModeChangeListeners_;
-std::map<int32_t, std::vector<sptr<IParentLifecycleEventListener>>> WindowSessionImpl::parentLifecycleEventListeners_;
-std::recursive_mutex WindowSessionImpl::lifeCycleListenerMutex_;
+CowListenerRegistry<sptr<IWindowWillCloseListener>> WindowSessionImpl::windowWillCloseListeners_;
+CowListenerRegistry<sptr<ISwitchFreeMultiWindowListener>> WindowSessionImpl::switchFreeMultiWindowListeners_;
+CowListenerRegistry<sptr<IWindowHighlightChangeListener>> WindowSessionImpl::highlightChangeListeners_;
+CowListenerRegistry<sptr<IWindowRotationChangeListener>> WindowSessionImpl::windowRotationChangeListeners_;
+CowListenerRegistry<sptr<IFreeWindowModeChangeListener>> WindowSessionImpl::freeWindowModeChangeListeners_;
+CowListenerRegistry<sptr<IParentLifecycleEventListener>> WindowSessionImpl::parentLifecycleEventListeners_;
 std::recursive_mutex WindowSessionImpl::windowStageLifeCycleListenerMutex_;
-std::recursive_mutex WindowSessionImpl::windowChangeListenerMutex_;
-std::recursive_mutex WindowSessionImpl::windowCrossAxisListenerMutex_;
 std::recursive_mutex WindowSessionImpl::avoidAreaChangeListenerMutex_;
-std::recursive_mutex WindowSessionImpl::dialogDeathRecipientListenerMutex_;
-std::recursive_mutex WindowSessionImpl::dialogTargetTouchListenerMutex_;
-std::recursive_mutex WindowSessionImpl::occupiedAreaChangeListenerMutex_;
 std::recursive_mutex WindowSessionImpl::keyboardWillShowListenerMutex_;
 std::recursive_mutex WindowSessionImpl::keyboardWillHideListenerMutex_;
 std::recursive_mutex WindowSessionImpl::keyboardDidShowListenerMutex_;
@@ -275,30 +257,13 @@ std::recursive_mutex WindowSessionImpl::screenshotAppEventListenerMutex_;
 std::recursive_mutex WindowSessionImpl::touchOutsideListenerMutex_;
 std::recursive_mutex WindowSessionImpl::windowVisibilityChangeListenerMutex_;
 std::recursive_mutex WindowSessionImpl::windowNoInteractionListenerMutex_;
-std::recursive_mutex WindowSessionImpl::windowStatusChangeListenerMutex_;
-std::recursive_mutex WindowSessionImpl::windowStatusDidChangeListenerMutex_;
-std::recursive_mutex WindowSessionImpl::parentWindowSizeChangeListenerMutex_;
-std::recursive_mutex WindowSessionImpl::parentWindowStatusChangeListenerMutex_;
-std::recursive_mutex WindowSessionImpl::windowTitleButtonRectChangeListenerMutex_;
-std::mutex WindowSessionImpl::displayMoveListenerMutex_;
-std::mutex WindowSessionImpl::windowRectChangeListenerMutex_;
-std::mutex WindowSessionImpl::windowTitleChangeListenerMutex_;
-std::mutex WindowSessionImpl::windowTitleOrHotAreasListenerMutex_;
-std::mutex WindowSessionImpl::rectChangeInGlobalDisplayListenerMutex_;
-std::mutex WindowSessionImpl::secureLimitChangeListenerMutex_;
 std::mutex WindowSessionImpl::subWindowCloseListenersMutex_;
 std::mutex WindowSessionImpl::mainWindowCloseListenersMutex_;
 std::recursive_mutex WindowSessionImpl::windowWillCloseListenersMutex_;
-std::mutex WindowSessionImpl::switchFreeMultiWindowListenerMutex_;
 std::mutex WindowSessionImpl::preferredOrientationChangeListenerMutex_;
 std::mutex WindowSessionImpl::windowOrientationChangeListenerMutex_;
-std::mutex WindowSessionImpl::highlightChangeListenerMutex_;
-std::mutex WindowSessionImpl::waterfallModeChangeListenerMutex_;
-std::unordered_map<int32_t, std::vector<sptr<IWaterfallModeChangeListener>>>
-    WindowSessionImpl::waterfallModeChangeListeners_;
+CowListenerRegistry<sptr<IWaterfallModeChangeListener>> WindowSessionImpl::waterfallModeChangeListeners_;
 std::mutex WindowSessionImpl::windowRotationChangeListenerMutex_;
-std::mutex WindowSessionImpl::freeWindowModeChangeListenerMutex_;
-std::mutex WindowSessionImpl::parentLifecycleEventListenerMutex_;
 std::map<std::string, std::pair<int32_t, sptr<WindowSessionImpl>>> WindowSessionImpl::windowSessionMap_;
 std::shared_mutex WindowSessionImpl::windowSessionMutex_;
 std::set<sptr<WindowSessionImpl>> g_windowExtensionSessionSet_;
@@ -309,15 +274,12 @@ std::mutex WindowSessionImpl::highlightTimeStampMutex_;
 std::shared_mutex WindowSessionImpl::windowExtensionSessionMutex_;
 std::recursive_mutex WindowSessionImpl::subWindowSessionMutex_;
 std::map<int32_t, std::vector<sptr<WindowSessionImpl>>> WindowSessionImpl::subWindowSessionMap_;
-std::map<int32_t, std::vector<sptr<IWindowStatusChangeListener>>> WindowSessionImpl::windowStatusChangeListeners_;
-std::map<int32_t, std::vector<sptr<IWindowStatusDidChangeListener>>> WindowSessionImpl::windowStatusDidChangeListeners_;
-std::map<int32_t, std::vector<sptr<IParentWindowSizeChangeListener>>>
-    WindowSessionImpl::parentWindowSizeChangeListeners_;
-std::map<int32_t, std::vector<sptr<IParentWindowStatusChangeListener>>>
-    WindowSessionImpl::parentWindowStatusChangeListeners_;
+CowListenerRegistry<sptr<IWindowStatusChangeListener>> WindowSessionImpl::windowStatusChangeListeners_;
+CowListenerRegistry<sptr<IWindowStatusDidChangeListener>> WindowSessionImpl::windowStatusDidChangeListeners_;
+CowListenerRegistry<sptr<IParentWindowSizeChangeListener>> WindowSessionImpl::parentWindowSizeChangeListeners_;
+CowListenerRegistry<sptr<IParentWindowStatusChangeListener>> WindowSessionImpl::parentWindowStatusChangeListeners_;
 std::recursive_mutex WindowSessionImpl::windowHoverStateChangeListenerMutex_;
-std::map<int32_t, std::vector<sptr<IWindowHoverStateChangeListener>>>
-    WindowSessionImpl::windowHoverStateChangeListeners_;
+CowListenerRegistry<sptr<IWindowHoverStateChangeListener>> WindowSessionImpl::windowHoverStateChangeListeners_;
 bool WindowSessionImpl::isUIExtensionAbilityProcess_ = false;
 
 #define CALL_LIFECYCLE_LISTENER(windowLifecycleCb, listeners, isGamePreLaunch)  \
@@ -3109,9 +3071,8 @@ void WindowSessionImpl::UpdateDecorEnableToAce(bool isDecorEnable)
         return;
     }
 
-    std::lock_guard<std::recursive_mutex> lockListener(windowChangeListenerMutex_);
     auto windowChangeListeners = GetListeners<IWindowChangeListener>();
-    for (auto& listener : windowChangeListeners) {
+    for (auto& listener : *windowChangeListeners) {
         if (listener.first.GetRefPtr() != nullptr) {
             listener.first.GetRefPtr()->OnModeChange(GetWindowMode(), isDecorEnable);
         }
@@ -3175,13 +3136,10 @@ bool WindowSessionImpl::NeedShowDecorInOtherDisplay(bool decorVisible)
 /** @note @window.layout */
 void WindowSessionImpl::NotifyModeChange(WindowMode mode, bool hasDeco)
 {
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowChangeListenerMutex_);
-        auto windowChangeListeners = GetListeners<IWindowChangeListener>();
-        for (auto& listener : windowChangeListeners) {
-            if (listener.first.GetRefPtr() != nullptr) {
-                listener.first.GetRefPtr()->OnModeChange(mode, hasDeco);
-            }
+    auto windowChangeListeners = GetListeners<IWindowChangeListener>();
+    for (auto& listener : *windowChangeListeners) {
+        if (listener.first.GetRefPtr() != nullptr) {
+            listener.first.GetRefPtr()->OnModeChange(mode, hasDeco);
         }
     }
 
@@ -3345,12 +3303,8 @@ WindowState WindowSessionImpl::GetRequestWindowState() const
 WSError WindowSessionImpl::NotifyExtensionSecureLimitChange(bool isLimit)
 {
     TLOGI(WmsLogTag::WMS_UIEXT, "windowId: %{public}d, isLimite: %{public}u", GetPersistentId(), isLimit);
-    std::vector<sptr<IExtensionSecureLimitChangeListener>> secureLimitChangeListeners;
-    {
-        std::lock_guard<std::mutex> lockListener(secureLimitChangeListenerMutex_);
-        secureLimitChangeListeners = GetListeners<IExtensionSecureLimitChangeListener>();
-    }
-    for (const auto& listener : secureLimitChangeListeners) {
+    auto secureLimitChangeListeners = GetListeners<IExtensionSecureLimitChangeListener>();
+    for (const auto& listener : *secureLimitChangeListeners) {
         if (listener != nullptr) {
             listener->OnSecureLimitChange(isLimit);
         }
@@ -3468,9 +3422,8 @@ void WindowSessionImpl::NotifyHighlightChange(bool isHighlight)
     } else {
         shouldReNotifyHighlight_ = true;
     }
-    std::lock_guard<std::mutex> lockListener(highlightChangeListenerMutex_);
     auto highlightChangeListeners = GetListeners<IWindowHighlightChangeListener>();
-    for (const auto& listener : highlightChangeListeners) {
+    for (const auto& listener : *highlightChangeListeners) {
         if (listener != nullptr) {
             listener->OnWindowHighlightChange(isHighlight);
         }
@@ -4111,36 +4064,31 @@ WMError WindowSessionImpl::SetAPPWindowIcon(const std::shared_ptr<Media::PixelMa
 WMError WindowSessionImpl::RegisterLifeCycleListener(const sptr<IWindowLifeCycle>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
-    return RegisterListener(lifecycleListeners_[GetPersistentId()], listener);
+    return RegisterListener(lifecycleListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterWindowStageLifeCycleListener(const sptr<IWindowStageLifeCycle>& listener)
 {
     TLOGD(WmsLogTag::WMS_LIFE, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowStageLifeCycleListenerMutex_);
-    return RegisterListener(windowStageLifecycleListeners_[GetPersistentId()], listener);
+    return RegisterListener(windowStageLifecycleListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWindowStageLifeCycleListener(const sptr<IWindowStageLifeCycle>& listener)
 {
     TLOGD(WmsLogTag::WMS_LIFE, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowStageLifeCycleListenerMutex_);
-    return UnregisterListenerInMap(windowStageLifecycleListeners_, GetPersistentId(), listener);
+    return UnregisterListener(windowStageLifecycleListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterDisplayMoveListener(sptr<IDisplayMoveListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::mutex> lockListener(displayMoveListenerMutex_);
-    return RegisterListener(displayMoveListeners_[GetPersistentId()], listener);
+    return RegisterListener(displayMoveListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterDisplayMoveListener(sptr<IDisplayMoveListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::mutex> lockListener(displayMoveListenerMutex_);
-    return UnregisterListenerInMap(displayMoveListeners_, GetPersistentId(), listener);
+    return UnregisterListener(displayMoveListeners_, GetPersistentId(), listener);
 }
 
 bool WindowSessionImpl::IsWindowShouldDrag()
@@ -4188,15 +4136,13 @@ WMError WindowSessionImpl::EnableDrag(bool enableDrag)
 WMError WindowSessionImpl::RegisterOccupiedAreaChangeListener(const sptr<IOccupiedAreaChangeListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(occupiedAreaChangeListenerMutex_);
-    return RegisterListener(occupiedAreaChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(occupiedAreaChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterOccupiedAreaChangeListener(const sptr<IOccupiedAreaChangeListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(occupiedAreaChangeListenerMutex_);
-    return UnregisterListenerInMap(occupiedAreaChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(occupiedAreaChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterKeyboardWillShowListener(const sptr<IKBWillShowListener>& listener)
@@ -4207,7 +4153,7 @@ WMError WindowSessionImpl::RegisterKeyboardWillShowListener(const sptr<IKBWillSh
         return WMError::WM_ERROR_DEVICE_NOT_SUPPORT;
     }
     std::lock_guard<std::recursive_mutex> lockListener(keyboardWillShowListenerMutex_);
-    WMError ret = RegisterListener(keyboardWillShowListeners_[GetPersistentId()], listener);
+    WMError ret = RegisterListener(keyboardWillShowListeners_, GetPersistentId(), listener);
     if (ret == WMError::WM_OK && property_->EditSessionInfo().isKeyboardWillShowRegistered_ == false) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
@@ -4221,8 +4167,8 @@ WMError WindowSessionImpl::UnregisterKeyboardWillShowListener(const sptr<IKBWill
 {
     TLOGD(WmsLogTag::WMS_KEYBOARD, "in");
     std::lock_guard<std::recursive_mutex> lockListener(keyboardWillShowListenerMutex_);
-    WMError ret = UnregisterListenerInMap(keyboardWillShowListeners_, GetPersistentId(), listener);
-    if (keyboardWillShowListeners_[GetPersistentId()].empty()) {
+    WMError ret = UnregisterListener(keyboardWillShowListeners_, GetPersistentId(), listener);
+    if (!keyboardWillShowListeners_.HasListeners(GetPersistentId())) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
         hostSession->NotifyKeyboardWillShowRegistered(false);
@@ -4239,7 +4185,7 @@ WMError WindowSessionImpl::RegisterKeyboardWillHideListener(const sptr<IKBWillHi
         return WMError::WM_ERROR_DEVICE_NOT_SUPPORT;
     }
     std::lock_guard<std::recursive_mutex> lockListener(keyboardWillHideListenerMutex_);
-    WMError ret = RegisterListener(keyboardWillHideListeners_[GetPersistentId()], listener);
+    WMError ret = RegisterListener(keyboardWillHideListeners_, GetPersistentId(), listener);
     if (ret == WMError::WM_OK && property_->EditSessionInfo().isKeyboardWillHideRegistered_ == false) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
@@ -4253,8 +4199,8 @@ WMError WindowSessionImpl::UnregisterKeyboardWillHideListener(const sptr<IKBWill
 {
     TLOGD(WmsLogTag::WMS_KEYBOARD, "in");
     std::lock_guard<std::recursive_mutex> lockListener(keyboardWillHideListenerMutex_);
-    WMError ret = UnregisterListenerInMap(keyboardWillHideListeners_, GetPersistentId(), listener);
-    if (keyboardWillHideListeners_[GetPersistentId()].empty()) {
+    WMError ret = UnregisterListener(keyboardWillHideListeners_, GetPersistentId(), listener);
+    if (!keyboardWillHideListeners_.HasListeners(GetPersistentId())) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
         hostSession->NotifyKeyboardWillHideRegistered(false);
@@ -4267,7 +4213,7 @@ WMError WindowSessionImpl::RegisterKeyboardDidShowListener(const sptr<IKeyboardD
 {
     TLOGD(WmsLogTag::WMS_KEYBOARD, "in");
     std::lock_guard<std::recursive_mutex> lockListener(keyboardDidShowListenerMutex_);
-    WMError ret = RegisterListener(keyboardDidShowListeners_[GetPersistentId()], listener);
+    WMError ret = RegisterListener(keyboardDidShowListeners_, GetPersistentId(), listener);
     if (ret == WMError::WM_OK && property_->EditSessionInfo().isKeyboardDidShowRegistered_ == false) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
@@ -4281,8 +4227,8 @@ WMError WindowSessionImpl::UnregisterKeyboardDidShowListener(const sptr<IKeyboar
 {
     TLOGD(WmsLogTag::WMS_KEYBOARD, "in");
     std::lock_guard<std::recursive_mutex> lockListener(keyboardDidShowListenerMutex_);
-    WMError ret = UnregisterListenerInMap(keyboardDidShowListeners_, GetPersistentId(), listener);
-    if (keyboardDidShowListeners_[GetPersistentId()].empty()) {
+    WMError ret = UnregisterListener(keyboardDidShowListeners_, GetPersistentId(), listener);
+    if (!keyboardDidShowListeners_.HasListeners(GetPersistentId())) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
         hostSession->NotifyKeyboardDidShowRegistered(false);
@@ -4295,7 +4241,7 @@ WMError WindowSessionImpl::RegisterKeyboardDidHideListener(const sptr<IKeyboardD
 {
     TLOGD(WmsLogTag::WMS_KEYBOARD, "in");
     std::lock_guard<std::recursive_mutex> lockListener(keyboardDidHideListenerMutex_);
-    WMError ret = RegisterListener(keyboardDidHideListeners_[GetPersistentId()], listener);
+    WMError ret = RegisterListener(keyboardDidHideListeners_, GetPersistentId(), listener);
     if (ret == WMError::WM_OK && property_->EditSessionInfo().isKeyboardDidHideRegistered_ == false) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
@@ -4309,8 +4255,8 @@ WMError WindowSessionImpl::UnregisterKeyboardDidHideListener(const sptr<IKeyboar
 {
     TLOGD(WmsLogTag::WMS_KEYBOARD, "in");
     std::lock_guard<std::recursive_mutex> lockListener(keyboardDidHideListenerMutex_);
-    WMError ret = UnregisterListenerInMap(keyboardDidHideListeners_, GetPersistentId(), listener);
-    if (keyboardDidHideListeners_[GetPersistentId()].empty()) {
+    WMError ret = UnregisterListener(keyboardDidHideListeners_, GetPersistentId(), listener);
+    if (!keyboardDidHideListeners_.HasListeners(GetPersistentId())) {
         auto hostSession = GetHostSession();
         CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_INVALID_WINDOW);
         hostSession->NotifyKeyboardDidHideRegistered(false);
@@ -4322,8 +4268,7 @@ WMError WindowSessionImpl::UnregisterKeyboardDidHideListener(const sptr<IKeyboar
 WMError WindowSessionImpl::UnregisterLifeCycleListener(const sptr<IWindowLifeCycle>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
-    return UnregisterListenerInMap(lifecycleListeners_, GetPersistentId(), listener);
+    return UnregisterListener(lifecycleListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterWindowChangeListener(const sptr<IWindowChangeListener>& listener)
@@ -4335,88 +4280,76 @@ WMError WindowSessionImpl::RegisterWindowChangeListener(const sptr<IWindowChange
     bool useHookedSize)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowChangeListenerMutex_);
-    return RegisterListener(windowChangeListeners_[GetPersistentId()], std::make_pair(listener, useHookedSize));
+    return RegisterListener(windowChangeListeners_, GetPersistentId(), std::make_pair(listener, useHookedSize));
 }
 
 WMError WindowSessionImpl::UnregisterWindowChangeListener(const sptr<IWindowChangeListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowChangeListenerMutex_);
-    return UnregisterListenerInMap(windowChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(windowChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterWindowCrossAxisListener(const sptr<IWindowCrossAxisListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowCrossAxisListenerMutex_);
-    return RegisterListener(windowCrossAxisListeners_[GetPersistentId()], listener);
+    return RegisterListener(windowCrossAxisListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWindowCrossAxisListener(const sptr<IWindowCrossAxisListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowCrossAxisListenerMutex_);
-    return UnregisterListenerInMap(windowCrossAxisListeners_, GetPersistentId(), listener);
+    return UnregisterListener(windowCrossAxisListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterWindowStatusChangeListener(const sptr<IWindowStatusChangeListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowStatusChangeListenerMutex_);
-    return RegisterListener(windowStatusChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(windowStatusChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWindowStatusChangeListener(const sptr<IWindowStatusChangeListener>& listener)
 {
     WLOGFD("in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowStatusChangeListenerMutex_);
-    return UnregisterListenerInMap(windowStatusChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(windowStatusChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterWindowStatusDidChangeListener(const sptr<IWindowStatusDidChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_LAYOUT, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowStatusDidChangeListenerMutex_);
-    return RegisterListener(windowStatusDidChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(windowStatusDidChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWindowStatusDidChangeListener(const sptr<IWindowStatusDidChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_LAYOUT, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(windowStatusDidChangeListenerMutex_);
-    return UnregisterListenerInMap(windowStatusDidChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(windowStatusDidChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterParentWindowSizeChangeListener(const sptr<IParentWindowSizeChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_LAYOUT, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(parentWindowSizeChangeListenerMutex_);
-    return RegisterListener(parentWindowSizeChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(parentWindowSizeChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterParentWindowSizeChangeListener(const
     sptr<IParentWindowSizeChangeListener>&listener)
 {
     TLOGD(WmsLogTag::WMS_LAYOUT, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(parentWindowSizeChangeListenerMutex_);
-    return UnregisterListenerInMap(parentWindowSizeChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(parentWindowSizeChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterParentWindowStatusChangeListener(const
     sptr<IParentWindowStatusChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_LAYOUT, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(parentWindowStatusChangeListenerMutex_);
-    return RegisterListener(parentWindowStatusChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(parentWindowStatusChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterParentWindowStatusChangeListener(const
     sptr<IParentWindowStatusChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_LAYOUT, "in");
-    std::lock_guard<std::recursive_mutex> lockListener(parentWindowStatusChangeListenerMutex_);
-    return UnregisterListenerInMap(parentWindowStatusChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(parentWindowStatusChangeListeners_, GetPersistentId(), listener);
 }
 
 std::shared_ptr<Media::PixelMap> WindowSessionImpl::Snapshot()
@@ -4909,13 +4842,10 @@ WMError WindowSessionImpl::RegisterWindowTitleButtonRectChangeListener(
         return WMError::WM_ERROR_NULLPTR;
     }
 
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowTitleButtonRectChangeListenerMutex_);
-        WMError ret = RegisterListener(windowTitleButtonRectChangeListeners_[persistentId], listener);
-        if (ret != WMError::WM_OK) {
-            TLOGE(WmsLogTag::WMS_DECOR, "register failed");
-            return ret;
-        }
+    WMError ret = RegisterListener(windowTitleButtonRectChangeListeners_, persistentId, listener);
+    if (ret != WMError::WM_OK) {
+        TLOGE(WmsLogTag::WMS_DECOR, "register failed");
+        return ret;
     }
     if (auto uiContent = GetUIContentSharedPtr()) {
         const char* const where = __func__;
@@ -4957,13 +4887,10 @@ WMError WindowSessionImpl::UnregisterWindowTitleButtonRectChangeListener(
         TLOGE(WmsLogTag::WMS_DECOR, "listener is nullptr");
         return WMError::WM_ERROR_NULLPTR;
     }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowTitleButtonRectChangeListenerMutex_);
-        ret = UnregisterListenerInMap(windowTitleButtonRectChangeListeners_, persistentId, listener);
-        if (ret != WMError::WM_OK) {
-            TLOGE(WmsLogTag::WMS_DECOR, "failed");
-            return ret;
-        }
+    ret = UnregisterListener(windowTitleButtonRectChangeListeners_, persistentId, listener);
+    if (ret != WMError::WM_OK) {
+        TLOGE(WmsLogTag::WMS_DECOR, "failed");
+        return ret;
     }
     if (auto uiContent = GetUIContentSharedPtr()) {
         uiContent->SubscribeContainerModalButtonsRectChange(nullptr);
@@ -4973,20 +4900,15 @@ WMError WindowSessionImpl::UnregisterWindowTitleButtonRectChangeListener(
 
 template<typename T>
 EnableIfSame<T, IWindowTitleButtonRectChangedListener,
-    std::vector<sptr<IWindowTitleButtonRectChangedListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<IWindowTitleButtonRectChangedListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowTitleButtonRectChangedListener>> windowTitleButtonRectListeners;
-        for (auto& listener : windowTitleButtonRectChangeListeners_[GetPersistentId()]) {
-            windowTitleButtonRectListeners.push_back(listener);
-        }
-    return windowTitleButtonRectListeners;
+    return windowTitleButtonRectChangeListeners_.GetListeners(GetPersistentId());
 }
 
 void WindowSessionImpl::NotifyWindowTitleButtonRectChange(TitleButtonRect titleButtonRect)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(windowTitleButtonRectChangeListenerMutex_);
     auto windowTitleButtonRectListeners = GetListeners<IWindowTitleButtonRectChangedListener>();
-    for (auto& listener : windowTitleButtonRectListeners) {
+    for (auto& listener : *windowTitleButtonRectListeners) {
         if (listener != nullptr) {
             listener->OnWindowTitleButtonRectChanged(titleButtonRect);
         }
@@ -5002,13 +4924,8 @@ void WindowSessionImpl::UpdateRectChangeListenerRegisterStatus()
         return;
     }
 
-    auto isRegisteredIn = [windowId](auto& listeners, auto& mutex) {
-        std::lock_guard<std::mutex> lock(mutex);
-        auto it = listeners.find(windowId);
-        return it != listeners.end() && !it->second.empty();
-    };
-    bool isRegistered = isRegisteredIn(windowRectChangeListeners_, windowRectChangeListenerMutex_) ||
-                        isRegisteredIn(rectChangeInGlobalDisplayListeners_, rectChangeInGlobalDisplayListenerMutex_);
+    bool isRegistered = windowRectChangeListeners_.HasListeners(windowId) ||
+                        rectChangeInGlobalDisplayListeners_.HasListeners(windowId);
 
     auto ret = hostSession->UpdateRectChangeListenerRegistered(isRegistered);
     if (ret != WSError::WS_OK) {
@@ -5019,13 +4936,10 @@ void WindowSessionImpl::UpdateRectChangeListenerRegisterStatus()
 
 template<typename T>
 EnableIfSame<T, IWindowRectChangeListener,
-    std::vector<std::pair<sptr<IWindowRectChangeListener>, bool>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<std::pair<sptr<IWindowRectChangeListener>, bool>>::ListenerListPtr>
+    WindowSessionImpl::GetListeners()
 {
-    std::vector<std::pair<sptr<IWindowRectChangeListener>, bool>> windowRectChangeListeners;
-    for (auto& listener : windowRectChangeListeners_[GetPersistentId()]) {
-        windowRectChangeListeners.push_back(listener);
-    }
-    return windowRectChangeListeners;
+    return windowRectChangeListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterWindowRectChangeListener(const sptr<IWindowRectChangeListener>& listener,
@@ -5033,11 +4947,8 @@ WMError WindowSessionImpl::RegisterWindowRectChangeListener(const sptr<IWindowRe
 {
     HITRACE_METER_NAME(HITRACE_TAG_WINDOW_MANAGER,
         "CUSTOM_ANIMATOR_WindowSessionImpl::RegisterWindowRectChangeListener");
-    WMError ret = WMError::WM_DO_NOTHING;
-    {
-        std::lock_guard<std::mutex> lockListener(windowRectChangeListenerMutex_);
-        ret = RegisterListener(windowRectChangeListeners_[GetPersistentId()], std::make_pair(listener, useHookedSize));
-    }
+    WMError ret = RegisterListener(windowRectChangeListeners_, GetPersistentId(),
+        std::make_pair(listener, useHookedSize));
     if (ret == WMError::WM_OK) {
         UpdateRectChangeListenerRegisterStatus();
     }
@@ -5046,11 +4957,7 @@ WMError WindowSessionImpl::RegisterWindowRectChangeListener(const sptr<IWindowRe
 
 WMError WindowSessionImpl::UnregisterWindowRectChangeListener(const sptr<IWindowRectChangeListener>& listener)
 {
-    WMError ret = WMError::WM_DO_NOTHING;
-    {
-        std::lock_guard<std::mutex> lockListener(windowRectChangeListenerMutex_);
-        ret = UnregisterListenerInMap(windowRectChangeListeners_, GetPersistentId(), listener);
-    }
+    WMError ret = UnregisterListener(windowRectChangeListeners_, GetPersistentId(), listener);
     if (ret == WMError::WM_OK) {
         UpdateRectChangeListenerRegisterStatus();
     }
@@ -5059,14 +4966,10 @@ WMError WindowSessionImpl::UnregisterWindowRectChangeListener(const sptr<IWindow
 
 template<typename T>
 EnableIfSame<T, IRectChangeInGlobalDisplayListener,
-    std::vector<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<std::pair<sptr<IRectChangeInGlobalDisplayListener>, bool>>::ListenerListPtr>
+    WindowSessionImpl::GetListeners()
 {
-    std::lock_guard<std::mutex> lock(rectChangeInGlobalDisplayListenerMutex_);
-    auto it = rectChangeInGlobalDisplayListeners_.find(GetPersistentId());
-    if (it != rectChangeInGlobalDisplayListeners_.end()) {
-        return it->second;
-    }
-    return {};
+    return rectChangeInGlobalDisplayListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterRectChangeInGlobalDisplayListener(
@@ -5074,12 +4977,8 @@ WMError WindowSessionImpl::RegisterRectChangeInGlobalDisplayListener(
 {
     HITRACE_METER_NAME(HITRACE_TAG_WINDOW_MANAGER,
         "CUSTOM_ANIMATOR_WindowSessionImpl::RegisterRectChangeInGlobalDisplayListener");
-    WMError ret = WMError::WM_DO_NOTHING;
-    {
-        std::lock_guard<std::mutex> lock(rectChangeInGlobalDisplayListenerMutex_);
-        ret = RegisterListener(rectChangeInGlobalDisplayListeners_[GetPersistentId()],
-            std::make_pair(listener, useHookedSize));
-    }
+    WMError ret = RegisterListener(rectChangeInGlobalDisplayListeners_, GetPersistentId(),
+        std::make_pair(listener, useHookedSize));
     if (ret == WMError::WM_OK) {
         UpdateRectChangeListenerRegisterStatus();
     }
@@ -5089,11 +4988,7 @@ WMError WindowSessionImpl::RegisterRectChangeInGlobalDisplayListener(
 WMError WindowSessionImpl::UnregisterRectChangeInGlobalDisplayListener(
     const sptr<IRectChangeInGlobalDisplayListener>& listener)
 {
-    WMError ret = WMError::WM_DO_NOTHING;
-    {
-        std::lock_guard<std::mutex> lock(rectChangeInGlobalDisplayListenerMutex_);
-        ret = UnregisterListenerInMap(rectChangeInGlobalDisplayListeners_, GetPersistentId(), listener);
-    }
+    WMError ret = UnregisterListener(rectChangeInGlobalDisplayListeners_, GetPersistentId(), listener);
     if (ret == WMError::WM_OK) {
         UpdateRectChangeListenerRegisterStatus();
     }
@@ -5102,29 +4997,23 @@ WMError WindowSessionImpl::UnregisterRectChangeInGlobalDisplayListener(
 
 template<typename T>
 EnableIfSame<T, IExtensionSecureLimitChangeListener,
-    std::vector<sptr<IExtensionSecureLimitChangeListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<IExtensionSecureLimitChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IExtensionSecureLimitChangeListener>> secureLimitChangeListeners;
-    for (auto& listener : secureLimitChangeListeners_[GetPersistentId()]) {
-        secureLimitChangeListeners.push_back(listener);
-    }
-    return secureLimitChangeListeners;
+    return secureLimitChangeListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterExtensionSecureLimitChangeListener(
     const sptr<IExtensionSecureLimitChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_UIEXT, "name=%{public}s, id=%{public}u", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(secureLimitChangeListenerMutex_);
-    return RegisterListener(secureLimitChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(secureLimitChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterExtensionSecureLimitChangeListener(
     const sptr<IExtensionSecureLimitChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_UIEXT, "name=%{public}s, id=%{public}u", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(secureLimitChangeListenerMutex_);
-    return UnregisterListenerInMap(secureLimitChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(secureLimitChangeListeners_, GetPersistentId(), listener);
 }
 
 template<typename T>
@@ -5166,29 +5055,23 @@ WMError WindowSessionImpl::UnregisterSubWindowCloseListeners(const sptr<ISubWind
 }
 
 template<typename T>
-EnableIfSame<T, IWindowHighlightChangeListener, std::vector<sptr<IWindowHighlightChangeListener>>>
-    WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowHighlightChangeListener,
+    CowListenerRegistry<sptr<IWindowHighlightChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowHighlightChangeListener>> highlightChangeListeners;
-    for (auto& listener : highlightChangeListeners_[GetPersistentId()]) {
-        highlightChangeListeners.push_back(listener);
-    }
-    return highlightChangeListeners;
+    return highlightChangeListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterWindowHighlightChangeListeners(const sptr<IWindowHighlightChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_FOCUS, "name=%{public}s, id=%{public}u", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(highlightChangeListenerMutex_);
-    return RegisterListener(highlightChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(highlightChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWindowHighlightChangeListeners(
     const sptr<IWindowHighlightChangeListener>& listener)
 {
     TLOGD(WmsLogTag::WMS_FOCUS, "name=%{public}s, id=%{public}u", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(highlightChangeListenerMutex_);
-    return UnregisterListenerInMap(highlightChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(highlightChangeListeners_, GetPersistentId(), listener);
 }
 
 template<typename T>
@@ -5234,9 +5117,10 @@ WMError WindowSessionImpl::UnregisterMainWindowCloseListeners(const sptr<IMainWi
 }
 
 template<typename T>
-EnableIfSame<T, IWindowWillCloseListener, std::vector<sptr<IWindowWillCloseListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowWillCloseListener,
+    CowListenerRegistry<sptr<IWindowWillCloseListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    return windowWillCloseListeners_[GetPersistentId()];
+    return windowWillCloseListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterWindowWillCloseListeners(const sptr<IWindowWillCloseListener>& listener)
@@ -5252,8 +5136,7 @@ WMError WindowSessionImpl::RegisterWindowWillCloseListeners(const sptr<IWindowWi
         TLOGE(WmsLogTag::WMS_DECOR, "window type is not supported");
         return WMError::WM_ERROR_INVALID_CALLING;
     }
-    std::lock_guard<std::recursive_mutex> lockListener(windowWillCloseListenersMutex_);
-    return RegisterListener(windowWillCloseListeners_[GetPersistentId()], listener);
+    return RegisterListener(windowWillCloseListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnRegisterWindowWillCloseListeners(const sptr<IWindowWillCloseListener>& listener)
@@ -5269,73 +5152,56 @@ WMError WindowSessionImpl::UnRegisterWindowWillCloseListeners(const sptr<IWindow
         TLOGE(WmsLogTag::WMS_DECOR, "window type is not supported");
         return WMError::WM_ERROR_INVALID_CALLING;
     }
-    std::lock_guard<std::recursive_mutex> lockListener(windowWillCloseListenersMutex_);
-    return UnregisterListenerInMap(windowWillCloseListeners_, GetPersistentId(), listener);
+    return UnregisterListener(windowWillCloseListeners_, GetPersistentId(), listener);
 }
 
 template<typename T>
-EnableIfSame<T, IWindowTitleChangeListener, std::vector<sptr<IWindowTitleChangeListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowTitleChangeListener,
+    CowListenerRegistry<sptr<IWindowTitleChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowTitleChangeListener>> windowTitleChangeListeners;
-    std::lock_guard<std::mutex> lockListener(windowTitleChangeListenerMutex_);
-    for (auto& listener : windowTitleChangeListeners_[GetPersistentId()]) {
-        windowTitleChangeListeners.push_back(listener);
-    }
-    return windowTitleChangeListeners;
+    return windowTitleChangeListeners_.GetListeners(GetPersistentId());
 }
  
 WMError WindowSessionImpl::RegisterWindowTitleChangeListener(const sptr<IWindowTitleChangeListener>& listener)
 {
-    std::lock_guard<std::mutex> lockListener(windowTitleChangeListenerMutex_);
-    WMError ret = RegisterListener(windowTitleChangeListeners_[GetPersistentId()], listener);
+    WMError ret = RegisterListener(windowTitleChangeListeners_, GetPersistentId(), listener);
     TLOGI(WmsLogTag::WMS_DECOR, "RegisterWindowTitleChangeListener");
     return ret;
 }
  
 WMError WindowSessionImpl::UnregisterWindowTitleChangeListener(const sptr<IWindowTitleChangeListener>& listener)
 {
-    std::lock_guard<std::mutex> lockListener(windowTitleChangeListenerMutex_);
-    WMError ret = UnregisterListenerInMap(windowTitleChangeListeners_, GetPersistentId(), listener);
+    WMError ret = UnregisterListener(windowTitleChangeListeners_, GetPersistentId(), listener);
     TLOGI(WmsLogTag::WMS_DECOR, "UnregisterWindowTitleChangeListener");
     return ret;
 }
 
 template<typename T>
-EnableIfSame<T, IWindowTitleOrHotAreasListener, std::vector<sptr<IWindowTitleOrHotAreasListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowTitleOrHotAreasListener,
+    CowListenerRegistry<sptr<IWindowTitleOrHotAreasListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowTitleOrHotAreasListener>> windowTitleOrHotAreasListeners;
-    std::lock_guard<std::mutex> lockListener(windowTitleOrHotAreasListenerMutex_);
-    for (auto& listener : windowTitleOrHotAreasListeners_[GetPersistentId()]) {
-        windowTitleOrHotAreasListeners.push_back(listener);
-    }
-    return windowTitleOrHotAreasListeners;
+    return windowTitleOrHotAreasListeners_.GetListeners(GetPersistentId());
 }
  
 WMError WindowSessionImpl::RegisterWindowTitleOrHotAreasListener(const sptr<IWindowTitleOrHotAreasListener>& listener)
 {
-    std::lock_guard<std::mutex> lockListener(windowTitleOrHotAreasListenerMutex_);
-    WMError ret = RegisterListener(windowTitleOrHotAreasListeners_[GetPersistentId()], listener);
+    WMError ret = RegisterListener(windowTitleOrHotAreasListeners_, GetPersistentId(), listener);
     TLOGI(WmsLogTag::WMS_DECOR, "RegisterWindowTitleOrHotAreasListener");
     return ret;
 }
  
 WMError WindowSessionImpl::UnregisterWindowTitleOrHotAreasListener(const sptr<IWindowTitleOrHotAreasListener>& listener)
 {
-    std::lock_guard<std::mutex> lockListener(windowTitleOrHotAreasListenerMutex_);
-    WMError ret = UnregisterListenerInMap(windowTitleOrHotAreasListeners_, GetPersistentId(), listener);
+    WMError ret = UnregisterListener(windowTitleOrHotAreasListeners_, GetPersistentId(), listener);
     TLOGI(WmsLogTag::WMS_DECOR, "UnregisterWindowTitleOrHotAreasListener");
     return ret;
 }
 
 template<typename T>
 EnableIfSame<T, ISwitchFreeMultiWindowListener,
-    std::vector<sptr<ISwitchFreeMultiWindowListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<ISwitchFreeMultiWindowListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<ISwitchFreeMultiWindowListener>> switchFreeMultiWindowListeners;
-    for (auto& listener : switchFreeMultiWindowListeners_[GetPersistentId()]) {
-        switchFreeMultiWindowListeners.push_back(listener);
-    }
-    return switchFreeMultiWindowListeners;
+    return switchFreeMultiWindowListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterSwitchFreeMultiWindowListener(const sptr<ISwitchFreeMultiWindowListener>& listener)
@@ -5349,8 +5215,7 @@ WMError WindowSessionImpl::RegisterSwitchFreeMultiWindowListener(const sptr<ISwi
         return WMError::WM_ERROR_INVALID_CALLING;
     }
     TLOGD(WmsLogTag::WMS_LAYOUT_PC, "Start register");
-    std::lock_guard<std::mutex> lockListener(switchFreeMultiWindowListenerMutex_);
-    return RegisterListener(switchFreeMultiWindowListeners_[GetPersistentId()], listener);
+    return RegisterListener(switchFreeMultiWindowListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterSwitchFreeMultiWindowListener(const sptr<ISwitchFreeMultiWindowListener>& listener)
@@ -5364,8 +5229,7 @@ WMError WindowSessionImpl::UnregisterSwitchFreeMultiWindowListener(const sptr<IS
         return WMError::WM_ERROR_INVALID_CALLING;
     }
     TLOGD(WmsLogTag::WMS_LAYOUT_PC, "Start unregister");
-    std::lock_guard<std::mutex> lockListener(switchFreeMultiWindowListenerMutex_);
-    return UnregisterListenerInMap(switchFreeMultiWindowListeners_, GetPersistentId(), listener);
+    return UnregisterListener(switchFreeMultiWindowListeners_, GetPersistentId(), listener);
 }
 
 void WindowSessionImpl::RecoverSessionListener()
@@ -5374,22 +5238,19 @@ void WindowSessionImpl::RecoverSessionListener()
     TLOGI(WmsLogTag::WMS_RECOVER, "with persistentId=%{public}d", persistentId);
     {
         std::lock_guard<std::recursive_mutex> lockListener(avoidAreaChangeListenerMutex_);
-        if (avoidAreaChangeListeners_.find(persistentId) != avoidAreaChangeListeners_.end() &&
-            !avoidAreaChangeListeners_[persistentId].empty()) {
+        if (avoidAreaChangeListeners_.HasListeners(persistentId)) {
             SingletonContainer::Get<WindowAdapter>().UpdateSessionAvoidAreaListener(persistentId, true);
         }
     }
     {
         std::lock_guard<std::recursive_mutex> lockListener(touchOutsideListenerMutex_);
-        if (touchOutsideListeners_.find(persistentId) != touchOutsideListeners_.end() &&
-            !touchOutsideListeners_[persistentId].empty()) {
+        if (touchOutsideListeners_.HasListeners(persistentId)) {
             SingletonContainer::Get<WindowAdapter>().UpdateSessionTouchOutsideListener(persistentId, true);
         }
     }
     {
         std::lock_guard<std::recursive_mutex> lockListener(windowVisibilityChangeListenerMutex_);
-        if (windowVisibilityChangeListeners_.find(persistentId) != windowVisibilityChangeListeners_.end() &&
-            !windowVisibilityChangeListeners_[persistentId].empty()) {
+        if (windowVisibilityChangeListeners_.HasListeners(persistentId)) {
             SingletonContainer::Get<WindowAdapter>().UpdateSessionWindowVisibilityListener(persistentId, true);
         }
     }
@@ -5397,8 +5258,7 @@ void WindowSessionImpl::RecoverSessionListener()
         bool hasListener = false;
         {
             std::lock_guard<std::mutex> lockListener(occlusionStateChangeListenerMutex_);
-            hasListener = occlusionStateChangeListeners_.count(persistentId) > 0 &&
-                !occlusionStateChangeListeners_[persistentId].empty();
+            hasListener = occlusionStateChangeListeners_.HasListeners(persistentId);
         }
         if (hasListener) {
             SingletonContainer::Get<WindowAdapter>().UpdateSessionOcclusionStateListener(persistentId, true);
@@ -5407,8 +5267,7 @@ void WindowSessionImpl::RecoverSessionListener()
     UpdateRectChangeListenerRegisterStatus();
     {
         std::lock_guard<std::mutex> lockListener(windowRotationChangeListenerMutex_);
-        if (windowRotationChangeListeners_.find(persistentId) != windowRotationChangeListeners_.end() &&
-            !windowRotationChangeListeners_[persistentId].empty()) {
+        if (windowRotationChangeListeners_.HasListeners(persistentId)) {
             if (auto hostSession = GetHostSession()) {
                 hostSession->UpdateRotationChangeRegistered(persistentId, true);
             }
@@ -5418,7 +5277,7 @@ void WindowSessionImpl::RecoverSessionListener()
         bool hasListener = false;
         {
             std::lock_guard<std::recursive_mutex> lockListener(screenshotListenerMutex_);
-            hasListener = screenshotListeners_.count(persistentId) > 0 && !screenshotListeners_[persistentId].empty();
+            hasListener = screenshotListeners_.HasListeners(persistentId);
         }
         if (hasListener) {
             SingletonContainer::Get<WindowAdapter>().UpdateSessionScreenshotListener(persistentId, true);
@@ -5426,8 +5285,7 @@ void WindowSessionImpl::RecoverSessionListener()
     }
     {
         std::lock_guard<std::recursive_mutex> lockListener(screenshotAppEventListenerMutex_);
-        if (screenshotAppEventListeners_.find(persistentId) != screenshotAppEventListeners_.end() &&
-            !screenshotAppEventListeners_[persistentId].empty()) {
+        if (screenshotAppEventListeners_.HasListeners(persistentId)) {
             if (auto hostSession = GetHostSession()) {
                 hostSession->UpdateScreenshotAppEventRegistered(persistentId, true);
             }
@@ -5435,8 +5293,7 @@ void WindowSessionImpl::RecoverSessionListener()
     }
     {
         std::lock_guard<std::recursive_mutex> lockListener(acrossDisplaysChangeListenerMutex_);
-        if (acrossDisplaysChangeListeners_.find(persistentId) != acrossDisplaysChangeListeners_.end() &&
-            !acrossDisplaysChangeListeners_[persistentId].empty()) {
+        if (acrossDisplaysChangeListeners_.HasListeners(persistentId)) {
             if (auto hostSession = GetHostSession()) {
                 hostSession->UpdateAcrossDisplaysChangeRegistered(true);
             }
@@ -5448,24 +5305,9 @@ void WindowSessionImpl::RecoverSessionListener()
 void WindowSessionImpl::RecoverDensityChangeListener()
 {
     auto persistentId = GetPersistentId();
-    bool hasDisplayIdListener = false;
-    bool hasSystemDensityListener = false;
-    bool hasWindowDensityListener = false;
-    {
-        std::lock_guard<std::mutex> lockListener(displayIdChangeListenerMutex_);
-        auto iter = displayIdChangeListeners_.find(persistentId);
-        hasDisplayIdListener = iter != displayIdChangeListeners_.end() && !iter->second.empty();
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(systemDensityChangeListenerMutex_);
-        auto iter = systemDensityChangeListeners_.find(persistentId);
-        hasSystemDensityListener = iter != systemDensityChangeListeners_.end() && !iter->second.empty();
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(windowDensityChangeListenerMutex_);
-        auto iter = windowDensityChangeListeners_.find(persistentId);
-        hasWindowDensityListener = iter != windowDensityChangeListeners_.end() && !iter->second.empty();
-    }
+    bool hasDisplayIdListener = displayIdChangeListeners_.HasListeners(persistentId);
+    bool hasSystemDensityListener = systemDensityChangeListeners_.HasListeners(persistentId);
+    bool hasWindowDensityListener = windowDensityChangeListeners_.HasListeners(persistentId);
     if (!hasDisplayIdListener && !hasSystemDensityListener && !hasWindowDensityListener) {
         return;
     }
@@ -5489,50 +5331,32 @@ void WindowSessionImpl::RecoverDensityChangeListener()
 }
 
 template<typename T>
-EnableIfSame<T, IWindowLifeCycle, std::vector<sptr<IWindowLifeCycle>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowLifeCycle,
+    CowListenerRegistry<sptr<IWindowLifeCycle>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
-    auto iter = lifecycleListeners_.find(GetPersistentId());
-    if (iter == lifecycleListeners_.end()) {
-        return std::vector<sptr<IWindowLifeCycle>>();
-    }
-    std::vector<sptr<IWindowLifeCycle>> lifecycleListeners;
-    for (auto& listener : iter->second) {
-        lifecycleListeners.push_back(listener);
-    }
-    return lifecycleListeners;
+    return lifecycleListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IWindowStageLifeCycle, std::vector<sptr<IWindowStageLifeCycle>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowStageLifeCycle,
+    CowListenerRegistry<sptr<IWindowStageLifeCycle>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(windowStageLifeCycleListenerMutex_);
-    std::vector<sptr<IWindowStageLifeCycle>> windowStageLifecycleListeners;
-    for (auto& listener : windowStageLifecycleListeners_[GetPersistentId()]) {
-        windowStageLifecycleListeners.push_back(listener);
-    }
-    return windowStageLifecycleListeners;
+    return windowStageLifecycleListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IWindowChangeListener, std::vector<std::pair<sptr<IWindowChangeListener>, bool>>>
+EnableIfSame<T, IWindowChangeListener,
+    CowListenerRegistry<std::pair<sptr<IWindowChangeListener>, bool>>::ListenerListPtr>
     WindowSessionImpl::GetListeners()
 {
-    std::vector<std::pair<sptr<IWindowChangeListener>, bool>> windowChangeListeners;
-    for (auto& listener : windowChangeListeners_[GetPersistentId()]) {
-        windowChangeListeners.push_back(listener);
-    }
-    return windowChangeListeners;
+    return windowChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IWindowCrossAxisListener, std::vector<sptr<IWindowCrossAxisListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowCrossAxisListener,
+    CowListenerRegistry<sptr<IWindowCrossAxisListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowCrossAxisListener>> windowCrossAxisListeners;
-    for (const auto& listener : windowCrossAxisListeners_[GetPersistentId()]) {
-        windowCrossAxisListeners.push_back(listener);
-    }
-    return windowCrossAxisListeners;
+    return windowCrossAxisListeners_.GetListeners(GetPersistentId());
 }
 
 void WindowSessionImpl::NotifyWindowCrossAxisChange(CrossAxisState state)
@@ -5546,9 +5370,8 @@ void WindowSessionImpl::NotifyWindowCrossAxisChange(CrossAxisState state)
         uiContent->SendUIExtProprty(static_cast<uint32_t>(Extension::Businesscode::SYNC_CROSS_AXIS_STATE),
             want, static_cast<uint8_t>(SubSystemId::WM_UIEXT));
     }
-    std::lock_guard<std::recursive_mutex> lockListener(windowCrossAxisListenerMutex_);
     auto windowCrossAxisListeners = GetListeners<IWindowCrossAxisListener>();
-    for (const auto& listener : windowCrossAxisListeners) {
+    for (const auto& listener : *windowCrossAxisListeners) {
         if (listener != nullptr) {
             listener->OnCrossAxisChange(state);
         }
@@ -5632,25 +5455,19 @@ bool WindowSessionImpl::InitWaterfallMode()
 WMError WindowSessionImpl::RegisterWaterfallModeChangeListener(const sptr<IWaterfallModeChangeListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "winId: %{public}u", GetWindowId());
-    std::lock_guard<std::mutex> lockListener(waterfallModeChangeListenerMutex_);
-    return RegisterListener(waterfallModeChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(waterfallModeChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWaterfallModeChangeListener(const sptr<IWaterfallModeChangeListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "winId: %{public}u", GetWindowId());
-    std::lock_guard<std::mutex> lockListener(waterfallModeChangeListenerMutex_);
-    return UnregisterListenerInMap(waterfallModeChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(waterfallModeChangeListeners_, GetPersistentId(), listener);
 }
 
-std::vector<sptr<IWaterfallModeChangeListener>> WindowSessionImpl::GetWaterfallModeChangeListeners()
+CowListenerRegistry<sptr<IWaterfallModeChangeListener>>::ListenerListPtr
+    WindowSessionImpl::GetWaterfallModeChangeListeners()
 {
-    std::vector<sptr<IWaterfallModeChangeListener>> listeners;
-    std::lock_guard<std::mutex> lockListener(waterfallModeChangeListenerMutex_);
-    for (auto& listener : waterfallModeChangeListeners_[GetPersistentId()]) {
-        listeners.push_back(listener);
-    }
-    return listeners;
+    return waterfallModeChangeListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::NotifyAcrossDisplaysChange(bool isAcrossDisplays)
@@ -5662,7 +5479,7 @@ WMError WindowSessionImpl::NotifyAcrossDisplaysChange(bool isAcrossDisplays)
     }
     std::lock_guard<std::recursive_mutex> lock(acrossDisplaysChangeListenerMutex_);
     const auto& acrossMultiDisplayChangeListeners = GetListeners<IAcrossDisplaysChangeListener>();
-    for (const auto& listener : acrossMultiDisplayChangeListeners) {
+    for (const auto& listener : *acrossMultiDisplayChangeListeners) {
         if (listener != nullptr) {
             listener->OnAcrossDisplaysChanged(isAcrossDisplays);
         }
@@ -5687,7 +5504,7 @@ void WindowSessionImpl::NotifyWaterfallModeChange(bool isWaterfallMode)
             want, static_cast<uint8_t>(SubSystemId::WM_UIEXT));
     }
     auto waterfallModeChangeListeners = GetWaterfallModeChangeListeners();
-    for (const auto& listener : waterfallModeChangeListeners) {
+    for (const auto& listener : *waterfallModeChangeListeners) {
         if (listener != nullptr) {
             listener->OnWaterfallModeChange(isWaterfallMode);
         }
@@ -5696,53 +5513,37 @@ void WindowSessionImpl::NotifyWaterfallModeChange(bool isWaterfallMode)
 
 template<typename T>
 EnableIfSame<T, IOccupiedAreaChangeListener,
-    std::vector<sptr<IOccupiedAreaChangeListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<IOccupiedAreaChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IOccupiedAreaChangeListener>> occupiedAreaChangeListeners;
-    for (auto& listener : occupiedAreaChangeListeners_[GetPersistentId()]) {
-        occupiedAreaChangeListeners.push_back(listener);
-    }
-    return occupiedAreaChangeListeners;
+    return occupiedAreaChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IKBWillShowListener, std::vector<sptr<IKBWillShowListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IKBWillShowListener,
+    CowListenerRegistry<sptr<IKBWillShowListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IKBWillShowListener>> keyboardWillShowListeners;
-    for (auto& listener : keyboardWillShowListeners_[GetPersistentId()]) {
-        keyboardWillShowListeners.push_back(listener);
-    }
-    return keyboardWillShowListeners;
+    return keyboardWillShowListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IKBWillHideListener, std::vector<sptr<IKBWillHideListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IKBWillHideListener,
+    CowListenerRegistry<sptr<IKBWillHideListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IKBWillHideListener>> keyboardWillHideListeners;
-    for (auto& listener : keyboardWillHideListeners_[GetPersistentId()]) {
-        keyboardWillHideListeners.push_back(listener);
-    }
-    return keyboardWillHideListeners;
+    return keyboardWillHideListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IKeyboardDidShowListener, std::vector<sptr<IKeyboardDidShowListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IKeyboardDidShowListener,
+    CowListenerRegistry<sptr<IKeyboardDidShowListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IKeyboardDidShowListener>> keyboardDidShowListeners;
-    for (auto& listener : keyboardDidShowListeners_[GetPersistentId()]) {
-        keyboardDidShowListeners.push_back(listener);
-    }
-    return keyboardDidShowListeners;
+    return keyboardDidShowListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IKeyboardDidHideListener, std::vector<sptr<IKeyboardDidHideListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IKeyboardDidHideListener,
+    CowListenerRegistry<sptr<IKeyboardDidHideListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IKeyboardDidHideListener>> keyboardDidHideListeners;
-    for (auto& listener : keyboardDidHideListeners_[GetPersistentId()]) {
-        keyboardDidHideListeners.push_back(listener);
-    }
-    return keyboardDidHideListeners;
+    return keyboardDidHideListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
@@ -5781,134 +5582,60 @@ void WindowSessionImpl::ClearUselessListeners(std::unordered_map<int32_t, T>& li
 }
 
 template<typename T>
-EnableIfSame<T, IWindowStatusChangeListener, std::vector<sptr<IWindowStatusChangeListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowStatusChangeListener,
+    CowListenerRegistry<sptr<IWindowStatusChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowStatusChangeListener>> windowStatusChangeListeners;
-    for (auto& listener : windowStatusChangeListeners_[GetPersistentId()]) {
-        windowStatusChangeListeners.push_back(listener);
-    }
-    return windowStatusChangeListeners;
+    return windowStatusChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IWindowStatusDidChangeListener, std::vector<sptr<IWindowStatusDidChangeListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowStatusDidChangeListener,
+    CowListenerRegistry<sptr<IWindowStatusDidChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowStatusDidChangeListener>> windowStatusDidChangeListeners;
-    for (auto& listener : windowStatusDidChangeListeners_[GetPersistentId()]) {
-        windowStatusDidChangeListeners.push_back(listener);
-    }
-    return windowStatusDidChangeListeners;
+    return windowStatusDidChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IParentWindowSizeChangeListener, std::vector<sptr<IParentWindowSizeChangeListener>>> 
-    WindowSessionImpl::GetListeners()
+EnableIfSame<T, IParentWindowSizeChangeListener,
+    CowListenerRegistry<sptr<IParentWindowSizeChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IParentWindowSizeChangeListener>> parentWindowSizeChangeListeners;
-    for (auto& listener : parentWindowSizeChangeListeners_[GetPersistentId()]) {
-        parentWindowSizeChangeListeners.push_back(listener);
-    }
-    return parentWindowSizeChangeListeners;
+    return parentWindowSizeChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IParentWindowStatusChangeListener, std::vector<sptr<IParentWindowStatusChangeListener>>> 
-    WindowSessionImpl::GetListeners()
+EnableIfSame<T, IParentWindowStatusChangeListener,
+    CowListenerRegistry<sptr<IParentWindowStatusChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IParentWindowStatusChangeListener>> parentWindowStatusChangeListeners;
-    for (auto& listener : parentWindowStatusChangeListeners_[GetPersistentId()]) {
-        parentWindowStatusChangeListeners.push_back(listener);
-    }
-    return parentWindowStatusChangeListeners;
+    return parentWindowStatusChangeListeners_.GetListeners(GetPersistentId());
 }
 
 void WindowSessionImpl::ClearListenersById(int32_t persistentId)
 {
     TLOGI(WmsLogTag::WMS_LIFE, "Called id: %{public}d.", GetPersistentId());
-    {
-        std::lock_guard<std::mutex> lockListener(displayMoveListenerMutex_);
-        ClearUselessListeners(displayMoveListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
-        ClearUselessListeners(lifecycleListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowChangeListenerMutex_);
-        ClearUselessListeners(windowChangeListeners_, persistentId);
-    }
+    displayMoveListeners_.Clear(persistentId);
+    lifecycleListeners_.Clear(persistentId);
+    windowChangeListeners_.Clear(persistentId);
     {
         std::lock_guard<std::recursive_mutex> lockListener(avoidAreaChangeListenerMutex_);
-        ClearUselessListeners(avoidAreaChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(dialogDeathRecipientListenerMutex_);
-        ClearUselessListeners(dialogDeathRecipientListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(dialogTargetTouchListenerMutex_);
-        ClearUselessListeners(dialogTargetTouchListener_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(screenshotListenerMutex_);
-        ClearUselessListeners(screenshotListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(screenshotAppEventListenerMutex_);
-        ClearUselessListeners(screenshotAppEventListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowStatusChangeListenerMutex_);
-        ClearUselessListeners(windowStatusChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowStatusDidChangeListenerMutex_);
-        ClearUselessListeners(windowStatusDidChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowTitleButtonRectChangeListenerMutex_);
-        ClearUselessListeners(windowTitleButtonRectChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(displayIdChangeListenerMutex_);
-        ClearUselessListeners(displayIdChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(systemDensityChangeListenerMutex_);
-        ClearUselessListeners(systemDensityChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(windowDensityChangeListenerMutex_);
-        ClearUselessListeners(windowDensityChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(acrossDisplaysChangeListenerMutex_);
-        ClearUselessListeners(acrossDisplaysChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowNoInteractionListenerMutex_);
-        ClearUselessListeners(windowNoInteractionListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(windowRectChangeListenerMutex_);
-        ClearUselessListeners(windowRectChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(windowTitleChangeListenerMutex_);
-        ClearUselessListeners(windowTitleChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(windowTitleOrHotAreasListenerMutex_);
-        ClearUselessListeners(windowTitleOrHotAreasListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(rectChangeInGlobalDisplayListenerMutex_);
-        ClearUselessListeners(rectChangeInGlobalDisplayListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(secureLimitChangeListenerMutex_);
-        ClearUselessListeners(secureLimitChangeListeners_, persistentId);
-    }
+        avoidAreaChangeListeners_.Clear(persistentId);
+    }
+    dialogDeathRecipientListeners_.Clear(persistentId);
+    dialogTargetTouchListener_.Clear(persistentId);
+    screenshotListeners_.Clear(persistentId);
+    screenshotAppEventListeners_.Clear(persistentId);
+    windowStatusChangeListeners_.Clear(persistentId);
+    windowStatusDidChangeListeners_.Clear(persistentId);
+    windowTitleButtonRectChangeListeners_.Clear(persistentId);
+    displayIdChangeListeners_.Clear(persistentId);
+    systemDensityChangeListeners_.Clear(persistentId);
+    windowDensityChangeListeners_.Clear(persistentId);
+    acrossDisplaysChangeListeners_.Clear(persistentId);
+    windowNoInteractionListeners_.Clear(persistentId);
+    windowRectChangeListeners_.Clear(persistentId);
+    windowTitleChangeListeners_.Clear(persistentId);
+    windowTitleOrHotAreasListeners_.Clear(persistentId);
+    rectChangeInGlobalDisplayListeners_.Clear(persistentId);
+    secureLimitChangeListeners_.Clear(persistentId);
     {
         std::lock_guard<std::mutex> lockListener(subWindowCloseListenersMutex_);
         ClearUselessListeners(subWindowCloseListeners_, persistentId);
@@ -5917,42 +5644,15 @@ void WindowSessionImpl::ClearListenersById(int32_t persistentId)
         std::lock_guard<std::mutex> lockListener(mainWindowCloseListenersMutex_);
         ClearUselessListeners(mainWindowCloseListeners_, persistentId);
     }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowWillCloseListenersMutex_);
-        ClearUselessListeners(windowWillCloseListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(occupiedAreaChangeListenerMutex_);
-        ClearUselessListeners(occupiedAreaChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(keyboardWillShowListenerMutex_);
-        ClearUselessListeners(keyboardWillShowListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(keyboardWillHideListenerMutex_);
-        ClearUselessListeners(keyboardWillHideListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(keyboardDidShowListenerMutex_);
-        ClearUselessListeners(keyboardDidShowListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(keyboardDidHideListenerMutex_);
-        ClearUselessListeners(keyboardDidHideListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(highlightChangeListenerMutex_);
-        ClearUselessListeners(highlightChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowCrossAxisListenerMutex_);
-        ClearUselessListeners(windowCrossAxisListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::mutex> lockListener(waterfallModeChangeListenerMutex_);
-        ClearUselessListeners(waterfallModeChangeListeners_, persistentId);
-    }
+    windowWillCloseListeners_.Clear(persistentId);
+    occupiedAreaChangeListeners_.Clear(persistentId);
+    keyboardWillShowListeners_.Clear(persistentId);
+    keyboardWillHideListeners_.Clear(persistentId);
+    keyboardDidShowListeners_.Clear(persistentId);
+    keyboardDidHideListeners_.Clear(persistentId);
+    highlightChangeListeners_.Clear(persistentId);
+    windowCrossAxisListeners_.Clear(persistentId);
+    waterfallModeChangeListeners_.Clear(persistentId);
     {
         std::lock_guard<std::mutex> lockListener(preferredOrientationChangeListenerMutex_);
         ClearUselessListeners(preferredOrientationChangeListener_, persistentId);
@@ -5961,38 +5661,22 @@ void WindowSessionImpl::ClearListenersById(int32_t persistentId)
         std::lock_guard<std::mutex> lockListener(windowOrientationChangeListenerMutex_);
         ClearUselessListeners(windowOrientationChangeListener_, persistentId);
     }
-    {
-        std::lock_guard<std::mutex> lockListener(windowRotationChangeListenerMutex_);
-        ClearUselessListeners(windowRotationChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowStageLifeCycleListenerMutex_);
-        ClearUselessListeners(windowStageLifecycleListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowHoverStateChangeListenerMutex_);
-        ClearUselessListeners(windowHoverStateChangeListeners_, persistentId);
-    }
+    windowRotationChangeListeners_.Clear(persistentId);
+    windowStageLifecycleListeners_.Clear(persistentId);
+    windowHoverStateChangeListeners_.Clear(persistentId);
     ClearSwitchFreeMultiWindowListenersById(persistentId);
     TLOGI(WmsLogTag::WMS_LIFE, "Clear success, id: %{public}d.", GetPersistentId());
 }
 
 void WindowSessionImpl::ClearParentWindowListeners(int32_t persistentId)
 {
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(parentWindowSizeChangeListenerMutex_);
-        ClearUselessListeners(parentWindowSizeChangeListeners_, persistentId);
-    }
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(parentWindowStatusChangeListenerMutex_);
-        ClearUselessListeners(parentWindowStatusChangeListeners_, persistentId);
-    }
+    parentWindowSizeChangeListeners_.Clear(persistentId);
+    parentWindowStatusChangeListeners_.Clear(persistentId);
 }
 
 void WindowSessionImpl::ClearSwitchFreeMultiWindowListenersById(int32_t persistentId)
 {
-    std::lock_guard<std::mutex> lockListener(switchFreeMultiWindowListenerMutex_);
-    ClearUselessListeners(switchFreeMultiWindowListeners_, persistentId);
+    switchFreeMultiWindowListeners_.Clear(persistentId);
 }
 
 void WindowSessionImpl::RegisterWindowDestroyedListener(const NotifyNativeWinDestroyFunc& func)
@@ -6211,11 +5895,8 @@ void WindowSessionImpl::NotifyAfterForeground(bool needNotifyListeners, bool nee
 {
     if (needNotifyListeners) {
         NotifyAfterLifecycleForeground();
-        {
-            std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
-            auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-            CALL_LIFECYCLE_LISTENER(AfterForeground, lifecycleListeners, isGamePreLaunch_);
-        }
+        auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
+        CALL_LIFECYCLE_LISTENER(AfterForeground, *lifecycleListeners, isGamePreLaunch_);
     }
     GetAttachStateSyncResult(waitAttach, true);
     if (needNotifyUiContent) {
@@ -6301,18 +5982,15 @@ void WindowSessionImpl::NotifyAfterDidForeground(uint32_t reason)
         }
         TLOGND(WmsLogTag::WMS_LIFE, "%{public}s execute", where);
         auto lifecycleListeners = window->GetListeners<IWindowLifeCycle>();
-        CALL_LIFECYCLE_LISTENER(AfterDidForeground, lifecycleListeners, window->isGamePreLaunch_);
+        CALL_LIFECYCLE_LISTENER(AfterDidForeground, *lifecycleListeners, window->isGamePreLaunch_);
     }, where, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
 }
 
 void WindowSessionImpl::NotifyAfterBackground(bool needNotifyListeners, bool needNotifyUiContent)
 {
     if (needNotifyListeners) {
-        {
-            std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
-            auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-            CALL_LIFECYCLE_LISTENER(AfterBackground, lifecycleListeners, false);
-        }
+        auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
+        CALL_LIFECYCLE_LISTENER(AfterBackground, *lifecycleListeners, false);
         NotifyAfterLifecycleBackground();
     }
 
@@ -6356,7 +6034,7 @@ void WindowSessionImpl::NotifyAfterDidBackground(uint32_t reason)
         }
         TLOGND(WmsLogTag::WMS_LIFE, "%{public}s execute", where);
         auto lifecycleListeners = window->GetListeners<IWindowLifeCycle>();
-        CALL_LIFECYCLE_LISTENER(AfterDidBackground, lifecycleListeners, false);
+        CALL_LIFECYCLE_LISTENER(AfterDidBackground, *lifecycleListeners, false);
     }, where, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
 }
 
@@ -6443,17 +6121,15 @@ void WindowSessionImpl::NotifyAfterUnfocused(bool needNotifyUiContent)
 
 void WindowSessionImpl::NotifyWindowAfterFocused()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER(AfterFocused, lifecycleListeners, isGamePreLaunch_);
+    CALL_LIFECYCLE_LISTENER(AfterFocused, *lifecycleListeners, isGamePreLaunch_);
 }
 
 void WindowSessionImpl::NotifyWindowAfterUnfocused()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
     // use needNotifyUinContent to separate ui content callbacks
-    CALL_LIFECYCLE_LISTENER(AfterUnfocused, lifecycleListeners, isGamePreLaunch_);
+    CALL_LIFECYCLE_LISTENER(AfterUnfocused, *lifecycleListeners, isGamePreLaunch_);
 }
 
 void WindowSessionImpl::NotifyUIContentHighlightStatus(bool isHighlighted)
@@ -6494,51 +6170,44 @@ void WindowSessionImpl::NotifyBeforeDestroy(std::string windowName)
 
 void WindowSessionImpl::NotifyAfterDestroy()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER(AfterDestroyed, lifecycleListeners, false);
+    CALL_LIFECYCLE_LISTENER(AfterDestroyed, *lifecycleListeners, false);
 }
 
 void WindowSessionImpl::NotifyAfterActive()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER(AfterActive, lifecycleListeners, false);
+    CALL_LIFECYCLE_LISTENER(AfterActive, *lifecycleListeners, false);
 }
 
 void WindowSessionImpl::NotifyAfterInactive()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER(AfterInactive, lifecycleListeners, false);
+    CALL_LIFECYCLE_LISTENER(AfterInactive, *lifecycleListeners, false);
 }
 
 void WindowSessionImpl::NotifyForegroundFailed(WMError ret)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER_WITH_PARAM(ForegroundFailed, lifecycleListeners, static_cast<int32_t>(ret));
+    CALL_LIFECYCLE_LISTENER_WITH_PARAM(ForegroundFailed, *lifecycleListeners, static_cast<int32_t>(ret));
 }
 
 void WindowSessionImpl::NotifyBackgroundFailed(WMError ret)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER_WITH_PARAM(BackgroundFailed, lifecycleListeners, static_cast<int32_t>(ret));
+    CALL_LIFECYCLE_LISTENER_WITH_PARAM(BackgroundFailed, *lifecycleListeners, static_cast<int32_t>(ret));
 }
 
 void WindowSessionImpl::NotifyAfterResumed()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER(AfterResumed, lifecycleListeners, isGamePreLaunch_);
+    CALL_LIFECYCLE_LISTENER(AfterResumed, *lifecycleListeners, isGamePreLaunch_);
 }
 
 void WindowSessionImpl::NotifyAfterPaused()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowLifeCycle>();
-    CALL_LIFECYCLE_LISTENER(AfterPaused, lifecycleListeners, false);
+    CALL_LIFECYCLE_LISTENER(AfterPaused, *lifecycleListeners, false);
 }
 
 void WindowSessionImpl::NotifyAfterLifecycleForeground()
@@ -6546,16 +6215,14 @@ void WindowSessionImpl::NotifyAfterLifecycleForeground()
     if (isGamePreLaunch_) {
         return;
     }
-    std::lock_guard<std::recursive_mutex> lockListener(windowStageLifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowStageLifeCycle>();
-    CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecycleForeground, lifecycleListeners);
+    CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecycleForeground, *lifecycleListeners);
 }
 
 void WindowSessionImpl::NotifyAfterLifecycleBackground()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(windowStageLifeCycleListenerMutex_);
     auto lifecycleListeners = GetListeners<IWindowStageLifeCycle>();
-    CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecycleBackground, lifecycleListeners);
+    CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecycleBackground, *lifecycleListeners);
 }
 
 void WindowSessionImpl::NotifyAfterLifecycleResumed(bool isGamePreLaunch)
@@ -6565,7 +6232,7 @@ void WindowSessionImpl::NotifyAfterLifecycleResumed(bool isGamePreLaunch)
     bool useControlState = property_->GetUseControlState();
     if (useControlState) {
         auto lifecycleListeners = GetListeners<IWindowStageLifeCycle>();
-        CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecyclePaused, lifecycleListeners);
+        CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecyclePaused, *lifecycleListeners);
         isInteractiveStateFlag_ = false;
         return;
     }
@@ -6581,7 +6248,7 @@ void WindowSessionImpl::NotifyAfterLifecycleResumed(bool isGamePreLaunch)
     isInteractiveStateFlag_ = true;
     if (!isGamePreLaunch) {
         auto lifecycleListeners = GetListeners<IWindowStageLifeCycle>();
-        CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecycleResumed, lifecycleListeners);
+        CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecycleResumed, *lifecycleListeners);
     }
 }
 
@@ -6595,7 +6262,7 @@ void WindowSessionImpl::NotifyAfterLifecyclePaused()
     }
     isInteractiveStateFlag_ = false;
     auto lifecycleListeners = GetListeners<IWindowStageLifeCycle>();
-    CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecyclePaused, lifecycleListeners);
+    CALL_WINDOW_STAGE_LIFECYCLE_LISTENER(AfterLifecyclePaused, *lifecycleListeners);
 }
 
 WSError WindowSessionImpl::MarkProcessed(int32_t eventId)
@@ -6617,16 +6284,14 @@ void WindowSessionImpl::RegisterDialogDeathRecipientListener(const sptr<IDialogD
         WLOGFE("listener is null");
         return;
     }
-    std::lock_guard<std::recursive_mutex> lockListener(dialogDeathRecipientListenerMutex_);
-    RegisterListener(dialogDeathRecipientListeners_[GetPersistentId()], listener);
+    RegisterListener(dialogDeathRecipientListeners_, GetPersistentId(), listener);
 }
 
 void WindowSessionImpl::UnregisterDialogDeathRecipientListener(const sptr<IDialogDeathRecipientListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_DIALOG, "window %{public}s id %{public}d",
         GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::recursive_mutex> lockListener(dialogDeathRecipientListenerMutex_);
-    UnregisterListenerInMap(dialogDeathRecipientListeners_, GetPersistentId(), listener);
+    UnregisterListener(dialogDeathRecipientListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterDialogTargetTouchListener(const sptr<IDialogTargetTouchListener>& listener)
@@ -6637,16 +6302,14 @@ WMError WindowSessionImpl::RegisterDialogTargetTouchListener(const sptr<IDialogT
         WLOGFE("listener is nullptr");
         return WMError::WM_ERROR_NULLPTR;
     }
-    std::lock_guard<std::recursive_mutex> lockListener(dialogTargetTouchListenerMutex_);
-    return RegisterListener(dialogTargetTouchListener_[GetPersistentId()], listener);
+    return RegisterListener(dialogTargetTouchListener_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterDialogTargetTouchListener(const sptr<IDialogTargetTouchListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_DIALOG, "window %{public}s id %{public}d",
         GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::recursive_mutex> lockListener(dialogTargetTouchListenerMutex_);
-    return UnregisterListenerInMap(dialogTargetTouchListener_, GetPersistentId(), listener);
+    return UnregisterListener(dialogTargetTouchListener_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterScreenshotListener(const sptr<IScreenshotListener>& listener)
@@ -6655,12 +6318,12 @@ WMError WindowSessionImpl::RegisterScreenshotListener(const sptr<IScreenshotList
     bool isFirstRegister = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(screenshotListenerMutex_);
-        auto ret = RegisterListener(screenshotListeners_[persistentId], listener);
+        auto ret = RegisterListener(screenshotListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_ATTRIBUTE, "failed: winId=%{public}d", persistentId);
             return ret;
         }
-        isFirstRegister = screenshotListeners_[persistentId].size() == 1;
+        isFirstRegister = screenshotListeners_.GetListenerCount(persistentId) == 1;
     }
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "winId=%{public}d, isFirstRegister=%{public}d", persistentId, isFirstRegister);
     if (!isFirstRegister) {
@@ -6671,7 +6334,7 @@ WMError WindowSessionImpl::RegisterScreenshotListener(const sptr<IScreenshotList
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "ipc failed: winId=%{public}d, retCode=%{public}d",
             persistentId, static_cast<int32_t>(ret));
         std::lock_guard<std::recursive_mutex> lockListener(screenshotListenerMutex_);
-        ret = UnregisterListenerInMap(screenshotListeners_, persistentId, listener);
+        ret = UnregisterListener(screenshotListeners_, persistentId, listener);
     }
     return ret;
 }
@@ -6682,15 +6345,12 @@ WMError WindowSessionImpl::UnregisterScreenshotListener(const sptr<IScreenshotLi
     bool isLastUnregister = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(screenshotListenerMutex_);
-        auto ret = UnregisterListenerInMap(screenshotListeners_, persistentId, listener);
+        auto ret = UnregisterListener(screenshotListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_ATTRIBUTE, "failed: winId=%{public}d", persistentId);
             return ret;
         }
-        if (screenshotListeners_[persistentId].empty()) {
-            screenshotListeners_.erase(persistentId);
-            isLastUnregister = true;
-        }
+        isLastUnregister = !screenshotListeners_.HasListeners(persistentId);
     }
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "winId=%{public}d, isLastUnregister=%{public}d", persistentId, isLastUnregister);
     if (!isLastUnregister) {
@@ -6701,7 +6361,7 @@ WMError WindowSessionImpl::UnregisterScreenshotListener(const sptr<IScreenshotLi
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "ipc failed: winId=%{public}d, retCode=%{public}d",
             persistentId, static_cast<int32_t>(ret));
         std::lock_guard<std::recursive_mutex> lockListener(screenshotListenerMutex_);
-        ret = RegisterListener(screenshotListeners_[persistentId], listener);
+        ret = RegisterListener(screenshotListeners_, persistentId, listener);
     }
     return ret;
 }
@@ -6722,11 +6382,11 @@ WMError WindowSessionImpl::RegisterScreenshotAppEventListener(const IScreenshotA
     bool isUpdate = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(screenshotAppEventListenerMutex_);
-        ret = RegisterListener(screenshotAppEventListeners_[persistentId], listener);
+        ret = RegisterListener(screenshotAppEventListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        if (screenshotAppEventListeners_[persistentId].size() == 1) {
+        if (screenshotAppEventListeners_.GetListenerCount(persistentId) == 1) {
             isUpdate = true;
         }
     }
@@ -6753,11 +6413,11 @@ WMError WindowSessionImpl::UnregisterScreenshotAppEventListener(const IScreensho
     bool isUpdate = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(screenshotAppEventListenerMutex_);
-        ret = UnregisterListenerInMap(screenshotAppEventListeners_, persistentId, listener);
+        ret = UnregisterListener(screenshotAppEventListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        if (screenshotAppEventListeners_[persistentId].empty()) {
+        if (!screenshotAppEventListeners_.HasListeners(persistentId)) {
             isUpdate = true;
         }
     }
@@ -6769,49 +6429,38 @@ WMError WindowSessionImpl::UnregisterScreenshotAppEventListener(const IScreensho
 }
 
 template<typename T>
-EnableIfSame<T, IDialogDeathRecipientListener, std::vector<sptr<IDialogDeathRecipientListener>>> WindowSessionImpl::
-    GetListeners()
+EnableIfSame<T, IDialogDeathRecipientListener,
+    CowListenerRegistry<sptr<IDialogDeathRecipientListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IDialogDeathRecipientListener>> dialogDeathRecipientListener;
-    for (auto& listener : dialogDeathRecipientListeners_[GetPersistentId()]) {
-        dialogDeathRecipientListener.push_back(listener);
-    }
-    return dialogDeathRecipientListener;
+    return dialogDeathRecipientListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
 EnableIfSame<T, IDialogTargetTouchListener,
-    std::vector<sptr<IDialogTargetTouchListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<IDialogTargetTouchListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IDialogTargetTouchListener>> dialogTargetTouchListener;
-    for (auto& listener : dialogTargetTouchListener_[GetPersistentId()]) {
-        dialogTargetTouchListener.push_back(listener);
-    }
-    return dialogTargetTouchListener;
+    return dialogTargetTouchListener_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IScreenshotListener, std::vector<sptr<IScreenshotListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IScreenshotListener,
+    CowListenerRegistry<sptr<IScreenshotListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IScreenshotListener>> screenshotListeners;
-    for (auto& listener : screenshotListeners_[GetPersistentId()]) {
-        screenshotListeners.push_back(listener);
-    }
-    return screenshotListeners;
+    return screenshotListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IScreenshotAppEventListener, std::vector<IScreenshotAppEventListenerSptr>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IScreenshotAppEventListener,
+    CowListenerRegistry<IScreenshotAppEventListenerSptr>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    return screenshotAppEventListeners_[GetPersistentId()];
+    return screenshotAppEventListeners_.GetListeners(GetPersistentId());
 }
 
 WSError WindowSessionImpl::NotifyDestroy()
 {
     if (WindowHelper::IsDialogWindow(property_->GetWindowType())) {
-        std::lock_guard<std::recursive_mutex> lockListener(dialogDeathRecipientListenerMutex_);
         auto dialogDeathRecipientListener = GetListeners<IDialogDeathRecipientListener>();
-        for (auto& listener : dialogDeathRecipientListener) {
+        for (auto& listener : *dialogDeathRecipientListener) {
             if (listener != nullptr) {
                 listener->OnDialogDeathRecipient();
             }
@@ -6825,25 +6474,19 @@ WSError WindowSessionImpl::NotifyDestroy()
 }
 
 template<typename T>
-EnableIfSame<T, IDisplayMoveListener, std::vector<sptr<IDisplayMoveListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IDisplayMoveListener,
+    CowListenerRegistry<sptr<IDisplayMoveListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IDisplayMoveListener>> displayMoveListeners;
-    for (auto& listener : displayMoveListeners_[GetPersistentId()]) {
-        displayMoveListeners.push_back(listener);
-    }
-    return displayMoveListeners;
+    return displayMoveListeners_.GetListeners(GetPersistentId());
 }
 
 void WindowSessionImpl::NotifyDisplayMove(DisplayId from, DisplayId to)
 {
     WLOGFD("from %{public}" PRIu64 " to %{public}" PRIu64, from, to);
-    {
-        std::lock_guard<std::mutex> lockListener(displayMoveListenerMutex_);
-        auto displayMoveListeners = GetListeners<IDisplayMoveListener>();
-        for (auto& listener : displayMoveListeners) {
-            if (listener != nullptr) {
-                listener->OnDisplayMove(from, to);
-            }
+    auto displayMoveListeners = GetListeners<IDisplayMoveListener>();
+    for (auto& listener : *displayMoveListeners) {
+        if (listener != nullptr) {
+            listener->OnDisplayMove(from, to);
         }
     }
     NotifyDmsDisplayMove(to);
@@ -6875,9 +6518,8 @@ void WindowSessionImpl::NotifyTouchDialogTarget(int32_t posX, int32_t posY)
     if (auto hostSession = GetHostSession()) {
         hostSession->ProcessPointDownSession(posX, posY);
     }
-    std::lock_guard<std::recursive_mutex> lockListener(dialogTargetTouchListenerMutex_);
     auto dialogTargetTouchListener = GetListeners<IDialogTargetTouchListener>();
-    for (auto& listener : dialogTargetTouchListener) {
+    for (auto& listener : *dialogTargetTouchListener) {
         if (listener != nullptr) {
             listener->OnDialogTargetTouch();
         }
@@ -6886,9 +6528,8 @@ void WindowSessionImpl::NotifyTouchDialogTarget(int32_t posX, int32_t posY)
 
 void WindowSessionImpl::NotifyScreenshot()
 {
-    std::lock_guard<std::recursive_mutex> lockListener(screenshotListenerMutex_);
     auto screenshotListeners = GetListeners<IScreenshotListener>();
-    for (auto& listener : screenshotListeners) {
+    for (auto& listener : *screenshotListeners) {
         if (listener != nullptr) {
             listener->OnScreenshot();
         }
@@ -6904,9 +6545,8 @@ WSError WindowSessionImpl::NotifyScreenshotAppEvent(ScreenshotEventType type)
 {
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "winId: %{public}d, screenshotEvent: %{public}d",
         GetPersistentId(), type);
-    std::lock_guard<std::recursive_mutex> lockListener(screenshotAppEventListenerMutex_);
     auto screenshotAppEventListeners = GetListeners<IScreenshotAppEventListener>();
-    for (auto& listener : screenshotAppEventListeners) {
+    for (auto& listener : *screenshotAppEventListeners) {
         if (listener != nullptr) {
             listener->OnScreenshotAppEvent(type);
         }
@@ -6921,11 +6561,10 @@ void WindowSessionImpl::NotifySizeChange(Rect rect, WindowSizeChangeReason reaso
         NotifyTitleChange(true, 0);
     }
     {
-        std::lock_guard<std::recursive_mutex> lockListener(windowChangeListenerMutex_);
         auto windowChangeListeners = GetListeners<IWindowChangeListener>();
         TLOGD(WmsLogTag::WMS_LAYOUT, "Id:%{public}d, sizeChange listenerSize:%{public}zu",
-            GetPersistentId(), windowChangeListeners.size());
-        for (auto& [listener, useHookedSize] : windowChangeListeners) {
+            GetPersistentId(), windowChangeListeners->size());
+        for (auto& [listener, useHookedSize] : *windowChangeListeners) {
             if (listener != nullptr) {
                 Rect hookedRect = rect;
                 HookWindowSizeByHookWindowInfo(hookedRect);
@@ -6939,11 +6578,10 @@ void WindowSessionImpl::NotifySizeChange(Rect rect, WindowSizeChangeReason reaso
         }
     }
     {
-        std::lock_guard<std::mutex> lockRectListener(windowRectChangeListenerMutex_);
         auto windowRectChangeListeners = GetListeners<IWindowRectChangeListener>();
         TLOGD(WmsLogTag::WMS_LAYOUT, "Id:%{public}d, rectChange listenerSize:%{public}zu",
-            GetPersistentId(), windowRectChangeListeners.size());
-        for (auto& [listener, useHookedSize] : windowRectChangeListeners) {
+            GetPersistentId(), windowRectChangeListeners->size());
+        for (auto& [listener, useHookedSize] : *windowRectChangeListeners) {
             if (listener != nullptr) {
                 Rect hookedRect = rect;
                 HookWindowSizeByHookWindowInfo(hookedRect);
@@ -6966,8 +6604,8 @@ void WindowSessionImpl::NotifyGlobalDisplayRectChange(const Rect& rect, WindowSi
     auto listeners = GetListeners<IRectChangeInGlobalDisplayListener>();
     TLOGD(WmsLogTag::WMS_LAYOUT,
         "windowId: %{public}d, rect: %{public}s, reason: %{public}d, listenerSize: %{public}zu",
-        GetPersistentId(), rect.ToString().c_str(), static_cast<int32_t>(reason), listeners.size());
-    for (const auto& [listener, useHookedSize] : listeners) {
+        GetPersistentId(), rect.ToString().c_str(), static_cast<int32_t>(reason), listeners->size());
+    for (const auto& [listener, useHookedSize] : *listeners) {
         if (listener) {
             Rect hookedRect = rect;
             HookWindowSizeByHookWindowInfo(hookedRect);
@@ -7050,7 +6688,7 @@ WMError WindowSessionImpl::NotifyWindowWillClose(sptr<Window> window)
     std::lock_guard<std::recursive_mutex> lockListener(windowWillCloseListenersMutex_);
     const auto& windowWillCloseListeners = GetListeners<IWindowWillCloseListener>();
     auto res = WMError::WM_ERROR_NULLPTR;
-    for (const auto& listener : windowWillCloseListeners) {
+    for (const auto& listener : *windowWillCloseListeners) {
         if (listener != nullptr) {
             listener->OnWindowWillClose(window);
             res = WMError::WM_OK;
@@ -7061,9 +6699,8 @@ WMError WindowSessionImpl::NotifyWindowWillClose(sptr<Window> window)
 
 void WindowSessionImpl::NotifySwitchFreeMultiWindow(bool enable)
 {
-    std::lock_guard<std::mutex> lockListener(switchFreeMultiWindowListenerMutex_);
     auto switchFreeMultiWindowListeners = GetListeners<ISwitchFreeMultiWindowListener>();
-    for (auto& listener : switchFreeMultiWindowListeners) {
+    for (auto& listener : *switchFreeMultiWindowListeners) {
         if (listener != nullptr) {
             listener->OnSwitchFreeMultiWindow(enable);
         }
@@ -7079,7 +6716,7 @@ void WindowSessionImpl::NotifyTitleChange(bool isShow, int32_t height)
     property_->SetStatusBarHeightInImmersive(height);
     std::vector<Rect> rectAreas = GetAncoWindowHotAreas();
  
-    for (auto& listener : windowTitleOrHotAreasListeners) {
+    for (auto& listener : *windowTitleOrHotAreasListeners) {
         if (listener != nullptr) {
             TLOGI(WmsLogTag::WMS_IMMS, "NotifyTitleChange, the title bar is show? %{public}d", isShow);
             listener->OnTitleOrHotAreasChange(rectAreas, isShow);
@@ -7155,11 +6792,11 @@ WMError WindowSessionImpl::RegisterAvoidAreaChangeListener(const sptr<IAvoidArea
     bool isUpdate = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(avoidAreaChangeListenerMutex_);
-        ret = RegisterListener(avoidAreaChangeListeners_[persistentId], listener);
+        ret = RegisterListener(avoidAreaChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        if (avoidAreaChangeListeners_[persistentId].size() == 1) {
+        if (avoidAreaChangeListeners_.GetListenerCount(persistentId) == 1) {
             isUpdate = true;
         }
     }
@@ -7182,11 +6819,11 @@ WMError WindowSessionImpl::UnregisterAvoidAreaChangeListener(const sptr<IAvoidAr
     bool isUpdate = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(avoidAreaChangeListenerMutex_);
-        ret = UnregisterListenerInMap(avoidAreaChangeListeners_, persistentId, listener);
+        ret = UnregisterListener(avoidAreaChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        if (avoidAreaChangeListeners_[persistentId].empty()) {
+        if (!avoidAreaChangeListeners_.HasListeners(persistentId)) {
             isUpdate = true;
         }
     }
@@ -7201,7 +6838,7 @@ WMError WindowSessionImpl::RegisterExtensionAvoidAreaChangeListener(const sptr<I
     auto persistentId = GetPersistentId();
     WLOGFI("Start, id:%{public}d", persistentId);
     std::lock_guard<std::recursive_mutex> lockListener(avoidAreaChangeListenerMutex_);
-    return RegisterListener(avoidAreaChangeListeners_[persistentId], listener);
+    return RegisterListener(avoidAreaChangeListeners_, persistentId, listener);
 }
 
 WMError WindowSessionImpl::UnregisterExtensionAvoidAreaChangeListener(const sptr<IAvoidAreaChangedListener>& listener)
@@ -7209,23 +6846,18 @@ WMError WindowSessionImpl::UnregisterExtensionAvoidAreaChangeListener(const sptr
     auto persistentId = GetPersistentId();
     WLOGFI("Start, id:%{public}d", persistentId);
     std::lock_guard<std::recursive_mutex> lockListener(avoidAreaChangeListenerMutex_);
-    return UnregisterListenerInMap(avoidAreaChangeListeners_, persistentId, listener);
+    return UnregisterListener(avoidAreaChangeListeners_, persistentId, listener);
 }
 
 template<typename T>
 EnableIfSame<T, IAvoidAreaChangedListener,
-    std::vector<sptr<IAvoidAreaChangedListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<IAvoidAreaChangedListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IAvoidAreaChangedListener>> windowChangeListeners;
-    for (auto& listener : avoidAreaChangeListeners_[GetPersistentId()]) {
-        windowChangeListeners.push_back(listener);
-    }
-    return windowChangeListeners;
+    return avoidAreaChangeListeners_.GetListeners(GetPersistentId());
 }
 
 void WindowSessionImpl::NotifyAvoidAreaChange(const sptr<AvoidArea>& avoidArea, AvoidAreaType type)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(avoidAreaChangeListenerMutex_);
     auto avoidAreaChangeListeners = GetListeners<IAvoidAreaChangedListener>();
     bool isUIExtensionWithSystemHost =
         WindowHelper::IsUIExtensionWindow(GetType()) && WindowHelper::IsSystemWindow(GetRootHostWindowType());
@@ -7242,7 +6874,7 @@ void WindowSessionImpl::NotifyAvoidAreaChange(const sptr<AvoidArea>& avoidArea,
             GetPersistentId(), currentApiVersion, type, newAvoidArea.ToString().c_str());
     }
 
-    for (auto& listener : avoidAreaChangeListeners) {
+    for (auto& listener : *avoidAreaChangeListeners) {
         if (listener != nullptr) {
             listener->OnAvoidAreaChanged(newAvoidArea, type);
         }
@@ -7424,12 +7056,12 @@ WMError WindowSessionImpl::RegisterTouchOutsideListener(const sptr<ITouchOutside
 
     {
         std::lock_guard<std::recursive_mutex> lockListener(touchOutsideListenerMutex_);
-        ret = RegisterListener(touchOutsideListeners_[persistentId], listener);
+        ret = RegisterListener(touchOutsideListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_EVENT, "fail, ret:%{public}u", ret);
             return ret;
         }
-        if (touchOutsideListeners_[persistentId].size() == 1) {
+        if (touchOutsideListeners_.GetListenerCount(persistentId) == 1) {
             isUpdate = true;
         }
     }
@@ -7453,12 +7085,12 @@ WMError WindowSessionImpl::UnregisterTouchOutsideListener(const sptr<ITouchOutsi
 
     {
         std::lock_guard<std::recursive_mutex> lockListener(touchOutsideListenerMutex_);
-        ret = UnregisterListenerInMap(touchOutsideListeners_, persistentId, listener);
+        ret = UnregisterListener(touchOutsideListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_EVENT, "fail, ret:%{public}u", ret);
             return ret;
         }
-        if (touchOutsideListeners_[persistentId].empty()) {
+        if (!touchOutsideListeners_.HasListeners(persistentId)) {
             isUpdate = true;
         }
     }
@@ -7469,13 +7101,10 @@ WMError WindowSessionImpl::UnregisterTouchOutsideListener(const sptr<ITouchOutsi
 }
 
 template<typename T>
-EnableIfSame<T, ITouchOutsideListener, std::vector<sptr<ITouchOutsideListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, ITouchOutsideListener,
+    CowListenerRegistry<sptr<ITouchOutsideListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<ITouchOutsideListener>> windowChangeListeners;
-    for (auto& listener : touchOutsideListeners_[GetPersistentId()]) {
-        windowChangeListeners.push_back(listener);
-    }
-    return windowChangeListeners;
+    return touchOutsideListeners_.GetListeners(GetPersistentId());
 }
 
 void WindowSessionImpl::NotifyUIExtTouchOutside()
@@ -7494,9 +7123,8 @@ WSError WindowSessionImpl::NotifyTouchOutside()
 {
     TLOGD(WmsLogTag::WMS_EVENT, "window: name=%{public}s, id=%{public}u",
         GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::recursive_mutex> lockListener(touchOutsideListenerMutex_);
     auto touchOutsideListeners = GetListeners<ITouchOutsideListener>();
-    for (auto& listener : touchOutsideListeners) {
+    for (auto& listener : *touchOutsideListeners) {
         if (listener != nullptr) {
             listener->OnTouchOutside();
         }
@@ -7513,11 +7141,11 @@ WMError WindowSessionImpl::RegisterWindowVisibilityChangeListener(const IWindowV
     bool isFirstRegister = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(windowVisibilityChangeListenerMutex_);
-        ret = RegisterListener(windowVisibilityChangeListeners_[persistentId], listener);
+        ret = RegisterListener(windowVisibilityChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        isFirstRegister = windowVisibilityChangeListeners_[persistentId].size() == 1;
+        isFirstRegister = windowVisibilityChangeListeners_.GetListenerCount(persistentId) == 1;
     }
 
     if (isFirstRegister) {
@@ -7534,11 +7162,11 @@ WMError WindowSessionImpl::UnregisterWindowVisibilityChangeListener(const IWindo
     bool isLastUnregister = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(windowVisibilityChangeListenerMutex_);
-        ret = UnregisterListenerInMap(windowVisibilityChangeListeners_, persistentId, listener);
+        ret = UnregisterListener(windowVisibilityChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        isLastUnregister = windowVisibilityChangeListeners_[persistentId].empty();
+        isLastUnregister = !windowVisibilityChangeListeners_.HasListeners(persistentId);
     }
 
     if (isLastUnregister) {
@@ -7553,12 +7181,12 @@ WMError WindowSessionImpl::RegisterOcclusionStateChangeListener(const sptr<IOccl
     bool isFirstRegister = false;
     {
         std::lock_guard<std::mutex> lockListener(occlusionStateChangeListenerMutex_);
-        auto ret = RegisterListener(occlusionStateChangeListeners_[persistentId], listener);
+        auto ret = RegisterListener(occlusionStateChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_ATTRIBUTE, "failed: winId=%{public}d", persistentId);
             return ret;
         }
-        isFirstRegister = occlusionStateChangeListeners_[persistentId].size() == 1;
+        isFirstRegister = occlusionStateChangeListeners_.GetListenerCount(persistentId) == 1;
     }
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "winId=%{public}d, isFirstRegister=%{public}d", persistentId, isFirstRegister);
     if (!isFirstRegister) {
@@ -7569,7 +7197,7 @@ WMError WindowSessionImpl::RegisterOcclusionStateChangeListener(const sptr<IOccl
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "ipc failed: winId=%{public}d, retCode=%{public}d",
             persistentId, static_cast<int32_t>(ret));
         std::lock_guard<std::mutex> lockListener(occlusionStateChangeListenerMutex_);
-        ret = UnregisterListenerInMap(occlusionStateChangeListeners_, persistentId, listener);
+        ret = UnregisterListener(occlusionStateChangeListeners_, persistentId, listener);
     }
     return ret;
 }
@@ -7580,15 +7208,12 @@ WMError WindowSessionImpl::UnregisterOcclusionStateChangeListener(const sptr<IOc
     bool isLastUnregister = false;
     {
         std::lock_guard<std::mutex> lockListener(occlusionStateChangeListenerMutex_);
-        auto ret = UnregisterListenerInMap(occlusionStateChangeListeners_, persistentId, listener);
+        auto ret = UnregisterListener(occlusionStateChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_ATTRIBUTE, "failed: winId=%{public}d", persistentId);
             return ret;
         }
-        if (occlusionStateChangeListeners_[persistentId].empty()) {
-            occlusionStateChangeListeners_.erase(persistentId);
-            isLastUnregister = true;
-        }
+        isLastUnregister = !occlusionStateChangeListeners_.HasListeners(persistentId);
     }
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "winId=%{public}d, isLastUnregister=%{public}d", persistentId, isLastUnregister);
     if (!isLastUnregister) {
@@ -7599,7 +7224,7 @@ WMError WindowSessionImpl::UnregisterOcclusionStateChangeListener(const sptr<IOc
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "ipc failed: winId=%{public}d, retCode=%{public}d",
             persistentId, static_cast<int32_t>(ret));
         std::lock_guard<std::mutex> lockListener(occlusionStateChangeListenerMutex_);
-        ret = RegisterListener(occlusionStateChangeListeners_[persistentId], listener);
+        ret = RegisterListener(occlusionStateChangeListeners_, persistentId, listener);
     }
     return ret;
 }
@@ -7607,13 +7232,7 @@ WMError WindowSessionImpl::UnregisterOcclusionStateChangeListener(const sptr<IOc
 WSError WindowSessionImpl::NotifyWindowOcclusionState(const WindowVisibilityState state)
 {
     auto persistentId = GetPersistentId();
-    std::vector<sptr<IOcclusionStateChangedListener>> listeners;
-    {
-        std::lock_guard<std::mutex> lockListener(occlusionStateChangeListenerMutex_);
-        for (auto& listener : occlusionStateChangeListeners_[persistentId]) {
-            listeners.push_back(listener);
-        }
-    }
+    auto listeners = occlusionStateChangeListeners_.GetListeners(persistentId);
     auto visibilityState = state;
     if (static_cast<uint32_t>(state) > static_cast<uint32_t>(
         WindowVisibilityState::WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION)) {
@@ -7628,7 +7247,7 @@ WSError WindowSessionImpl::NotifyWindowOcclusionState(const WindowVisibilityStat
     }
     lastVisibilityState_ = visibilityState;
     uint32_t notifyCounter = 0;
-    for (auto& listener : listeners) {
+    for (auto& listener : *listeners) {
         if (listener != nullptr) {
             listener->OnOcclusionStateChanged(visibilityState);
             notifyCounter++;
@@ -7650,12 +7269,12 @@ WMError WindowSessionImpl::RegisterFrameMetricsChangeListener(const sptr<IFrameM
     bool isFirstRegister = false;
     {
         std::lock_guard<std::mutex> lockListener(frameMetricsChangeListenerMutex_);
-        auto ret = RegisterListener(frameMetricsChangeListeners_[persistentId], listener);
+        auto ret = RegisterListener(frameMetricsChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_ATTRIBUTE, "failed: winId=%{public}d", persistentId);
             return ret;
         }
-        isFirstRegister = frameMetricsChangeListeners_[persistentId].size() == 1;
+        isFirstRegister = frameMetricsChangeListeners_.GetListenerCount(persistentId) == 1;
     }
     if (!isFirstRegister) {
         TLOGI(WmsLogTag::WMS_ATTRIBUTE, "register another: winId=%{public}d", persistentId);
@@ -7684,15 +7303,12 @@ WMError WindowSessionImpl::UnregisterFrameMetricsChangeListener(const sptr<IFram
     bool isLastUnregister = false;
     {
         std::lock_guard<std::mutex> lockListener(frameMetricsChangeListenerMutex_);
-        WMError ret = UnregisterListenerInMap(frameMetricsChangeListeners_, persistentId, listener);
+        WMError ret = UnregisterListener(frameMetricsChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_ATTRIBUTE, "failed: winId=%{public}d", persistentId);
             return ret;
         }
-        if (frameMetricsChangeListeners_[persistentId].empty()) {
-            frameMetricsChangeListeners_.erase(persistentId);
-            isLastUnregister = true;
-        }
+        isLastUnregister = !frameMetricsChangeListeners_.HasListeners(persistentId);
     }
     if (!isLastUnregister) {
         TLOGI(WmsLogTag::WMS_ATTRIBUTE, "unregister another: winId=%{public}d", persistentId);
@@ -7706,20 +7322,14 @@ WMError WindowSessionImpl::UnregisterFrameMetricsChangeListener(const sptr<IFram
 void WindowSessionImpl::NotifyFrameMetrics(const Ace::FrameMetrics& info)
 {
     auto persistentId = GetPersistentId();
-    std::vector<sptr<IFrameMetricsChangedListener>> listeners;
-    {
-        std::lock_guard<std::mutex> lockListener(frameMetricsChangeListenerMutex_);
-        for (auto& listener : frameMetricsChangeListeners_[persistentId]) {
-            listeners.push_back(listener);
-        }
-    }
+    auto listeners = frameMetricsChangeListeners_.GetListeners(persistentId);
     uint32_t notifyCounter = 0;
     FrameMetrics metrics;
     metrics.firstDrawFrame_ = info.firstDrawFrame;
     metrics.inputHandlingDuration_ = info.inputHandlingDuration;
     metrics.layoutMeasureDuration_ = info.layoutMeasureDuration;
     metrics.vsyncTimestamp_ = info.vsyncTimestamp;
-    for (auto& listener : listeners) {
+    for (auto& listener : *listeners) {
         if (listener != nullptr) {
             listener->OnFrameMetricsChanged(metrics);
             notifyCounter++;
@@ -7734,43 +7344,37 @@ void WindowSessionImpl::NotifyFrameMetrics(const Ace::FrameMetrics& info)
 WMError WindowSessionImpl::RegisterDisplayIdChangeListener(const IDisplayIdChangeListenerSptr& listener)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "name=%{public}s, id=%{public}u", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(displayIdChangeListenerMutex_);
-    return RegisterListener(displayIdChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(displayIdChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterDisplayIdChangeListener(const IDisplayIdChangeListenerSptr& listener)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "name=%{public}s, id=%{public}u", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(displayIdChangeListenerMutex_);
-    return UnregisterListenerInMap(displayIdChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(displayIdChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterSystemDensityChangeListener(const ISystemDensityChangeListenerSptr& listener)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "name=%{public}s, id=%{public}d", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(systemDensityChangeListenerMutex_);
-    return RegisterListener(systemDensityChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(systemDensityChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterSystemDensityChangeListener(const ISystemDensityChangeListenerSptr& listener)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "name=%{public}s, id=%{public}d", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(systemDensityChangeListenerMutex_);
-    return UnregisterListenerInMap(systemDensityChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(systemDensityChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterWindowDensityChangeListener(const IWindowDensityChangeListenerSptr& listener)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "name=%{public}s, id=%{public}d", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(windowDensityChangeListenerMutex_);
-    return RegisterListener(windowDensityChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(windowDensityChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWindowDensityChangeListener(const IWindowDensityChangeListenerSptr& listener)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "name=%{public}s, id=%{public}d", GetWindowName().c_str(), GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(windowDensityChangeListenerMutex_);
-    return UnregisterListener(windowDensityChangeListeners_[GetPersistentId()], listener);
+    return UnregisterListener(windowDensityChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::RegisterAcrossDisplaysChangeListener(
@@ -7790,11 +7394,11 @@ WMError WindowSessionImpl::RegisterAcrossDisplaysChangeListener(
     bool isUpdate = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(acrossDisplaysChangeListenerMutex_);
-        ret = RegisterListener(acrossDisplaysChangeListeners_[persistentId], listener);
+        ret = RegisterListener(acrossDisplaysChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        if (acrossDisplaysChangeListeners_[persistentId].size() == 1) {
+        if (acrossDisplaysChangeListeners_.GetListenerCount(persistentId) == 1) {
             isUpdate = true;
         }
     }
@@ -7804,7 +7408,7 @@ WMError WindowSessionImpl::RegisterAcrossDisplaysChangeListener(
     }
     if (ret != WMError::WM_OK) {
         std::lock_guard<std::recursive_mutex> lockListener(acrossDisplaysChangeListenerMutex_);
-        UnregisterListenerInMap(acrossDisplaysChangeListeners_, persistentId, listener);
+        UnregisterListener(acrossDisplaysChangeListeners_, persistentId, listener);
     }
     return ret;
 }
@@ -7826,11 +7430,11 @@ WMError WindowSessionImpl::UnregisterAcrossDisplaysChangeListener(
     bool isUpdate = false;
     {
         std::lock_guard<std::recursive_mutex> lockListener(acrossDisplaysChangeListenerMutex_);
-        ret = UnregisterListenerInMap(acrossDisplaysChangeListeners_, persistentId, listener);
+        ret = UnregisterListener(acrossDisplaysChangeListeners_, persistentId, listener);
         if (ret != WMError::WM_OK) {
             return ret;
         }
-        if (acrossDisplaysChangeListeners_[persistentId].empty()) {
+        if (!acrossDisplaysChangeListeners_.HasListeners(persistentId)) {
             isUpdate = true;
         }
     }
@@ -7840,7 +7444,7 @@ WMError WindowSessionImpl::UnregisterAcrossDisplaysChangeListener(
     }
     if (ret != WMError::WM_OK) {
         std::lock_guard<std::recursive_mutex> lockListener(acrossDisplaysChangeListenerMutex_);
-        RegisterListener(acrossDisplaysChangeListeners_[persistentId], listener);
+        RegisterListener(acrossDisplaysChangeListeners_, persistentId, listener);
     }
     return ret;
 }
@@ -7849,7 +7453,7 @@ WMError WindowSessionImpl::RegisterWindowNoInteractionListener(const IWindowNoIn
 {
     WLOGFD("in");
     std::lock_guard<std::recursive_mutex> lockListener(windowNoInteractionListenerMutex_);
-    WMError ret = RegisterListener(windowNoInteractionListeners_[GetPersistentId()], listener);
+    WMError ret = RegisterListener(windowNoInteractionListeners_, GetPersistentId(), listener);
     if (ret != WMError::WM_OK) {
         WLOGFE("register failed.");
     } else {
@@ -7862,21 +7466,18 @@ WMError WindowSessionImpl::UnregisterWindowNoInteractionListener(const IWindowNo
 {
     WLOGFD("in");
     std::lock_guard<std::recursive_mutex> lockListener(windowNoInteractionListenerMutex_);
-    WMError ret = UnregisterListenerInMap(windowNoInteractionListeners_, GetPersistentId(), listener);
-    if (windowNoInteractionListeners_[GetPersistentId()].empty()) {
+    WMError ret = UnregisterListener(windowNoInteractionListeners_, GetPersistentId(), listener);
+    if (!windowNoInteractionListeners_.HasListeners(GetPersistentId())) {
         lastInteractionEventId_.store(-1);
     }
     return ret;
 }
 
 template<typename T>
-EnableIfSame<T, IWindowRotationChangeListener, std::vector<sptr<IWindowRotationChangeListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowRotationChangeListener,
+    CowListenerRegistry<sptr<IWindowRotationChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowRotationChangeListener>> windowRotationChangeListener;
-    for (const auto& listener : windowRotationChangeListeners_[GetPersistentId()]) {
-        windowRotationChangeListener.push_back(listener);
-    }
-    return windowRotationChangeListener;
+    return windowRotationChangeListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterWindowRotationChangeListener(const sptr<IWindowRotationChangeListener>& listener)
@@ -7889,7 +7490,7 @@ WMError WindowSessionImpl::RegisterWindowRotationChangeListener(const sptr<IWind
     WMError ret = WMError::WM_OK;
     {
         std::lock_guard<std::mutex> lockListener(windowRotationChangeListenerMutex_);
-        ret = RegisterListener(windowRotationChangeListeners_[persistentId], listener);
+        ret = RegisterListener(windowRotationChangeListeners_, persistentId, listener);
     }
     auto hostSession = GetHostSession();
     if (hostSession != nullptr && ret == WMError::WM_OK) {
@@ -7905,9 +7506,8 @@ WMError WindowSessionImpl::UnregisterWindowRotationChangeListener(const sptr<IWi
     bool windowRotationChangeListenerEmpty = false;
     {
         std::lock_guard<std::mutex> lockListener(windowRotationChangeListenerMutex_);
-        ret = UnregisterListenerInMap(windowRotationChangeListeners_, persistentId, listener);
-        windowRotationChangeListenerEmpty = windowRotationChangeListeners_.count(persistentId) == 0 ||
-                                            windowRotationChangeListeners_[persistentId].empty();
+        ret = UnregisterListener(windowRotationChangeListeners_, persistentId, listener);
+        windowRotationChangeListenerEmpty = !windowRotationChangeListeners_.HasListeners(persistentId);
     }
     auto hostSession = GetHostSession();
     if (hostSession != nullptr && windowRotationChangeListenerEmpty) {
@@ -7917,57 +7517,52 @@ WMError WindowSessionImpl::UnregisterWindowRotationChangeListener(const sptr<IWi
 }
 
 template<typename T>
-EnableIfSame<T, IWindowVisibilityChangedListener, std::vector<IWindowVisibilityListenerSptr>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowVisibilityChangedListener,
+    CowListenerRegistry<IWindowVisibilityListenerSptr>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<IWindowVisibilityListenerSptr> windowVisibilityChangeListeners;
-    for (auto& listener : windowVisibilityChangeListeners_[GetPersistentId()]) {
-        windowVisibilityChangeListeners.push_back(listener);
-    }
-    return windowVisibilityChangeListeners;
+    return windowVisibilityChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
 EnableIfSame<T, IDisplayIdChangeListener,
-    std::vector<IDisplayIdChangeListenerSptr>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<IDisplayIdChangeListenerSptr>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    return displayIdChangeListeners_[GetPersistentId()];
+    return displayIdChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
 EnableIfSame<T, ISystemDensityChangeListener,
-    std::vector<ISystemDensityChangeListenerSptr>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<ISystemDensityChangeListenerSptr>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    return systemDensityChangeListeners_[GetPersistentId()];
+    return systemDensityChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IWindowDensityChangeListener, std::vector<IWindowDensityChangeListenerSptr>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowDensityChangeListener,
+    CowListenerRegistry<IWindowDensityChangeListenerSptr>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    return windowDensityChangeListeners_[GetPersistentId()];
+    return windowDensityChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IAcrossDisplaysChangeListener, std::vector<IAcrossDisplaysChangeListenerSptr>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IAcrossDisplaysChangeListener,
+    CowListenerRegistry<IAcrossDisplaysChangeListenerSptr>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    return acrossDisplaysChangeListeners_[GetPersistentId()];
+    return acrossDisplaysChangeListeners_.GetListeners(GetPersistentId());
 }
 
 template<typename T>
-EnableIfSame<T, IWindowNoInteractionListener, std::vector<IWindowNoInteractionListenerSptr>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IWindowNoInteractionListener,
+    CowListenerRegistry<IWindowNoInteractionListenerSptr>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<IWindowNoInteractionListenerSptr> noInteractionListeners;
-    for (auto& listener : windowNoInteractionListeners_[GetPersistentId()]) {
-        noInteractionListeners.push_back(listener);
-    }
-    return noInteractionListeners;
+    return windowNoInteractionListeners_.GetListeners(GetPersistentId());
 }
 
 WSError WindowSessionImpl::NotifyDisplayIdChange(DisplayId displayId)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "id=%{public}u, displayId=%{public}" PRIu64, GetPersistentId(), displayId);
-    std::lock_guard<std::mutex> lock(displayIdChangeListenerMutex_);
     auto displayIdChangeListeners = GetListeners<IDisplayIdChangeListener>();
-    for (auto& listener : displayIdChangeListeners) {
+    for (auto& listener : *displayIdChangeListeners) {
         if (listener != nullptr) {
             listener->OnDisplayIdChanged(displayId);
         }
@@ -7998,9 +7593,8 @@ void WindowSessionImpl::SetWatchGestureConsumed(bool isWatchGestureConsumed)
 
 WSError WindowSessionImpl::NotifySystemDensityChange(float density)
 {
-    std::lock_guard<std::mutex> lock(systemDensityChangeListenerMutex_);
     const auto& systemDensityChangeListeners = GetListeners<ISystemDensityChangeListener>();
-    for (const auto& listener : systemDensityChangeListeners) {
+    for (const auto& listener : *systemDensityChangeListeners) {
         if (listener != nullptr) {
             listener->OnSystemDensityChanged(density);
         }
@@ -8010,9 +7604,8 @@ WSError WindowSessionImpl::NotifySystemDensityChange(float density)
 
 WSError WindowSessionImpl::NotifyWindowDensityChange(float density)
 {
-    std::lock_guard<std::mutex> lock(windowDensityChangeListenerMutex_);
     const auto& windowDensityChangeListeners = GetListeners<IWindowDensityChangeListener>();
-    for (const auto& listener : windowDensityChangeListeners) {
+    for (const auto& listener : *windowDensityChangeListeners) {
         if (listener != nullptr) {
             listener->OnWindowDensityChanged(density);
         }
@@ -8054,9 +7647,8 @@ WSError WindowSessionImpl::NotifyWindowVisibility(bool isVisible)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "window: name=%{public}s, id=%{public}u, isVisible=%{public}d",
         GetWindowName().c_str(), GetPersistentId(), isVisible);
-    std::lock_guard<std::recursive_mutex> lockListener(windowVisibilityChangeListenerMutex_);
     auto windowVisibilityListeners = GetListeners<IWindowVisibilityChangedListener>();
-    for (auto& listener : windowVisibilityListeners) {
+    for (auto& listener : *windowVisibilityListeners) {
         if (listener != nullptr) {
             listener->OnWindowVisibilityChangedCallback(isVisible);
         }
@@ -8749,9 +8341,8 @@ WMError WindowSessionImpl::UpdateStatusBarColorByColorMode(uint32_t& contentColo
 
 void WindowSessionImpl::NotifyOccupiedAreaChangeInfoInner(sptr<OccupiedAreaChangeInfo> info)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(occupiedAreaChangeListenerMutex_);
     auto occupiedAreaChangeListeners = GetListeners<IOccupiedAreaChangeListener>();
-    for (auto& listener : occupiedAreaChangeListeners) {
+    for (auto& listener : *occupiedAreaChangeListeners) {
         if (listener != nullptr) {
             listener->OnSizeChange(info);
         }
@@ -8798,9 +8389,8 @@ void WindowSessionImpl::NotifyOccupiedAreaChangeInfo(sptr<OccupiedAreaChangeInfo
 
 void WindowSessionImpl::NotifyKeyboardWillShow(const KeyboardAnimationInfo& keyboardAnimationInfo)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(keyboardWillShowListenerMutex_);
     auto keyboardWillShowListeners = GetListeners<IKBWillShowListener>();
-    for (const auto& listener : keyboardWillShowListeners) {
+    for (const auto& listener : *keyboardWillShowListeners) {
         if (listener != nullptr) {
             auto config = GetKeyboardAnimationConfig();
             auto animation = keyboardAnimationInfo.isShow ? config.curveIn : config.curveOut;
@@ -8811,9 +8401,8 @@ void WindowSessionImpl::NotifyKeyboardWillShow(const KeyboardAnimationInfo& keyb
 
 void WindowSessionImpl::NotifyKeyboardWillHide(const KeyboardAnimationInfo& keyboardAnimationInfo)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(keyboardWillHideListenerMutex_);
     auto keyboardWillHideListeners = GetListeners<IKBWillHideListener>();
-    for (const auto& listener : keyboardWillHideListeners) {
+    for (const auto& listener : *keyboardWillHideListeners) {
         if (listener != nullptr) {
             auto config = GetKeyboardAnimationConfig();
             auto animation = keyboardAnimationInfo.isShow ? config.curveIn : config.curveOut;
@@ -8824,9 +8413,8 @@ void WindowSessionImpl::NotifyKeyboardWillHide(const KeyboardAnimationInfo& keyb
 
 void WindowSessionImpl::NotifyKeyboardDidShow(const KeyboardPanelInfo& keyboardPanelInfo)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(keyboardDidShowListenerMutex_);
     auto keyboardDidShowListeners = GetListeners<IKeyboardDidShowListener>();
-    for (const auto& listener : keyboardDidShowListeners) {
+    for (const auto& listener : *keyboardDidShowListeners) {
         if (listener != nullptr) {
             listener->OnKeyboardDidShow(keyboardPanelInfo);
         }
@@ -8842,9 +8430,8 @@ void WindowSessionImpl::NotifyKeyboardDidShow(const KeyboardPanelInfo& keyboardP
 
 void WindowSessionImpl::NotifyKeyboardDidHide(const KeyboardPanelInfo& keyboardPanelInfo)
 {
-    std::lock_guard<std::recursive_mutex> lockListener(keyboardDidHideListenerMutex_);
     auto keyboardDidHideListeners = GetListeners<IKeyboardDidHideListener>();
-    for (const auto& listener : keyboardDidHideListeners) {
+    for (const auto& listener : *keyboardDidHideListeners) {
         if (listener != nullptr) {
             listener->OnKeyboardDidHide(keyboardPanelInfo);
         }
@@ -9305,9 +8892,8 @@ void WindowSessionImpl::NotifyWindowStatusChange(WindowMode mode)
             windowSystemConfig_.skipRedundantWindowStatusNotifications_);
     }
     lastWindowStatus_.store(windowStatus);
-    std::lock_guard<std::recursive_mutex> lockListener(windowStatusChangeListenerMutex_);
     auto windowStatusChangeListeners = GetListeners<IWindowStatusChangeListener>();
-    for (auto& listener : windowStatusChangeListeners) {
+    for (auto& listener : *windowStatusChangeListeners) {
         if (listener != nullptr) {
             listener->OnWindowStatusChange(windowStatus);
         }
@@ -9346,18 +8932,14 @@ void WindowSessionImpl::NotifyWindowStatusDidChange(WindowMode mode)
         return;
     }
     lastStatusWhenNotifyWindowStatusDidChange_.store(windowStatus);
-    std::vector<sptr<IWindowStatusDidChangeListener>> windowStatusDidChangeListeners;
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowStatusDidChangeListenerMutex_);
-        windowStatusDidChangeListeners = GetListeners<IWindowStatusDidChangeListener>();
-    }
+    auto windowStatusDidChangeListeners = GetListeners<IWindowStatusDidChangeListener>();
     const auto& windowRect = GetRect();
     TLOGI(WmsLogTag::WMS_LAYOUT,
         "[WindowModeUpdate:Inner] NotifyWindowStatusDidChange id:%{public}d, mode:%{public}d, "
         "status:%{public}d, lastStatus:%{public}d, listenerSize:%{public}zu, rect:%{public}s",
         GetPersistentId(), static_cast<int32_t>(mode), windowStatus, lastStatus,
-        windowStatusDidChangeListeners.size(), windowRect.ToString().c_str());
-    for (auto& listener : windowStatusDidChangeListeners) {
+        windowStatusDidChangeListeners->size(), windowRect.ToString().c_str());
+    for (auto& listener : *windowStatusDidChangeListeners) {
         if (listener != nullptr) {
             listener->OnWindowStatusDidChange(windowStatus);
         }
@@ -9372,15 +8954,11 @@ void WindowSessionImpl::NotifyParentWindowSizeChange(Rect rect)
 {
     TLOGD(WmsLogTag::WMS_LAYOUT, "NotifyParentWindowSizeChange begin, id:%{public}d, rect:[%{public}d, %{public}d,"
         "%{public}u,%{public}u]", GetPersistentId(), rect.posX_, rect.posY_, rect.width_, rect.height_);
-    std::vector<sptr<IParentWindowSizeChangeListener>> parentWindowSizeChangeListeners;
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(parentWindowSizeChangeListenerMutex_);
-        parentWindowSizeChangeListeners = GetListeners<IParentWindowSizeChangeListener>();
-    }
+    auto parentWindowSizeChangeListeners = GetListeners<IParentWindowSizeChangeListener>();
 
     TLOGD(WmsLogTag::WMS_LAYOUT, "NotifyParentWindowSizeChange listener count:%{public}zu",
-        parentWindowSizeChangeListeners.size());
-    for (auto& listener : parentWindowSizeChangeListeners) {
+        parentWindowSizeChangeListeners->size());
+    for (auto& listener : *parentWindowSizeChangeListeners) {
         if (listener != nullptr) {
             listener->OnParentWindowSizeChange(rect);
         }
@@ -9401,15 +8979,11 @@ void WindowSessionImpl::NotifyParentWindowStatusChange(WindowMode mode, Maximize
         return;
     }
     lastStatusWhenNotifyParentStatusChange_.store(windowStatus);
-    std::vector<sptr<IParentWindowStatusChangeListener>> parentWindowStatusChangeListeners;
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(parentWindowStatusChangeListenerMutex_);
-        parentWindowStatusChangeListeners = GetListeners<IParentWindowStatusChangeListener>();
-    }
+    auto parentWindowStatusChangeListeners = GetListeners<IParentWindowStatusChangeListener>();
     TLOGI(WmsLogTag::WMS_LAYOUT, "NotifyParentWindowStatusChange listener count:%{public}zu",
-        parentWindowStatusChangeListeners.size());
+        parentWindowStatusChangeListeners->size());
 
-    for (auto& listener : parentWindowStatusChangeListeners) {
+    for (auto& listener : *parentWindowStatusChangeListeners) {
         if (listener != nullptr) {
             listener->OnParentWindowStatusChange(windowStatus);
         }
@@ -9573,13 +9147,13 @@ void WindowSessionImpl::SubmitNoInteractionMonitorTask(int32_t eventId,
 void WindowSessionImpl::RefreshNoInteractionTimeoutMonitor()
 {
     std::lock_guard<std::recursive_mutex> lockListener(windowNoInteractionListenerMutex_);
-    if (windowNoInteractionListeners_[GetPersistentId()].empty()) {
+    if (!windowNoInteractionListeners_.HasListeners(GetPersistentId())) {
         return;
     }
     this->lastInteractionEventId_.fetch_add(1);
     int32_t eventId = lastInteractionEventId_.load();
     auto noInteractionListeners = GetListeners<IWindowNoInteractionListener>();
-    for (const auto& listenerItem : noInteractionListeners) {
+    for (const auto& listenerItem : *noInteractionListeners) {
         SubmitNoInteractionMonitorTask(eventId, listenerItem);
     }
 }
@@ -10350,11 +9924,7 @@ void WindowSessionImpl::NotifyRotationChangeResult(RotationChangeResult rotation
 
 void WindowSessionImpl::NotifyRotationChangeResultInner(const RotationChangeInfo& rotationChangeInfo)
 {
-    std::vector<sptr<IWindowRotationChangeListener>> windowRotationChangeListeners;
-    {
-        std::lock_guard<std::mutex> lockListener(windowRotationChangeListenerMutex_);
-        windowRotationChangeListeners = GetListeners<IWindowRotationChangeListener>();
-    }
+    auto windowRotationChangeListeners = GetListeners<IWindowRotationChangeListener>();
     handler_->PostTask(
         [weakThis = wptr(this), windowRotationChangeListeners, rotationChangeInfo] {
             TLOGI(WmsLogTag::WMS_ROTATION, "post task to notify listener.");
@@ -10364,7 +9934,7 @@ void WindowSessionImpl::NotifyRotationChangeResultInner(const RotationChangeInfo
                 return;
             }
             RotationChangeResult rotationChangeResult = { RectType::RELATIVE_TO_SCREEN, { 0, 0, 0, 0 } };
-            for (auto& listener : windowRotationChangeListeners) {
+            for (auto& listener : *windowRotationChangeListeners) {
                 if (listener == nullptr) {
                     continue;
                 }
@@ -10597,21 +10167,17 @@ WSError WindowSessionImpl::UpdateIsShowDecorInFreeMultiWindow(bool isShow)
 }
 
 template<typename T>
-EnableIfSame<T, IFreeWindowModeChangeListener, std::vector<sptr<IFreeWindowModeChangeListener>>> WindowSessionImpl::GetListeners()
+EnableIfSame<T, IFreeWindowModeChangeListener,
+    CowListenerRegistry<sptr<IFreeWindowModeChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IFreeWindowModeChangeListener>> freeWindowModeChangeListeners;
-    for (auto& listener : freeWindowModeChangeListeners_[GetPersistentId()]) {
-        freeWindowModeChangeListeners.push_back(listener);
-    }
-    return freeWindowModeChangeListeners;
+    return freeWindowModeChangeListeners_.GetListeners(GetPersistentId());
 }
  
 WMError WindowSessionImpl::RegisterFreeWindowModeChangeListener(const sptr<IFreeWindowModeChangeListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_LAYOUT_PC, "Start register");
     if (listener) {
-        std::lock_guard<std::mutex> lockListener(freeWindowModeChangeListenerMutex_);
-        return RegisterListener(freeWindowModeChangeListeners_[GetPersistentId()], listener);
+        return RegisterListener(freeWindowModeChangeListeners_, GetPersistentId(), listener);
     } else {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "id: %{public}d, listener is null", GetPersistentId());
         return WMError::WM_ERROR_NULLPTR;
@@ -10622,15 +10188,13 @@ WMError WindowSessionImpl::RegisterFreeWindowModeChangeListener(const sptr<IFree
 WMError WindowSessionImpl::UnregisterFreeWindowModeChangeListener(const sptr<IFreeWindowModeChangeListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_LAYOUT_PC, "Start unregister");
-    std::lock_guard<std::mutex> lockListener(freeWindowModeChangeListenerMutex_);
-    return UnregisterListenerInMap(freeWindowModeChangeListeners_, GetPersistentId(), listener);
+    return UnregisterListener(freeWindowModeChangeListeners_, GetPersistentId(), listener);
 }
  
 void WindowSessionImpl::NotifyFreeWindowModeChange(bool isInFreeWindowMode)
 {
-    std::lock_guard<std::mutex> lockListener(freeWindowModeChangeListenerMutex_);
     auto freeWindowModeChangeListeners = GetListeners<IFreeWindowModeChangeListener>();
-    for (auto& listener : freeWindowModeChangeListeners) {
+    for (auto& listener : *freeWindowModeChangeListeners) {
         if (listener != nullptr) {
             listener->OnFreeWindowModeChange(isInFreeWindowMode);
         }
@@ -10639,21 +10203,16 @@ void WindowSessionImpl::NotifyFreeWindowModeChange(bool isInFreeWindowMode)
 
 template<typename T>
 EnableIfSame<T, IParentLifecycleEventListener,
-    std::vector<sptr<IParentLifecycleEventListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<IParentLifecycleEventListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IParentLifecycleEventListener>> parentLifecycleEventListeners;
-    for (const auto& listener : parentLifecycleEventListeners_[GetPersistentId()]) {
-        parentLifecycleEventListeners.push_back(listener);
-    }
-    return parentLifecycleEventListeners;
+    return parentLifecycleEventListeners_.GetListeners(GetPersistentId());
 }
 
 WMError WindowSessionImpl::RegisterParentLifecycleEventListener(const sptr<IParentLifecycleEventListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_LIFE, "Start register, id: %{public}d", GetPersistentId());
     if (listener) {
-        std::lock_guard<std::mutex> lockListener(parentLifecycleEventListenerMutex_);
-        return RegisterListener(parentLifecycleEventListeners_[GetPersistentId()], listener);
+        return RegisterListener(parentLifecycleEventListeners_, GetPersistentId(), listener);
     } else {
         TLOGE(WmsLogTag::WMS_LIFE, "id: %{public}d, listener is null", GetPersistentId());
         return WMError::WM_ERROR_NULLPTR;
@@ -10663,15 +10222,13 @@ WMError WindowSessionImpl::RegisterParentLifecycleEventListener(const sptr<IPare
 WMError WindowSessionImpl::UnregisterParentLifecycleEventListener(const sptr<IParentLifecycleEventListener>& listener)
 {
     TLOGI(WmsLogTag::WMS_LIFE, "Start unregister, id: %{public}d", GetPersistentId());
-    std::lock_guard<std::mutex> lockListener(parentLifecycleEventListenerMutex_);
-    return UnregisterListenerInMap(parentLifecycleEventListeners_, GetPersistentId(), listener);
+    return UnregisterListener(parentLifecycleEventListeners_, GetPersistentId(), listener);
 }
 
 WSError WindowSessionImpl::NotifyParentLifecycleEvent(ParentLifeCycleEvent eventType)
 {
-    std::lock_guard<std::mutex> lockListener(parentLifecycleEventListenerMutex_);
     auto parentLifecycleEventListeners = GetListeners<IParentLifecycleEventListener>();
-    for (auto& listener : parentLifecycleEventListeners) {
+    for (auto& listener : *parentLifecycleEventListeners) {
         if (listener != nullptr) {
             switch (eventType) {
                 case ParentLifeCycleEvent::FOREGROUND:
@@ -10790,7 +10347,7 @@ WMError WindowSessionImpl::RegisterWindowHoverStateChangeListener(
     TLOGD(WmsLogTag::DEFAULT, "in");
     std::lock_guard<std::recursive_mutex> lockListener(windowHoverStateChangeListenerMutex_);
     RegisterFoldStatusListener();
-    return RegisterListener(windowHoverStateChangeListeners_[GetPersistentId()], listener);
+    return RegisterListener(windowHoverStateChangeListeners_, GetPersistentId(), listener);
 }
 
 WMError WindowSessionImpl::UnregisterWindowHoverStateChangeListener(
@@ -10801,15 +10358,11 @@ WMError WindowSessionImpl::UnregisterWindowHoverStateChangeListener(
     {
         std::lock_guard<std::recursive_mutex> lockListener(windowHoverStateChangeListenerMutex_);
         auto persistentId = GetPersistentId();
-        WMError err = UnregisterListenerInMap(windowHoverStateChangeListeners_, persistentId, listener);
+        WMError err = UnregisterListener(windowHoverStateChangeListeners_, persistentId, listener);
         if (err != WMError::WM_OK) {
             return err;
         }
-        auto it = windowHoverStateChangeListeners_.find(persistentId);
-        if (it != windowHoverStateChangeListeners_.end() && it->second.empty()) {
-            windowHoverStateChangeListeners_.erase(persistentId);
-        }
-        unregisterFlag = windowHoverStateChangeListeners_.empty();
+        unregisterFlag = windowHoverStateChangeListeners_.IsEmpty();
     }
     if (unregisterFlag) {
         UnregisterFoldStatusListener();
@@ -10819,25 +10372,17 @@ WMError WindowSessionImpl::UnregisterWindowHoverStateChangeListener(
 
 template<typename T>
 EnableIfSame<T, IWindowHoverStateChangeListener,
-    std::vector<sptr<IWindowHoverStateChangeListener>>> WindowSessionImpl::GetListeners()
+    CowListenerRegistry<sptr<IWindowHoverStateChangeListener>>::ListenerListPtr> WindowSessionImpl::GetListeners()
 {
-    std::vector<sptr<IWindowHoverStateChangeListener>> windowHoverStateChangeListeners;
-    for (const auto& listener : windowHoverStateChangeListeners_[GetPersistentId()]) {
-        windowHoverStateChangeListeners.push_back(listener);
-    }
-    return windowHoverStateChangeListeners;
+    return windowHoverStateChangeListeners_.GetListeners(GetPersistentId());
 }
 
 void WindowSessionImpl::NotifyWindowHoverStateChange(bool hoverState)
 {
     TLOGD(WmsLogTag::DEFAULT, "NotifyWindowHoverStateChange begin, id:%{public}d, hoverState:%{public}d",
         GetPersistentId(), hoverState);
-    std::vector<sptr<IWindowHoverStateChangeListener>> windowHoverStateChangeListeners;
-    {
-        std::lock_guard<std::recursive_mutex> lockListener(windowHoverStateChangeListenerMutex_);
-        windowHoverStateChangeListeners = GetListeners<IWindowHoverStateChangeListener>();
-    }
-    for (auto& listener : windowHoverStateChangeListeners) {
+    auto windowHoverStateChangeListeners = GetListeners<IWindowHoverStateChangeListener>();
+    for (auto& listener : *windowHoverStateChangeListeners) {
         if (listener != nullptr) {
             listener->OnWindowHoverStateChange(hoverState);
         }
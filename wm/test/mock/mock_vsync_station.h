@@ -28,6 +28,8 @@ public:
         : VsyncStation(nodeId, vsyncHandler) {}
 
     MOCK_METHOD(void, RequestVsync, (const std::shared_ptr<VsyncCallback>& vsyncCallback), (override));
+    MOCK_METHOD(void, ScheduleVsyncCallback,
+        (const std::shared_ptr<VsyncCallback>& vsyncCallback, const VsyncScheduleOption& option), (override));
     MOCK_METHOD(int64_t, GetVSyncPeriod, (), (override));
     MOCK_METHOD(std::optional<uint32_t>, GetFps, (), (override));
 };
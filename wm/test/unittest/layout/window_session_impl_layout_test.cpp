@@ -367,7 +367,9 @@ HWTEST_F(WindowSessionImplLayoutTest, NotifyWindowStatusDidChange, TestSize.Leve
     auto listeners = GetListenerList<IWindowStatusDidChangeListener, MockWindowStatusDidChangeListener>();
     EXPECT_NE(listeners.size(), 0);
     listeners.insert(listeners.begin(), nullptr);
-    window->windowStatusDidChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window->windowStatusDidChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
     window->NotifyWindowStatusDidChange(WindowMode::WINDOW_MODE_FLOATING);
     EXPECT_EQ(WMError::WM_ERROR_INVALID_WINDOW, window->Destroy());
     GTEST_LOG_(INFO) << "WindowSessionImplLayoutTest: NotifyWindowStatusDidChange end";
@@ -384,7 +386,9 @@ HWTEST_F(WindowSessionImplLayoutTest, NotifyWindowStatusDidChange_Test_Undefined
     auto window = GetTestWindowImpl("NotifyWindowStatusDidChange");
     auto listeners = GetListenerList<IWindowStatusDidChangeListener, MockWindowStatusDidChangeListener>();
     EXPECT_NE(listeners.size(), 0);
-    window->windowStatusDidChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window->windowStatusDidChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
     window->lastStatusWhenNotifyWindowStatusDidChange_.store(WindowStatus::WINDOW_STATUS_FULLSCREEN);
     window->NotifyWindowStatusDidChange(WindowMode::WINDOW_MODE_UNDEFINED);
     EXPECT_EQ(window->lastStatusWhenNotifyWindowStatusDidChange_, WindowStatus::WINDOW_STATUS_UNDEFINED);
@@ -404,7 +408,9 @@ HWTEST_F(WindowSessionImplLayoutTest, NotifyParentWindowSizeChange, TestSize.Lev
     auto listeners = GetListenerList<IParentWindowSizeChangeListener, MockParentWindowSizeChangeListener>();
     EXPECT_NE(listeners.size(), 0);
     listeners.insert(listeners.begin(), nullptr);
-    window->parentWindowSizeChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window->parentWindowSizeChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
     Rect rect = { 1, 2, 3, 4};
     window->NotifyParentWindowSizeChange(rect);
     EXPECT_EQ(WMError::WM_ERROR_INVALID_WINDOW, window->Destroy());
@@ -423,7 +429,9 @@ HWTEST_F(WindowSessionImplLayoutTest, NotifyParentWindowStatusChange, TestSize.L
     auto listeners = GetListenerList<IParentWindowStatusChangeListener, MockParentWindowStatusChangeListener>();
     EXPECT_NE(listeners.size(), 0);
     listeners.insert(listeners.begin(), nullptr);
-    window->parentWindowStatusChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window->parentWindowStatusChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
     window->NotifyParentWindowStatusChange(WindowMode::WINDOW_MODE_FLOATING, MaximizeMode::MODE_AVOID_SYSTEM_BAR, true);
     EXPECT_EQ(WMError::WM_ERROR_INVALID_WINDOW, window->Destroy());
     GTEST_LOG_(INFO) << "WindowSessionImplLayoutTest: NotifyParentWindowStatusChange end";
@@ -674,8 +682,8 @@ HWTEST_F(WindowSessionImplLayoutTest, ClearParentWindowListeners01, TestSize.Lev
     window->ClearParentWindowListeners(persistentId);
 
     // Verify listeners are cleared by checking the map entry is removed
-    EXPECT_EQ(WindowSessionImpl::parentWindowSizeChangeListeners_.count(persistentId), 0u);
-    EXPECT_EQ(WindowSessionImpl::parentWindowStatusChangeListeners_.count(persistentId), 0u);
+    EXPECT_FALSE(WindowSessionImpl::parentWindowSizeChangeListeners_.HasListeners(persistentId));
+    EXPECT_FALSE(WindowSessionImpl::parentWindowStatusChangeListeners_.HasListeners(persistentId));
 }
 
 /**
@@ -695,7 +703,7 @@ HWTEST_F(WindowSessionImplLayoutTest, ClearParentWindowListeners02, TestSize.Lev
 
     // No listeners registered, should not crash
     window->ClearParentWindowListeners(persistentId);
-    EXPECT_EQ(WindowSessionImpl::parentWindowSizeChangeListeners_.count(persistentId), 0u);
+    EXPECT_FALSE(WindowSessionImpl::parentWindowSizeChangeListeners_.HasListeners(persistentId));
 }
 
 /**
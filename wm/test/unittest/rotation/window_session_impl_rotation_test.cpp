@@ -487,13 +487,12 @@ HWTEST_F(WindowSessionImplRotationTest, RegisterWindowRotationChangeListener, Fu
     EXPECT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IWindowRotationChangeListener>::MakeSptr();
-    std::vector<sptr<IWindowRotationChangeListener>> holder;
-    window->windowRotationChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->windowRotationChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->RegisterWindowRotationChangeListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
-    holder = window->windowRotationChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_NE(existsListener, holder.end());
+    auto holder = window->windowRotationChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_NE(existsListener, holder->end());
 
     ret = window->RegisterWindowRotationChangeListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
@@ -515,15 +514,14 @@ HWTEST_F(WindowSessionImplRotationTest, UnregisterWindowRotationChangeListener,
     EXPECT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IWindowRotationChangeListener>::MakeSptr();
-    std::vector<sptr<IWindowRotationChangeListener>> holder;
-    window->windowRotationChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->windowRotationChangeListeners_.Clear(window->property_->GetPersistentId());
     window->RegisterWindowRotationChangeListener(listener);
     ret = window->UnregisterWindowRotationChangeListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
 
-    holder = window->windowRotationChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    EXPECT_EQ(existsListener, holder.end());
+    auto holder = window->windowRotationChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    EXPECT_EQ(existsListener, holder->end());
 }
 
 /**
@@ -574,8 +572,7 @@ HWTEST_F(WindowSessionImplRotationTest, NotifyRotationChange, Function | SmallTe
     EXPECT_EQ(RectType::RELATIVE_TO_SCREEN, res.rectType_);
 
     sptr<IWindowRotationChangeListener> listener = sptr<IWindowRotationChangeListener>::MakeSptr();
-    std::vector<sptr<IWindowRotationChangeListener>> holder;
-    windowSessionImpl->windowRotationChangeListeners_[windowSessionImpl->property_->GetPersistentId()] = holder;
+    windowSessionImpl->windowRotationChangeListeners_.Clear(windowSessionImpl->property_->GetPersistentId());
     WMError ret = windowSessionImpl->RegisterWindowRotationChangeListener(listener);
     EXPECT_EQ(WMError::WM_OK, ret);
     res = windowSessionImpl->NotifyRotationChange(info);
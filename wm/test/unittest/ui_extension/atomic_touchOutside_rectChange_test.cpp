@@ -75,7 +75,7 @@ void WindowExtensionSessionImplTouchOutsideTest::TearDown()
 {
     if (extWindow_ != nullptr) {
         extWindow_->dataHandler_ = savedDataHandler_;
-        extWindow_->touchOutsideListeners_.clear();
+        extWindow_->touchOutsideListeners_.Clear();
         extWindow_->touchOutsideUIExtListenerIds_.clear();
         extWindow_->touchOutsideUIExtListeners_.clear();
     }
@@ -123,7 +123,7 @@ void WindowSceneSessionImplTouchOutsideTest::TearDown()
 {
     if (sceneWindow_ != nullptr) {
         sceneWindow_->uiContent_ = std::move(savedUiContent_);
-        sceneWindow_->touchOutsideListeners_.clear();
+        sceneWindow_->touchOutsideListeners_.Clear();
         sceneWindow_->touchOutsideUIExtListenerIds_.clear();
         sceneWindow_->touchOutsideUIExtListeners_.clear();
     }
@@ -142,7 +142,7 @@ HWTEST_F(WindowExtensionSessionImplTouchOutsideTest, RegisterTouchOutsideListene
     sptr<MockTouchOutsideListener> listener = sptr<MockTouchOutsideListener>::MakeSptr();
     ASSERT_NE(nullptr, listener);
     EXPECT_EQ(WMError::WM_OK, extWindow_->RegisterTouchOutsideListener(listener));
-    EXPECT_FALSE(extWindow_->touchOutsideListeners_[extWindow_->GetPersistentId()].empty());
+    EXPECT_TRUE(extWindow_->touchOutsideListeners_.HasListeners(extWindow_->GetPersistentId()));
 }
 
 /**
@@ -198,7 +198,7 @@ HWTEST_F(WindowExtensionSessionImplTouchOutsideTest, UnregisterTouchOutsideListe
     ASSERT_NE(nullptr, listener);
     EXPECT_EQ(WMError::WM_OK, extWindow_->RegisterTouchOutsideListener(listener));
     EXPECT_EQ(WMError::WM_OK, extWindow_->UnregisterTouchOutsideListener(listener));
-    EXPECT_TRUE(extWindow_->touchOutsideListeners_[extWindow_->GetPersistentId()].empty());
+    EXPECT_FALSE(extWindow_->touchOutsideListeners_.HasListeners(extWindow_->GetPersistentId()));
 }
 
 /**
@@ -227,7 +227,7 @@ HWTEST_F(WindowExtensionSessionImplTouchOutsideTest, UnregisterTouchOutsideListe
     extWindow_->touchOutsideUIExtListeners_[100] = sptr<ITouchOutsideListener>::MakeSptr();
     extWindow_->touchOutsideUIExtListenerIds_.emplace(100);
     EXPECT_EQ(WMError::WM_OK, extWindow_->UnregisterTouchOutsideListener(listener));
-    EXPECT_TRUE(extWindow_->touchOutsideListeners_[extWindow_->GetPersistentId()].empty());
+    EXPECT_FALSE(extWindow_->touchOutsideListeners_.HasListeners(extWindow_->GetPersistentId()));
     EXPECT_FALSE(extWindow_->touchOutsideUIExtListeners_.empty());
 }
 
@@ -246,7 +246,7 @@ HWTEST_F(WindowExtensionSessionImplTouchOutsideTest, UnregisterTouchOutsideListe
     EXPECT_EQ(WMError::WM_OK, extWindow_->RegisterTouchOutsideListener(listener1));
     EXPECT_EQ(WMError::WM_OK, extWindow_->RegisterTouchOutsideListener(listener2));
     EXPECT_EQ(WMError::WM_OK, extWindow_->UnregisterTouchOutsideListener(listener1));
-    EXPECT_FALSE(extWindow_->touchOutsideListeners_[extWindow_->GetPersistentId()].empty());
+    EXPECT_TRUE(extWindow_->touchOutsideListeners_.HasListeners(extWindow_->GetPersistentId()));
 }
 
 /**
@@ -415,7 +415,7 @@ HWTEST_F(WindowSceneSessionImplTouchOutsideTest, HandleUIExtRegisterTouchOutside
         sceneWindow_->touchOutsideUIExtListeners_.end());
     EXPECT_TRUE(sceneWindow_->touchOutsideUIExtListenerIds_.find(persistentId) !=
         sceneWindow_->touchOutsideUIExtListenerIds_.end());
-    EXPECT_FALSE(sceneWindow_->touchOutsideListeners_[sceneWindow_->GetPersistentId()].empty());
+    EXPECT_TRUE(sceneWindow_->touchOutsideListeners_.HasListeners(sceneWindow_->GetPersistentId()));
 }
 
 /**
@@ -225,6 +225,7 @@ HWTEST_F(VsyncStationTest, TestRunOnceAfterNVsyncsDelayZero, TestSize.Level1)
     bool callbackCalled = false;
 
     EXPECT_CALL(*station, RequestVsync(_)).Times(0);
+    EXPECT_CALL(*station, ScheduleVsyncCallback(_, _)).Times(0);
 
     station->RunOnceAfterNVsyncs(0, [&](int64_t, int64_t) { callbackCalled = true; });
 
@@ -258,21 +259,20 @@ HWTEST_F(VsyncStationTest, TestRunOnceAfterNVsyncsDelayOne, TestSize.Level1)
 
 /**
  * @tc.name: TestRunOnceAfterNVsyncsMultiple
- * @tc.desc: Verify RunOnceAfterNVsyncs triggers callback after N vsyncs
+ * @tc.desc: Verify RunOnceAfterNVsyncs schedules the callback once, N frames ahead
  * @tc.type: FUNC
  */
 HWTEST_F(VsyncStationTest, TestRunOnceAfterNVsyncsMultiple, TestSize.Level1)
 {
     auto station = std::make_shared<MockVsyncStation>();
-
+    VsyncFrameScheduler scheduler;
     bool callbackCalled = false;
-    int vsyncCount = 0;
 
-    EXPECT_CALL(*station, RequestVsync(_))
-        .WillRepeatedly(Invoke([&](const std::shared_ptr<VsyncCallback>& cb) {
-            ASSERT_NE(cb, nullptr);
-            ++vsyncCount;
-            cb->onCallback(1000 + vsyncCount, vsyncCount);
+    EXPECT_CALL(*station, RequestVsync(_)).Times(0);
+    EXPECT_CALL(*station, ScheduleVsyncCallback(_, _))
+        .WillOnce(Invoke([&](const std::shared_ptr<VsyncCallback>& cb, const VsyncScheduleOption& option) {
+            EXPECT_EQ(option.delayFrames, 3);
+            scheduler.Schedule(cb, option);
         }));
 
     station->RunOnceAfterNVsyncs(3, [&](int64_t timestamp, int64_t frameCount) {
@@ -281,35 +281,115 @@ HWTEST_F(VsyncStationTest, TestRunOnceAfterNVsyncsMultiple, TestSize.Level1)
         EXPECT_EQ(timestamp, 1003);
     });
 
+    for (int64_t vsyncCount = 1; vsyncCount <= 3; vsyncCount++) {
+        VsyncFrameScheduler::RunCallbacks(scheduler.AdvanceFrame(), 1000 + vsyncCount, vsyncCount);
+    }
     EXPECT_TRUE(callbackCalled);
-    EXPECT_EQ(vsyncCount, 3);
+    EXPECT_FALSE(scheduler.HasPending());
 }
 
 /**
  * @tc.name: TestRunOnceAfterNVsyncsStationDestroyed
- * @tc.desc: Verify no crash when VsyncStation is destroyed before completion
+ * @tc.desc: Verify pending callbacks are released with their scheduler
  * @tc.type: FUNC
  */
 HWTEST_F(VsyncStationTest, TestRunOnceAfterNVsyncsStationDestroyed, TestSize.Level1)
 {
-    bool callbackCalled = false;
-    std::shared_ptr<VsyncCallback> savedCallback;
-
+    std::weak_ptr<VsyncCallback> weakCallback;
     {
-        auto station = std::make_shared<MockVsyncStation>();
+        VsyncFrameScheduler scheduler;
+        auto vsyncCallback = std::make_shared<VsyncCallback>();
+        weakCallback = vsyncCallback;
+        scheduler.Schedule(vsyncCallback, { 2 });
+    } // scheduler destroyed here
 
-        EXPECT_CALL(*station, RequestVsync(_))
-            .WillOnce(Invoke([&](const std::shared_ptr<VsyncCallback>& cb) {
-                savedCallback = cb;
-            }));
+    EXPECT_TRUE(weakCallback.expired());
+}
 
-        station->RunOnceAfterNVsyncs(2, [&](int64_t, int64_t) { callbackCalled = true; });
-    } // station destroyed here
+/**
+ * @tc.name: FrameSchedulerDelay
+ * @tc.desc: Verify callbacks run on their due frame, also for delays longer than the wheel
+ * @tc.type: FUNC
+ */
+HWTEST_F(VsyncStationTest, FrameSchedulerDelay, TestSize.Level1)
+{
+    VsyncFrameScheduler scheduler;
+    std::vector<uint32_t> ranFrames;
+    uint32_t frame = 0;
+    auto makeCallback = [&ranFrames, &frame] {
+        auto vsyncCallback = std::make_shared<VsyncCallback>();
+        vsyncCallback->onCallback = [&ranFrames, &frame](int64_t, int64_t) { ranFrames.push_back(frame); };
+        return vsyncCallback;
+    };
+    constexpr uint32_t longDelay = VsyncFrameScheduler::WHEEL_SIZE + 2;
+    EXPECT_FALSE(scheduler.Schedule(nullptr));
+    EXPECT_TRUE(scheduler.Schedule(makeCallback(), { 0 }));
+    EXPECT_TRUE(scheduler.Schedule(makeCallback(), { 2 }));
+    EXPECT_TRUE(scheduler.Schedule(makeCallback(), { longDelay }));
+    EXPECT_EQ(scheduler.GetPendingCount(), 3);
+
+    for (frame = 1; frame <= longDelay; frame++) {
+        VsyncFrameScheduler::RunCallbacks(scheduler.AdvanceFrame(), frame, frame);
+    }
+    EXPECT_EQ(ranFrames, std::vector<uint32_t>({ 1, 2, longDelay }));
+    EXPECT_FALSE(scheduler.HasPending());
+}
 
-    ASSERT_NE(savedCallback, nullptr);
-    savedCallback->onCallback(0, 1); // remaining -> 1, weakThis.lock() == null
+/**
+ * @tc.name: FrameSchedulerPriority
+ * @tc.desc: Verify callbacks of one frame run by priority, then in scheduling order, without duplicates
+ * @tc.type: FUNC
+ */
+HWTEST_F(VsyncStationTest, FrameSchedulerPriority, TestSize.Level1)
+{
+    VsyncFrameScheduler scheduler;
+    std::vector<int> order;
+    auto makeCallback = [&order](int id) {
+        auto vsyncCallback = std::make_shared<VsyncCallback>();
+        vsyncCallback->onCallback = [&order, id](int64_t, int64_t) { order.push_back(id); };
+        return vsyncCallback;
+    };
+    auto lowCallback = makeCallback(0);
+    EXPECT_TRUE(scheduler.Schedule(lowCallback, { 1, VsyncCallbackPriority::LOW }));
+    EXPECT_TRUE(scheduler.Schedule(makeCallback(1)));
+    EXPECT_TRUE(scheduler.Schedule(makeCallback(2), { 1, VsyncCallbackPriority::HIGH }));
+    EXPECT_TRUE(scheduler.Schedule(makeCallback(3)));
+    EXPECT_FALSE(scheduler.Schedule(lowCallback));
+    EXPECT_TRUE(scheduler.Schedule(lowCallback, { 2 }));
+
+    VsyncFrameScheduler::RunCallbacks(scheduler.AdvanceFrame(), 0, 1);
+    EXPECT_EQ(order, std::vector<int>({ 2, 1, 3, 0 }));
+    EXPECT_EQ(scheduler.GetPendingCount(), 1);
+    scheduler.Clear();
+    EXPECT_FALSE(scheduler.HasPending());
+    EXPECT_TRUE(scheduler.AdvanceFrame().empty());
+}
 
-    EXPECT_FALSE(callbackCalled);
+/**
+ * @tc.name: FrameSchedulerStats
+ * @tc.desc: Verify missed deadlines and frames running callbacks are counted
+ * @tc.type: FUNC
+ */
+HWTEST_F(VsyncStationTest, FrameSchedulerStats, TestSize.Level1)
+{
+    VsyncFrameScheduler scheduler;
+    auto vsyncCallback = std::make_shared<VsyncCallback>();
+    vsyncCallback->onCallback = [](int64_t, int64_t) {};
+    scheduler.Schedule(vsyncCallback, { 1, VsyncCallbackPriority::NORMAL, 100 });
+    scheduler.Schedule(std::make_shared<VsyncCallback>(*vsyncCallback), { 1, VsyncCallbackPriority::NORMAL, 300 });
+
+    auto result = VsyncFrameScheduler::RunCallbacks(scheduler.AdvanceFrame(), 200, 1);
+    EXPECT_EQ(result.callbackCount, 2);
+    EXPECT_EQ(result.missedDeadlineCount, 1);
+    scheduler.RecordFrame(result);
+    scheduler.RecordFrame(VsyncFrameScheduler::RunCallbacks(scheduler.AdvanceFrame(), 300, 2));
+
+    const auto& stats = scheduler.GetStats();
+    EXPECT_EQ(stats.frameCount, 1);
+    EXPECT_EQ(stats.callbackCount, 2);
+    EXPECT_EQ(stats.missedDeadlineCount, 1);
+    EXPECT_GE(stats.maxFrameExecutionUs, stats.lastFrameExecutionUs);
+    EXPECT_FALSE(stats.ToString().empty());
 }
 } // namespace
 } // namespace Rosen
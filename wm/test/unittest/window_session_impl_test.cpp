@@ -2952,7 +2952,7 @@ HWTEST_F(WindowSessionImplTest, RegisterWaterfallModeChangeListener, TestSize.Le
     ret = window->RegisterWaterfallModeChangeListener(listener);
     ASSERT_EQ(WMError::WM_ERROR_NULLPTR, ret);
     auto listeners = window->GetWaterfallModeChangeListeners();
-    ASSERT_EQ(listeners.size(), 1);
+    ASSERT_EQ(listeners->size(), 1);
 }
 
 /**
@@ -2965,16 +2965,16 @@ HWTEST_F(WindowSessionImplTest, UnregisterWaterfallModeChangeListener, TestSize.
     sptr<WindowOption> option = sptr<WindowOption>::MakeSptr();
     option->SetWindowName("waterfall");
     sptr<WindowSessionImpl> window = sptr<WindowSessionImpl>::MakeSptr(option);
-    window->waterfallModeChangeListeners_.clear();
+    window->waterfallModeChangeListeners_.Clear();
     sptr<IWaterfallModeChangeListener> listener = sptr<IWaterfallModeChangeListener>::MakeSptr();
     auto ret = window->RegisterWaterfallModeChangeListener(listener);
     ASSERT_EQ(WMError::WM_OK, ret);
     auto listeners = window->GetWaterfallModeChangeListeners();
-    ASSERT_EQ(listeners.size(), 1);
+    ASSERT_EQ(listeners->size(), 1);
     ret = window->UnregisterWaterfallModeChangeListener(listener);
     ASSERT_EQ(WMError::WM_OK, ret);
     listeners = window->GetWaterfallModeChangeListeners();
-    ASSERT_EQ(listeners.size(), 0);
+    ASSERT_EQ(listeners->size(), 0);
     listener = nullptr;
     ret = window->UnregisterWaterfallModeChangeListener(listener);
     ASSERT_EQ(WMError::WM_ERROR_NULLPTR, ret);
@@ -3051,13 +3051,13 @@ HWTEST_F(WindowSessionImplTest, NotifyAcrossDisplaysChange, TestSize.Level1)
     window->property_->SetPersistentId(1);
     window->state_ = WindowState::STATE_SHOWN;
     sptr<IAcrossDisplaysChangeListener> listener = sptr<IAcrossDisplaysChangeListener>::MakeSptr();
-    window->acrossDisplaysChangeListeners_[1].push_back(listener);
+    window->acrossDisplaysChangeListeners_.Register(1, listener);
     window->RegisterAcrossDisplaysChangeListener(listener);
     auto ret = window->NotifyAcrossDisplaysChange(true);
     EXPECT_EQ(WMError::WM_OK, ret);
     ret = window->NotifyAcrossDisplaysChange(true);
     EXPECT_EQ(WMError::WM_DO_NOTHING, ret);
-    window->acrossDisplaysChangeListeners_[1].push_back(nullptr);
+    window->acrossDisplaysChangeListeners_.Register(1, nullptr);
     ret = window->NotifyAcrossDisplaysChange(false);
     EXPECT_EQ(WMError::WM_OK, ret);
 }
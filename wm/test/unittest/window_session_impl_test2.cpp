@@ -281,42 +281,29 @@ HWTEST_F(WindowSessionImplTest2, RecoverSessionListener, TestSize.Level1)
     window->property_->SetPersistentId(id);
     window->RecoverSessionListener();
 
-    std::vector<sptr<IAcrossDisplaysChangeListener>> iAcrossDisplaysChangeListener;
-    std::vector<sptr<IAvoidAreaChangedListener>> iAvoidAreaChangedListeners;
-    std::vector<sptr<ITouchOutsideListener>> iTouchOutsideListeners;
-    window->avoidAreaChangeListeners_.insert({ id, iAvoidAreaChangedListeners });
-    window->acrossDisplaysChangeListeners_.insert({ id, iAcrossDisplaysChangeListener });
-    window->touchOutsideListeners_.insert({ id, iTouchOutsideListeners });
+    window->avoidAreaChangeListeners_.Clear(id);
+    window->acrossDisplaysChangeListeners_.Clear(id);
+    window->touchOutsideListeners_.Clear(id);
     window->RecoverSessionListener();
 
-    window->avoidAreaChangeListeners_.clear();
-    window->acrossDisplaysChangeListeners_.clear();
-    window->touchOutsideListeners_.clear();
+    window->avoidAreaChangeListeners_.Clear();
+    window->acrossDisplaysChangeListeners_.Clear();
+    window->touchOutsideListeners_.Clear();
     sptr<MockAvoidAreaChangedListener> changedListener = sptr<MockAvoidAreaChangedListener>::MakeSptr();
     sptr<MockTouchOutsideListener> touchOutsideListener = sptr<MockTouchOutsideListener>::MakeSptr();
     sptr<MockAcrossDisplaysChangeListener> changedListener2 = sptr<MockAcrossDisplaysChangeListener>::MakeSptr();
-    iAvoidAreaChangedListeners.insert(iAvoidAreaChangedListeners.begin(), changedListener);
-    iAcrossDisplaysChangeListener.insert(iAcrossDisplaysChangeListener.begin(), changedListener2);
-    iTouchOutsideListeners.insert(iTouchOutsideListeners.begin(), touchOutsideListener);
-    window->avoidAreaChangeListeners_.insert({ id, iAvoidAreaChangedListeners });
-    window->acrossDisplaysChangeListeners_.insert({ id, iAcrossDisplaysChangeListener });
-    window->touchOutsideListeners_.insert({ id, iTouchOutsideListeners });
-    std::vector<sptr<IOcclusionStateChangedListener>> occlusionStateChangeListeners;
-    occlusionStateChangeListeners.push_back(nullptr);
-    window->occlusionStateChangeListeners_.clear();
-    window->occlusionStateChangeListeners_.insert({ id, occlusionStateChangeListeners });
-    std::vector<sptr<IScreenshotListener>> screenshotListeners;
-    screenshotListeners.push_back(nullptr);
-    window->screenshotListeners_.clear();
-    window->screenshotListeners_.insert({ id, screenshotListeners });
+    window->avoidAreaChangeListeners_.Register(id, changedListener);
+    window->acrossDisplaysChangeListeners_.Register(id, changedListener2);
+    window->touchOutsideListeners_.Register(id, touchOutsideListener);
+    window->occlusionStateChangeListeners_.Clear();
+    window->occlusionStateChangeListeners_.Register(id, nullptr);
+    window->screenshotListeners_.Clear();
+    window->screenshotListeners_.Register(id, nullptr);
     window->RecoverSessionListener();
-    window->occlusionStateChangeListeners_.clear();
-    ASSERT_TRUE(window->avoidAreaChangeListeners_.find(id) != window->avoidAreaChangeListeners_.end() &&
-                !window->avoidAreaChangeListeners_[id].empty());
-    ASSERT_TRUE(window->touchOutsideListeners_.find(id) != window->touchOutsideListeners_.end() &&
-                !window->touchOutsideListeners_[id].empty());
-    ASSERT_TRUE(window->acrossDisplaysChangeListeners_.find(id) != window->acrossDisplaysChangeListeners_.end() &&
-                !window->acrossDisplaysChangeListeners_[id].empty());
+    window->occlusionStateChangeListeners_.Clear();
+    ASSERT_EQ(window->avoidAreaChangeListeners_.GetListenerCount(id), 1);
+    ASSERT_EQ(window->touchOutsideListeners_.GetListenerCount(id), 1);
+    ASSERT_EQ(window->acrossDisplaysChangeListeners_.GetListenerCount(id), 1);
     window->Destroy();
 }
 
@@ -330,15 +317,16 @@ HWTEST_F(WindowSessionImplTest2, RegisterOcclusionStateChangeListener, TestSize.
     auto window = GetTestWindowImpl("RegisterOcclusionStateChangeListener");
     ASSERT_NE(window, nullptr);
     window->property_->SetPersistentId(1);
-    window->occlusionStateChangeListeners_.clear();
+    window->occlusionStateChangeListeners_.Clear();
     EXPECT_NE(window->RegisterOcclusionStateChangeListener(nullptr), WMError::WM_OK);
     sptr<IOcclusionStateChangedListener> listener = sptr<IOcclusionStateChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterOcclusionStateChangeListener(listener), WMError::WM_OK);
-    EXPECT_EQ(window->occlusionStateChangeListeners_.size(), 1);
-    window->occlusionStateChangeListeners_[window->GetPersistentId()].push_back(nullptr);
+    EXPECT_EQ(window->occlusionStateChangeListeners_.GetListenerCount(window->GetPersistentId()), 1);
+    window->occlusionStateChangeListeners_.Register(window->GetPersistentId(), nullptr);
     sptr<IOcclusionStateChangedListener> listener2 = sptr<IOcclusionStateChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterOcclusionStateChangeListener(listener2), WMError::WM_OK);
-    window->occlusionStateChangeListeners_.clear();
+    EXPECT_EQ(window->occlusionStateChangeListeners_.GetListenerCount(window->GetPersistentId()), 3);
+    window->occlusionStateChangeListeners_.Clear();
     window->Destroy();
 }
 
@@ -351,17 +339,18 @@ HWTEST_F(WindowSessionImplTest2, UnregisterOcclusionStateChangeListener, TestSiz
 {
     auto window = GetTestWindowImpl("UnregisterOcclusionStateChangeListener");
     ASSERT_NE(window, nullptr);
-    window->occlusionStateChangeListeners_.clear();
+    window->occlusionStateChangeListeners_.Clear();
     EXPECT_NE(window->UnregisterOcclusionStateChangeListener(nullptr), WMError::WM_OK);
     sptr<IOcclusionStateChangedListener> listener = sptr<IOcclusionStateChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterOcclusionStateChangeListener(listener), WMError::WM_OK);
     sptr<IOcclusionStateChangedListener> listener2 = sptr<IOcclusionStateChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterOcclusionStateChangeListener(listener2), WMError::WM_OK);
     EXPECT_EQ(window->UnregisterOcclusionStateChangeListener(listener), WMError::WM_OK);
-    EXPECT_EQ(window->occlusionStateChangeListeners_.size(), 1);
+    EXPECT_EQ(window->occlusionStateChangeListeners_.GetListenerCount(window->GetPersistentId()), 1);
     EXPECT_EQ(window->UnregisterOcclusionStateChangeListener(listener2), WMError::WM_OK);
-    window->occlusionStateChangeListeners_.clear();
-    EXPECT_EQ(window->occlusionStateChangeListeners_.size(), 0);
+    EXPECT_EQ(window->occlusionStateChangeListeners_.GetListenerCount(window->GetPersistentId()), 0);
+    window->occlusionStateChangeListeners_.Clear();
+    EXPECT_TRUE(window->occlusionStateChangeListeners_.IsEmpty());
     window->Destroy();
 }
 
@@ -374,16 +363,16 @@ HWTEST_F(WindowSessionImplTest2, NotifyWindowOcclusionState, TestSize.Level1)
 {
     auto window = GetTestWindowImpl("NotifyWindowOcclusionState");
     ASSERT_NE(window, nullptr);
-    window->occlusionStateChangeListeners_.clear();
+    window->occlusionStateChangeListeners_.Clear();
     sptr<IOcclusionStateChangedListener> listener = sptr<IOcclusionStateChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterOcclusionStateChangeListener(listener), WMError::WM_OK);
-    EXPECT_EQ(window->occlusionStateChangeListeners_.size(), 1);
+    EXPECT_EQ(window->occlusionStateChangeListeners_.GetListenerCount(window->GetPersistentId()), 1);
     EXPECT_EQ(window->NotifyWindowOcclusionState(WindowVisibilityState::END), WSError::WS_OK);
     EXPECT_EQ(window->lastVisibilityState_, WindowVisibilityState::WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION);
     EXPECT_EQ(window->NotifyWindowOcclusionState(WindowVisibilityState::WINDOW_VISIBILITY_STATE_NO_OCCLUSION),
         WSError::WS_OK);
     EXPECT_EQ(window->lastVisibilityState_, WindowVisibilityState::WINDOW_VISIBILITY_STATE_NO_OCCLUSION);
-    window->occlusionStateChangeListeners_.clear();
+    window->occlusionStateChangeListeners_.Clear();
     window->Destroy();
 }
 
@@ -403,11 +392,11 @@ HWTEST_F(WindowSessionImplTest2, NotifyWindowOcclusionStateAll, TestSize.Level1)
     EXPECT_EQ(window->NotifyWindowOcclusionState(static_cast<WindowVisibilityState>(state + 1)), WSError::WS_OK);
     EXPECT_EQ(window->lastVisibilityState_, WindowVisibilityState::WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION);
 
-    window->occlusionStateChangeListeners_.clear();
-    EXPECT_EQ(window->occlusionStateChangeListeners_.size(), 0);
+    window->occlusionStateChangeListeners_.Clear();
+    EXPECT_TRUE(window->occlusionStateChangeListeners_.IsEmpty());
     sptr<IOcclusionStateChangedListener> listener = sptr<IOcclusionStateChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterOcclusionStateChangeListener(listener), WMError::WM_OK);
-    EXPECT_EQ(window->occlusionStateChangeListeners_.size(), 1);
+    EXPECT_EQ(window->occlusionStateChangeListeners_.GetListenerCount(window->GetPersistentId()), 1);
 
     // traverse all visibility states verify
     WindowVisibilityState visibilityStates[] = {
@@ -422,8 +411,8 @@ HWTEST_F(WindowSessionImplTest2, NotifyWindowOcclusionStateAll, TestSize.Level1)
         EXPECT_EQ(state, window->lastVisibilityState_);
     }
 
-    window->occlusionStateChangeListeners_.clear();
-    EXPECT_EQ(window->occlusionStateChangeListeners_.size(), 0);
+    window->occlusionStateChangeListeners_.Clear();
+    EXPECT_TRUE(window->occlusionStateChangeListeners_.IsEmpty());
 
     window->Destroy();
 }
@@ -438,7 +427,7 @@ HWTEST_F(WindowSessionImplTest2, RegisterFrameMetricsChangeListener, TestSize.Le
     auto window = GetTestWindowImpl("RegisterFrameMetricsChangeListener");
     ASSERT_NE(window, nullptr);
     window->property_->SetPersistentId(1);
-    window->frameMetricsChangeListeners_.clear();
+    window->frameMetricsChangeListeners_.Clear();
     window->uiContent_ = nullptr;
     EXPECT_NE(window->RegisterFrameMetricsChangeListener(nullptr), WMError::WM_OK);
     window->uiContent_ = std::make_unique<Ace::UIContentMocker>();
@@ -447,12 +436,13 @@ HWTEST_F(WindowSessionImplTest2, RegisterFrameMetricsChangeListener, TestSize.Le
     EXPECT_CALL(*content, SetFrameMetricsCallBack(_));
     sptr<IFrameMetricsChangedListener> listener = sptr<IFrameMetricsChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterFrameMetricsChangeListener(listener), WMError::WM_OK);
-    EXPECT_EQ(window->frameMetricsChangeListeners_.size(), 1);
+    EXPECT_EQ(window->frameMetricsChangeListeners_.GetListenerCount(window->GetPersistentId()), 1);
     sptr<IFrameMetricsChangedListener> listener2 = sptr<IFrameMetricsChangedListener>::MakeSptr();
-    window->frameMetricsChangeListeners_[window->GetPersistentId()].push_back(listener2);
+    window->frameMetricsChangeListeners_.Register(window->GetPersistentId(), listener2);
     sptr<IFrameMetricsChangedListener> listener3 = sptr<IFrameMetricsChangedListener>::MakeSptr();
     EXPECT_EQ(window->RegisterFrameMetricsChangeListener(listener3), WMError::WM_OK);
-    window->frameMetricsChangeListeners_.clear();
+    EXPECT_EQ(window->frameMetricsChangeListeners_.GetListenerCount(window->GetPersistentId()), 3);
+    window->frameMetricsChangeListeners_.Clear();
     window->Destroy();
 }
 
@@ -466,7 +456,7 @@ HWTEST_F(WindowSessionImplTest2, UnregisterFrameMetricsChangeListener, TestSize.
     auto window = GetTestWindowImpl("UnregisterFrameMetricsChangeListener");
     ASSERT_NE(window, nullptr);
     window->property_->SetPersistentId(1);
-    window->frameMetricsChangeListeners_.clear();
+    window->frameMetricsChangeListeners_.Clear();
     window->uiContent_ = nullptr;
     EXPECT_NE(window->RegisterFrameMetricsChangeListener(nullptr), WMError::WM_OK);
     window->uiContent_ = std::make_unique<Ace::UIContentMocker>();
@@ -480,8 +470,8 @@ HWTEST_F(WindowSessionImplTest2, UnregisterFrameMetricsChangeListener, TestSize.
     EXPECT_EQ(window->UnregisterFrameMetricsChangeListener(listener), WMError::WM_OK);
     EXPECT_CALL(*content, SetFrameMetricsCallBack(_));
     EXPECT_EQ(window->UnregisterFrameMetricsChangeListener(listener2), WMError::WM_OK);
-    window->frameMetricsChangeListeners_.clear();
-    EXPECT_EQ(window->frameMetricsChangeListeners_.size(), 0);
+    window->frameMetricsChangeListeners_.Clear();
+    EXPECT_TRUE(window->frameMetricsChangeListeners_.IsEmpty());
     window->Destroy();
 }
 
@@ -495,12 +485,12 @@ HWTEST_F(WindowSessionImplTest2, NotifyFrameMetrics, TestSize.Level1)
     auto window = GetTestWindowImpl("NotifyFrameMetrics");
     ASSERT_NE(window, nullptr);
     window->property_->SetPersistentId(1);
-    window->frameMetricsChangeListeners_.clear();
+    window->frameMetricsChangeListeners_.Clear();
     sptr<IFrameMetricsChangedListener> listener = sptr<IFrameMetricsChangedListener>::MakeSptr();
-    window->frameMetricsChangeListeners_[window->GetPersistentId()].push_back(listener);
+    window->frameMetricsChangeListeners_.Register(window->GetPersistentId(), listener);
     Ace::FrameMetrics metric;
     window->NotifyFrameMetrics(metric);
-    window->frameMetricsChangeListeners_.clear();
+    window->frameMetricsChangeListeners_.Clear();
     window->Destroy();
 }
 
@@ -1142,7 +1132,9 @@ HWTEST_F(WindowSessionImplTest2, NotifyOccupiedAreaChangeInfo, TestSize.Level1)
     auto listeners = GetListenerList<IOccupiedAreaChangeListener, MockIOccupiedAreaChangeListener>();
     ASSERT_NE(listeners.size(), 0);
     listeners.insert(listeners.begin(), nullptr);
-    window->occupiedAreaChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window->occupiedAreaChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
 
     sptr<OccupiedAreaChangeInfo> info = sptr<OccupiedAreaChangeInfo>::MakeSptr();
     window->property_->SetWindowMode(WindowMode::WINDOW_MODE_FULLSCREEN);
@@ -1186,7 +1178,9 @@ HWTEST_F(WindowSessionImplTest2, NotifyOccupiedAreaChangeInfoInner, TestSize.Lev
     auto listeners = GetListenerList<IOccupiedAreaChangeListener, MockIOccupiedAreaChangeListener>();
     ASSERT_NE(listeners.size(), 0);
     listeners.insert(listeners.begin(), nullptr);
-    window->occupiedAreaChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window->occupiedAreaChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
 
     window->windowSystemConfig_.windowUIType_ = WindowUIType::PHONE_WINDOW;
     sptr<OccupiedAreaChangeInfo> info = sptr<OccupiedAreaChangeInfo>::MakeSptr();
@@ -1224,7 +1218,9 @@ HWTEST_F(WindowSessionImplTest2, NotifyWindowStatusChange, TestSize.Level1)
     auto listeners = GetListenerList<IWindowStatusChangeListener, MockWindowStatusChangeListener>();
     ASSERT_NE(listeners.size(), 0);
     listeners.insert(listeners.begin(), nullptr);
-    window->windowStatusChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window->windowStatusChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
 
     WindowMode mode = WindowMode::WINDOW_MODE_FLOATING;
     window->state_ = WindowState::STATE_HIDDEN;
@@ -1259,7 +1255,9 @@ HWTEST_F(WindowSessionImplTest2, NotifyWindowStatusChange02, TestSize.Level1)
     auto listeners = GetListenerList<IWindowStatusChangeListener, MockWindowStatusChangeListener>();
     EXPECT_NE(listeners.size(), 0);
     listeners.insert(listeners.begin(), nullptr);
-    window->windowStatusChangeListeners_.insert({window->GetPersistentId(), listeners});
+    for (const auto& listener : listeners) {
+        window->windowStatusChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
 
     WindowMode mode = WindowMode::WINDOW_MODE_SPLIT_PRIMARY;
     window->state_ = WindowState::STATE_SHOWN;
@@ -1340,14 +1338,14 @@ HWTEST_F(WindowSessionImplTest2, RefreshNoInteractionTimeoutMonitor, TestSize.Le
     auto window = GetTestWindowImpl("RefreshNoInteractionTimeoutMonitor");
     ASSERT_NE(window, nullptr);
     window->RefreshNoInteractionTimeoutMonitor();
-    ASSERT_TRUE(window->windowNoInteractionListeners_[window->GetPersistentId()].empty());
+    ASSERT_EQ(window->windowNoInteractionListeners_.GetListenerCount(window->GetPersistentId()), 0);
     ASSERT_NE(window->property_, nullptr);
     window->property_->SetPersistentId(1);
     sptr<IWindowNoInteractionListener> listener = sptr<MockWindowNoInteractionListener>::MakeSptr();
     ASSERT_EQ(window->RegisterWindowNoInteractionListener(listener), WMError::WM_OK);
     window->RefreshNoInteractionTimeoutMonitor();
     ASSERT_EQ(window->GetPersistentId(), 1);
-    ASSERT_FALSE(window->windowNoInteractionListeners_[window->GetPersistentId()].empty());
+    ASSERT_EQ(window->windowNoInteractionListeners_.GetListenerCount(window->GetPersistentId()), 1);
     window->Destroy();
 }
 
@@ -1442,11 +1440,9 @@ HWTEST_F(WindowSessionImplTest2, UpdateDecorEnableToAce, TestSize.Level1)
     auto listeners = GetListenerList<IWindowChangeListener, MockWindowChangeListener>();
     sptr<MockWindowChangeListener> nullListener;
     listeners.insert(listeners.begin(), nullListener);
-    std::vector<std::pair<sptr<IWindowChangeListener>, bool>> pairListeners;
     for (auto& listener : listeners) {
-        pairListeners.push_back({listener, false});
+        window->windowChangeListeners_.Register(window->GetPersistentId(), { listener, false });
     }
-    window->windowChangeListeners_.insert({ window->GetPersistentId(), pairListeners });
     window->windowSystemConfig_.freeMultiWindowSupport_ = false;
     window->UpdateDecorEnableToAce(false);
 
@@ -1524,11 +1520,9 @@ HWTEST_F(WindowSessionImplTest2, NotifyModeChange, TestSize.Level1)
     auto listeners = GetListenerList<IWindowChangeListener, MockWindowChangeListener>();
     sptr<MockWindowChangeListener> nullListener;
     listeners.insert(listeners.begin(), nullListener);
-    std::vector<std::pair<sptr<IWindowChangeListener>, bool>> pairListeners;
     for (auto& listener : listeners) {
-        pairListeners.push_back({listener, false});
+        window->windowChangeListeners_.Register(window->GetPersistentId(), { listener, false });
     }
-    window->windowChangeListeners_.insert({ window->GetPersistentId(), pairListeners });
 
     window->NotifyModeChange(WindowMode::WINDOW_MODE_FULLSCREEN, true);
     window->Destroy();
@@ -1796,7 +1790,9 @@ HWTEST_F(WindowSessionImplTest2, NotifyWindowTitleButtonRectChange, TestSize.Lev
     ASSERT_NE(window, nullptr);
     auto listeners = GetListenerList<IWindowTitleButtonRectChangedListener, MockWindowTitleButtonRectChangedListener>();
     listeners.insert(listeners.begin(), nullptr);
-    window->windowTitleButtonRectChangeListeners_.insert({ window->GetPersistentId(), listeners });
+    for (auto& listener : listeners) {
+        window->windowTitleButtonRectChangeListeners_.Register(window->GetPersistentId(), listener);
+    }
     TitleButtonRect titleButtonRect;
     window->NotifyWindowTitleButtonRectChange(titleButtonRect);
     window->Destroy();
@@ -1933,11 +1929,13 @@ HWTEST_F(WindowSessionImplTest2, NotifyScreenshot01, TestSize.Level1)
     auto listeners = GetListenerList<IScreenshotListener, MockIScrenshotListener>();
     listeners[0] = nullptr;
     ASSERT_EQ(listeners.size(), 1);
-    window_->screenshotListeners_.insert({ window_->GetPersistentId(), listeners });
+    for (const auto& listener : listeners) {
+        window_->screenshotListeners_.Register(window_->GetPersistentId(), listener);
+    }
     window_->NotifyScreenshot();
-    std::vector<sptr<IScreenshotListener>> screenshotListeners =
-        window_->screenshotListeners_[window_->GetPersistentId()];
-    ASSERT_NE(std::find(screenshotListeners.begin(), screenshotListeners.end(), nullptr), screenshotListeners.end());
+    auto screenshotListeners = window_->screenshotListeners_.GetListeners(window_->GetPersistentId());
+    ASSERT_NE(std::find(screenshotListeners->begin(), screenshotListeners->end(), nullptr),
+        screenshotListeners->end());
     GTEST_LOG_(INFO) << "WindowSessionImplTest2: NotifyScreenshot01 end";
 }
 
@@ -1975,15 +1973,16 @@ HWTEST_F(WindowSessionImplTest2, RegisterScreenshotListener, TestSize.Level1)
     auto window = GetTestWindowImpl("RegisterScreenshotListener");
     ASSERT_NE(window, nullptr);
     window->property_->SetPersistentId(1);
-    window->screenshotListeners_.clear();
+    window->screenshotListeners_.Clear();
     EXPECT_NE(window->RegisterScreenshotListener(nullptr), WMError::WM_OK);
     sptr<IScreenshotListener> listener = sptr<IScreenshotListener>::MakeSptr();
     EXPECT_EQ(window->RegisterScreenshotListener(listener), WMError::WM_OK);
-    EXPECT_EQ(window->screenshotListeners_.size(), 1);
-    window->screenshotListeners_[window->GetPersistentId()].push_back(nullptr);
+    EXPECT_EQ(window->screenshotListeners_.GetListenerCount(window->GetPersistentId()), 1);
+    window->screenshotListeners_.Register(window->GetPersistentId(), nullptr);
     sptr<IScreenshotListener> listener2 = sptr<IScreenshotListener>::MakeSptr();
     EXPECT_EQ(window->RegisterScreenshotListener(listener2), WMError::WM_OK);
-    window->screenshotListeners_.clear();
+    EXPECT_EQ(window->screenshotListeners_.GetListenerCount(window->GetPersistentId()), 3);
+    window->screenshotListeners_.Clear();
     window->Destroy();
 }
 
@@ -1996,17 +1995,18 @@ HWTEST_F(WindowSessionImplTest2, UnregisterScreenshotListener, TestSize.Level1)
 {
     auto window = GetTestWindowImpl("UnregisterScreenshotListener");
     ASSERT_NE(window, nullptr);
-    window->screenshotListeners_.clear();
+    window->screenshotListeners_.Clear();
     EXPECT_NE(window->UnregisterScreenshotListener(nullptr), WMError::WM_OK);
     sptr<IScreenshotListener> listener = sptr<IScreenshotListener>::MakeSptr();
     EXPECT_EQ(window->RegisterScreenshotListener(listener), WMError::WM_OK);
     sptr<IScreenshotListener> listener2 = sptr<IScreenshotListener>::MakeSptr();
     EXPECT_EQ(window->RegisterScreenshotListener(listener2), WMError::WM_OK);
     EXPECT_EQ(window->UnregisterScreenshotListener(listener), WMError::WM_OK);
-    EXPECT_EQ(window->screenshotListeners_.size(), 1);
+    EXPECT_EQ(window->screenshotListeners_.GetListenerCount(window->GetPersistentId()), 1);
     EXPECT_EQ(window->UnregisterScreenshotListener(listener2), WMError::WM_OK);
-    window->screenshotListeners_.clear();
-    EXPECT_EQ(window->screenshotListeners_.size(), 0);
+    EXPECT_EQ(window->screenshotListeners_.GetListenerCount(window->GetPersistentId()), 0);
+    window->screenshotListeners_.Clear();
+    EXPECT_TRUE(window->screenshotListeners_.IsEmpty());
     window->Destroy();
 }
 
@@ -2283,13 +2283,13 @@ HWTEST_F(WindowSessionImplTest2, GetListeners01, TestSize.Level1)
     GTEST_LOG_(INFO) << "WindowSessionImplTest2: GetListeners01 start";
     window_ = GetTestWindowImpl("GetListeners01");
     ASSERT_NE(window_, nullptr);
-    window_->lifecycleListeners_.clear();
+    window_->lifecycleListeners_.Clear();
     window_->NotifyWindowAfterFocused();
-    ASSERT_TRUE(window_->lifecycleListeners_[window_->GetPersistentId()].empty());
+    ASSERT_EQ(window_->lifecycleListeners_.GetListenerCount(window_->GetPersistentId()), 0);
     sptr<IWindowLifeCycle> listener = sptr<MockWindowLifeCycleListener>::MakeSptr();
     window_->RegisterLifeCycleListener(listener);
     window_->NotifyWindowAfterFocused();
-    ASSERT_FALSE(window_->lifecycleListeners_[window_->GetPersistentId()].empty());
+    ASSERT_EQ(window_->lifecycleListeners_.GetListenerCount(window_->GetPersistentId()), 1);
     window_->Destroy();
     GTEST_LOG_(INFO) << "WindowSessionImplTest2: GetListeners01 end";
 }
@@ -2304,14 +2304,14 @@ HWTEST_F(WindowSessionImplTest2, GetListeners02, TestSize.Level1)
     GTEST_LOG_(INFO) << "WindowSessionImplTest2: GetListeners02 start";
     window_ = GetTestWindowImpl("GetListeners02");
     ASSERT_NE(window_, nullptr);
-    window_->occupiedAreaChangeListeners_.clear();
+    window_->occupiedAreaChangeListeners_.Clear();
     sptr<OccupiedAreaChangeInfo> occupiedAreaChangeInfo = sptr<OccupiedAreaChangeInfo>::MakeSptr();
     window_->NotifyOccupiedAreaChangeInfo(occupiedAreaChangeInfo, nullptr, {}, {});
-    ASSERT_TRUE(window_->occupiedAreaChangeListeners_[window_->GetPersistentId()].empty());
+    ASSERT_EQ(window_->occupiedAreaChangeListeners_.GetListenerCount(window_->GetPersistentId()), 0);
     sptr<IOccupiedAreaChangeListener> listener = sptr<MockIOccupiedAreaChangeListener>::MakeSptr();
     window_->RegisterOccupiedAreaChangeListener(listener);
     window_->NotifyOccupiedAreaChangeInfo(occupiedAreaChangeInfo, nullptr, {}, {});
-    ASSERT_FALSE(window_->occupiedAreaChangeListeners_[window_->GetPersistentId()].empty());
+    ASSERT_EQ(window_->occupiedAreaChangeListeners_.GetListenerCount(window_->GetPersistentId()), 1);
     window_->Destroy();
     GTEST_LOG_(INFO) << "WindowSessionImplTest2: GetListeners02 end";
 }
@@ -2330,15 +2330,15 @@ HWTEST_F(WindowSessionImplTest2, GetListeners03, TestSize.Level1)
     window_->NotifyKeyboardAnimationCompleted(keyboardPanelInfo);
     keyboardPanelInfo.isShowing_ = true;
     window_->NotifyKeyboardAnimationCompleted(keyboardPanelInfo);
-    ASSERT_TRUE(window_->keyboardDidShowListeners_[window_->GetPersistentId()].empty());
-    ASSERT_TRUE(window_->keyboardDidHideListeners_[window_->GetPersistentId()].empty());
+    ASSERT_EQ(window_->keyboardDidShowListeners_.GetListenerCount(window_->GetPersistentId()), 0);
+    ASSERT_EQ(window_->keyboardDidHideListeners_.GetListenerCount(window_->GetPersistentId()), 0);
     sptr<IKeyboardDidShowListener> listener = sptr<MockIKeyboardDidShowListener>::MakeSptr();
     window_->RegisterKeyboardDidShowListener(listener);
     keyboardPanelInfo.isShowing_ = true;
     window_->NotifyKeyboardAnimationCompleted(keyboardPanelInfo);
     window_->uiContent_ = std::make_unique<Ace::UIContentMocker>();
     window_->NotifyKeyboardAnimationCompleted(keyboardPanelInfo);
-    ASSERT_FALSE(window_->keyboardDidShowListeners_[window_->GetPersistentId()].empty());
+    ASSERT_EQ(window_->keyboardDidShowListeners_.GetListenerCount(window_->GetPersistentId()), 1);
     window_->UnregisterKeyboardDidShowListener(listener);
 
     sptr<IKeyboardDidHideListener> listener1 = sptr<MockIKeyboardDidHideListener>::MakeSptr();
@@ -2348,7 +2348,7 @@ HWTEST_F(WindowSessionImplTest2, GetListeners03, TestSize.Level1)
     window_->NotifyKeyboardAnimationCompleted(keyboardPanelInfo);
     window_->uiContent_ = std::make_unique<Ace::UIContentMocker>();
     window_->NotifyKeyboardAnimationCompleted(keyboardPanelInfo);
-    ASSERT_FALSE(window_->keyboardDidHideListeners_[window_->GetPersistentId()].empty());
+    ASSERT_EQ(window_->keyboardDidHideListeners_.GetListenerCount(window_->GetPersistentId()), 1);
     window_->UnregisterKeyboardDidHideListener(listener1);
     window_->Destroy();
     GTEST_LOG_(INFO) << "WindowSessionImplTest2: GetListeners03 end";
@@ -2475,18 +2475,17 @@ HWTEST_F(WindowSessionImplTest2, RegisterScreenshotAppEventListener01, TestSize.
     EXPECT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IScreenshotAppEventListener>::MakeSptr();
-    std::vector<sptr<IScreenshotAppEventListener>> holder;
-    window->screenshotAppEventListeners_[window->property_->GetPersistentId()] = holder;
+    window->screenshotAppEventListeners_.Clear(window->property_->GetPersistentId());
     ret = window->RegisterScreenshotAppEventListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
-    holder = window->screenshotAppEventListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    EXPECT_NE(existsListener, holder.end());
+    auto holder = window->screenshotAppEventListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    EXPECT_NE(existsListener, holder->end());
 
     ret = window->RegisterScreenshotAppEventListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
-    holder = window->screenshotAppEventListeners_[window->property_->GetPersistentId()];
-    EXPECT_EQ(holder.size(), 1);
+    holder = window->screenshotAppEventListeners_.GetListeners(window->property_->GetPersistentId());
+    EXPECT_EQ(holder->size(), 1);
 }
 
 /**
@@ -2513,14 +2512,13 @@ HWTEST_F(WindowSessionImplTest2, unregisterScreenshotAppEventListener01, TestSiz
     EXPECT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IScreenshotAppEventListener>::MakeSptr();
-    std::vector<sptr<IScreenshotAppEventListener>> holder;
-    window->screenshotAppEventListeners_[window->property_->GetPersistentId()] = holder;
+    window->screenshotAppEventListeners_.Clear(window->property_->GetPersistentId());
     ret = window->UnregisterScreenshotAppEventListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
 
-    holder = window->screenshotAppEventListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    EXPECT_EQ(existsListener, holder.end());
+    auto holder = window->screenshotAppEventListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    EXPECT_EQ(existsListener, holder->end());
 }
 
 /**
@@ -2547,18 +2545,17 @@ HWTEST_F(WindowSessionImplTest2, RegisterAcrossDisplaysChangeListener01, TestSiz
     EXPECT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IAcrossDisplaysChangeListener>::MakeSptr();
-    std::vector<sptr<IAcrossDisplaysChangeListener>> holder;
-    window->acrossDisplaysChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->acrossDisplaysChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->RegisterAcrossDisplaysChangeListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
-    holder = window->acrossDisplaysChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    EXPECT_NE(existsListener, holder.end());
+    auto holder = window->acrossDisplaysChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    EXPECT_NE(existsListener, holder->end());
 
     ret = window->RegisterAcrossDisplaysChangeListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
-    holder = window->acrossDisplaysChangeListeners_[window->property_->GetPersistentId()];
-    EXPECT_EQ(holder.size(), 1);
+    holder = window->acrossDisplaysChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    EXPECT_EQ(holder->size(), 1);
 }
 
 /**
@@ -2585,14 +2582,13 @@ HWTEST_F(WindowSessionImplTest2, UnregisterAcrossDisplaysChangeListener01, TestS
     EXPECT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IAcrossDisplaysChangeListener>::MakeSptr();
-    std::vector<sptr<IAcrossDisplaysChangeListener>> holder;
-    window->acrossDisplaysChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->acrossDisplaysChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->UnregisterAcrossDisplaysChangeListener(listener);
     EXPECT_EQ(ret, WMError::WM_OK);
 
-    holder = window->acrossDisplaysChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    EXPECT_EQ(existsListener, holder.end());
+    auto holder = window->acrossDisplaysChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    EXPECT_EQ(existsListener, holder->end());
 }
 
 /**
@@ -2607,14 +2603,12 @@ HWTEST_F(WindowSessionImplTest2, NotifyScreenshotAppEvent, TestSize.Level1)
 
     sptr<WindowSessionImpl> window = sptr<WindowSessionImpl>::MakeSptr(option);
     ASSERT_NE(window, nullptr);
-    window->screenshotAppEventListeners_.clear();
-    EXPECT_EQ(0, window->screenshotAppEventListeners_.size());
+    window->screenshotAppEventListeners_.Clear();
+    EXPECT_TRUE(window->screenshotAppEventListeners_.IsEmpty());
 
     sptr<IScreenshotAppEventListener> listeners = sptr<IScreenshotAppEventListener>::MakeSptr();
-    std::vector<sptr<IScreenshotAppEventListener>> holder;
-    holder.push_back(listeners);
-    window->screenshotAppEventListeners_[window->property_->GetPersistentId()] = holder;
-    EXPECT_EQ(1, window->screenshotAppEventListeners_.size());
+    window->screenshotAppEventListeners_.Register(window->property_->GetPersistentId(), listeners);
+    EXPECT_EQ(window->screenshotAppEventListeners_.GetListenerCount(window->GetPersistentId()), 1);
     auto ret = window->NotifyScreenshotAppEvent(ScreenshotEventType::SCROLL_SHOT_START);
     EXPECT_EQ(WSError::WS_OK, ret);
 }
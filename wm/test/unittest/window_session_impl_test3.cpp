@@ -132,14 +132,14 @@ HWTEST_F(WindowSessionImplTest3, GetListeners01, TestSize.Level1)
     GTEST_LOG_(INFO) << "WindowSessionImplTest3: GetListeners01 start";
     window_ = GetTestWindowImpl("GetListeners01");
     ASSERT_NE(window_, nullptr);
-    window_->displayMoveListeners_.clear();
+    window_->displayMoveListeners_.Clear();
     window_->NotifyDisplayMove(0, 100);
-    ASSERT_TRUE(window_->displayMoveListeners_[window_->GetPersistentId()].empty());
+    ASSERT_FALSE(window_->displayMoveListeners_.HasListeners(window_->GetPersistentId()));
 
     sptr<IDisplayMoveListener> displayMoveListener = new (std::nothrow) MockIDisplayMoveListener();
     ASSERT_EQ(window_->RegisterDisplayMoveListener(displayMoveListener), WMError::WM_OK);
     window_->NotifyDisplayMove(0, 100);
-    ASSERT_FALSE(window_->displayMoveListeners_[window_->GetPersistentId()].empty());
+    ASSERT_TRUE(window_->displayMoveListeners_.HasListeners(window_->GetPersistentId()));
     GTEST_LOG_(INFO) << "WindowSessionImplTest3: GetListeners01 end";
 }
 
@@ -1048,7 +1048,7 @@ HWTEST_F(WindowSessionImplTest3, UnregisterWindowRectChangeListener, TestSize.Le
     ASSERT_NE(window_, nullptr);
     window_->property_->SetPersistentId(1);
     window_->state_ = WindowState::STATE_SHOWN;
-    window_->windowRectChangeListeners_.clear();
+    window_->windowRectChangeListeners_.Clear();
     sptr<IWindowRectChangeListener> listener = nullptr;
     auto ret = window_->UnregisterWindowRectChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
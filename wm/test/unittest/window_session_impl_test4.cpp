@@ -667,13 +667,12 @@ HWTEST_F(WindowSessionImplTest4, RegisterExtensionAvoidAreaChangeListener, TestS
     ASSERT_EQ(res, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IAvoidAreaChangedListener>::MakeSptr();
-    vector<sptr<IAvoidAreaChangedListener>> holder;
-    window->avoidAreaChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->avoidAreaChangeListeners_.Clear(window->property_->GetPersistentId());
     res = window->RegisterExtensionAvoidAreaChangeListener(listener);
     ASSERT_EQ(res, WMError::WM_OK);
-    holder = window->avoidAreaChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_NE(existsListener, holder.end());
+    auto holder = window->avoidAreaChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_NE(existsListener, holder->end());
 
     // already registered
     res = window->RegisterExtensionAvoidAreaChangeListener(listener);
@@ -697,16 +696,15 @@ HWTEST_F(WindowSessionImplTest4, UnregisterExtensionAvoidAreaChangeListener, Tes
     ASSERT_EQ(res, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IAvoidAreaChangedListener>::MakeSptr();
-    vector<sptr<IAvoidAreaChangedListener>> holder;
-    window->avoidAreaChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->avoidAreaChangeListeners_.Clear(window->property_->GetPersistentId());
     window->RegisterExtensionAvoidAreaChangeListener(listener);
 
     res = window->UnregisterExtensionAvoidAreaChangeListener(listener);
     ASSERT_EQ(res, WMError::WM_OK);
 
-    holder = window->avoidAreaChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_EQ(existsListener, holder.end());
+    auto holder = window->avoidAreaChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_EQ(existsListener, holder->end());
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: UnregisterExtensionAvoidAreaChangeListener end";
 }
 
@@ -1896,10 +1894,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_displayMoveListeners, TestSi
 
     sptr<IDisplayMoveListener> listener_ = new (std::nothrow) MockIDisplayMoveListener();
     window_->RegisterDisplayMoveListener(listener_);
-    ASSERT_NE(window_->displayMoveListeners_.find(persistentId), window_->displayMoveListeners_.end());
+    ASSERT_EQ(window_->displayMoveListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->displayMoveListeners_.find(persistentId), window_->displayMoveListeners_.end());
+    ASSERT_EQ(window_->displayMoveListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_displayMoveListeners end";
 }
@@ -1921,10 +1919,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_lifecycleListeners, TestSize
 
     sptr<IWindowLifeCycle> listener_ = new (std::nothrow) MockWindowLifeCycleListener();
     window_->RegisterLifeCycleListener(listener_);
-    ASSERT_NE(window_->lifecycleListeners_.find(persistentId), window_->lifecycleListeners_.end());
+    ASSERT_EQ(window_->lifecycleListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->lifecycleListeners_.find(persistentId), window_->lifecycleListeners_.end());
+    ASSERT_EQ(window_->lifecycleListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_lifecycleListeners end";
 }
@@ -1946,10 +1944,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_windowChangeListeners, TestS
 
     sptr<IWindowChangeListener> listener_ = new (std::nothrow) MockWindowChangeListener();
     window_->RegisterWindowChangeListener(listener_);
-    ASSERT_NE(window_->windowChangeListeners_.find(persistentId), window_->windowChangeListeners_.end());
+    ASSERT_EQ(window_->windowChangeListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->windowChangeListeners_.find(persistentId), window_->windowChangeListeners_.end());
+    ASSERT_EQ(window_->windowChangeListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_windowChangeListeners end";
 }
@@ -1971,10 +1969,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_avoidAreaChangeListeners, Te
 
     sptr<IAvoidAreaChangedListener> listener_ = new (std::nothrow) MockAvoidAreaChangedListener();
     window_->RegisterExtensionAvoidAreaChangeListener(listener_);
-    ASSERT_NE(window_->avoidAreaChangeListeners_.find(persistentId), window_->avoidAreaChangeListeners_.end());
+    ASSERT_EQ(window_->avoidAreaChangeListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->avoidAreaChangeListeners_.find(persistentId), window_->avoidAreaChangeListeners_.end());
+    ASSERT_EQ(window_->avoidAreaChangeListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_avoidAreaChangeListeners end";
 }
@@ -1996,12 +1994,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_dialogDeathRecipientListener
 
     sptr<IDialogDeathRecipientListener> listener_ = new (std::nothrow) MockIDialogDeathRecipientListener();
     window_->RegisterDialogDeathRecipientListener(listener_);
-    ASSERT_NE(window_->dialogDeathRecipientListeners_.find(persistentId),
-              window_->dialogDeathRecipientListeners_.end());
+    ASSERT_EQ(window_->dialogDeathRecipientListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->dialogDeathRecipientListeners_.find(persistentId),
-              window_->dialogDeathRecipientListeners_.end());
+    ASSERT_EQ(window_->dialogDeathRecipientListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_dialogDeathRecipientListeners end";
 }
@@ -2023,10 +2019,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_dialogTargetTouchListener, T
 
     sptr<IDialogTargetTouchListener> listener_ = new (std::nothrow) MockIDialogTargetTouchListener();
     window_->RegisterDialogTargetTouchListener(listener_);
-    ASSERT_NE(window_->dialogTargetTouchListener_.find(persistentId), window_->dialogTargetTouchListener_.end());
+    ASSERT_EQ(window_->dialogTargetTouchListener_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->dialogTargetTouchListener_.find(persistentId), window_->dialogTargetTouchListener_.end());
+    ASSERT_EQ(window_->dialogTargetTouchListener_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_dialogTargetTouchListener end";
 }
@@ -2048,10 +2044,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_screenshotListeners, TestSiz
 
     sptr<IScreenshotListener> listener_ = new (std::nothrow) MockIScreenshotListener();
     window_->RegisterScreenshotListener(listener_);
-    ASSERT_NE(window_->screenshotListeners_.find(persistentId), window_->screenshotListeners_.end());
+    ASSERT_EQ(window_->screenshotListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->screenshotListeners_.find(persistentId), window_->screenshotListeners_.end());
+    ASSERT_EQ(window_->screenshotListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_screenshotListeners end";
 }
@@ -2073,10 +2069,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_windowStatusChangeListeners,
 
     sptr<IWindowStatusChangeListener> listener_ = new (std::nothrow) MockWindowStatusChangeListener();
     window_->RegisterWindowStatusChangeListener(listener_);
-    ASSERT_NE(window_->windowStatusChangeListeners_.find(persistentId), window_->windowStatusChangeListeners_.end());
+    ASSERT_EQ(window_->windowStatusChangeListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->windowStatusChangeListeners_.find(persistentId), window_->windowStatusChangeListeners_.end());
+    ASSERT_EQ(window_->windowStatusChangeListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_windowStatusChangeListeners end";
 }
@@ -2098,13 +2094,11 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_windowTitleButtonRectChangeL
 
     sptr<IWindowTitleButtonRectChangedListener> listener_ =
         new (std::nothrow) MockWindowTitleButtonRectChangedListener();
-    window_->windowTitleButtonRectChangeListeners_[persistentId].emplace_back(listener_);
-    ASSERT_NE(window_->windowTitleButtonRectChangeListeners_.find(persistentId),
-              window_->windowTitleButtonRectChangeListeners_.end());
+    window_->windowTitleButtonRectChangeListeners_.Register(persistentId, listener_);
+    ASSERT_EQ(window_->windowTitleButtonRectChangeListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->windowTitleButtonRectChangeListeners_.find(persistentId),
-              window_->windowTitleButtonRectChangeListeners_.end());
+    ASSERT_EQ(window_->windowTitleButtonRectChangeListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_windowTitleButtonRectChangeListeners end";
 }
@@ -2126,10 +2120,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_windowNoInteractionListeners
 
     sptr<IWindowNoInteractionListener> listener_ = new (std::nothrow) MockWindowNoInteractionListener();
     window_->RegisterWindowNoInteractionListener(listener_);
-    ASSERT_NE(window_->windowNoInteractionListeners_.find(persistentId), window_->windowNoInteractionListeners_.end());
+    ASSERT_EQ(window_->windowNoInteractionListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->windowNoInteractionListeners_.find(persistentId), window_->windowNoInteractionListeners_.end());
+    ASSERT_EQ(window_->windowNoInteractionListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_windowNoInteractionListeners end";
 }
@@ -2151,10 +2145,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_windowRectChangeListeners, T
 
     sptr<IWindowRectChangeListener> listener_ = new (std::nothrow) MockWindowRectChangeListener();
     window_->RegisterWindowRectChangeListener(listener_);
-    ASSERT_NE(window_->windowRectChangeListeners_.find(persistentId), window_->windowRectChangeListeners_.end());
+    ASSERT_EQ(window_->windowRectChangeListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->windowRectChangeListeners_.find(persistentId), window_->windowRectChangeListeners_.end());
+    ASSERT_EQ(window_->windowRectChangeListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_windowRectChangeListeners end";
 }
@@ -2176,10 +2170,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_windowDensityChangeListeners
 
     sptr<IWindowDensityChangeListener> listener_ = sptr<IWindowDensityChangeListener>::MakeSptr();
     ASSERT_EQ(WMError::WM_OK, window_->RegisterWindowDensityChangeListener(listener_));
-    ASSERT_NE(window_->windowDensityChangeListeners_.find(persistentId), window_->windowDensityChangeListeners_.end());
+    ASSERT_EQ(window_->windowDensityChangeListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->windowDensityChangeListeners_.find(persistentId), window_->windowDensityChangeListeners_.end());
+    ASSERT_EQ(window_->windowDensityChangeListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_windowDensityChangeListeners end";
 }
@@ -2255,10 +2249,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_windowWillCloseListeners, Te
     sptr<IWindowWillCloseListener> listener_ = sptr<MockIWindowWillCloseListener>::MakeSptr();
     window_->windowSystemConfig_.windowUIType_ = WindowUIType::PC_WINDOW;
     ASSERT_EQ(WMError::WM_OK, window_->RegisterWindowWillCloseListeners(listener_));
-    ASSERT_NE(window_->windowWillCloseListeners_.find(persistentId), window_->windowWillCloseListeners_.end());
+    ASSERT_EQ(window_->windowWillCloseListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->windowWillCloseListeners_.find(persistentId), window_->windowWillCloseListeners_.end());
+    ASSERT_EQ(window_->windowWillCloseListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_windowWillCloseListeners end";
 }
@@ -2280,10 +2274,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_occupiedAreaChangeListeners,
 
     sptr<IOccupiedAreaChangeListener> listener_ = new (std::nothrow) MockIOccupiedAreaChangeListener();
     window_->RegisterOccupiedAreaChangeListener(listener_);
-    ASSERT_NE(window_->occupiedAreaChangeListeners_.find(persistentId), window_->occupiedAreaChangeListeners_.end());
+    ASSERT_EQ(window_->occupiedAreaChangeListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->occupiedAreaChangeListeners_.find(persistentId), window_->occupiedAreaChangeListeners_.end());
+    ASSERT_EQ(window_->occupiedAreaChangeListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_occupiedAreaChangeListeners end";
 }
@@ -2305,10 +2299,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_keyboardDidShowListeners, Te
 
     sptr<IKeyboardDidShowListener> listener_ = new (std::nothrow) MockIKeyboardDidShowListener();
     window_->RegisterKeyboardDidShowListener(listener_);
-    ASSERT_NE(window_->keyboardDidShowListeners_.find(persistentId), window_->keyboardDidShowListeners_.end());
+    ASSERT_EQ(window_->keyboardDidShowListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->keyboardDidShowListeners_.find(persistentId), window_->keyboardDidShowListeners_.end());
+    ASSERT_EQ(window_->keyboardDidShowListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_keyboardDidShowListeners end";
 }
@@ -2330,10 +2324,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_keyboardDidHideListeners, Te
 
     sptr<IKeyboardDidHideListener> listener_ = new (std::nothrow) MockIKeyboardDidHideListener();
     window_->RegisterKeyboardDidHideListener(listener_);
-    ASSERT_NE(window_->keyboardDidHideListeners_.find(persistentId), window_->keyboardDidHideListeners_.end());
+    ASSERT_EQ(window_->keyboardDidHideListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->keyboardDidHideListeners_.find(persistentId), window_->keyboardDidHideListeners_.end());
+    ASSERT_EQ(window_->keyboardDidHideListeners_.GetListenerCount(persistentId), 0);
 
     GTEST_LOG_(INFO) << "WindowSessionImplTest4: ClearListenersById_keyboardDidHideListeners end";
 }
@@ -2355,12 +2349,10 @@ HWTEST_F(WindowSessionImplTest4, ClearListenersById_switchFreeMultiWindowListene
 
     sptr<ISwitchFreeMultiWindowListener> listener_ = new (std::nothrow) MockISwitchFreeMultiWindowListener();
     window_->RegisterSwitchFreeMultiWindowListener(listener_);
-    ASSERT_NE(window_->switchFreeMultiWindowListeners_.find(persistentId),
-              window_->switchFreeMultiWindowListeners_.end());
+    ASSERT_EQ(window_->switchFreeMultiWindowListeners_.GetListenerCount(persistentId), 1);
 
     window_->ClearListenersById(persistentId);
-    ASSERT_EQ(window_->switchFreeMultiWindowListeners_.find(persistentId),
-              window_->switchFreeMultiWindowListeners_.end());
+    ASSERT_EQ(window_->switchFreeMultiWindowListeners_.GetListenerCount(persistentId), 0);
 
     WindowAccessibilityController::GetInstance().SetAnchorAndScale(0, 0, 2);
     sleep(1);
@@ -2491,13 +2483,12 @@ HWTEST_F(WindowSessionImplTest4, RegisterDisplayIdChangeListener01, TestSize.Lev
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IDisplayIdChangeListener>::MakeSptr();
-    std::vector<sptr<IDisplayIdChangeListener>> holder;
-    window->displayIdChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->displayIdChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->RegisterDisplayIdChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
-    holder = window->displayIdChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_NE(existsListener, holder.end());
+    auto holder = window->displayIdChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_NE(existsListener, holder->end());
 
     ret = window->RegisterDisplayIdChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
@@ -2519,16 +2510,15 @@ HWTEST_F(WindowSessionImplTest4, UnregisterDisplayIdChangeListener01, TestSize.L
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IDisplayIdChangeListener>::MakeSptr();
-    std::vector<sptr<IDisplayIdChangeListener>> holder;
-    window->displayIdChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->displayIdChangeListeners_.Clear(window->property_->GetPersistentId());
     window->UnregisterDisplayIdChangeListener(listener);
 
     ret = window->UnregisterDisplayIdChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
 
-    holder = window->displayIdChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_EQ(existsListener, holder.end());
+    auto holder = window->displayIdChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_EQ(existsListener, holder->end());
 }
 
 /**
@@ -2569,18 +2559,17 @@ HWTEST_F(WindowSessionImplTest4, RegisterSystemDensityChangeListener01, TestSize
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<ISystemDensityChangeListener>::MakeSptr();
-    std::vector<sptr<ISystemDensityChangeListener>> holder;
-    window->systemDensityChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->systemDensityChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->RegisterSystemDensityChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
-    holder = window->systemDensityChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_NE(existsListener, holder.end());
+    auto holder = window->systemDensityChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_NE(existsListener, holder->end());
 
     ret = window->RegisterSystemDensityChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
-    holder = window->systemDensityChangeListeners_[window->property_->GetPersistentId()];
-    ASSERT_EQ(holder.size(), 1);
+    holder = window->systemDensityChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    ASSERT_EQ(holder->size(), 1);
 }
 
 /**
@@ -2599,14 +2588,13 @@ HWTEST_F(WindowSessionImplTest4, UnregisterSystemDensityChangeListener01, TestSi
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<ISystemDensityChangeListener>::MakeSptr();
-    std::vector<sptr<ISystemDensityChangeListener>> holder;
-    window->systemDensityChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->systemDensityChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->UnregisterSystemDensityChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
 
-    holder = window->systemDensityChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_EQ(existsListener, holder.end());
+    auto holder = window->systemDensityChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_EQ(existsListener, holder->end());
 }
 
 /**
@@ -2646,18 +2634,17 @@ HWTEST_F(WindowSessionImplTest4, RegisterWindowDensityChangeListener01, TestSize
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IWindowDensityChangeListener>::MakeSptr();
-    std::vector<sptr<IWindowDensityChangeListener>> holder;
-    window->windowDensityChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->windowDensityChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->RegisterWindowDensityChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
-    holder = window->windowDensityChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_NE(existsListener, holder.end());
+    auto holder = window->windowDensityChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_NE(existsListener, holder->end());
 
     ret = window->RegisterWindowDensityChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
-    holder = window->windowDensityChangeListeners_[window->property_->GetPersistentId()];
-    ASSERT_EQ(holder.size(), 1);
+    holder = window->windowDensityChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    ASSERT_EQ(holder->size(), 1);
 }
 
 /**
@@ -2676,14 +2663,13 @@ HWTEST_F(WindowSessionImplTest4, UnregisterWindowDensityChangeListener01, TestSi
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
 
     listener = sptr<IWindowDensityChangeListener>::MakeSptr();
-    std::vector<sptr<IWindowDensityChangeListener>> holder;
-    window->windowDensityChangeListeners_[window->property_->GetPersistentId()] = holder;
+    window->windowDensityChangeListeners_.Clear(window->property_->GetPersistentId());
     ret = window->UnregisterWindowDensityChangeListener(listener);
     ASSERT_EQ(ret, WMError::WM_OK);
 
-    holder = window->windowDensityChangeListeners_[window->property_->GetPersistentId()];
-    auto existsListener = std::find(holder.begin(), holder.end(), listener);
-    ASSERT_EQ(existsListener, holder.end());
+    auto holder = window->windowDensityChangeListeners_.GetListeners(window->property_->GetPersistentId());
+    auto existsListener = std::find(holder->begin(), holder->end(), listener);
+    ASSERT_EQ(existsListener, holder->end());
 }
 
 /**
@@ -3116,11 +3102,11 @@ HWTEST_F(WindowSessionImplTest4, NotifyWindowCrossAxisChange, TestSize.Level1)
     option->SetWindowName("NotifyWindowCrossAxisChange");
     sptr<WindowSessionImpl> window = sptr<WindowSessionImpl>::MakeSptr(option);
     sptr<MockIWindowCrossAxisListener> crossListener = sptr<MockIWindowCrossAxisListener>::MakeSptr();
-    WindowSessionImpl::windowCrossAxisListeners_[window->property_->persistentId_].push_back(crossListener);
+    WindowSessionImpl::windowCrossAxisListeners_.Register(window->property_->persistentId_, crossListener);
     EXPECT_CALL(*crossListener, OnCrossAxisChange(CrossAxisState::STATE_CROSS)).Times(1);
     window->NotifyWindowCrossAxisChange(CrossAxisState::STATE_CROSS);
     EXPECT_EQ(window->crossAxisState_.load(), CrossAxisState::STATE_CROSS);
-    WindowSessionImpl::windowCrossAxisListeners_[window->property_->persistentId_].clear();
+    WindowSessionImpl::windowCrossAxisListeners_.Clear(window->property_->persistentId_);
 }
 
 /**
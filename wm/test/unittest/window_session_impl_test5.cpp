@@ -2227,10 +2227,7 @@ HWTEST_F(WindowSessionImplTest5, TestRegisterRectChangeInGlobalDisplayListener,
     result = window->RegisterRectChangeInGlobalDisplayListener(nullListener);
     EXPECT_EQ(result, WMError::WM_ERROR_NULLPTR);
 
-    {
-        std::lock_guard<std::mutex> lock(window->rectChangeInGlobalDisplayListenerMutex_);
-        window->rectChangeInGlobalDisplayListeners_.clear();
-    }
+    window->rectChangeInGlobalDisplayListeners_.Clear();
 }
 
 /**
@@ -2260,10 +2257,7 @@ HWTEST_F(WindowSessionImplTest5, TestUnregisterRectChangeInGlobalDisplayListener
     result = window->UnregisterRectChangeInGlobalDisplayListener(nullListener);
     EXPECT_EQ(result, WMError::WM_ERROR_NULLPTR);
 
-    {
-        std::lock_guard<std::mutex> lock(window->rectChangeInGlobalDisplayListenerMutex_);
-        window->rectChangeInGlobalDisplayListeners_.clear();
-    }
+    window->rectChangeInGlobalDisplayListeners_.Clear();
 }
 
 /**
@@ -2281,11 +2275,9 @@ HWTEST_F(WindowSessionImplTest5, TestNotifyGlobalDisplayRectChange, TestSize.Lev
     auto listener2 = sptr<MockRectChangeInGlobalDisplayListener>::MakeSptr();
     sptr<IRectChangeInGlobalDisplayListener> nullListener = nullptr;
 
-    {
-        std::lock_guard<std::mutex> lock(window->rectChangeInGlobalDisplayListenerMutex_);
-        window->rectChangeInGlobalDisplayListeners_[window->GetPersistentId()] = {
-            {listener1, false}, {nullListener, false}, {listener2, false}
-        };
+    std::vector<sptr<IRectChangeInGlobalDisplayListener>> listeners { listener1, nullListener, listener2 };
+    for (const auto& listener : listeners) {
+        window->rectChangeInGlobalDisplayListeners_.Register(window->GetPersistentId(), { listener, false });
     }
 
     Rect rect { 10, 20, 100, 200 };
@@ -2296,10 +2288,7 @@ HWTEST_F(WindowSessionImplTest5, TestNotifyGlobalDisplayRectChange, TestSize.Lev
 
     window->NotifyGlobalDisplayRectChange(rect, reason);
 
-    {
-        std::lock_guard<std::mutex> lock(window->rectChangeInGlobalDisplayListenerMutex_);
-        window->rectChangeInGlobalDisplayListeners_.clear();
-    }
+    window->rectChangeInGlobalDisplayListeners_.Clear();
 }
 
 /**
@@ -2468,9 +2457,9 @@ HWTEST_F(WindowSessionImplTest5, GetListeners, TestSize.Level1)
     option->SetWindowName("GetListeners");
     sptr<WindowSessionImpl> window = sptr<WindowSessionImpl>::MakeSptr(option);
     window->property_->SetPersistentId(502);
-    window->windowTitleChangeListeners_[502] = std::vector<sptr<IWindowTitleChangeListener>>();
+    window->windowTitleChangeListeners_.Clear(502);
  
-    ASSERT_FALSE(window_->windowTitleChangeListeners_[window_->GetPersistentId()].empty());
+    ASSERT_TRUE(window_->windowTitleChangeListeners_.HasListeners(window_->GetPersistentId()));
 }
  
 /**
@@ -2636,9 +2625,9 @@ HWTEST_F(WindowSessionImplTest5, GetTitleOrHotAreasListeners, TestSize.Level1)
     option->SetWindowName("GetListeners");
     sptr<WindowSessionImpl> window = sptr<WindowSessionImpl>::MakeSptr(option);
     window->property_->SetPersistentId(502);
-    window->windowTitleOrHotAreasListeners_[502] = std::vector<sptr<IWindowTitleOrHotAreasListener>>();
+    window->windowTitleOrHotAreasListeners_.Clear(502);
  
-    ASSERT_FALSE(window_->windowTitleOrHotAreasListeners_[window_->GetPersistentId()].empty());
+    ASSERT_TRUE(window_->windowTitleOrHotAreasListeners_.HasListeners(window_->GetPersistentId()));
 }
  
 /**
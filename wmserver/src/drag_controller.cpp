@@ -286,7 +286,10 @@ void MoveDragController::ConsumePointerEvent(const std::shared_ptr<MMI::PointerE
         uint32_t windowId = static_cast<uint32_t>(pointerEvent->GetAgentWindowId());
         auto vsyncStation = GetVsyncStationByWindowId(windowId);
         if (vsyncStation != nullptr) {
-            vsyncStation->RequestVsync(vsyncCallback_);
+            // the move follows the pointer, run it ahead of other callbacks of the same vsync
+            VsyncScheduleOption option;
+            option.priority = VsyncCallbackPriority::HIGH;
+            vsyncStation->ScheduleVsyncCallback(vsyncCallback_, option);
         }
     } else {
         WLOGFD("[WMS] Dispatch non-move event, action: %{public}d", pointerEvent->GetPointerAction());
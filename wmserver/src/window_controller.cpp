@@ -970,7 +970,7 @@ void WindowController::StopBootAnimationIfNeed(const sptr<WindowNode>& node)
             windowRect.posX_ + static_cast<int32_t>(windowRect.width_),
             windowRect.posY_ + static_cast<int32_t>(windowRect.height_)};
         WmOcclusion::Region curRegion(curRect);
-        allRegion = curRegion.Or(allRegion);
+        allRegion.OrSelf(curRegion);
         WmOcclusion::Region subResult = defaultDisplayRegion.Sub(allRegion);
         if (subResult.GetSize() == 0) {
             WLOGI("stop boot animation");